@@ -717,6 +717,18 @@ enum mgp_error mgp_vertex_iter_in_edges(struct mgp_vertex *v, struct mgp_memory
 enum mgp_error mgp_vertex_iter_out_edges(struct mgp_vertex *v, struct mgp_memory *memory,
                                          struct mgp_edges_iterator **result);
 
+/// Get the number of inbound edges of the given vertex.
+/// If `type` isn't NULL, only the edges of that type are counted. The edges are counted without iterating over them,
+/// so this is much cheaper than using mgp_vertex_iter_in_edges for the same purpose.
+/// Return MGP_ERROR_DELETED_OBJECT if `v` has been deleted.
+enum mgp_error mgp_vertex_in_degree(struct mgp_vertex *v, struct mgp_edge_type *type, size_t *result);
+
+/// Get the number of outbound edges of the given vertex.
+/// If `type` isn't NULL, only the edges of that type are counted. The edges are counted without iterating over them,
+/// so this is much cheaper than using mgp_vertex_iter_out_edges for the same purpose.
+/// Return MGP_ERROR_DELETED_OBJECT if `v` has been deleted.
+enum mgp_error mgp_vertex_out_degree(struct mgp_vertex *v, struct mgp_edge_type *type, size_t *result);
+
 /// Result is non-zero if the edges returned by this iterator can be modified.
 /// The mutability of the mgp_edges_iterator is the same as the graph which it belongs to.
 /// Current implementation always returns without errors.
@@ -814,6 +826,15 @@ enum mgp_error mgp_graph_get_vertex_by_id(struct mgp_graph *g, struct mgp_vertex
 /// Current implementation always returns without errors.
 enum mgp_error mgp_graph_is_mutable(struct mgp_graph *graph, int *result);
 
+/// Get an estimate of the memory used by the graph database in bytes.
+/// The result maps each memory category ("vertices", "edges", "labels", "properties", "adjacency_lists", "deltas",
+/// "indices", "name_id_mapper" and "memory_tracked") to the number of bytes it uses. The "per_label" and
+/// "per_edge_type" entries are maps from label and edge type names to the estimated number of bytes of the vertices
+/// with the label and edges with the edge type.
+/// Resulting map must be freed with mgp_map_destroy.
+/// Return MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate the map.
+enum mgp_error mgp_graph_get_memory_info(struct mgp_graph *graph, struct mgp_memory *memory, struct mgp_map **result);
+
 /// Add a new vertex to the graph.
 /// Resulting vertex must be freed using mgp_vertex_destroy.
 /// Return MGP_ERROR_IMMUTABLE_OBJECT if `graph` is immutable.
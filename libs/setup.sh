@@ -104,6 +104,7 @@ declare -A primary_urls=(
   ["libbcrypt"]="http://$local_cache_host/git/libbcrypt.git"
   ["bzip2"]="http://$local_cache_host/git/bzip2.git"
   ["zlib"]="http://$local_cache_host/git/zlib.git"
+  ["lz4"]="http://$local_cache_host/git/lz4.git"
   ["rocksdb"]="http://$local_cache_host/git/rocksdb.git"
   ["mgclient"]="http://$local_cache_host/git/mgclient.git"
   ["pymgclient"]="http://$local_cache_host/git/pymgclient.git"
@@ -131,6 +132,7 @@ declare -A secondary_urls=(
   ["libbcrypt"]="https://github.com/rg3/libbcrypt"
   ["bzip2"]="https://github.com/VFR-maniac/bzip2"
   ["zlib"]="https://github.com/madler/zlib.git"
+  ["lz4"]="https://github.com/lz4/lz4.git"
   ["rocksdb"]="https://github.com/facebook/rocksdb.git"
   ["mgclient"]="https://github.com/memgraph/mgclient.git"
   ["pymgclient"]="https://github.com/memgraph/pymgclient.git"
@@ -206,6 +208,9 @@ repo_clone_try_double "${primary_urls[zlib]}" "${secondary_urls[zlib]}" "zlib" "
 # remove shared library from install dependencies
 sed -i 's/install(TARGETS zlib zlibstatic/install(TARGETS zlibstatic/g' zlib/CMakeLists.txt
 
+lz4_tag="v1.9.3" # (2020-11-16)
+repo_clone_try_double "${primary_urls[lz4]}" "${secondary_urls[lz4]}" "lz4" "$lz4_tag"
+
 rocksdb_tag="f3e33549c151f30ac4eb7c22356c6d0331f37652" # (2020-10-14)
 repo_clone_try_double "${primary_urls[rocksdb]}" "${secondary_urls[rocksdb]}" "rocksdb" "$rocksdb_tag"
 # remove shared library from install dependencies
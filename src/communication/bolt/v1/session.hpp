@@ -58,12 +58,14 @@ class Session {
   virtual ~Session() {}
 
   /**
-   * Process the given `query` with `params`.
+   * Process the given `query` with `params`. The `extra` map contains the
+   * metadata of the RUN message (e.g. the access `mode`).
    * @return A pair which contains list of headers and qid which is set only
    * if an explicit transaction was started.
    */
   virtual std::pair<std::vector<std::string>, std::optional<int>> Interpret(
-      const std::string &query, const std::map<std::string, Value> &params) = 0;
+      const std::string &query, const std::map<std::string, Value> &params,
+      const std::map<std::string, Value> &extra) = 0;
 
   /**
    * Put results of the processed query in the `encoder`.
@@ -85,7 +87,8 @@ class Session {
    */
   virtual std::map<std::string, Value> Discard(std::optional<int> n, std::optional<int> qid) = 0;
 
-  virtual void BeginTransaction() = 0;
+  /** The `extra` map contains the metadata of the BEGIN message. */
+  virtual void BeginTransaction(const std::map<std::string, Value> &extra) = 0;
   virtual void CommitTransaction() = 0;
   virtual void RollbackTransaction() = 0;
 
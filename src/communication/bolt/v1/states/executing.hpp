@@ -128,7 +128,8 @@ State HandleRun(TSession &session, State state, Marker marker) {
 
   try {
     // Interpret can throw.
-    auto [header, qid] = session.Interpret(query.ValueString(), params.ValueMap());
+    auto [header, qid] = session.Interpret(query.ValueString(), params.ValueMap(),
+                                           extra.IsMap() ? extra.ValueMap() : std::map<std::string, Value>{});
     // Convert std::string to Value
     std::vector<Value> vec;
     std::map<std::string, Value> data;
@@ -283,7 +284,7 @@ State HandleBegin(Session &session, State state, Marker marker) {
   }
 
   try {
-    session.BeginTransaction();
+    session.BeginTransaction(extra.ValueMap());
   } catch (const std::exception &e) {
     return HandleFailure(session, e);
   }
@@ -158,10 +158,28 @@ DEFINE_bool(allow_load_csv, true, "Controls whether LOAD CSV clause is allowed i
 // Storage flags.
 DEFINE_VALIDATED_uint64(storage_gc_cycle_sec, 30, "Storage garbage collector interval (in seconds).",
                         FLAG_IN_RANGE(1, 24 * 3600));
+DEFINE_VALIDATED_uint64(storage_gc_threads, 1,
+                        "Number of threads used by the storage garbage collector to unlink deltas, clean up the "
+                        "indices and free the deleted objects.",
+                        FLAG_IN_RANGE(1, 256));
+DEFINE_VALIDATED_uint64(storage_schema_creation_threads, 1,
+                        "Number of threads used to fill new indices and to validate the existing data against new "
+                        "constraints.",
+                        FLAG_IN_RANGE(1, 256));
+DEFINE_bool(storage_online_index_build, false,
+            "Controls whether label and label+property indices are filled while the transactions keep running. The "
+            "index is used by the queries only after it is built.");
 // NOTE: The `storage_properties_on_edges` flag must be the same here and in
 // `mg_import_csv`. If you change it, make sure to change it there as well.
 DEFINE_bool(storage_properties_on_edges, false, "Controls whether edges have properties.");
+DEFINE_bool(storage_vertex_lookup_table, false,
+            "Controls whether vertices are looked up by their ID in a dense table instead of the vertex skip list. "
+            "The table uses 8 bytes for each allocated vertex ID.");
 DEFINE_bool(storage_recover_on_startup, false, "Controls whether the storage recovers persisted data on startup.");
+DEFINE_VALIDATED_uint64(storage_recovery_thread_count, 1,
+                        "Number of threads used to load the snapshot, to apply the WAL transactions and to fill "
+                        "the indices during the recovery.",
+                        FLAG_IN_RANGE(1, 256));
 DEFINE_VALIDATED_uint64(storage_snapshot_interval_sec, 0,
                         "Storage snapshot creation interval (in seconds). Set "
                         "to 0 to disable periodic snapshot creation.",
@@ -171,12 +189,28 @@ DEFINE_bool(storage_wal_enabled, false,
             "WAL periodic snapshots must be enabled.");
 DEFINE_VALIDATED_uint64(storage_snapshot_retention_count, 3, "The number of snapshots that should always be kept.",
                         FLAG_IN_RANGE(1, 1000000));
+DEFINE_VALIDATED_uint64(storage_snapshot_thread_count, 1,
+                        "Number of threads used to write the edges and vertices of a snapshot.",
+                        FLAG_IN_RANGE(1, 256));
+DEFINE_VALIDATED_uint64(storage_snapshot_incremental_count, 0,
+                        "Number of incremental snapshots, which contain only the objects modified since the "
+                        "previous snapshot, created between two full snapshots. Set to 0 to create only full "
+                        "snapshots.",
+                        FLAG_IN_RANGE(0, 1000));
 DEFINE_VALIDATED_uint64(storage_wal_file_size_kib, storage::Config::Durability().wal_file_size_kibibytes,
                         "Minimum file size of each WAL file.", FLAG_IN_RANGE(1, 1000 * 1024));
 DEFINE_VALIDATED_uint64(storage_wal_file_flush_every_n_tx, storage::Config::Durability().wal_file_flush_every_n_tx,
                         "Issue a 'fsync' call after this amount of transactions are written to the "
                         "WAL file. Set to 1 for fully synchronous operation.",
                         FLAG_IN_RANGE(1, 1000000));
+DEFINE_bool(storage_wal_group_commit, false,
+            "Controls whether the commits wait until their WAL records are synced to disk. The records of "
+            "concurrent commits are synced together by a single thread. When enabled, "
+            "--storage-wal-file-flush-every-n-tx isn't used.");
+DEFINE_VALIDATED_uint64(storage_wal_group_commit_max_latency_us, 0,
+                        "Maximum time (in microseconds) the WAL group commit waits for more commits to join a "
+                        "batch before syncing it.",
+                        FLAG_IN_RANGE(0, 1000000));
 DEFINE_bool(storage_snapshot_on_exit, false, "Controls whether the storage creates another snapshot on exit.");
 
 DEFINE_bool(telemetry_enabled, false,
@@ -222,6 +256,14 @@ constexpr std::array isolation_level_mappings{
 const std::string isolation_level_help_string =
     fmt::format("Default isolation level used for the transactions. Allowed values: {}",
                 GetAllowedEnumValuesString(isolation_level_mappings));
+
+constexpr std::array storage_compression_mappings{
+    std::pair{"NONE"sv, storage::Config::Durability::Compression::NONE},
+    std::pair{"LZ4"sv, storage::Config::Durability::Compression::LZ4}};
+
+const std::string storage_compression_help_string =
+    fmt::format("Compression used for the blocks of the snapshot and WAL files. Allowed values: {}",
+                GetAllowedEnumValuesString(storage_compression_mappings));
 }  // namespace
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
@@ -245,6 +287,27 @@ DEFINE_VALIDATED_string(isolation_level, "SNAPSHOT_ISOLATION", isolation_level_h
   return true;
 });
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_string(storage_compression, "NONE", storage_compression_help_string.c_str(), {
+  if (const auto result = IsValidEnumValueString(value, storage_compression_mappings); result.HasError()) {
+    const auto error = result.GetError();
+    switch (error) {
+      case ValidationError::EmptyValue: {
+        std::cout << "Storage compression cannot be empty." << std::endl;
+        break;
+      }
+      case ValidationError::InvalidValue: {
+        std::cout << "Invalid value for storage compression. Allowed values: "
+                  << GetAllowedEnumValuesString(storage_compression_mappings) << std::endl;
+        break;
+      }
+    }
+    return false;
+  }
+
+  return true;
+});
+
 namespace {
 storage::IsolationLevel ParseIsolationLevel() {
   const auto isolation_level = StringToEnum<storage::IsolationLevel>(FLAGS_isolation_level, isolation_level_mappings);
@@ -252,6 +315,13 @@ storage::IsolationLevel ParseIsolationLevel() {
   return *isolation_level;
 }
 
+storage::Config::Durability::Compression ParseStorageCompression() {
+  const auto compression =
+      StringToEnum<storage::Config::Durability::Compression>(FLAGS_storage_compression, storage_compression_mappings);
+  MG_ASSERT(compression, "Invalid storage compression");
+  return *compression;
+}
+
 int64_t GetMemoryLimit() {
   if (FLAGS_memory_limit == 0) {
     auto maybe_total_memory = utils::sysinfo::TotalMemory();
@@ -796,14 +866,18 @@ class BoltSession final : public communication::bolt::Session<communication::Inp
 
   using communication::bolt::Session<communication::InputStream, communication::OutputStream>::TEncoder;
 
-  void BeginTransaction() override { interpreter_.BeginTransaction(); }
+  void BeginTransaction(const std::map<std::string, communication::bolt::Value> &extra) override {
+    if (IsReadOnlyMode(extra)) interpreter_.SetNextTransactionReadOnly();
+    interpreter_.BeginTransaction();
+  }
 
   void CommitTransaction() override { interpreter_.CommitTransaction(); }
 
   void RollbackTransaction() override { interpreter_.RollbackTransaction(); }
 
   std::pair<std::vector<std::string>, std::optional<int>> Interpret(
-      const std::string &query, const std::map<std::string, communication::bolt::Value> &params) override {
+      const std::string &query, const std::map<std::string, communication::bolt::Value> &params,
+      const std::map<std::string, communication::bolt::Value> &extra) override {
     std::map<std::string, storage::PropertyValue> params_pv;
     for (const auto &kv : params) params_pv.emplace(kv.first, glue::ToPropertyValue(kv.second));
     const std::string *username{nullptr};
@@ -816,6 +890,7 @@ class BoltSession final : public communication::bolt::Session<communication::Inp
     }
 #endif
     try {
+      if (IsReadOnlyMode(extra)) interpreter_.SetNextTransactionReadOnly();
       auto result = interpreter_.Prepare(query, params_pv, username);
       if (user_ && !AuthChecker::IsUserAuthorized(*user_, result.privileges)) {
         interpreter_.Abort();
@@ -860,6 +935,13 @@ class BoltSession final : public communication::bolt::Session<communication::Inp
   }
 
  private:
+  // Bolt clients request read-only transactions with `mode: "r"` in the
+  // metadata of the BEGIN and RUN messages.
+  static bool IsReadOnlyMode(const std::map<std::string, communication::bolt::Value> &extra) {
+    auto it = extra.find("mode");
+    return it != extra.end() && it->second.IsString() && it->second.ValueString() == "r";
+  }
+
   template <typename TStream>
   std::map<std::string, communication::bolt::Value> PullResults(TStream &stream, std::optional<int> n,
                                                                 std::optional<int> qid) {
@@ -1086,15 +1168,27 @@ int main(int argc, char **argv) {
 
   // Main storage and execution engines initialization
   storage::Config db_config{
-      .gc = {.type = storage::Config::Gc::Type::PERIODIC, .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec)},
-      .items = {.properties_on_edges = FLAGS_storage_properties_on_edges},
+      .gc = {.type = storage::Config::Gc::Type::PERIODIC,
+             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec),
+             .num_threads = FLAGS_storage_gc_threads},
+      .items = {.properties_on_edges = FLAGS_storage_properties_on_edges,
+                .vertex_lookup_table = FLAGS_storage_vertex_lookup_table},
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = FLAGS_storage_recover_on_startup,
+                     .recovery_thread_count = FLAGS_storage_recovery_thread_count,
                      .snapshot_retention_count = FLAGS_storage_snapshot_retention_count,
+                     .snapshot_thread_count = FLAGS_storage_snapshot_thread_count,
+                     .snapshot_incremental_count = FLAGS_storage_snapshot_incremental_count,
                      .wal_file_size_kibibytes = FLAGS_storage_wal_file_size_kib,
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
-                     .snapshot_on_exit = FLAGS_storage_snapshot_on_exit},
-      .transaction = {.isolation_level = ParseIsolationLevel()}};
+                     .wal_group_commit = FLAGS_storage_wal_group_commit,
+                     .wal_group_commit_max_latency =
+                         std::chrono::microseconds(FLAGS_storage_wal_group_commit_max_latency_us),
+                     .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
+                     .compression = ParseStorageCompression()},
+      .transaction = {.isolation_level = ParseIsolationLevel()},
+      .schema_creation = {.num_threads = FLAGS_storage_schema_creation_threads,
+                          .online_index_build = FLAGS_storage_online_index_build}};
   if (FLAGS_storage_snapshot_interval_sec == 0) {
     if (FLAGS_storage_wal_enabled) {
       LOG_FATAL(
@@ -28,6 +28,7 @@
 #include "query/frontend/semantic/required_privileges.hpp"
 #include "query/frontend/semantic/symbol_generator.hpp"
 #include "query/frontend/stripped.hpp"
+#include "query/plan/read_write_type_checker.hpp"
 #include "utils/flag_validation.hpp"
 #include "utils/timer.hpp"
 
@@ -65,6 +66,8 @@ class CachedPlan {
   double cost() const { return plan_->GetCost(); }
   const auto &symbol_table() const { return plan_->GetSymbolTable(); }
   const auto &ast_storage() const { return plan_->GetAstStorage(); }
+  /// The read/write type of the plan, inferred once when the plan is created.
+  auto rw_type() const { return rw_type_; }
 
   bool IsExpired() const {
     // NOLINTNEXTLINE (modernize-use-nullptr)
@@ -73,6 +76,7 @@ class CachedPlan {
 
  private:
   std::unique_ptr<LogicalPlan> plan_;
+  plan::ReadWriteTypeChecker::RWType rw_type_;
   utils::Timer cache_timer_;
 };
 
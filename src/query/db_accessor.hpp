@@ -163,9 +163,49 @@ class VertexAccessor final {
     return iter::imap(MakeEdgeAccessor, std::move(*maybe_edges));
   }
 
-  storage::Result<size_t> InDegree(storage::View view) const { return impl_.InDegree(view); }
+  /// Lazy variant of `InEdges`, the edges are read from the storage on demand.
+  auto IterateInEdges(storage::View view, const std::vector<storage::EdgeTypeId> &edge_types) const
+      -> storage::Result<decltype(iter::imap(MakeEdgeAccessor, *impl_.IterateInEdges(view)))> {
+    auto maybe_edges = impl_.IterateInEdges(view, edge_types);
+    if (maybe_edges.HasError()) return maybe_edges.GetError();
+    return iter::imap(MakeEdgeAccessor, std::move(*maybe_edges));
+  }
+
+  auto IterateInEdges(storage::View view) const { return IterateInEdges(view, {}); }
+
+  auto IterateInEdges(storage::View view, const std::vector<storage::EdgeTypeId> &edge_types,
+                      const VertexAccessor &dest) const
+      -> storage::Result<decltype(iter::imap(MakeEdgeAccessor, *impl_.IterateInEdges(view)))> {
+    auto maybe_edges = impl_.IterateInEdges(view, edge_types, &dest.impl_);
+    if (maybe_edges.HasError()) return maybe_edges.GetError();
+    return iter::imap(MakeEdgeAccessor, std::move(*maybe_edges));
+  }
+
+  /// Lazy variant of `OutEdges`, the edges are read from the storage on demand.
+  auto IterateOutEdges(storage::View view, const std::vector<storage::EdgeTypeId> &edge_types) const
+      -> storage::Result<decltype(iter::imap(MakeEdgeAccessor, *impl_.IterateOutEdges(view)))> {
+    auto maybe_edges = impl_.IterateOutEdges(view, edge_types);
+    if (maybe_edges.HasError()) return maybe_edges.GetError();
+    return iter::imap(MakeEdgeAccessor, std::move(*maybe_edges));
+  }
+
+  auto IterateOutEdges(storage::View view) const { return IterateOutEdges(view, {}); }
+
+  auto IterateOutEdges(storage::View view, const std::vector<storage::EdgeTypeId> &edge_types,
+                       const VertexAccessor &dest) const
+      -> storage::Result<decltype(iter::imap(MakeEdgeAccessor, *impl_.IterateOutEdges(view)))> {
+    auto maybe_edges = impl_.IterateOutEdges(view, edge_types, &dest.impl_);
+    if (maybe_edges.HasError()) return maybe_edges.GetError();
+    return iter::imap(MakeEdgeAccessor, std::move(*maybe_edges));
+  }
 
-  storage::Result<size_t> OutDegree(storage::View view) const { return impl_.OutDegree(view); }
+  storage::Result<size_t> InDegree(storage::View view, const std::vector<storage::EdgeTypeId> &edge_types = {}) const {
+    return impl_.InDegree(view, edge_types);
+  }
+
+  storage::Result<size_t> OutDegree(storage::View view, const std::vector<storage::EdgeTypeId> &edge_types = {}) const {
+    return impl_.OutDegree(view, edge_types);
+  }
 
   int64_t CypherId() const { return impl_.Gid().AsInt(); }
 
@@ -217,6 +257,35 @@ class DbAccessor final {
     Iterator end() { return Iterator(iterable_.end()); }
   };
 
+  class EdgesIterable final {
+    storage::IndexedEdgesIterable iterable_;
+
+   public:
+    class Iterator final {
+      storage::IndexedEdgesIterable::Iterator it_;
+
+     public:
+      explicit Iterator(storage::IndexedEdgesIterable::Iterator it) : it_(it) {}
+
+      EdgeAccessor operator*() const { return EdgeAccessor(*it_); }
+
+      Iterator &operator++() {
+        ++it_;
+        return *this;
+      }
+
+      bool operator==(const Iterator &other) const { return it_ == other.it_; }
+
+      bool operator!=(const Iterator &other) const { return !(other == *this); }
+    };
+
+    explicit EdgesIterable(storage::IndexedEdgesIterable iterable) : iterable_(std::move(iterable)) {}
+
+    Iterator begin() { return Iterator(iterable_.begin()); }
+
+    Iterator end() { return Iterator(iterable_.end()); }
+  };
+
  public:
   explicit DbAccessor(storage::Storage::Accessor *accessor) : accessor_(accessor) {}
 
@@ -234,6 +303,21 @@ class DbAccessor final {
     return VerticesIterable(accessor_->Vertices(label, view));
   }
 
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type) {
+    return EdgesIterable(accessor_->Edges(edge_type, view));
+  }
+
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, storage::PropertyId property,
+                      const storage::PropertyValue &value) {
+    return EdgesIterable(accessor_->Edges(edge_type, property, value, view));
+  }
+
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, storage::PropertyId property,
+                      const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                      const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return EdgesIterable(accessor_->Edges(edge_type, property, lower, upper, view));
+  }
+
   VerticesIterable Vertices(storage::View view, storage::LabelId label, storage::PropertyId property) {
     return VerticesIterable(accessor_->Vertices(label, property, view));
   }
@@ -249,6 +333,14 @@ class DbAccessor final {
     return VerticesIterable(accessor_->Vertices(label, property, lower, upper, view));
   }
 
+  VerticesIterable Vertices(storage::View view, storage::LabelId label,
+                            const std::vector<storage::PropertyId> &properties,
+                            const std::vector<storage::PropertyValue> &prefix,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return VerticesIterable(accessor_->Vertices(label, properties, prefix, lower, upper, view));
+  }
+
   VertexAccessor InsertVertex() { return VertexAccessor(accessor_->CreateVertex()); }
 
   storage::Result<EdgeAccessor> InsertEdge(VertexAccessor *from, VertexAccessor *to,
@@ -334,10 +426,47 @@ class DbAccessor final {
     return accessor_->LabelPropertyIndexExists(label, prop);
   }
 
+  bool LabelPropertyCompositeIndexExists(storage::LabelId label,
+                                         const std::vector<storage::PropertyId> &properties) const {
+    return accessor_->LabelPropertyCompositeIndexExists(label, properties);
+  }
+
+  /// Return the property lists of all composite indices on the given label.
+  std::vector<std::vector<storage::PropertyId>> LabelPropertyCompositeIndices(storage::LabelId label) const {
+    std::vector<std::vector<storage::PropertyId>> ret;
+    for (auto &[index_label, properties] : accessor_->ListAllIndices().label_property_composite) {
+      if (index_label == label) ret.push_back(std::move(properties));
+    }
+    return ret;
+  }
+
+  bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) const { return accessor_->EdgeTypeIndexExists(edge_type); }
+
+  bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
+    return accessor_->EdgeTypePropertyIndexExists(edge_type, property);
+  }
+
   int64_t VerticesCount() const { return accessor_->ApproximateVertexCount(); }
 
   int64_t VerticesCount(storage::LabelId label) const { return accessor_->ApproximateVertexCount(label); }
 
+  int64_t EdgesCount(storage::EdgeTypeId edge_type) const { return accessor_->ApproximateEdgeCount(edge_type); }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
+    return accessor_->ApproximateEdgeCount(edge_type, property);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property,
+                     const storage::PropertyValue &value) const {
+    return accessor_->ApproximateEdgeCount(edge_type, property, value);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property,
+                     const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                     const std::optional<utils::Bound<storage::PropertyValue>> &upper) const {
+    return accessor_->ApproximateEdgeCount(edge_type, property, lower, upper);
+  }
+
   int64_t VerticesCount(storage::LabelId label, storage::PropertyId property) const {
     return accessor_->ApproximateVertexCount(label, property);
   }
@@ -353,9 +482,27 @@ class DbAccessor final {
     return accessor_->ApproximateVertexCount(label, property, lower, upper);
   }
 
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties) const {
+    return accessor_->ApproximateVertexCount(label, properties);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix) const {
+    return accessor_->ApproximateVertexCount(label, properties, prefix);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix,
+                        const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                        const std::optional<utils::Bound<storage::PropertyValue>> &upper) const {
+    return accessor_->ApproximateVertexCount(label, properties, prefix, lower, upper);
+  }
+
   storage::IndicesInfo ListAllIndices() const { return accessor_->ListAllIndices(); }
 
   storage::ConstraintsInfo ListAllConstraints() const { return accessor_->ListAllConstraints(); }
+
+  storage::StorageMemoryInfo GetMemoryInfo() const { return accessor_->GetMemoryInfo(); }
 };
 
 }  // namespace query
@@ -245,6 +245,25 @@ void DumpLabelPropertyIndex(std::ostream *os, query::DbAccessor *dba, storage::L
       << ");";
 }
 
+void DumpLabelPropertyCompositeIndex(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
+                                     const std::vector<storage::PropertyId> &properties) {
+  *os << "CREATE INDEX ON :" << EscapeName(dba->LabelToName(label)) << "(";
+  utils::PrintIterable(*os, properties, ", ", [&dba](auto &stream, const auto &property) {
+    stream << EscapeName(dba->PropertyToName(property));
+  });
+  *os << ");";
+}
+
+void DumpEdgeTypeIndex(std::ostream *os, query::DbAccessor *dba, const storage::EdgeTypeId edge_type) {
+  *os << "CREATE EDGE INDEX ON :" << EscapeName(dba->EdgeTypeToName(edge_type)) << ";";
+}
+
+void DumpEdgeTypePropertyIndex(std::ostream *os, query::DbAccessor *dba, storage::EdgeTypeId edge_type,
+                               storage::PropertyId property) {
+  *os << "CREATE EDGE INDEX ON :" << EscapeName(dba->EdgeTypeToName(edge_type)) << "("
+      << EscapeName(dba->PropertyToName(property)) << ");";
+}
+
 void DumpExistenceConstraint(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
                              storage::PropertyId property) {
   *os << "CREATE CONSTRAINT ON (u:" << EscapeName(dba->LabelToName(label)) << ") ASSERT EXISTS (u."
@@ -269,6 +288,12 @@ PullPlanDump::PullPlanDump(DbAccessor *dba)
                    CreateLabelIndicesPullChunk(),
                    // Dump all label property indices
                    CreateLabelPropertyIndicesPullChunk(),
+                   // Dump all composite label property indices
+                   CreateLabelPropertyCompositeIndicesPullChunk(),
+                   // Dump all edge type indices
+                   CreateEdgeTypeIndicesPullChunk(),
+                   // Dump all edge type property indices
+                   CreateEdgeTypePropertyIndicesPullChunk(),
                    // Dump all existence constraints
                    CreateExistenceConstraintsPullChunk(),
                    // Dump all unique constraints
@@ -364,6 +389,87 @@ PullPlanDump::PullChunk PullPlanDump::CreateLabelPropertyIndicesPullChunk() {
   };
 }
 
+PullPlanDump::PullChunk PullPlanDump::CreateLabelPropertyCompositeIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &label_property_composite = indices_info_->label_property_composite;
+
+    size_t local_counter = 0;
+    while (global_index < label_property_composite.size() && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      const auto &label_property_composite_index = label_property_composite[global_index];
+      DumpLabelPropertyCompositeIndex(&os, dba_, label_property_composite_index.first,
+                                      label_property_composite_index.second);
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == label_property_composite.size()) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
+PullPlanDump::PullChunk PullPlanDump::CreateEdgeTypeIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &edge_type = indices_info_->edge_type;
+
+    size_t local_counter = 0;
+    while (global_index < edge_type.size() && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      DumpEdgeTypeIndex(&os, dba_, edge_type[global_index]);
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == edge_type.size()) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
+PullPlanDump::PullChunk PullPlanDump::CreateEdgeTypePropertyIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &edge_type_property = indices_info_->edge_type_property;
+
+    size_t local_counter = 0;
+    while (global_index < edge_type_property.size() && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      const auto &edge_type_property_index = edge_type_property[global_index];
+      DumpEdgeTypePropertyIndex(&os, dba_, edge_type_property_index.first, edge_type_property_index.second);
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == edge_type_property.size()) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
 PullPlanDump::PullChunk PullPlanDump::CreateExistenceConstraintsPullChunk() {
   return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
     // Delay the construction of constraint vectors
@@ -123,6 +123,9 @@ antlrcpp::Any CypherMainVisitor::visitInfoQuery(MemgraphCypher::InfoQueryContext
   } else if (ctx->constraintInfo()) {
     info_query->info_type_ = InfoQuery::InfoType::CONSTRAINT;
     return info_query;
+  } else if (ctx->memoryInfo()) {
+    info_query->info_type_ = InfoQuery::InfoType::MEMORY;
+    return info_query;
   } else {
     throw utils::NotYetImplemented("Info query: '{}'", ctx->getText());
   }
@@ -209,9 +212,8 @@ antlrcpp::Any CypherMainVisitor::visitCreateIndex(MemgraphCypher::CreateIndexCon
   auto *index_query = storage_->Create<IndexQuery>();
   index_query->action_ = IndexQuery::Action::CREATE;
   index_query->label_ = AddLabel(ctx->labelName()->accept(this));
-  if (ctx->propertyKeyName()) {
-    PropertyIx name_key = ctx->propertyKeyName()->accept(this);
-    index_query->properties_ = {name_key};
+  for (auto *property_key_name : ctx->propertyKeyName()) {
+    index_query->properties_.push_back(property_key_name->accept(this));
   }
   return index_query;
 }
@@ -219,14 +221,42 @@ antlrcpp::Any CypherMainVisitor::visitCreateIndex(MemgraphCypher::CreateIndexCon
 antlrcpp::Any CypherMainVisitor::visitDropIndex(MemgraphCypher::DropIndexContext *ctx) {
   auto *index_query = storage_->Create<IndexQuery>();
   index_query->action_ = IndexQuery::Action::DROP;
-  if (ctx->propertyKeyName()) {
-    PropertyIx key = ctx->propertyKeyName()->accept(this);
-    index_query->properties_ = {key};
+  for (auto *property_key_name : ctx->propertyKeyName()) {
+    index_query->properties_.push_back(property_key_name->accept(this));
   }
   index_query->label_ = AddLabel(ctx->labelName()->accept(this));
   return index_query;
 }
 
+antlrcpp::Any CypherMainVisitor::visitEdgeIndexQuery(MemgraphCypher::EdgeIndexQueryContext *ctx) {
+  MG_ASSERT(ctx->children.size() == 1, "EdgeIndexQuery should have exactly one child!");
+  auto *edge_index_query = ctx->children[0]->accept(this).as<EdgeIndexQuery *>();
+  query_ = edge_index_query;
+  return edge_index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitCreateEdgeIndex(MemgraphCypher::CreateEdgeIndexContext *ctx) {
+  auto *edge_index_query = storage_->Create<EdgeIndexQuery>();
+  edge_index_query->action_ = EdgeIndexQuery::Action::CREATE;
+  edge_index_query->edge_type_ = AddEdgeType(ctx->relTypeName()->accept(this));
+  if (ctx->propertyKeyName()) {
+    PropertyIx name_key = ctx->propertyKeyName()->accept(this);
+    edge_index_query->properties_ = {name_key};
+  }
+  return edge_index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitDropEdgeIndex(MemgraphCypher::DropEdgeIndexContext *ctx) {
+  auto *edge_index_query = storage_->Create<EdgeIndexQuery>();
+  edge_index_query->action_ = EdgeIndexQuery::Action::DROP;
+  edge_index_query->edge_type_ = AddEdgeType(ctx->relTypeName()->accept(this));
+  if (ctx->propertyKeyName()) {
+    PropertyIx name_key = ctx->propertyKeyName()->accept(this);
+    edge_index_query->properties_ = {name_key};
+  }
+  return edge_index_query;
+}
+
 antlrcpp::Any CypherMainVisitor::visitAuthQuery(MemgraphCypher::AuthQueryContext *ctx) {
   MG_ASSERT(ctx->children.size() == 1, "AuthQuery should have exactly one child!");
   auto *auth_query = ctx->children[0]->accept(this).as<AuthQuery *>();
@@ -479,6 +509,20 @@ antlrcpp::Any CypherMainVisitor::visitIsolationLevelQuery(MemgraphCypher::Isolat
   return isolation_level_query;
 }
 
+antlrcpp::Any CypherMainVisitor::visitStorageModeQuery(MemgraphCypher::StorageModeQueryContext *ctx) {
+  auto *storage_mode_query = storage_->Create<StorageModeQuery>();
+
+  storage_mode_query->storage_mode_ = [mode = ctx->storageMode()]() {
+    if (mode->ANALYTICAL()) {
+      return StorageModeQuery::StorageMode::IN_MEMORY_ANALYTICAL;
+    }
+    return StorageModeQuery::StorageMode::IN_MEMORY_TRANSACTIONAL;
+  }();
+
+  query_ = storage_mode_query;
+  return storage_mode_query;
+}
+
 antlrcpp::Any CypherMainVisitor::visitCreateSnapshotQuery(MemgraphCypher::CreateSnapshotQueryContext *ctx) {
   query_ = storage_->Create<CreateSnapshotQuery>();
   return query_;
@@ -1827,6 +1871,9 @@ antlrcpp::Any CypherMainVisitor::visitFunctionInvocation(MemgraphCypher::Functio
     throw utils::NotYetImplemented("DISTINCT function call");
   }
   std::string function_name = ctx->functionName()->accept(this);
+  if (function_name == "SIZE" && ctx->expression().size() == 1U) {
+    if (auto *degree = PatternSizeToDegree(ctx->expression()[0])) return degree;
+  }
   std::vector<Expression *> expressions;
   for (auto *expression : ctx->expression()) {
     expressions.push_back(expression->accept(this));
@@ -1863,6 +1910,50 @@ antlrcpp::Any CypherMainVisitor::visitFunctionInvocation(MemgraphCypher::Functio
   return static_cast<Expression *>(storage_->Create<Function>(function_name, expressions));
 }
 
+Expression *CypherMainVisitor::PatternSizeToDegree(antlr4::tree::ParseTree *expression) {
+  // Descend through the expression precedence levels down to the pattern.
+  MemgraphCypher::RelationshipsPatternContext *pattern = nullptr;
+  for (auto *tree = expression; tree; tree = tree->children.size() == 1U ? tree->children[0] : nullptr) {
+    pattern = dynamic_cast<MemgraphCypher::RelationshipsPatternContext *>(tree);
+    if (pattern) break;
+  }
+  if (!pattern || pattern->patternElementChain().size() != 1U) return nullptr;
+
+  auto *start = pattern->nodePattern();
+  auto *chain = pattern->patternElementChain()[0];
+  auto *end = chain->nodePattern();
+  auto *relationship = chain->relationshipPattern();
+  if (!start->variable() || start->nodeLabels() || start->properties()) return nullptr;
+  if (end->variable() || end->nodeLabels() || end->properties()) return nullptr;
+  // Undirected patterns aren't rewritten because a self-loop is matched only
+  // once by them, while it contributes to both the in and the out degree.
+  if (static_cast<bool>(relationship->leftArrowHead()) == static_cast<bool>(relationship->rightArrowHead())) {
+    return nullptr;
+  }
+
+  std::vector<Expression *> edge_types;
+  if (auto *detail = relationship->relationshipDetail()) {
+    if (detail->name || detail->variableExpansion() || !detail->properties().empty() ||
+        !detail->relationshipLambda().empty()) {
+      return nullptr;
+    }
+    if (detail->relationshipTypes()) {
+      for (auto *edge_type : detail->relationshipTypes()->relTypeName()) {
+        std::string name = edge_type->accept(this);
+        edge_types.push_back(storage_->Create<PrimitiveLiteral>(name));
+      }
+    }
+  }
+
+  std::string variable = start->variable()->accept(this);
+  users_identifiers.insert(variable);
+  std::vector<Expression *> arguments{storage_->Create<Identifier>(variable)};
+  if (!edge_types.empty()) {
+    arguments.push_back(storage_->Create<ListLiteral>(std::move(edge_types)));
+  }
+  return storage_->Create<Function>(relationship->leftArrowHead() ? "INDEGREE" : "OUTDEGREE", std::move(arguments));
+}
+
 antlrcpp::Any CypherMainVisitor::visitFunctionName(MemgraphCypher::FunctionNameContext *ctx) {
   return utils::ToUpperCase(ctx->getText());
 }
@@ -149,6 +149,11 @@ class CypherMainVisitor : public antlropencypher::MemgraphCypherBaseVisitor {
    */
   antlrcpp::Any visitIndexQuery(MemgraphCypher::IndexQueryContext *ctx) override;
 
+  /**
+   * @return EdgeIndexQuery*
+   */
+  antlrcpp::Any visitEdgeIndexQuery(MemgraphCypher::EdgeIndexQueryContext *ctx) override;
+
   /**
    * @return ExplainQuery*
    */
@@ -254,6 +259,11 @@ class CypherMainVisitor : public antlropencypher::MemgraphCypherBaseVisitor {
    */
   antlrcpp::Any visitIsolationLevelQuery(MemgraphCypher::IsolationLevelQueryContext *ctx) override;
 
+  /**
+   * @return StorageModeQuery*
+   */
+  antlrcpp::Any visitStorageModeQuery(MemgraphCypher::StorageModeQueryContext *ctx) override;
+
   /**
    * @return CreateSnapshotQuery*
    */
@@ -384,6 +394,16 @@ class CypherMainVisitor : public antlropencypher::MemgraphCypherBaseVisitor {
    */
   antlrcpp::Any visitDropIndex(MemgraphCypher::DropIndexContext *ctx) override;
 
+  /**
+   * @return EdgeIndexQuery*
+   */
+  antlrcpp::Any visitCreateEdgeIndex(MemgraphCypher::CreateEdgeIndexContext *ctx) override;
+
+  /**
+   * @return EdgeIndexQuery*
+   */
+  antlrcpp::Any visitDropEdgeIndex(MemgraphCypher::DropEdgeIndexContext *ctx) override;
+
   /**
    * @return AuthQuery*
    */
@@ -821,6 +841,14 @@ class CypherMainVisitor : public antlropencypher::MemgraphCypherBaseVisitor {
   PropertyIx AddProperty(const std::string &name);
   EdgeTypeIx AddEdgeType(const std::string &name);
 
+  /**
+   * Rewrites the argument of `size((n)-[:Type]->())` into a degree function
+   * call, so that the edges don't have to be expanded only to be counted.
+   *
+   * @return Expression* or nullptr if the argument isn't a supported pattern.
+   */
+  Expression *PatternSizeToDegree(antlr4::tree::ParseTree *expression);
+
   ParsingContext context_;
   AstStorage *storage_;
 
@@ -46,7 +46,9 @@ indexInfo : INDEX INFO ;
 
 constraintInfo : CONSTRAINT INFO ;
 
-infoQuery : SHOW ( storageInfo | indexInfo | constraintInfo ) ;
+memoryInfo : MEMORY INFO ;
+
+infoQuery : SHOW ( storageInfo | indexInfo | constraintInfo | memoryInfo ) ;
 
 explainQuery : EXPLAIN cypherQuery ;
 
@@ -310,9 +312,9 @@ integerLiteral : DecimalLiteral
                | HexadecimalLiteral
                ;
 
-createIndex : CREATE INDEX ON ':' labelName ( '(' propertyKeyName ')' )? ;
+createIndex : CREATE INDEX ON ':' labelName ( '(' propertyKeyName ( ',' propertyKeyName )* ')' )? ;
 
-dropIndex : DROP INDEX ON ':' labelName ( '(' propertyKeyName ')' )? ;
+dropIndex : DROP INDEX ON ':' labelName ( '(' propertyKeyName ( ',' propertyKeyName )* ')' )? ;
 
 doubleLiteral : FloatingLiteral ;
 
@@ -21,6 +21,7 @@ import Cypher ;
 memgraphCypherKeyword : cypherKeyword
                       | AFTER
                       | ALTER
+                      | ANALYTICAL
                       | ASYNC
                       | AUTH
                       | BAD
@@ -41,6 +42,7 @@ memgraphCypherKeyword : cypherKeyword
                       | DENY
                       | DROP
                       | DUMP
+                      | EDGE
                       | EXECUTE
                       | FOR
                       | FREE
@@ -82,6 +84,7 @@ memgraphCypherKeyword : cypherKeyword
                       | TO
                       | TOPICS
                       | TRANSACTION
+                      | TRANSACTIONAL
                       | TRANSFORM
                       | TRIGGER
                       | TRIGGERS
@@ -99,6 +102,7 @@ symbolicName : UnescapedSymbolicName
 
 query : cypherQuery
       | indexQuery
+      | edgeIndexQuery
       | explainQuery
       | profileQuery
       | infoQuery
@@ -110,6 +114,7 @@ query : cypherQuery
       | freeMemoryQuery
       | triggerQuery
       | isolationLevelQuery
+      | storageModeQuery
       | createSnapshotQuery
       | streamQuery
       | settingQuery
@@ -285,8 +290,18 @@ isolationLevelScope : GLOBAL | SESSION | NEXT ;
 
 isolationLevelQuery : SET isolationLevelScope TRANSACTION ISOLATION LEVEL isolationLevel ;
 
+storageMode : ANALYTICAL | TRANSACTIONAL ;
+
+storageModeQuery : STORAGE MODE storageMode ;
+
 createSnapshotQuery : CREATE SNAPSHOT ;
 
+edgeIndexQuery : createEdgeIndex | dropEdgeIndex ;
+
+createEdgeIndex : CREATE EDGE INDEX ON ':' relTypeName ( '(' propertyKeyName ')' )? ;
+
+dropEdgeIndex : DROP EDGE INDEX ON ':' relTypeName ( '(' propertyKeyName ')' )? ;
+
 streamName : symbolicName ;
 
 symbolicNameWithMinus : symbolicName ( MINUS symbolicName )* ;
@@ -26,6 +26,7 @@ UNDERSCORE : '_' ;
 
 AFTER          : A F T E R ;
 ALTER          : A L T E R ;
+ANALYTICAL     : A N A L Y T I C A L ;
 ASYNC          : A S Y N C ;
 AUTH           : A U T H ;
 BAD            : B A D ;
@@ -48,6 +49,7 @@ DIRECTORY      : D I R E C T O R Y ;
 DROP           : D R O P ;
 DUMP           : D U M P ;
 DURABILITY     : D U R A B I L I T Y ;
+EDGE           : E D G E ;
 EXECUTE        : E X E C U T E ;
 FOR            : F O R ;
 FREE           : F R E E ;
@@ -94,6 +96,7 @@ TIMEOUT        : T I M E O U T ;
 TO             : T O ;
 TOPICS         : T O P I C S;
 TRANSACTION    : T R A N S A C T I O N ;
+TRANSACTIONAL  : T R A N S A C T I O N A L ;
 TRANSFORM      : T R A N S F O R M ;
 TRIGGER        : T R I G G E R ;
 TRIGGERS       : T R I G G E R S ;
@@ -143,7 +143,9 @@ const trie::Trie kKeywords = {"union",       "all",
                               "start",       "stream",
                               "streams",     "transform",
                               "topics",      "check",
-                              "setting",     "settings"};
+                              "setting",     "settings",
+                              "edge",        "mode",
+                              "analytical",  "transactional"};
 
 // Unicode codepoints that are allowed at the start of the unescaped name.
 const std::bitset<kBitsetSize> kUnescapedNameAllowedStarts(
@@ -458,30 +458,60 @@ size_t UnwrapDegreeResult(storage::Result<size_t> maybe_degree) {
   return *maybe_degree;
 }
 
+// Converts the optional edge type argument of the degree functions, which is
+// either a single edge type name or a list of them.
+std::vector<storage::EdgeTypeId> DegreeEdgeTypes(const char *name, const TypedValue *args, int64_t nargs,
+                                                 const FunctionContext &ctx) {
+  std::vector<storage::EdgeTypeId> edge_types;
+  if (nargs < 2) return edge_types;
+  auto add_edge_type = [&](const TypedValue &value) {
+    if (!value.IsString()) {
+      throw QueryRuntimeException("Edge types passed to '{}' must be strings.", name);
+    }
+    edge_types.push_back(ctx.db_accessor->NameToEdgeType(value.ValueString()));
+  };
+  if (args[1].IsList()) {
+    for (const auto &value : args[1].ValueList()) add_edge_type(value);
+  } else {
+    add_edge_type(args[1]);
+  }
+  return edge_types;
+}
+
+// An empty list of edge types means that no edges should be counted, unlike an
+// empty filter in the storage that accepts all edge types.
+bool HasEmptyEdgeTypeList(const TypedValue *args, int64_t nargs) {
+  return nargs >= 2 && args[1].IsList() && args[1].ValueList().empty();
+}
+
 }  // namespace
 
 TypedValue Degree(const TypedValue *args, int64_t nargs, const FunctionContext &ctx) {
-  FType<Or<Null, Vertex>>("degree", args, nargs);
+  FType<Or<Null, Vertex>, Optional<Or<String, List>>>("degree", args, nargs);
   if (args[0].IsNull()) return TypedValue(ctx.memory);
+  if (HasEmptyEdgeTypeList(args, nargs)) return TypedValue(0, ctx.memory);
   const auto &vertex = args[0].ValueVertex();
-  size_t out_degree = UnwrapDegreeResult(vertex.OutDegree(ctx.view));
-  size_t in_degree = UnwrapDegreeResult(vertex.InDegree(ctx.view));
+  auto edge_types = DegreeEdgeTypes("degree", args, nargs, ctx);
+  size_t out_degree = UnwrapDegreeResult(vertex.OutDegree(ctx.view, edge_types));
+  size_t in_degree = UnwrapDegreeResult(vertex.InDegree(ctx.view, edge_types));
   return TypedValue(static_cast<int64_t>(out_degree + in_degree), ctx.memory);
 }
 
 TypedValue InDegree(const TypedValue *args, int64_t nargs, const FunctionContext &ctx) {
-  FType<Or<Null, Vertex>>("inDegree", args, nargs);
+  FType<Or<Null, Vertex>, Optional<Or<String, List>>>("inDegree", args, nargs);
   if (args[0].IsNull()) return TypedValue(ctx.memory);
+  if (HasEmptyEdgeTypeList(args, nargs)) return TypedValue(0, ctx.memory);
   const auto &vertex = args[0].ValueVertex();
-  size_t in_degree = UnwrapDegreeResult(vertex.InDegree(ctx.view));
+  size_t in_degree = UnwrapDegreeResult(vertex.InDegree(ctx.view, DegreeEdgeTypes("inDegree", args, nargs, ctx)));
   return TypedValue(static_cast<int64_t>(in_degree), ctx.memory);
 }
 
 TypedValue OutDegree(const TypedValue *args, int64_t nargs, const FunctionContext &ctx) {
-  FType<Or<Null, Vertex>>("outDegree", args, nargs);
+  FType<Or<Null, Vertex>, Optional<Or<String, List>>>("outDegree", args, nargs);
   if (args[0].IsNull()) return TypedValue(ctx.memory);
+  if (HasEmptyEdgeTypeList(args, nargs)) return TypedValue(0, ctx.memory);
   const auto &vertex = args[0].ValueVertex();
-  size_t out_degree = UnwrapDegreeResult(vertex.OutDegree(ctx.view));
+  size_t out_degree = UnwrapDegreeResult(vertex.OutDegree(ctx.view, DegreeEdgeTypes("outDegree", args, nargs, ctx)));
   return TypedValue(static_cast<int64_t>(out_degree), ctx.memory);
 }
 
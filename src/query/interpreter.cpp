@@ -15,6 +15,7 @@
 #include <chrono>
 #include <limits>
 #include <optional>
+#include <utility>
 
 #include "glue/communication.hpp"
 #include "memory/memory_control.hpp"
@@ -60,6 +61,8 @@ extern Event ReadWriteQuery;
 
 extern const Event LabelIndexCreated;
 extern const Event LabelPropertyIndexCreated;
+extern const Event EdgeTypeIndexCreated;
+extern const Event EdgeTypePropertyIndexCreated;
 
 extern const Event StreamsCreated;
 extern const Event TriggersCreated;
@@ -868,6 +871,16 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
 }
 
 using RWType = plan::ReadWriteTypeChecker::RWType;
+
+// The transaction has to be created before the query is planned, so the type
+// of the query is known only if its plan is already in the plan cache.
+bool IsCachedReadQuery(const ParsedQuery &parsed_query, InterpreterContext *interpreter_context) {
+  if (!utils::Downcast<CypherQuery>(parsed_query.query) || !parsed_query.is_cacheable) return false;
+  auto plan_cache_access = interpreter_context->plan_cache.access();
+  auto it = plan_cache_access.find(parsed_query.stripped_query.hash());
+  if (it == plan_cache_access.end() || it->second->IsExpired()) return false;
+  return it->second->rw_type() == RWType::R;
+}
 }  // namespace
 
 InterpreterContext::InterpreterContext(storage::Storage *db, const InterpreterConfig config,
@@ -892,11 +905,11 @@ PreparedQuery Interpreter::PrepareTransactionQuery(std::string_view query_upper)
       in_explicit_transaction_ = true;
       expect_rollback_ = false;
 
-      db_accessor_ =
-          std::make_unique<storage::Storage::Accessor>(interpreter_context_->db->Access(GetIsolationLevelOverride()));
+      const bool read_only = std::exchange(next_transaction_read_only, false);
+      db_accessor_ = CreateStorageAccessor(read_only);
       execution_db_accessor_.emplace(db_accessor_.get());
 
-      if (interpreter_context_->trigger_store.HasTriggers()) {
+      if (!read_only && interpreter_context_->trigger_store.HasTriggers()) {
         trigger_context_collector_.emplace(interpreter_context_->trigger_store.GetEventTypes());
       }
     };
@@ -965,8 +978,7 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
                                 parsed_query.is_cacheable ? &interpreter_context->plan_cache : nullptr, dba);
 
   summary->insert_or_assign("cost_estimate", plan->cost());
-  auto rw_type_checker = plan::ReadWriteTypeChecker();
-  rw_type_checker.InferRWType(const_cast<plan::LogicalOperator &>(plan->plan()));
+  const auto rw_type = plan->rw_type();
 
   auto output_symbols = plan->plan().OutputSymbols(plan->symbol_table());
 
@@ -991,7 +1003,7 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
                          }
                          return std::nullopt;
                        },
-                       rw_type_checker.type};
+                       rw_type};
 }
 
 PreparedQuery PrepareExplainQuery(ParsedQuery parsed_query, std::map<std::string, TypedValue> *summary,
@@ -1091,8 +1103,7 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
   auto cypher_query_plan = CypherQueryToPlan(
       parsed_inner_query.stripped_query.hash(), std::move(parsed_inner_query.ast_storage), cypher_query,
       parsed_inner_query.parameters, parsed_inner_query.is_cacheable ? &interpreter_context->plan_cache : nullptr, dba);
-  auto rw_type_checker = plan::ReadWriteTypeChecker();
-  rw_type_checker.InferRWType(const_cast<plan::LogicalOperator &>(cypher_query_plan->plan()));
+  const auto rw_type = cypher_query_plan->rw_type();
 
   return PreparedQuery{{"OPERATOR", "ACTUAL HITS", "RELATIVE TIME", "ABSOLUTE TIME"},
                        std::move(parsed_query.required_privileges),
@@ -1120,7 +1131,7 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
 
                          return std::nullopt;
                        },
-                       rw_type_checker.type};
+                       rw_type};
 }
 
 PreparedQuery PrepareDumpQuery(ParsedQuery parsed_query, std::map<std::string, TypedValue> *summary, DbAccessor *dba,
@@ -1159,11 +1170,11 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
   std::vector<storage::PropertyId> properties;
   properties.reserve(index_query->properties_.size());
   for (const auto &prop : index_query->properties_) {
-    properties.push_back(interpreter_context->db->NameToProperty(prop.name));
-  }
-
-  if (properties.size() > 1) {
-    throw utils::NotYetImplemented("index on multiple properties");
+    auto property = interpreter_context->db->NameToProperty(prop.name);
+    if (std::find(properties.begin(), properties.end(), property) != properties.end()) {
+      throw QueryRuntimeException("Property '{}' is used more than once in the index.", prop.name);
+    }
+    properties.push_back(property);
   }
 
   switch (index_query->action_) {
@@ -1173,10 +1184,12 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
         if (properties.empty()) {
           interpreter_context->db->CreateIndex(label);
           EventCounter::IncrementCounter(EventCounter::LabelIndexCreated);
-        } else {
-          MG_ASSERT(properties.size() == 1U);
+        } else if (properties.size() == 1U) {
           interpreter_context->db->CreateIndex(label, properties[0]);
           EventCounter::IncrementCounter(EventCounter::LabelPropertyIndexCreated);
+        } else {
+          interpreter_context->db->CreateIndex(label, properties);
+          EventCounter::IncrementCounter(EventCounter::LabelPropertyCompositeIndexCreated);
         }
         invalidate_plan_cache();
       };
@@ -1187,9 +1200,82 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
                  invalidate_plan_cache = std::move(invalidate_plan_cache)] {
         if (properties.empty()) {
           interpreter_context->db->DropIndex(label);
+        } else if (properties.size() == 1U) {
+          interpreter_context->db->DropIndex(label, properties[0]);
+        } else {
+          interpreter_context->db->DropIndex(label, properties);
+        }
+        invalidate_plan_cache();
+      };
+      break;
+    }
+  }
+
+  return PreparedQuery{{},
+                       std::move(parsed_query.required_privileges),
+                       [handler = std::move(handler)](AnyStream *stream, std::optional<int>) {
+                         handler();
+                         return QueryHandlerResult::NOTHING;
+                       },
+                       RWType::W};
+}
+
+PreparedQuery PrepareEdgeIndexQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
+                                    InterpreterContext *interpreter_context) {
+  if (in_explicit_transaction) {
+    throw IndexInMulticommandTxException();
+  }
+
+  auto *edge_index_query = utils::Downcast<EdgeIndexQuery>(parsed_query.query);
+  std::function<void()> handler;
+
+  // Creating an index influences computed plan costs.
+  auto invalidate_plan_cache = [plan_cache = &interpreter_context->plan_cache] {
+    auto access = plan_cache->access();
+    for (auto &kv : access) {
+      access.remove(kv.first);
+    }
+  };
+
+  auto edge_type = interpreter_context->db->NameToEdgeType(edge_index_query->edge_type_.name);
+  std::vector<storage::PropertyId> properties;
+  properties.reserve(edge_index_query->properties_.size());
+  for (const auto &prop : edge_index_query->properties_) {
+    properties.push_back(interpreter_context->db->NameToProperty(prop.name));
+  }
+
+  if (properties.size() > 1) {
+    throw utils::NotYetImplemented("index on multiple properties");
+  }
+
+  switch (edge_index_query->action_) {
+    case EdgeIndexQuery::Action::CREATE: {
+      handler = [interpreter_context, edge_type, properties = std::move(properties),
+                 invalidate_plan_cache = std::move(invalidate_plan_cache)] {
+        if (properties.empty()) {
+          interpreter_context->db->CreateIndex(edge_type);
+          EventCounter::IncrementCounter(EventCounter::EdgeTypeIndexCreated);
         } else {
           MG_ASSERT(properties.size() == 1U);
-          interpreter_context->db->DropIndex(label, properties[0]);
+          auto ret = interpreter_context->db->CreateIndex(edge_type, properties[0]);
+          if (ret.HasError()) {
+            MG_ASSERT(ret.GetError() == storage::Error::PROPERTIES_DISABLED);
+            throw QueryRuntimeException("Can't create an edge property index when properties on edges are disabled.");
+          }
+          EventCounter::IncrementCounter(EventCounter::EdgeTypePropertyIndexCreated);
+        }
+        invalidate_plan_cache();
+      };
+      break;
+    }
+    case EdgeIndexQuery::Action::DROP: {
+      handler = [interpreter_context, edge_type, properties = std::move(properties),
+                 invalidate_plan_cache = std::move(invalidate_plan_cache)] {
+        if (properties.empty()) {
+          interpreter_context->db->DropIndex(edge_type);
+        } else {
+          MG_ASSERT(properties.size() == 1U);
+          interpreter_context->db->DropIndex(edge_type, properties[0]);
         }
         invalidate_plan_cache();
       };
@@ -1511,6 +1597,47 @@ PreparedQuery PrepareIsolationLevelQuery(ParsedQuery parsed_query, const bool in
       RWType::NONE};
 }
 
+constexpr auto ToStorageMode(const StorageModeQuery::StorageMode storage_mode) noexcept {
+  switch (storage_mode) {
+    case StorageModeQuery::StorageMode::IN_MEMORY_TRANSACTIONAL:
+      return storage::StorageMode::IN_MEMORY_TRANSACTIONAL;
+    case StorageModeQuery::StorageMode::IN_MEMORY_ANALYTICAL:
+      return storage::StorageMode::IN_MEMORY_ANALYTICAL;
+  }
+}
+
+PreparedQuery PrepareStorageModeQuery(ParsedQuery parsed_query, const bool in_explicit_transaction,
+                                      InterpreterContext *interpreter_context) {
+  if (in_explicit_transaction) {
+    throw StorageModeModificationInMulticommandTxException();
+  }
+
+  auto *storage_mode_query = utils::Downcast<StorageModeQuery>(parsed_query.query);
+  MG_ASSERT(storage_mode_query);
+
+  const auto storage_mode = ToStorageMode(storage_mode_query->storage_mode_);
+
+  return PreparedQuery{
+      {},
+      std::move(parsed_query.required_privileges),
+      [interpreter_context, storage_mode](AnyStream *stream,
+                                          std::optional<int> n) -> std::optional<QueryHandlerResult> {
+        if (auto maybe_error = interpreter_context->db->SetStorageMode(storage_mode); maybe_error.HasError()) {
+          switch (maybe_error.GetError()) {
+            case storage::Storage::SetStorageModeError::ReplicationEnabled:
+              throw utils::BasicException(
+                  "Failed to switch to the analytical storage mode. Its changes can't be replicated.");
+            case storage::Storage::SetStorageModeError::ConstraintsExist:
+              throw utils::BasicException(
+                  "Failed to switch to the analytical storage mode. Constraints aren't validated in it, drop all of "
+                  "the constraints first.");
+          }
+        }
+        return QueryHandlerResult::COMMIT;
+      },
+      RWType::NONE};
+}
+
 PreparedQuery PrepareCreateSnapshotQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
                                          InterpreterContext *interpreter_context) {
   if (in_explicit_transaction) {
@@ -1583,23 +1710,58 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
             {TypedValue("disk_usage"), TypedValue(static_cast<int64_t>(info.disk_usage))},
             {TypedValue("memory_allocated"), TypedValue(static_cast<int64_t>(utils::total_memory_tracker.Amount()))},
             {TypedValue("allocation_limit"),
-             TypedValue(static_cast<int64_t>(utils::total_memory_tracker.HardLimit()))}};
+             TypedValue(static_cast<int64_t>(utils::total_memory_tracker.HardLimit()))},
+            {TypedValue("gc_runs"), TypedValue(static_cast<int64_t>(info.gc_runs))},
+            {TypedValue("gc_unlink_deltas_time_us"), TypedValue(static_cast<int64_t>(info.gc_unlink_deltas_time_us))},
+            {TypedValue("gc_index_cleanup_time_us"), TypedValue(static_cast<int64_t>(info.gc_index_cleanup_time_us))},
+            {TypedValue("gc_free_objects_time_us"), TypedValue(static_cast<int64_t>(info.gc_free_objects_time_us))},
+            {TypedValue("wal_sync_batches"), TypedValue(static_cast<int64_t>(info.wal_sync_batches))},
+            {TypedValue("wal_synced_transactions"), TypedValue(static_cast<int64_t>(info.wal_synced_transactions))},
+            {TypedValue("wal_max_sync_batch_size"), TypedValue(static_cast<int64_t>(info.wal_max_sync_batch_size))},
+            {TypedValue("wal_sync_time_us"), TypedValue(static_cast<int64_t>(info.wal_sync_time_us))}};
         return std::pair{results, QueryHandlerResult::COMMIT};
       };
       break;
     case InfoQuery::InfoType::INDEX:
-      header = {"index type", "label", "property"};
+      header = {"index type", "label", "property", "state"};
       handler = [interpreter_context] {
         auto *db = interpreter_context->db;
         auto info = db->ListAllIndices();
         std::vector<std::vector<TypedValue>> results;
-        results.reserve(info.label.size() + info.label_property.size());
+        results.reserve(info.label.size() + info.label_property.size() + info.edge_type.size() +
+                        info.edge_type_property.size() + info.label_property_composite.size() +
+                        info.label_building.size() + info.label_property_building.size());
+        const TypedValue ready("ready");
+        const TypedValue building("building");
         for (const auto &item : info.label) {
-          results.push_back({TypedValue("label"), TypedValue(db->LabelToName(item)), TypedValue()});
+          results.push_back({TypedValue("label"), TypedValue(db->LabelToName(item)), TypedValue(), ready});
         }
         for (const auto &item : info.label_property) {
           results.push_back({TypedValue("label+property"), TypedValue(db->LabelToName(item.first)),
-                             TypedValue(db->PropertyToName(item.second))});
+                             TypedValue(db->PropertyToName(item.second)), ready});
+        }
+        for (const auto &item : info.edge_type) {
+          results.push_back({TypedValue("edge-type"), TypedValue(db->EdgeTypeToName(item)), TypedValue(), ready});
+        }
+        for (const auto &item : info.edge_type_property) {
+          results.push_back({TypedValue("edge-type+property"), TypedValue(db->EdgeTypeToName(item.first)),
+                             TypedValue(db->PropertyToName(item.second)), ready});
+        }
+        for (const auto &item : info.label_property_composite) {
+          std::vector<TypedValue> properties;
+          properties.reserve(item.second.size());
+          for (const auto &property : item.second) {
+            properties.emplace_back(db->PropertyToName(property));
+          }
+          results.push_back({TypedValue("label+properties"), TypedValue(db->LabelToName(item.first)),
+                             TypedValue(std::move(properties)), ready});
+        }
+        for (const auto &item : info.label_building) {
+          results.push_back({TypedValue("label"), TypedValue(db->LabelToName(item)), TypedValue(), building});
+        }
+        for (const auto &item : info.label_property_building) {
+          results.push_back({TypedValue("label+property"), TypedValue(db->LabelToName(item.first)),
+                             TypedValue(db->PropertyToName(item.second)), building});
         }
         return std::pair{results, QueryHandlerResult::NOTHING};
       };
@@ -1627,6 +1789,34 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
         return std::pair{results, QueryHandlerResult::NOTHING};
       };
       break;
+    case InfoQuery::InfoType::MEMORY:
+      header = {"category", "name", "bytes"};
+      handler = [db] {
+        auto info = db->GetMemoryInfo();
+        const auto total_row = [](const char *category, uint64_t bytes) {
+          return std::vector<TypedValue>{TypedValue(category), TypedValue(), TypedValue(static_cast<int64_t>(bytes))};
+        };
+        std::vector<std::vector<TypedValue>> results{total_row("vertices", info.vertices),
+                                                     total_row("edges", info.edges),
+                                                     total_row("labels", info.labels),
+                                                     total_row("properties", info.properties),
+                                                     total_row("adjacency_lists", info.adjacency_lists),
+                                                     total_row("deltas", info.deltas),
+                                                     total_row("indices", info.indices),
+                                                     total_row("name_id_mapper", info.name_id_mapper),
+                                                     total_row("memory_tracked", info.memory_tracked)};
+        results.reserve(results.size() + info.per_label.size() + info.per_edge_type.size());
+        for (const auto &[label, bytes] : info.per_label) {
+          results.push_back({TypedValue("label"), TypedValue(db->LabelToName(label)),
+                             TypedValue(static_cast<int64_t>(bytes))});
+        }
+        for (const auto &[edge_type, bytes] : info.per_edge_type) {
+          results.push_back({TypedValue("edge_type"), TypedValue(db->EdgeTypeToName(edge_type)),
+                             TypedValue(static_cast<int64_t>(bytes))});
+        }
+        return std::pair{results, QueryHandlerResult::NOTHING};
+      };
+      break;
   }
 
   return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
@@ -1657,6 +1847,11 @@ PreparedQuery PrepareConstraintQuery(ParsedQuery parsed_query, bool in_explicit_
   auto *constraint_query = utils::Downcast<ConstraintQuery>(parsed_query.query);
   std::function<void()> handler;
 
+  if (constraint_query->action_type_ == ConstraintQuery::ActionType::CREATE &&
+      interpreter_context->db->GetStorageMode() == storage::StorageMode::IN_MEMORY_ANALYTICAL) {
+    throw QueryException("Constraints can't be created in the analytical storage mode!");
+  }
+
   auto label = interpreter_context->db->NameToLabel(constraint_query->constraint_.label.name);
   std::vector<storage::PropertyId> properties;
   properties.reserve(constraint_query->constraint_.properties.size());
@@ -1824,6 +2019,10 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     return {query_execution->prepared_query->header, query_execution->prepared_query->privileges, qid};
   }
 
+  // The access mode requested for the next transaction applies only to the
+  // transaction implicitly started by this query.
+  const bool read_only_requested = std::exchange(next_transaction_read_only, false);
+
   // All queries other than transaction control queries advance the command in
   // an explicit transaction block.
   if (in_explicit_transaction_) {
@@ -1850,11 +2049,12 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
         (utils::Downcast<CypherQuery>(parsed_query.query) || utils::Downcast<ExplainQuery>(parsed_query.query) ||
          utils::Downcast<ProfileQuery>(parsed_query.query) || utils::Downcast<DumpQuery>(parsed_query.query) ||
          utils::Downcast<TriggerQuery>(parsed_query.query))) {
-      db_accessor_ =
-          std::make_unique<storage::Storage::Accessor>(interpreter_context_->db->Access(GetIsolationLevelOverride()));
+      const bool read_only = read_only_requested || IsCachedReadQuery(parsed_query, interpreter_context_);
+      db_accessor_ = CreateStorageAccessor(read_only);
       execution_db_accessor_.emplace(db_accessor_.get());
 
-      if (utils::Downcast<CypherQuery>(parsed_query.query) && interpreter_context_->trigger_store.HasTriggers()) {
+      if (!read_only && utils::Downcast<CypherQuery>(parsed_query.query) &&
+          interpreter_context_->trigger_store.HasTriggers()) {
         trigger_context_collector_.emplace(interpreter_context_->trigger_store.GetEventTypes());
       }
     }
@@ -1879,6 +2079,8 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     } else if (utils::Downcast<IndexQuery>(parsed_query.query)) {
       prepared_query = PrepareIndexQuery(std::move(parsed_query), in_explicit_transaction_, &query_execution->summary,
                                          interpreter_context_, &query_execution->execution_memory_with_exception);
+    } else if (utils::Downcast<EdgeIndexQuery>(parsed_query.query)) {
+      prepared_query = PrepareEdgeIndexQuery(std::move(parsed_query), in_explicit_transaction_, interpreter_context_);
     } else if (utils::Downcast<AuthQuery>(parsed_query.query)) {
       prepared_query = PrepareAuthQuery(std::move(parsed_query), in_explicit_transaction_, &query_execution->summary,
                                         interpreter_context_, &*execution_db_accessor_,
@@ -1908,6 +2110,8 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     } else if (utils::Downcast<IsolationLevelQuery>(parsed_query.query)) {
       prepared_query =
           PrepareIsolationLevelQuery(std::move(parsed_query), in_explicit_transaction_, interpreter_context_, this);
+    } else if (utils::Downcast<StorageModeQuery>(parsed_query.query)) {
+      prepared_query = PrepareStorageModeQuery(std::move(parsed_query), in_explicit_transaction_, interpreter_context_);
     } else if (utils::Downcast<CreateSnapshotQuery>(parsed_query.query)) {
       prepared_query =
           PrepareCreateSnapshotQuery(std::move(parsed_query), in_explicit_transaction_, interpreter_context_);
@@ -1932,6 +2136,12 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
       throw QueryException("Write query forbidden on the replica!");
     }
 
+    if (const auto query_type = query_execution->prepared_query->rw_type;
+        db_accessor_ && db_accessor_->IsReadOnly() && (query_type == RWType::W || query_type == RWType::RW)) {
+      query_execution = nullptr;
+      throw QueryException("Write query forbidden in a read-only transaction!");
+    }
+
     return {query_execution->prepared_query->header, query_execution->prepared_query->privileges, qid};
   } catch (const utils::BasicException &) {
     EventCounter::IncrementCounter(EventCounter::FailedQuery);
@@ -2108,6 +2318,16 @@ std::optional<storage::IsolationLevel> Interpreter::GetIsolationLevelOverride()
   return interpreter_isolation_level;
 }
 
+std::unique_ptr<storage::Storage::Accessor> Interpreter::CreateStorageAccessor(const bool read_only) {
+  if (read_only) {
+    return std::make_unique<storage::Storage::Accessor>(
+        interpreter_context_->db->ReadOnlyAccess(GetIsolationLevelOverride()));
+  }
+  return std::make_unique<storage::Storage::Accessor>(interpreter_context_->db->Access(GetIsolationLevelOverride()));
+}
+
+void Interpreter::SetNextTransactionReadOnly() { next_transaction_read_only = true; }
+
 void Interpreter::SetNextTransactionIsolationLevel(const storage::IsolationLevel isolation_level) {
   next_transaction_isolation_level.emplace(isolation_level);
 }
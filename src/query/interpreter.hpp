@@ -270,6 +270,14 @@ class Interpreter final {
 
   void RollbackTransaction();
 
+  /**
+   * Run the next transaction in read-only mode. The storage doesn't allocate a
+   * timestamp for read-only transactions, and write queries fail in them.
+   * Transactions of read queries with a cached plan are read-only even
+   * without the request.
+   */
+  void SetNextTransactionReadOnly();
+
   void SetNextTransactionIsolationLevel(storage::IsolationLevel isolation_level);
   void SetSessionIsolationLevel(storage::IsolationLevel isolation_level);
 
@@ -327,12 +335,14 @@ class Interpreter final {
 
   std::optional<storage::IsolationLevel> interpreter_isolation_level;
   std::optional<storage::IsolationLevel> next_transaction_isolation_level;
+  bool next_transaction_read_only{false};
 
   PreparedQuery PrepareTransactionQuery(std::string_view query_upper);
   void Commit();
   void AdvanceCommand();
   void AbortCommand(std::unique_ptr<QueryExecution> *query_execution);
   std::optional<storage::IsolationLevel> GetIsolationLevelOverride();
+  std::unique_ptr<storage::Storage::Accessor> CreateStorageAccessor(bool read_only);
 
   size_t ActiveQueryExecutions() {
     return std::count_if(query_executions_.begin(), query_executions_.end(),
@@ -56,6 +56,10 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     static constexpr double MakeScanAllByLabelPropertyValue{1.1};
     static constexpr double MakeScanAllByLabelPropertyRange{1.1};
     static constexpr double MakeScanAllByLabelProperty{1.1};
+    static constexpr double MakeScanAllByLabelProperties{1.1};
+    static constexpr double kScanAllByEdgeType{1.1};
+    static constexpr double kScanAllByEdgeTypePropertyValue{1.1};
+    static constexpr double kScanAllByEdgeTypePropertyRange{1.1};
     static constexpr double kExpand{2.0};
     static constexpr double kExpandVariable{3.0};
     static constexpr double kFilter{1.5};
@@ -146,6 +150,82 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PostVisit(ScanAllByLabelProperties &logical_op) override {
+    // Only the leading constant values of the prefix can be looked up in the
+    // index, every value after the first non-constant one is estimated with
+    // the filtering constant.
+    std::vector<storage::PropertyValue> prefix;
+    for (auto *expression : logical_op.prefix_expressions_) {
+      auto property_value = ConstPropertyValue(expression);
+      if (!property_value) break;
+      prefix.push_back(std::move(*property_value));
+    }
+    const auto unknown_values = logical_op.prefix_expressions_.size() - prefix.size();
+
+    double factor = 1.0;
+    if (unknown_values == 0 && (logical_op.lower_bound_ || logical_op.upper_bound_)) {
+      auto lower = BoundToPropertyValue(logical_op.lower_bound_);
+      auto upper = BoundToPropertyValue(logical_op.upper_bound_);
+      if (upper || lower)
+        factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.properties_, prefix, lower, upper);
+      else
+        factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.properties_, prefix);
+      if ((logical_op.upper_bound_ && !upper) || (logical_op.lower_bound_ && !lower)) factor *= CardParam::kFilter;
+    } else {
+      factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.properties_, prefix);
+      for (size_t i = 0; i < unknown_values; ++i) factor *= CardParam::kFilter;
+      if (logical_op.lower_bound_ || logical_op.upper_bound_) factor *= CardParam::kFilter;
+    }
+
+    cardinality_ *= factor;
+    IncrementCost(CostParam::MakeScanAllByLabelProperties);
+    return true;
+  }
+
+  bool PostVisit(ScanAllByEdgeType &logical_op) override {
+    double factor = db_accessor_->EdgesCount(logical_op.common_.edge_types[0]);
+    // Each edge is produced from both of its endpoints.
+    if (logical_op.common_.direction == EdgeAtom::Direction::BOTH) factor *= 2;
+    cardinality_ *= factor;
+    IncrementCost(CostParam::kScanAllByEdgeType);
+    return true;
+  }
+
+  bool PostVisit(ScanAllByEdgeTypePropertyValue &logical_op) override {
+    const auto edge_type = logical_op.common_.edge_types[0];
+    // The same as for ScanAllByLabelPropertyValue, the cardinality is exact
+    // only when the property value is a constant.
+    auto property_value = ConstPropertyValue(logical_op.expression_);
+    double factor = 1.0;
+    if (property_value)
+      factor = db_accessor_->EdgesCount(edge_type, logical_op.property_, property_value.value());
+    else
+      factor = db_accessor_->EdgesCount(edge_type, logical_op.property_) * CardParam::kFilter;
+    // Each edge is produced from both of its endpoints.
+    if (logical_op.common_.direction == EdgeAtom::Direction::BOTH) factor *= 2;
+    cardinality_ *= factor;
+    IncrementCost(CostParam::kScanAllByEdgeTypePropertyValue);
+    return true;
+  }
+
+  bool PostVisit(ScanAllByEdgeTypePropertyRange &logical_op) override {
+    const auto edge_type = logical_op.common_.edge_types[0];
+    auto lower = BoundToPropertyValue(logical_op.lower_bound_);
+    auto upper = BoundToPropertyValue(logical_op.upper_bound_);
+
+    double factor = 1.0;
+    if (upper || lower)
+      factor = db_accessor_->EdgesCount(edge_type, logical_op.property_, lower, upper);
+    else
+      factor = db_accessor_->EdgesCount(edge_type, logical_op.property_);
+    if ((logical_op.upper_bound_ && !upper) || (logical_op.lower_bound_ && !lower)) factor *= CardParam::kFilter;
+    // Each edge is produced from both of its endpoints.
+    if (logical_op.common_.direction == EdgeAtom::Direction::BOTH) factor *= 2;
+    cardinality_ *= factor;
+    IncrementCost(CostParam::kScanAllByEdgeTypePropertyRange);
+    return true;
+  }
+
   // TODO: Cost estimate ScanAllById?
 
 // For the given op first increments the cardinality and then cost.
@@ -78,7 +78,11 @@ extern const Event ScanAllByLabelOperator;
 extern const Event ScanAllByLabelPropertyRangeOperator;
 extern const Event ScanAllByLabelPropertyValueOperator;
 extern const Event ScanAllByLabelPropertyOperator;
+extern const Event ScanAllByLabelPropertiesOperator;
 extern const Event ScanAllByIdOperator;
+extern const Event ScanAllByEdgeTypeOperator;
+extern const Event ScanAllByEdgeTypePropertyValueOperator;
+extern const Event ScanAllByEdgeTypePropertyRangeOperator;
 extern const Event ExpandOperator;
 extern const Event ExpandVariableOperator;
 extern const Event ConstructNamedPathOperator;
@@ -462,6 +466,41 @@ UniqueCursorPtr ScanAllByLabel::MakeCursor(utils::MemoryResource *mem) const {
 // TODO(buda): Implement ScanAllByLabelProperty operator to iterate over
 // vertices that have the label and some value for the given property.
 
+namespace {
+
+// Evaluates the expression of a range bound to the property value used for an
+// indexed lookup.
+std::optional<utils::Bound<storage::PropertyValue>> EvaluateRangeBound(
+    ExpressionEvaluator *evaluator, const std::optional<utils::Bound<Expression *>> &bound) {
+  if (!bound) return std::nullopt;
+  const auto &value = bound->value()->Accept(*evaluator);
+  try {
+    const auto &property_value = storage::PropertyValue(value);
+    switch (property_value.type()) {
+      case storage::PropertyValue::Type::Bool:
+      case storage::PropertyValue::Type::List:
+      case storage::PropertyValue::Type::Map:
+        // Prevent indexed lookup with something that would fail if we did
+        // the original filter with `operator<`. Note, for some reason,
+        // Cypher does not support comparing boolean values.
+        throw QueryRuntimeException("Invalid type {} for '<'.", value.type());
+      case storage::PropertyValue::Type::Null:
+      case storage::PropertyValue::Type::Int:
+      case storage::PropertyValue::Type::Double:
+      case storage::PropertyValue::Type::String:
+      case storage::PropertyValue::Type::TemporalData:
+        // These are all fine, there's also Point, Date and Time data types
+        // which were added to Cypher, but we don't have support for those
+        // yet.
+        return std::make_optional(utils::Bound<storage::PropertyValue>(property_value, bound->type()));
+    }
+  } catch (const TypedValueException &) {
+    throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+  }
+}
+
+}  // namespace
+
 ScanAllByLabelPropertyRange::ScanAllByLabelPropertyRange(const std::shared_ptr<LogicalOperator> &input,
                                                          Symbol output_symbol, storage::LabelId label,
                                                          storage::PropertyId property, const std::string &property_name,
@@ -485,35 +524,8 @@ UniqueCursorPtr ScanAllByLabelPropertyRange::MakeCursor(utils::MemoryResource *m
       -> std::optional<decltype(context.db_accessor->Vertices(view_, label_, property_, std::nullopt, std::nullopt))> {
     auto *db = context.db_accessor;
     ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
-    auto convert = [&evaluator](const auto &bound) -> std::optional<utils::Bound<storage::PropertyValue>> {
-      if (!bound) return std::nullopt;
-      const auto &value = bound->value()->Accept(evaluator);
-      try {
-        const auto &property_value = storage::PropertyValue(value);
-        switch (property_value.type()) {
-          case storage::PropertyValue::Type::Bool:
-          case storage::PropertyValue::Type::List:
-          case storage::PropertyValue::Type::Map:
-            // Prevent indexed lookup with something that would fail if we did
-            // the original filter with `operator<`. Note, for some reason,
-            // Cypher does not support comparing boolean values.
-            throw QueryRuntimeException("Invalid type {} for '<'.", value.type());
-          case storage::PropertyValue::Type::Null:
-          case storage::PropertyValue::Type::Int:
-          case storage::PropertyValue::Type::Double:
-          case storage::PropertyValue::Type::String:
-          case storage::PropertyValue::Type::TemporalData:
-            // These are all fine, there's also Point, Date and Time data types
-            // which were added to Cypher, but we don't have support for those
-            // yet.
-            return std::make_optional(utils::Bound<storage::PropertyValue>(property_value, bound->type()));
-        }
-      } catch (const TypedValueException &) {
-        throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
-      }
-    };
-    auto maybe_lower = convert(lower_bound_);
-    auto maybe_upper = convert(upper_bound_);
+    auto maybe_lower = EvaluateRangeBound(&evaluator, lower_bound_);
+    auto maybe_upper = EvaluateRangeBound(&evaluator, upper_bound_);
     // If any bound is null, then the comparison would result in nulls. This
     // is treated as not satisfying the filter, so return no vertices.
     if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
@@ -574,6 +586,56 @@ UniqueCursorPtr ScanAllByLabelProperty::MakeCursor(utils::MemoryResource *mem) c
                                                                 std::move(vertices), "ScanAllByLabelProperty");
 }
 
+ScanAllByLabelProperties::ScanAllByLabelProperties(const std::shared_ptr<LogicalOperator> &input,
+                                                   Symbol output_symbol, storage::LabelId label,
+                                                   const std::vector<storage::PropertyId> &properties,
+                                                   const std::vector<Expression *> &prefix_expressions,
+                                                   std::optional<Bound> lower_bound, std::optional<Bound> upper_bound,
+                                                   storage::View view)
+    : ScanAll(input, output_symbol, view),
+      label_(label),
+      properties_(properties),
+      prefix_expressions_(prefix_expressions),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound) {
+  MG_ASSERT(prefix_expressions_.size() <= properties_.size(), "The prefix can't be longer than the index");
+  MG_ASSERT(!(lower_bound_ || upper_bound_) || prefix_expressions_.size() < properties_.size(),
+            "There is no property left to bound after the prefix");
+  MG_ASSERT(!prefix_expressions_.empty() || lower_bound_ || upper_bound_, "Either a prefix or a bound is required");
+}
+
+ACCEPT_WITH_INPUT(ScanAllByLabelProperties)
+
+UniqueCursorPtr ScanAllByLabelProperties::MakeCursor(utils::MemoryResource *mem) const {
+  EventCounter::IncrementCounter(EventCounter::ScanAllByLabelPropertiesOperator);
+
+  auto vertices = [this](Frame &frame, ExecutionContext &context)
+      -> std::optional<decltype(context.db_accessor->Vertices(view_, label_, properties_, {}, std::nullopt,
+                                                              std::nullopt))> {
+    auto *db = context.db_accessor;
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    std::vector<storage::PropertyValue> prefix;
+    prefix.reserve(prefix_expressions_.size());
+    for (auto *expression : prefix_expressions_) {
+      auto value = expression->Accept(evaluator);
+      if (value.IsNull()) return std::nullopt;
+      if (!value.IsPropertyValue()) {
+        throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+      }
+      prefix.emplace_back(value);
+    }
+    auto maybe_lower = EvaluateRangeBound(&evaluator, lower_bound_);
+    auto maybe_upper = EvaluateRangeBound(&evaluator, upper_bound_);
+    // If any bound is null, then the comparison would result in nulls. This
+    // is treated as not satisfying the filter, so return no vertices.
+    if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
+    if (maybe_upper && maybe_upper->value().IsNull()) return std::nullopt;
+    return std::make_optional(db->Vertices(view_, label_, properties_, prefix, maybe_lower, maybe_upper));
+  };
+  return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(mem, output_symbol_, input_->MakeCursor(mem),
+                                                                std::move(vertices), "ScanAllByLabelProperties");
+}
+
 ScanAllById::ScanAllById(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol, Expression *expression,
                          storage::View view)
     : ScanAll(input, output_symbol, view), expression_(expression) {
@@ -675,7 +737,8 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
     if (MustAbort(context)) throw HintedAbortError();
     // attempt to get a value from the incoming edges
     if (in_edges_ && *in_edges_it_ != in_edges_->end()) {
-      auto edge = *(*in_edges_it_)++;
+      auto edge = **in_edges_it_;
+      ++*in_edges_it_;
       frame[self_.common_.edge_symbol] = edge;
       pull_node(edge, EdgeAtom::Direction::IN);
       return true;
@@ -683,7 +746,8 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
 
     // attempt to get a value from the outgoing edges
     if (out_edges_ && *out_edges_it_ != out_edges_->end()) {
-      auto edge = *(*out_edges_it_)++;
+      auto edge = **out_edges_it_;
+      ++*out_edges_it_;
       // when expanding in EdgeAtom::Direction::BOTH directions
       // we should do only one expansion for cycles, and it was
       // already done in the block above
@@ -731,11 +795,11 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
         // old_node_value may be Null when using optional matching
         if (!existing_node.IsNull()) {
           ExpectType(self_.common_.node_symbol, existing_node, TypedValue::Type::Vertex);
-          in_edges_.emplace(
-              UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types, existing_node.ValueVertex())));
+          in_edges_.emplace(UnwrapEdgesResult(
+              vertex.IterateInEdges(self_.view_, self_.common_.edge_types, existing_node.ValueVertex())));
         }
       } else {
-        in_edges_.emplace(UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types)));
+        in_edges_.emplace(UnwrapEdgesResult(vertex.IterateInEdges(self_.view_, self_.common_.edge_types)));
       }
       if (in_edges_) {
         in_edges_it_.emplace(in_edges_->begin());
@@ -748,11 +812,11 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
         // old_node_value may be Null when using optional matching
         if (!existing_node.IsNull()) {
           ExpectType(self_.common_.node_symbol, existing_node, TypedValue::Type::Vertex);
-          out_edges_.emplace(
-              UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types, existing_node.ValueVertex())));
+          out_edges_.emplace(UnwrapEdgesResult(
+              vertex.IterateOutEdges(self_.view_, self_.common_.edge_types, existing_node.ValueVertex())));
         }
       } else {
-        out_edges_.emplace(UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types)));
+        out_edges_.emplace(UnwrapEdgesResult(vertex.IterateOutEdges(self_.view_, self_.common_.edge_types)));
       }
       if (out_edges_) {
         out_edges_it_.emplace(out_edges_->begin());
@@ -763,6 +827,189 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
   }
 }
 
+ScanAllByEdgeType::ScanAllByEdgeType(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol,
+                                     Symbol node_symbol, Symbol edge_symbol, EdgeAtom::Direction direction,
+                                     storage::EdgeTypeId edge_type, storage::View view)
+    : input_(input ? input : std::make_shared<Once>()),
+      input_symbol_(input_symbol),
+      common_{node_symbol, edge_symbol, direction, {edge_type}, false},
+      view_(view) {}
+
+ACCEPT_WITH_INPUT(ScanAllByEdgeType)
+
+std::vector<Symbol> ScanAllByEdgeType::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = input_->ModifiedSymbols(table);
+  symbols.emplace_back(input_symbol_);
+  symbols.emplace_back(common_.node_symbol);
+  symbols.emplace_back(common_.edge_symbol);
+  return symbols;
+}
+
+namespace {
+
+template <class TEdgesFun>
+class ScanAllByEdgeTypeCursor : public Cursor {
+ public:
+  ScanAllByEdgeTypeCursor(const ScanAllByEdgeType &self, UniqueCursorPtr input_cursor, TEdgesFun get_edges,
+                          const char *op_name)
+      : self_(self), input_cursor_(std::move(input_cursor)), get_edges_(std::move(get_edges)), op_name_(op_name) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    SCOPED_PROFILE_OP(op_name_);
+
+    while (true) {
+      if (MustAbort(context)) throw HintedAbortError();
+
+      // When expanding in EdgeAtom::Direction::BOTH directions, the edge
+      // produced in the previous pull is produced once more starting from its
+      // source vertex.
+      if (reverse_edge_) {
+        auto edge = *reverse_edge_;
+        reverse_edge_ = std::nullopt;
+        SetOnFrame(frame, edge, EdgeAtom::Direction::OUT);
+        return true;
+      }
+
+      if (edges_ && *edges_it_ != edges_->end()) {
+        auto edge = **edges_it_;
+        ++*edges_it_;
+        switch (self_.common_.direction) {
+          case EdgeAtom::Direction::IN:
+          case EdgeAtom::Direction::OUT:
+            SetOnFrame(frame, edge, self_.common_.direction);
+            break;
+          case EdgeAtom::Direction::BOTH:
+            // Cycles are expanded only once, the same as in Expand.
+            SetOnFrame(frame, edge, EdgeAtom::Direction::IN);
+            if (!edge.IsCycle()) reverse_edge_.emplace(edge);
+            break;
+        }
+        return true;
+      }
+
+      if (!input_cursor_->Pull(frame, context)) return false;
+      edges_it_ = std::nullopt;
+      edges_ = std::nullopt;
+      // The same as in ScanAllCursor, a getter function is needed because an
+      // exhausted lazy iterable can't be reset by calling begin().
+      auto next_edges = get_edges_(frame, context);
+      if (!next_edges) continue;
+      edges_.emplace(std::move(next_edges.value()));
+      edges_it_.emplace(edges_->begin());
+    }
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override {
+    input_cursor_->Reset();
+    edges_it_ = std::nullopt;
+    edges_ = std::nullopt;
+    reverse_edge_ = std::nullopt;
+  }
+
+ private:
+  // Places the edge and its endpoints on the frame as if the edge was
+  // expanded from the input vertex in the given direction.
+  void SetOnFrame(Frame &frame, const EdgeAccessor &edge, EdgeAtom::Direction direction) {
+    frame[self_.common_.edge_symbol] = edge;
+    if (direction == EdgeAtom::Direction::IN) {
+      frame[self_.input_symbol_] = edge.To();
+      frame[self_.common_.node_symbol] = edge.From();
+    } else {
+      frame[self_.input_symbol_] = edge.From();
+      frame[self_.common_.node_symbol] = edge.To();
+    }
+  }
+
+  const ScanAllByEdgeType &self_;
+  const UniqueCursorPtr input_cursor_;
+  TEdgesFun get_edges_;
+  std::optional<typename std::result_of<TEdgesFun(Frame &, ExecutionContext &)>::type::value_type> edges_;
+  std::optional<decltype(edges_.value().begin())> edges_it_;
+  std::optional<EdgeAccessor> reverse_edge_;
+  const char *op_name_;
+};
+
+}  // namespace
+
+UniqueCursorPtr ScanAllByEdgeType::MakeCursor(utils::MemoryResource *mem) const {
+  EventCounter::IncrementCounter(EventCounter::ScanAllByEdgeTypeOperator);
+
+  auto edges = [this](Frame &, ExecutionContext &context) {
+    return std::make_optional(context.db_accessor->Edges(view_, common_.edge_types[0]));
+  };
+  return MakeUniqueCursorPtr<ScanAllByEdgeTypeCursor<decltype(edges)>>(mem, *this, input_->MakeCursor(mem),
+                                                                       std::move(edges), "ScanAllByEdgeType");
+}
+
+ScanAllByEdgeTypePropertyValue::ScanAllByEdgeTypePropertyValue(
+    const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, Symbol node_symbol, Symbol edge_symbol,
+    EdgeAtom::Direction direction, storage::EdgeTypeId edge_type, storage::PropertyId property,
+    const std::string &property_name, Expression *expression, storage::View view)
+    : ScanAllByEdgeType(input, input_symbol, node_symbol, edge_symbol, direction, edge_type, view),
+      property_(property),
+      property_name_(property_name),
+      expression_(expression) {
+  DMG_ASSERT(expression, "Expression is not optional.");
+}
+
+ACCEPT_WITH_INPUT(ScanAllByEdgeTypePropertyValue)
+
+UniqueCursorPtr ScanAllByEdgeTypePropertyValue::MakeCursor(utils::MemoryResource *mem) const {
+  EventCounter::IncrementCounter(EventCounter::ScanAllByEdgeTypePropertyValueOperator);
+
+  auto edges = [this](Frame &frame, ExecutionContext &context)
+      -> std::optional<decltype(context.db_accessor->Edges(view_, common_.edge_types[0], property_,
+                                                           storage::PropertyValue()))> {
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    auto value = expression_->Accept(evaluator);
+    if (value.IsNull()) return std::nullopt;
+    if (!value.IsPropertyValue()) {
+      throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+    }
+    return std::make_optional(
+        context.db_accessor->Edges(view_, common_.edge_types[0], property_, storage::PropertyValue(value)));
+  };
+  return MakeUniqueCursorPtr<ScanAllByEdgeTypeCursor<decltype(edges)>>(
+      mem, *this, input_->MakeCursor(mem), std::move(edges), "ScanAllByEdgeTypePropertyValue");
+}
+
+ScanAllByEdgeTypePropertyRange::ScanAllByEdgeTypePropertyRange(
+    const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, Symbol node_symbol, Symbol edge_symbol,
+    EdgeAtom::Direction direction, storage::EdgeTypeId edge_type, storage::PropertyId property,
+    const std::string &property_name, std::optional<Bound> lower_bound, std::optional<Bound> upper_bound,
+    storage::View view)
+    : ScanAllByEdgeType(input, input_symbol, node_symbol, edge_symbol, direction, edge_type, view),
+      property_(property),
+      property_name_(property_name),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound) {
+  MG_ASSERT(lower_bound_ || upper_bound_, "Only one bound can be left out");
+}
+
+ACCEPT_WITH_INPUT(ScanAllByEdgeTypePropertyRange)
+
+UniqueCursorPtr ScanAllByEdgeTypePropertyRange::MakeCursor(utils::MemoryResource *mem) const {
+  EventCounter::IncrementCounter(EventCounter::ScanAllByEdgeTypePropertyRangeOperator);
+
+  auto edges = [this](Frame &frame, ExecutionContext &context)
+      -> std::optional<decltype(context.db_accessor->Edges(view_, common_.edge_types[0], property_, std::nullopt,
+                                                           std::nullopt))> {
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    auto maybe_lower = EvaluateRangeBound(&evaluator, lower_bound_);
+    auto maybe_upper = EvaluateRangeBound(&evaluator, upper_bound_);
+    // If any bound is null, then the comparison would result in nulls. This
+    // is treated as not satisfying the filter, so return no edges.
+    if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
+    if (maybe_upper && maybe_upper->value().IsNull()) return std::nullopt;
+    return std::make_optional(
+        context.db_accessor->Edges(view_, common_.edge_types[0], property_, maybe_lower, maybe_upper));
+  };
+  return MakeUniqueCursorPtr<ScanAllByEdgeTypeCursor<decltype(edges)>>(
+      mem, *this, input_->MakeCursor(mem), std::move(edges), "ScanAllByEdgeTypePropertyRange");
+}
+
 ExpandVariable::ExpandVariable(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, Symbol node_symbol,
                                Symbol edge_symbol, EdgeAtom::Type type, EdgeAtom::Direction direction,
                                const std::vector<storage::EdgeTypeId> &edge_types, bool is_reverse,
@@ -817,16 +1064,16 @@ auto ExpandFromVertex(const VertexAccessor &vertex, EdgeAtom::Direction directio
   };
 
   storage::View view = storage::View::OLD;
-  utils::pmr::vector<decltype(wrapper(direction, *vertex.InEdges(view, edge_types)))> chain_elements(memory);
+  utils::pmr::vector<decltype(wrapper(direction, *vertex.IterateInEdges(view, edge_types)))> chain_elements(memory);
 
   if (direction != EdgeAtom::Direction::OUT) {
-    auto edges = UnwrapEdgesResult(vertex.InEdges(view, edge_types));
+    auto edges = UnwrapEdgesResult(vertex.IterateInEdges(view, edge_types));
     if (edges.begin() != edges.end()) {
       chain_elements.emplace_back(wrapper(EdgeAtom::Direction::IN, std::move(edges)));
     }
   }
   if (direction != EdgeAtom::Direction::IN) {
-    auto edges = UnwrapEdgesResult(vertex.OutEdges(view, edge_types));
+    auto edges = UnwrapEdgesResult(vertex.IterateOutEdges(view, edge_types));
     if (edges.begin() != edges.end()) {
       chain_elements.emplace_back(wrapper(EdgeAtom::Direction::OUT, std::move(edges)));
     }
@@ -1007,7 +1254,8 @@ class ExpandVariableCursor : public Cursor {
 
       // if we are here, we have a valid stack,
       // get the edge, increase the relevant iterator
-      auto current_edge = *edges_it_.back()++;
+      auto current_edge = *edges_it_.back();
+      ++edges_it_.back();
 
       // Check edge-uniqueness.
       bool found_existing =
@@ -1176,7 +1424,7 @@ class STShortestPathCursor : public query::plan::Cursor {
 
       for (const auto &vertex : source_frontier) {
         if (self_.common_.direction != EdgeAtom::Direction::IN) {
-          auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types));
+          auto out_edges = UnwrapEdgesResult(vertex.IterateOutEdges(storage::View::OLD, self_.common_.edge_types));
           for (const auto &edge : out_edges) {
             if (ShouldExpand(edge.To(), edge, frame, evaluator) && !Contains(in_edge, edge.To())) {
               in_edge.emplace(edge.To(), edge);
@@ -1193,7 +1441,7 @@ class STShortestPathCursor : public query::plan::Cursor {
           }
         }
         if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-          auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types));
+          auto in_edges = UnwrapEdgesResult(vertex.IterateInEdges(storage::View::OLD, self_.common_.edge_types));
           for (const auto &edge : in_edges) {
             if (ShouldExpand(edge.From(), edge, frame, evaluator) && !Contains(in_edge, edge.From())) {
               in_edge.emplace(edge.From(), edge);
@@ -1224,7 +1472,7 @@ class STShortestPathCursor : public query::plan::Cursor {
       // reversed.
       for (const auto &vertex : sink_frontier) {
         if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-          auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types));
+          auto out_edges = UnwrapEdgesResult(vertex.IterateOutEdges(storage::View::OLD, self_.common_.edge_types));
           for (const auto &edge : out_edges) {
             if (ShouldExpand(vertex, edge, frame, evaluator) && !Contains(out_edge, edge.To())) {
               out_edge.emplace(edge.To(), edge);
@@ -1241,7 +1489,7 @@ class STShortestPathCursor : public query::plan::Cursor {
           }
         }
         if (self_.common_.direction != EdgeAtom::Direction::IN) {
-          auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types));
+          auto in_edges = UnwrapEdgesResult(vertex.IterateInEdges(storage::View::OLD, self_.common_.edge_types));
           for (const auto &edge : in_edges) {
             if (ShouldExpand(vertex, edge, frame, evaluator) && !Contains(out_edge, edge.From())) {
               out_edge.emplace(edge.From(), edge);
@@ -1317,11 +1565,11 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     // the "where" condition.
     auto expand_from_vertex = [this, &expand_pair](const auto &vertex) {
       if (self_.common_.direction != EdgeAtom::Direction::IN) {
-        auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types));
+        auto out_edges = UnwrapEdgesResult(vertex.IterateOutEdges(storage::View::OLD, self_.common_.edge_types));
         for (const auto &edge : out_edges) expand_pair(edge, edge.To());
       }
       if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-        auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types));
+        auto in_edges = UnwrapEdgesResult(vertex.IterateInEdges(storage::View::OLD, self_.common_.edge_types));
         for (const auto &edge : in_edges) expand_pair(edge, edge.From());
       }
     };
@@ -1479,13 +1727,13 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
     // the "where" condition.
     auto expand_from_vertex = [this, &expand_pair](const VertexAccessor &vertex, double weight, int64_t depth) {
       if (self_.common_.direction != EdgeAtom::Direction::IN) {
-        auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types));
+        auto out_edges = UnwrapEdgesResult(vertex.IterateOutEdges(storage::View::OLD, self_.common_.edge_types));
         for (const auto &edge : out_edges) {
           expand_pair(edge, edge.To(), weight, depth);
         }
       }
       if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-        auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types));
+        auto in_edges = UnwrapEdgesResult(vertex.IterateInEdges(storage::View::OLD, self_.common_.edge_types));
         for (const auto &edge : in_edges) {
           expand_pair(edge, edge.From(), weight, depth);
         }
@@ -84,6 +84,17 @@ bool PlanPrinter::PreVisit(query::plan::ScanAllByLabelProperty &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::ScanAllByLabelProperties &op) {
+  WithPrintLn([&](auto &out) {
+    out << "* ScanAllByLabelProperties"
+        << " (" << op.output_symbol_.name() << " :" << dba_->LabelToName(op.label_) << " {";
+    utils::PrintIterable(out, op.properties_, ", ",
+                         [&](auto &stream, const auto &property) { stream << dba_->PropertyToName(property); });
+    out << "})";
+  });
+  return true;
+}
+
 bool PlanPrinter::PreVisit(ScanAllById &op) {
   WithPrintLn([&](auto &out) {
     out << "* ScanAllById"
@@ -92,6 +103,41 @@ bool PlanPrinter::PreVisit(ScanAllById &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(ScanAllByEdgeType &op) {
+  WithPrintLn([&](auto &out) {
+    out << "* ScanAllByEdgeType (" << op.input_symbol_.name() << ")"
+        << (op.common_.direction == query::EdgeAtom::Direction::IN ? "<-" : "-") << "["
+        << op.common_.edge_symbol.name() << ":" << dba_->EdgeTypeToName(op.common_.edge_types[0]) << "]"
+        << (op.common_.direction == query::EdgeAtom::Direction::OUT ? "->" : "-") << "("
+        << op.common_.node_symbol.name() << ")";
+  });
+  return true;
+}
+
+bool PlanPrinter::PreVisit(ScanAllByEdgeTypePropertyValue &op) {
+  WithPrintLn([&](auto &out) {
+    out << "* ScanAllByEdgeTypePropertyValue (" << op.input_symbol_.name() << ")"
+        << (op.common_.direction == query::EdgeAtom::Direction::IN ? "<-" : "-") << "["
+        << op.common_.edge_symbol.name() << ":" << dba_->EdgeTypeToName(op.common_.edge_types[0]) << " {"
+        << dba_->PropertyToName(op.property_) << "}]"
+        << (op.common_.direction == query::EdgeAtom::Direction::OUT ? "->" : "-") << "("
+        << op.common_.node_symbol.name() << ")";
+  });
+  return true;
+}
+
+bool PlanPrinter::PreVisit(ScanAllByEdgeTypePropertyRange &op) {
+  WithPrintLn([&](auto &out) {
+    out << "* ScanAllByEdgeTypePropertyRange (" << op.input_symbol_.name() << ")"
+        << (op.common_.direction == query::EdgeAtom::Direction::IN ? "<-" : "-") << "["
+        << op.common_.edge_symbol.name() << ":" << dba_->EdgeTypeToName(op.common_.edge_types[0]) << " {"
+        << dba_->PropertyToName(op.property_) << "}]"
+        << (op.common_.direction == query::EdgeAtom::Direction::OUT ? "->" : "-") << "("
+        << op.common_.node_symbol.name() << ")";
+  });
+  return true;
+}
+
 bool PlanPrinter::PreVisit(query::plan::Expand &op) {
   WithPrintLn([&](auto &out) {
     *out_ << "* Expand (" << op.input_symbol_.name() << ")"
@@ -472,6 +518,23 @@ bool PlanToJsonVisitor::PreVisit(ScanAllByLabelProperty &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(ScanAllByLabelProperties &op) {
+  json self;
+  self["name"] = "ScanAllByLabelProperties";
+  self["label"] = ToJson(op.label_, *dba_);
+  self["properties"] = ToJson(op.properties_, *dba_);
+  self["prefix_expressions"] = ToJson(op.prefix_expressions_);
+  self["lower_bound"] = op.lower_bound_ ? ToJson(*op.lower_bound_) : json();
+  self["upper_bound"] = op.upper_bound_ ? ToJson(*op.upper_bound_) : json();
+  self["output_symbol"] = ToJson(op.output_symbol_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(ScanAllById &op) {
   json self;
   self["name"] = "ScanAllById";
@@ -482,6 +545,59 @@ bool PlanToJsonVisitor::PreVisit(ScanAllById &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(ScanAllByEdgeType &op) {
+  json self;
+  self["name"] = "ScanAllByEdgeType";
+  self["input_symbol"] = ToJson(op.input_symbol_);
+  self["node_symbol"] = ToJson(op.common_.node_symbol);
+  self["edge_symbol"] = ToJson(op.common_.edge_symbol);
+  self["edge_type"] = ToJson(op.common_.edge_types[0], *dba_);
+  self["direction"] = ToString(op.common_.direction);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
+bool PlanToJsonVisitor::PreVisit(ScanAllByEdgeTypePropertyValue &op) {
+  json self;
+  self["name"] = "ScanAllByEdgeTypePropertyValue";
+  self["input_symbol"] = ToJson(op.input_symbol_);
+  self["node_symbol"] = ToJson(op.common_.node_symbol);
+  self["edge_symbol"] = ToJson(op.common_.edge_symbol);
+  self["edge_type"] = ToJson(op.common_.edge_types[0], *dba_);
+  self["direction"] = ToString(op.common_.direction);
+  self["property"] = ToJson(op.property_, *dba_);
+  self["expression"] = ToJson(op.expression_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
+bool PlanToJsonVisitor::PreVisit(ScanAllByEdgeTypePropertyRange &op) {
+  json self;
+  self["name"] = "ScanAllByEdgeTypePropertyRange";
+  self["input_symbol"] = ToJson(op.input_symbol_);
+  self["node_symbol"] = ToJson(op.common_.node_symbol);
+  self["edge_symbol"] = ToJson(op.common_.edge_symbol);
+  self["edge_type"] = ToJson(op.common_.edge_types[0], *dba_);
+  self["direction"] = ToString(op.common_.direction);
+  self["property"] = ToJson(op.property_, *dba_);
+  self["lower_bound"] = op.lower_bound_ ? ToJson(*op.lower_bound_) : json();
+  self["upper_bound"] = op.upper_bound_ ? ToJson(*op.upper_bound_) : json();
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(CreateNode &op) {
   json self;
   self["name"] = "CreateNode";
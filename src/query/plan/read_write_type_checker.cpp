@@ -35,7 +35,11 @@ PRE_VISIT(ScanAllByLabel, RWType::R, true)
 PRE_VISIT(ScanAllByLabelPropertyRange, RWType::R, true)
 PRE_VISIT(ScanAllByLabelPropertyValue, RWType::R, true)
 PRE_VISIT(ScanAllByLabelProperty, RWType::R, true)
+PRE_VISIT(ScanAllByLabelProperties, RWType::R, true)
 PRE_VISIT(ScanAllById, RWType::R, true)
+PRE_VISIT(ScanAllByEdgeType, RWType::R, true)
+PRE_VISIT(ScanAllByEdgeTypePropertyValue, RWType::R, true)
+PRE_VISIT(ScanAllByEdgeTypePropertyRange, RWType::R, true)
 
 PRE_VISIT(Expand, RWType::R, true)
 PRE_VISIT(ExpandVariable, RWType::R, true)
@@ -91,7 +91,8 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
   }
 
   // See if it might be better to do ScanAllBy<Index> of the destination and
-  // then do Expand to existing.
+  // then do Expand to existing. Otherwise, an Expand of a single edge type
+  // from an unfiltered ScanAll is replaced with ScanAllByEdgeType.
   bool PostVisit(Expand &expand) override {
     prev_ops_.pop_back();
     if (expand.common_.existing_node) {
@@ -102,6 +103,11 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     if (indexed_scan) {
       expand.set_input(std::move(indexed_scan));
       expand.common_.existing_node = true;
+      return true;
+    }
+    auto edge_type_scan = GenScanByEdgeType(expand);
+    if (edge_type_scan) {
+      SetOnParent(std::move(edge_type_scan));
     }
     return true;
   }
@@ -271,6 +277,15 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ScanAllByLabelProperties &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByLabelProperties &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(ScanAllById &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -280,6 +295,33 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ScanAllByEdgeType &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByEdgeType &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
+  bool PreVisit(ScanAllByEdgeTypePropertyValue &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByEdgeTypePropertyValue &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
+  bool PreVisit(ScanAllByEdgeTypePropertyRange &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByEdgeTypePropertyRange &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(ConstructNamedPath &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -453,6 +495,20 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     int64_t vertex_count;
   };
 
+  struct LabelPropertiesIndex {
+    LabelIx label;
+    std::vector<storage::PropertyId> properties;
+    // FilterInfos with EQUAL PropertyFilter on the leading properties of the
+    // index, in the order of the index properties.
+    std::vector<FilterInfo> prefix_filters;
+    // FilterInfo with RANGE PropertyFilter on the property following the
+    // prefix.
+    std::optional<FilterInfo> range_filter;
+    int64_t vertex_count;
+
+    size_t UsedPropertiesCount() const { return prefix_filters.size() + (range_filter ? 1U : 0U); }
+  };
+
   bool DefaultPreVisit() override { throw utils::NotYetImplemented("optimizing index lookup"); }
 
   void SetOnParent(const std::shared_ptr<LogicalOperator> &input) {
@@ -535,6 +591,59 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return found;
   }
 
+  // Finds the composite index which can use the longest prefix of its
+  // properties for the lookup. The prefix is made of equality filters, and the
+  // property following it may additionally be looked up by a range filter.
+  // Among the indices using the same number of properties, the one which has
+  // indexed the lowest amount of vertices is chosen. If no composite index can
+  // be used, nullopt is returned.
+  std::optional<LabelPropertiesIndex> FindBestLabelPropertiesIndex(const Symbol &symbol,
+                                                                   const std::unordered_set<Symbol> &bound_symbols) {
+    auto are_bound = [&bound_symbols](const auto &used_symbols) {
+      for (const auto &used_symbol : used_symbols) {
+        if (!utils::Contains(bound_symbols, used_symbol)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    const auto property_filters = filters_.PropertyFilters(symbol);
+    auto find_filter = [&](storage::PropertyId property, PropertyFilter::Type type) -> std::optional<FilterInfo> {
+      for (const auto &filter : property_filters) {
+        const auto &property_filter = *filter.property_filter;
+        if (property_filter.type_ != type || property_filter.is_symbol_in_value_ || !are_bound(filter.used_symbols) ||
+            GetProperty(property_filter.property_) != property) {
+          continue;
+        }
+        return filter;
+      }
+      return std::nullopt;
+    };
+    std::optional<LabelPropertiesIndex> found;
+    for (const auto &label : filters_.FilteredLabels(symbol)) {
+      for (auto &properties : db_->LabelPropertyCompositeIndices(GetLabel(label))) {
+        LabelPropertiesIndex candidate{label, std::move(properties), {}, std::nullopt, 0};
+        for (const auto &property : candidate.properties) {
+          auto filter = find_filter(property, PropertyFilter::Type::EQUAL);
+          if (!filter) break;
+          candidate.prefix_filters.push_back(std::move(*filter));
+        }
+        if (candidate.prefix_filters.size() < candidate.properties.size()) {
+          candidate.range_filter =
+              find_filter(candidate.properties[candidate.prefix_filters.size()], PropertyFilter::Type::RANGE);
+        }
+        if (candidate.UsedPropertiesCount() == 0) continue;
+        candidate.vertex_count = db_->VerticesCount(GetLabel(label), candidate.properties);
+        if (!found || candidate.UsedPropertiesCount() > found->UsedPropertiesCount() ||
+            (candidate.UsedPropertiesCount() == found->UsedPropertiesCount() &&
+             candidate.vertex_count < found->vertex_count)) {
+          found = std::move(candidate);
+        }
+      }
+    }
+    return found;
+  }
+
   // Creates a ScanAll by the best possible index for the `node_symbol`. Best
   // index is defined as the index with least number of vertices. If the node
   // does not have at least a label, no indexed lookup can be created and
@@ -575,6 +684,35 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
       return nullptr;
     }
     auto found_index = FindBestLabelPropertyIndex(node_symbol, bound_symbols);
+    // A composite index is used instead of the label+property one when it can
+    // look up more than one property, because the longer prefix narrows down
+    // the scanned vertices the most.
+    auto found_composite_index = FindBestLabelPropertiesIndex(node_symbol, bound_symbols);
+    if (found_composite_index && (found_composite_index->UsedPropertiesCount() > 1 || !found_index) &&
+        (!max_vertex_count || *max_vertex_count >= found_composite_index->vertex_count)) {
+      std::vector<Expression *> prefix_expressions;
+      prefix_expressions.reserve(found_composite_index->prefix_filters.size());
+      for (const auto &filter : found_composite_index->prefix_filters) {
+        prefix_expressions.push_back(filter.property_filter->value_);
+        filter_exprs_for_removal_.insert(filter.expression);
+        filters_.EraseFilter(filter);
+      }
+      std::optional<ScanAllByLabelProperties::Bound> lower_bound;
+      std::optional<ScanAllByLabelProperties::Bound> upper_bound;
+      if (found_composite_index->range_filter) {
+        const auto &filter = *found_composite_index->range_filter;
+        lower_bound = filter.property_filter->lower_bound_;
+        upper_bound = filter.property_filter->upper_bound_;
+        filter_exprs_for_removal_.insert(filter.expression);
+        filters_.EraseFilter(filter);
+      }
+      std::vector<Expression *> removed_expressions;
+      filters_.EraseLabelFilter(node_symbol, found_composite_index->label, &removed_expressions);
+      filter_exprs_for_removal_.insert(removed_expressions.begin(), removed_expressions.end());
+      return std::make_unique<ScanAllByLabelProperties>(input, node_symbol, GetLabel(found_composite_index->label),
+                                                        found_composite_index->properties, prefix_expressions,
+                                                        lower_bound, upper_bound, view);
+    }
     if (found_index &&
         // Use label+property index if we satisfy max_vertex_count.
         (!max_vertex_count || *max_vertex_count >= found_index->vertex_count)) {
@@ -635,6 +773,88 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     filter_exprs_for_removal_.insert(removed_expressions.begin(), removed_expressions.end());
     return std::make_unique<ScanAllByLabel>(input, node_symbol, GetLabel(label), view);
   }
+
+  // Finds the equality or range filter on the edge property which has indexed
+  // the lowest amount of edges of the given type. Equality filters are
+  // preferred over the range filters with the same amount of edges. If there
+  // is no such filter, nullopt is returned.
+  std::optional<FilterInfo> FindBestEdgeTypePropertyFilter(const Symbol &edge_symbol, storage::EdgeTypeId edge_type,
+                                                           const std::unordered_set<Symbol> &bound_symbols) {
+    auto are_bound = [&bound_symbols](const auto &used_symbols) {
+      for (const auto &used_symbol : used_symbols) {
+        if (!utils::Contains(bound_symbols, used_symbol)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    std::optional<FilterInfo> found;
+    int64_t found_edge_count = 0;
+    for (const auto &filter : filters_.PropertyFilters(edge_symbol)) {
+      const auto &property_filter = *filter.property_filter;
+      if (property_filter.type_ != PropertyFilter::Type::EQUAL &&
+          property_filter.type_ != PropertyFilter::Type::RANGE) {
+        continue;
+      }
+      // The same as for vertices, the filter value must not depend on the
+      // scanned edge or on its endpoints.
+      if (property_filter.is_symbol_in_value_ || !are_bound(filter.used_symbols)) continue;
+      const auto property = GetProperty(property_filter.property_);
+      if (!db_->EdgeTypePropertyIndexExists(edge_type, property)) continue;
+      int64_t edge_count = db_->EdgesCount(edge_type, property);
+      if (!found || edge_count < found_edge_count ||
+          (edge_count == found_edge_count && property_filter.type_ == PropertyFilter::Type::EQUAL &&
+           found->property_filter->type_ != PropertyFilter::Type::EQUAL)) {
+        found = filter;
+        found_edge_count = edge_count;
+      }
+    }
+    return found;
+  }
+
+  // Creates a ScanAllByEdgeType which replaces the given `expand` together
+  // with the ScanAll of its input vertex. The expansion must be over a single
+  // indexed edge type and its input must be a plain ScanAll of the input
+  // vertex, i.e. the input vertex isn't filtered before the expansion. If
+  // that's not the case, `nullptr` is returned. When there is an equality or
+  // range filter on an indexed edge property, the edges are scanned by the
+  // edge type+property index instead.
+  std::unique_ptr<ScanAllByEdgeType> GenScanByEdgeType(const Expand &expand) {
+    if (expand.common_.existing_node || expand.common_.edge_types.size() != 1) return nullptr;
+    const auto &input = expand.input();
+    // Subclasses of ScanAll already restrict the input vertices.
+    if (input->GetTypeInfo() != ScanAll::kType) return nullptr;
+    const auto &scan = static_cast<const ScanAll &>(*input);
+    if (scan.output_symbol_ != expand.input_symbol_) return nullptr;
+    const auto edge_type = expand.common_.edge_types[0];
+    // The filters may use the scanned edge itself, but not its endpoints
+    // because they are produced together with the edge.
+    const auto &modified_symbols = scan.input()->ModifiedSymbols(*symbol_table_);
+    std::unordered_set<Symbol> bound_symbols(modified_symbols.begin(), modified_symbols.end());
+    bound_symbols.insert(expand.common_.edge_symbol);
+    auto found_filter = FindBestEdgeTypePropertyFilter(expand.common_.edge_symbol, edge_type, bound_symbols);
+    if (found_filter) {
+      // Copy the property filter and then erase it from filters.
+      const auto prop_filter = *found_filter->property_filter;
+      filter_exprs_for_removal_.insert(found_filter->expression);
+      filters_.EraseFilter(*found_filter);
+      if (prop_filter.lower_bound_ || prop_filter.upper_bound_) {
+        return std::make_unique<ScanAllByEdgeTypePropertyRange>(
+            scan.input(), expand.input_symbol_, expand.common_.node_symbol, expand.common_.edge_symbol,
+            expand.common_.direction, edge_type, GetProperty(prop_filter.property_), prop_filter.property_.name,
+            prop_filter.lower_bound_, prop_filter.upper_bound_, expand.view_);
+      }
+      MG_ASSERT(prop_filter.value_, "Property filter should either have bounds or a value expression.");
+      return std::make_unique<ScanAllByEdgeTypePropertyValue>(
+          scan.input(), expand.input_symbol_, expand.common_.node_symbol, expand.common_.edge_symbol,
+          expand.common_.direction, edge_type, GetProperty(prop_filter.property_), prop_filter.property_.name,
+          prop_filter.value_, expand.view_);
+    }
+    if (!db_->EdgeTypeIndexExists(edge_type)) return nullptr;
+    return std::make_unique<ScanAllByEdgeType>(scan.input(), expand.input_symbol_, expand.common_.node_symbol,
+                                               expand.common_.edge_symbol, expand.common_.direction, edge_type,
+                                               expand.view_);
+  }
 };
 
 }  // namespace impl
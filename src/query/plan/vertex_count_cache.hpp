@@ -13,6 +13,7 @@
 #pragma once
 
 #include <optional>
+#include <vector>
 
 #include "query/typed_value.hpp"
 #include "storage/v2/id_types.hpp"
@@ -72,12 +73,71 @@ class VertexCountCache {
     return bounds_vertex_count.at(bounds);
   }
 
+  // Composite index lookups are rare compared to the single property ones, so
+  // their counts are forwarded without caching.
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties) {
+    return db_->VerticesCount(label, properties);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix) {
+    return db_->VerticesCount(label, properties, prefix);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix,
+                        const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                        const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return db_->VerticesCount(label, properties, prefix, lower, upper);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type) {
+    if (edge_type_edge_count_.find(edge_type) == edge_type_edge_count_.end())
+      edge_type_edge_count_[edge_type] = db_->EdgesCount(edge_type);
+    return edge_type_edge_count_.at(edge_type);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property) {
+    auto key = std::make_pair(edge_type, property);
+    if (edge_type_property_edge_count_.find(key) == edge_type_property_edge_count_.end())
+      edge_type_property_edge_count_[key] = db_->EdgesCount(edge_type, property);
+    return edge_type_property_edge_count_.at(key);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property, const storage::PropertyValue &value) {
+    auto &value_edge_count = property_value_edge_count_[std::make_pair(edge_type, property)];
+    TypedValue tv_value(value);
+    if (value_edge_count.find(tv_value) == value_edge_count.end())
+      value_edge_count[tv_value] = db_->EdgesCount(edge_type, property, value);
+    return value_edge_count.at(tv_value);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property,
+                     const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                     const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    auto &bounds_edge_count = property_bounds_edge_count_[std::make_pair(edge_type, property)];
+    BoundsKey bounds = std::make_pair(lower, upper);
+    if (bounds_edge_count.find(bounds) == bounds_edge_count.end())
+      bounds_edge_count[bounds] = db_->EdgesCount(edge_type, property, lower, upper);
+    return bounds_edge_count.at(bounds);
+  }
+
   bool LabelIndexExists(storage::LabelId label) { return db_->LabelIndexExists(label); }
 
   bool LabelPropertyIndexExists(storage::LabelId label, storage::PropertyId property) {
     return db_->LabelPropertyIndexExists(label, property);
   }
 
+  std::vector<std::vector<storage::PropertyId>> LabelPropertyCompositeIndices(storage::LabelId label) {
+    return db_->LabelPropertyCompositeIndices(label);
+  }
+
+  bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) { return db_->EdgeTypeIndexExists(edge_type); }
+
+  bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) {
+    return db_->EdgeTypePropertyIndexExists(edge_type, property);
+  }
+
  private:
   typedef std::pair<storage::LabelId, storage::PropertyId> LabelPropertyKey;
 
@@ -87,6 +147,14 @@ class VertexCountCache {
     }
   };
 
+  typedef std::pair<storage::EdgeTypeId, storage::PropertyId> EdgeTypePropertyKey;
+
+  struct EdgeTypePropertyHash {
+    size_t operator()(const EdgeTypePropertyKey &key) const {
+      return utils::HashCombine<storage::EdgeTypeId, storage::PropertyId>{}(key.first, key.second);
+    }
+  };
+
   typedef std::pair<std::optional<utils::Bound<storage::PropertyValue>>,
                     std::optional<utils::Bound<storage::PropertyValue>>>
       BoundsKey;
@@ -130,6 +198,16 @@ class VertexCountCache {
   std::unordered_map<LabelPropertyKey, std::unordered_map<BoundsKey, int64_t, BoundsHash, BoundsEqual>,
                      LabelPropertyHash>
       property_bounds_vertex_count_;
+  std::unordered_map<storage::EdgeTypeId, int64_t> edge_type_edge_count_;
+  std::unordered_map<EdgeTypePropertyKey, int64_t, EdgeTypePropertyHash> edge_type_property_edge_count_;
+  std::unordered_map<
+      EdgeTypePropertyKey,
+      std::unordered_map<query::TypedValue, int64_t, query::TypedValue::Hash, query::TypedValue::BoolEqual>,
+      EdgeTypePropertyHash>
+      property_value_edge_count_;
+  std::unordered_map<EdgeTypePropertyKey, std::unordered_map<BoundsKey, int64_t, BoundsHash, BoundsEqual>,
+                     EdgeTypePropertyHash>
+      property_bounds_edge_count_;
 };
 
 template <class TDbAccessor>
@@ -1841,6 +1841,35 @@ mgp_error mgp_vertex_iter_out_edges(mgp_vertex *v, mgp_memory *memory, mgp_edges
       result);
 }
 
+namespace {
+size_t VertexDegree(mgp_vertex *v, mgp_edge_type *type, bool in) {
+  std::vector<storage::EdgeTypeId> edge_types;
+  if (type) edge_types.push_back(v->graph->impl->NameToEdgeType(type->name));
+  auto maybe_degree = in ? v->impl.InDegree(v->graph->view, edge_types) : v->impl.OutDegree(v->graph->view, edge_types);
+  if (maybe_degree.HasError()) {
+    switch (maybe_degree.GetError()) {
+      case storage::Error::DELETED_OBJECT:
+        throw DeletedObjectException{"Cannot get the degree of a deleted vertex!"};
+      case storage::Error::NONEXISTENT_OBJECT:
+        LOG_FATAL("Query modules shouldn't have access to nonexistent objects when getting the degree of a vertex.");
+      case storage::Error::PROPERTIES_DISABLED:
+      case storage::Error::VERTEX_HAS_EDGES:
+      case storage::Error::SERIALIZATION_ERROR:
+        LOG_FATAL("Unexpected error when getting the degree of a vertex.");
+    }
+  }
+  return *maybe_degree;
+}
+}  // namespace
+
+mgp_error mgp_vertex_in_degree(mgp_vertex *v, mgp_edge_type *type, size_t *result) {
+  return WrapExceptions([v, type] { return VertexDegree(v, type, true); }, result);
+}
+
+mgp_error mgp_vertex_out_degree(mgp_vertex *v, mgp_edge_type *type, size_t *result) {
+  return WrapExceptions([v, type] { return VertexDegree(v, type, false); }, result);
+}
+
 mgp_error mgp_edges_iterator_underlying_graph_is_mutable(mgp_edges_iterator *it, int *result) {
   return mgp_vertex_underlying_graph_is_mutable(&it->source_vertex, result);
 }
@@ -2018,6 +2047,40 @@ mgp_error mgp_graph_is_mutable(mgp_graph *graph, int *result) {
   return MGP_ERROR_NO_ERROR;
 };
 
+mgp_error mgp_graph_get_memory_info(mgp_graph *graph, mgp_memory *memory, mgp_map **result) {
+  return WrapExceptions(
+      [graph, memory] {
+        const auto info = graph->impl->GetMemoryInfo();
+        const auto to_value = [](uint64_t bytes) { return storage::PropertyValue(static_cast<int64_t>(bytes)); };
+        std::map<std::string, storage::PropertyValue> labels;
+        for (const auto &[label, bytes] : info.per_label) {
+          labels.emplace(graph->impl->LabelToName(label), to_value(bytes));
+        }
+        std::map<std::string, storage::PropertyValue> edge_types;
+        for (const auto &[edge_type, bytes] : info.per_edge_type) {
+          edge_types.emplace(graph->impl->EdgeTypeToName(edge_type), to_value(bytes));
+        }
+        const std::pair<const char *, storage::PropertyValue> items[] = {
+            {"vertices", to_value(info.vertices)},
+            {"edges", to_value(info.edges)},
+            {"labels", to_value(info.labels)},
+            {"properties", to_value(info.properties)},
+            {"adjacency_lists", to_value(info.adjacency_lists)},
+            {"deltas", to_value(info.deltas)},
+            {"indices", to_value(info.indices)},
+            {"name_id_mapper", to_value(info.name_id_mapper)},
+            {"memory_tracked", to_value(info.memory_tracked)},
+            {"per_label", storage::PropertyValue(std::move(labels))},
+            {"per_edge_type", storage::PropertyValue(std::move(edge_types))}};
+        auto *map = NewRawMgpObject<mgp_map>(memory);
+        for (const auto &[key, value] : items) {
+          map->items.emplace(key, mgp_value(value, memory->impl));
+        }
+        return map;
+      },
+      result);
+}
+
 mgp_error mgp_graph_create_vertex(struct mgp_graph *graph, mgp_memory *memory, mgp_vertex **result) {
   return WrapExceptions(
       [=] {
@@ -0,0 +1,140 @@
+// Copyright 2021 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/edge_ref.hpp"
+#include "storage/v2/id_types.hpp"
+
+namespace storage {
+
+struct Vertex;
+
+/// Adjacency list of a vertex. All edges are stored in a single contiguous
+/// vector, but the entries are kept grouped by their edge type and the groups
+/// are ordered by the edge type id. That allows an expansion filtered by edge
+/// type to locate the matching range with a binary search instead of scanning
+/// all of the edges of the vertex. The order of edges inside a single group is
+/// unspecified.
+///
+/// Both insertion and removal are performed by moving at most one element per
+/// edge type group, so the cost of a modification is O(t * log(n)) where `t` is
+/// the number of distinct edge types of the vertex, instead of O(n) that would
+/// be required to keep the whole vector sorted.
+///
+/// The class isn't thread-safe, all accesses should be guarded by the lock of
+/// the vertex that owns the list.
+class AdjacencyList final {
+ public:
+  using value_type = std::tuple<EdgeTypeId, Vertex *, EdgeRef>;
+  using const_iterator = std::vector<value_type>::const_iterator;
+  using iterator = const_iterator;
+
+  AdjacencyList() = default;
+
+  const_iterator begin() const { return edges_.begin(); }
+  const_iterator end() const { return edges_.end(); }
+
+  size_t size() const { return edges_.size(); }
+  bool empty() const { return edges_.empty(); }
+
+  void reserve(size_t size) { edges_.reserve(size); }
+
+  /// Returns the size in bytes of the buffer that holds the edges.
+  size_t ExternalBufferSize() const { return edges_.capacity() * sizeof(value_type); }
+
+  /// Returns the range of edges that have the edge type `edge_type`. The time
+  /// complexity of this function is O(log(n)).
+  std::pair<const_iterator, const_iterator> EdgeTypeRange(EdgeTypeId edge_type) const {
+    return std::equal_range(edges_.begin(), edges_.end(), edge_type, EdgeTypeCompare{});
+  }
+
+  /// Returns the number of edges that have the edge type `edge_type`. The time
+  /// complexity of this function is O(log(n)).
+  size_t EdgeTypeCount(EdgeTypeId edge_type) const {
+    auto [first, last] = EdgeTypeRange(edge_type);
+    return static_cast<size_t>(last - first);
+  }
+
+  /// Returns an iterator to the given link or `end()` if the link doesn't
+  /// exist. Only the group of the link's edge type is searched.
+  const_iterator Find(const value_type &link) const {
+    auto [first, last] = EdgeTypeRange(std::get<0>(link));
+    auto it = std::find(first, last, link);
+    if (it == last) return edges_.end();
+    return it;
+  }
+
+  /// Inserts the link into its edge type group.
+  /// @throw std::bad_alloc
+  void Insert(const value_type &link) {
+    const auto edge_type = std::get<0>(link);
+    edges_.push_back(link);
+    auto pos = edges_.size() - 1;
+    // Rotate the new element towards the front by swapping it with the first
+    // element of every group that has a larger edge type.
+    while (pos > 0 && std::get<0>(edges_[pos - 1]) > edge_type) {
+      const auto group_edge_type = std::get<0>(edges_[pos - 1]);
+      auto group_begin = std::lower_bound(edges_.begin(), edges_.begin() + pos, group_edge_type, EdgeTypeCompare{}) -
+                         edges_.begin();
+      std::swap(edges_[group_begin], edges_[pos]);
+      pos = group_begin;
+    }
+  }
+
+  /// Inserts a new link into its edge type group.
+  /// @throw std::bad_alloc
+  void Insert(EdgeTypeId edge_type, Vertex *vertex, EdgeRef edge) { Insert(value_type{edge_type, vertex, edge}); }
+
+  /// Removes the given link and returns `true` if the removal took place.
+  /// `false` is returned if the link didn't exist.
+  bool Remove(const value_type &link) {
+    auto it = Find(link);
+    if (it == edges_.end()) return false;
+    auto pos = static_cast<size_t>(it - edges_.begin());
+    // Move the removed element to the end of its group and then hand it over
+    // to the end of every following group. The last element of each following
+    // group takes the freed slot at the front of that group.
+    auto group_last = std::upper_bound(edges_.begin() + pos, edges_.end(), std::get<0>(edges_[pos]),
+                                       EdgeTypeCompare{}) -
+                      edges_.begin() - 1;
+    std::swap(edges_[pos], edges_[group_last]);
+    pos = group_last;
+    while (pos + 1 < edges_.size()) {
+      const auto next_edge_type = std::get<0>(edges_[pos + 1]);
+      auto next_last =
+          std::upper_bound(edges_.begin() + pos + 1, edges_.end(), next_edge_type, EdgeTypeCompare{}) - edges_.begin() -
+          1;
+      std::swap(edges_[pos], edges_[next_last]);
+      pos = next_last;
+    }
+    edges_.pop_back();
+    return true;
+  }
+
+  /// Removes the link that has the given components.
+  bool Remove(EdgeTypeId edge_type, Vertex *vertex, EdgeRef edge) { return Remove(value_type{edge_type, vertex, edge}); }
+
+ private:
+  struct EdgeTypeCompare {
+    bool operator()(const value_type &item, EdgeTypeId edge_type) const { return std::get<0>(item) < edge_type; }
+    bool operator()(EdgeTypeId edge_type, const value_type &item) const { return edge_type < std::get<0>(item); }
+  };
+
+  std::vector<value_type> edges_;
+};
+
+}  // namespace storage
@@ -10,102 +10,170 @@
 // licenses/APL.txt.
 
 #include "storage/v2/commit_log.hpp"
+
+#include <limits>
+
+#include "utils/logging.hpp"
 #include "utils/memory.hpp"
 
 namespace storage {
-CommitLog::CommitLog() : allocator_(utils::NewDeleteResource()) {}
+namespace {
+// Returns the marker shard of the calling thread. The threads are assigned to
+// the shards in a round-robin fashion.
+uint64_t ThreadMarkerShard(uint64_t shards) {
+  static std::atomic<uint64_t> next_shard{0};
+  static thread_local const uint64_t shard = next_shard.fetch_add(1, std::memory_order_relaxed);
+  return shard % shards;
+}
+}  // namespace
+
+CommitLog::CommitLog() : CommitLog(0) {}
 
 CommitLog::CommitLog(uint64_t oldest_active) : allocator_(utils::NewDeleteResource()) {
-  head_ = allocator_.allocate(1);
-  allocator_.construct(head_);
-  head_start_ = oldest_active / kIdsInBlock * kIdsInBlock;
-  next_start_ = head_start_ + kIdsInBlock;
+  free_blocks_->reserve(kMaxFreeBlocks);
+  auto *head = AllocateBlock(oldest_active / kIdsInBlock * kIdsInBlock);
 
   // set all the previous ids
   const auto field_idx = (oldest_active % kIdsInBlock) / kIdsInField;
   for (size_t i = 0; i < field_idx; ++i) {
-    head_->field[i] = std::numeric_limits<uint64_t>::max();
+    head->field[i].store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
   }
 
   const auto idx_in_field = oldest_active % kIdsInField;
   if (idx_in_field != 0) {
-    head_->field[field_idx] = std::numeric_limits<uint64_t>::max();
-    head_->field[field_idx] >>= kIdsInField - idx_in_field;
+    head->field[field_idx].store(std::numeric_limits<uint64_t>::max() >> (kIdsInField - idx_in_field),
+                                 std::memory_order_relaxed);
   }
 
-  oldest_active_ = oldest_active;
+  head_.store(head);
+  oldest_active_.store(oldest_active);
 }
 
 CommitLog::~CommitLog() {
-  while (head_) {
-    Block *tmp = head_->next;
-    head_->~Block();
-    allocator_.deallocate(head_, 1);
-    head_ = tmp;
+  Block *head = head_.load();
+  while (head) {
+    Block *tmp = head->next.load();
+    allocator_.delete_object(head);
+    head = tmp;
+  }
+  for (auto &retired : retired_) {
+    for (auto *block : retired) {
+      allocator_.delete_object(block);
+    }
   }
+  free_blocks_.WithLock([this](auto &free_blocks) {
+    for (auto *block : free_blocks) {
+      allocator_.deallocate(block, 1);
+    }
+  });
 }
 
 void CommitLog::MarkFinished(uint64_t id) {
-  std::lock_guard<utils::SpinLock> guard(lock_);
-
+  // The epoch and the counter are accessed before the head is loaded, see
+  // `FreeRetiredBlocks`.
+  auto &active = marker_shards_[ThreadMarkerShard(kMarkerShards)].active[epoch_.load() % 2];
+  active.fetch_add(1);
   Block *block = FindOrCreateBlock(id);
-  block->field[(id % kIdsInBlock) / kIdsInField] |= 1ULL << (id % kIdsInField);
-  if (id == oldest_active_) {
-    UpdateOldestActive();
-  }
+  block->field[(id - block->start) / kIdsInField].fetch_or(1ULL << (id % kIdsInField), std::memory_order_release);
+  active.fetch_sub(1, std::memory_order_release);
 }
 
 uint64_t CommitLog::OldestActive() {
-  std::lock_guard<utils::SpinLock> guard(lock_);
-  return oldest_active_;
+  if (!advancing_.exchange(true, std::memory_order_acquire)) {
+    UpdateOldestActive();
+    advancing_.store(false, std::memory_order_release);
+  }
+  return oldest_active_.load(std::memory_order_acquire);
 }
 
 void CommitLog::UpdateOldestActive() {
-  while (head_) {
+  auto oldest_active = oldest_active_.load(std::memory_order_relaxed);
+  Block *head = head_.load();
+  while (true) {
     // This is necessary for amortized constant complexity. If we always start
     // from the 0th field, the amount of steps we make through each block is
     // quadratic in kBlockSize.
-    uint64_t start_field = oldest_active_ >= head_start_ ? (oldest_active_ - head_start_) / kIdsInField : 0;
-    for (uint64_t i = start_field; i < kBlockSize; ++i) {
-      if (head_->field[i] != std::numeric_limits<uint64_t>::max()) {
-        oldest_active_ = head_start_ + i * kIdsInField + __builtin_ffsl(~head_->field[i]) - 1;
+    for (uint64_t i = (oldest_active - head->start) / kIdsInField; i < kBlockSize; ++i) {
+      const auto field = head->field[i].load(std::memory_order_acquire);
+      if (field != std::numeric_limits<uint64_t>::max()) {
+        oldest_active_.store(head->start + i * kIdsInField + __builtin_ctzll(~field), std::memory_order_release);
+        FreeRetiredBlocks();
         return;
       }
     }
 
-    // All IDs in this block are marked, we can delete it now.
-    Block *tmp = head_->next;
-    head_->~Block();
-    allocator_.deallocate(head_, 1);
-    head_ = tmp;
-    head_start_ += kIdsInBlock;
+    // All IDs in this block are marked, it can be freed once no thread that
+    // could have seen it is traversing the blocks.
+    Block *next = NextBlock(head);
+    head_.store(next);
+    retired_[epoch_.load(std::memory_order_relaxed) % 2].push_back(head);
+    head = next;
+    oldest_active = head->start;
   }
-
-  oldest_active_ = next_start_;
 }
 
 CommitLog::Block *CommitLog::FindOrCreateBlock(const uint64_t id) {
-  if (!head_) {
-    head_ = allocator_.allocate(1);
-    allocator_.construct(head_);
-    head_start_ = next_start_;
-    next_start_ += kIdsInBlock;
+  Block *current = head_.load();
+  DMG_ASSERT(id >= current->start, "Transaction {} is already marked as finished!", id);
+  while (id >= current->start + kIdsInBlock) {
+    current = NextBlock(current);
   }
+  return current;
+}
 
-  Block *current = head_;
-  uint64_t current_start = head_start_;
+CommitLog::Block *CommitLog::NextBlock(Block *block) {
+  Block *next = block->next.load(std::memory_order_acquire);
+  if (next) return next;
 
-  while (id >= current_start + kIdsInBlock) {
-    if (!current->next) {
-      current->next = allocator_.allocate(1);
-      allocator_.construct(current->next);
-      next_start_ += kIdsInBlock;
-    }
+  auto *new_block = AllocateBlock(block->start + kIdsInBlock);
+  if (block->next.compare_exchange_strong(next, new_block, std::memory_order_acq_rel)) {
+    return new_block;
+  }
+  // Another thread appended the block first.
+  DeallocateBlock(new_block);
+  return next;
+}
 
-    current = current->next;
-    current_start += kIdsInBlock;
+void CommitLog::FreeRetiredBlocks() {
+  // The blocks retired in the epoch `epoch` are in `retired_[epoch % 2]`. The
+  // markers that could have loaded the head before a block was retired are
+  // registered for the epoch in which the block was retired or the one before
+  // it. The epoch is advanced only when no marker of the previous epoch is
+  // running, so when no marker of the previous epoch is running, none can
+  // reach the blocks retired in it. The head is replaced before the counters
+  // are checked and the markers register before they load the head, so a
+  // marker that registers after the check can't reach the retired blocks.
+  const auto epoch = epoch_.load(std::memory_order_relaxed);
+  const auto previous = (epoch + 1) % 2;
+  for (const auto &shard : marker_shards_) {
+    if (shard.active[previous].load() != 0) return;
   }
+  for (auto *block : retired_[previous]) {
+    DeallocateBlock(block);
+  }
+  retired_[previous].clear();
+  if (!retired_[epoch % 2].empty()) epoch_.store(epoch + 1);
+}
 
-  return current;
+CommitLog::Block *CommitLog::AllocateBlock(uint64_t start) {
+  Block *block = free_blocks_.WithLock([](auto &free_blocks) -> Block * {
+    if (free_blocks.empty()) return nullptr;
+    auto *block = free_blocks.back();
+    free_blocks.pop_back();
+    return block;
+  });
+  if (!block) block = allocator_.allocate(1);
+  allocator_.construct(block, start);
+  return block;
+}
+
+void CommitLog::DeallocateBlock(Block *block) {
+  allocator_.destroy(block);
+  const bool reused = free_blocks_.WithLock([block](auto &free_blocks) {
+    if (free_blocks.size() >= kMaxFreeBlocks) return false;
+    free_blocks.push_back(block);
+    return true;
+  });
+  if (!reused) allocator_.deallocate(block, 1);
 }
 }  // namespace storage
@@ -12,11 +12,13 @@
 /// @file commit_log.hpp
 #pragma once
 
+#include <atomic>
 #include <cstdint>
-#include <mutex>
+#include <vector>
 
 #include "utils/memory.hpp"
 #include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
 
 namespace storage {
 
@@ -29,10 +31,18 @@ namespace storage {
 /// SetFinished) and retrieve the minimal ID still in the set (\ref
 /// OldestActive).
 ///
-/// This class is thread-safe.
+/// This class is thread-safe and lock-free except for the pool of free blocks,
+/// which is used once per block. Marking an ID only sets its bit, the oldest
+/// active ID is advanced lazily by \ref OldestActive.
+///
+/// The blocks whose IDs are all marked are removed from the list by \ref
+/// OldestActive and freed using epoch-based reclamation. Each \ref MarkFinished
+/// call registers itself for the current epoch in one of several shards of
+/// counters, so the calls from different threads don't share a counter. A
+/// removed block is freed once the epoch has moved on and no call registered
+/// for an epoch in which the block could have been reached is still running.
 class CommitLog final {
  public:
-  // TODO(mtomic): use pool allocator for blocks
   CommitLog();
   /// Create a commit log which has the oldest active id set to
   /// oldest_active
@@ -50,17 +60,29 @@ class CommitLog final {
   /// @throw std::bad_alloc
   void MarkFinished(uint64_t id);
 
-  /// Retrieve the oldest transaction still not marked as finished.
+  /// Retrieve the oldest transaction still not marked as finished. While
+  /// another thread is advancing the oldest active ID, the value advanced so
+  /// far is returned. It can be lower than the actual oldest active ID, but
+  /// never higher.
+  /// @throw std::bad_alloc
   uint64_t OldestActive();
 
  private:
   static constexpr uint64_t kBlockSize = 8192;
   static constexpr uint64_t kIdsInField = sizeof(uint64_t) * 8;
   static constexpr uint64_t kIdsInBlock = kBlockSize * kIdsInField;
+  // Maximum number of freed blocks kept for reuse.
+  static constexpr uint64_t kMaxFreeBlocks = 4;
+  // Number of shards of the counters of the running `MarkFinished` calls.
+  static constexpr uint64_t kMarkerShards = 16;
 
   struct Block {
-    Block *next{nullptr};
-    uint64_t field[kBlockSize]{};
+    explicit Block(uint64_t start) : start(start) {}
+
+    std::atomic<Block *> next{nullptr};
+    // The first ID in the block.
+    const uint64_t start;
+    std::atomic<uint64_t> field[kBlockSize]{};
   };
 
   void UpdateOldestActive();
@@ -68,11 +90,35 @@ class CommitLog final {
   /// @throw std::bad_alloc
   Block *FindOrCreateBlock(uint64_t id);
 
-  Block *head_{nullptr};
-  uint64_t head_start_{0};
-  uint64_t next_start_{0};
-  uint64_t oldest_active_{0};
-  utils::SpinLock lock_;
+  /// @throw std::bad_alloc
+  Block *NextBlock(Block *block);
+
+  // Frees the retired blocks that can't be reached by the running
+  // `MarkFinished` calls anymore and advances the epoch if needed.
+  void FreeRetiredBlocks();
+
+  /// @throw std::bad_alloc
+  Block *AllocateBlock(uint64_t start);
+  void DeallocateBlock(Block *block);
+
+  // Numbers of `MarkFinished` calls that are currently traversing the blocks,
+  // by the parity of the epoch they registered for.
+  struct alignas(64) MarkerShard {
+    std::atomic<uint64_t> active[2]{};
+  };
+
+  std::atomic<Block *> head_{nullptr};
+  std::atomic<uint64_t> oldest_active_{0};
+  // Advanced only by the thread that advances the oldest active ID.
+  std::atomic<uint64_t> epoch_{0};
+  MarkerShard marker_shards_[kMarkerShards];
+  // Set while a thread is advancing the oldest active ID. The retired blocks
+  // are accessed only by that thread.
+  std::atomic<bool> advancing_{false};
+  // Blocks removed from the list, by the parity of the epoch in which they
+  // were removed.
+  std::vector<Block *> retired_[2];
+  utils::Synchronized<std::vector<Block *>, utils::SpinLock> free_blocks_;
   utils::Allocator<Block> allocator_;
 };
 
@@ -27,34 +27,74 @@ struct Config {
 
     Type type{Type::PERIODIC};
     std::chrono::milliseconds interval{std::chrono::milliseconds(1000)};
+    // Number of threads (including the GC thread itself) used to unlink
+    // deltas, clean up the indices and free the deleted objects.
+    uint64_t num_threads{1};
   } gc;
 
   struct Items {
     bool properties_on_edges{true};
+    // Vertices are looked up by their gid in a dense table instead of the
+    // vertex skip list. The table uses 8 bytes per allocated gid.
+    bool vertex_lookup_table{false};
   } items;
 
   struct Durability {
     enum class SnapshotWalMode { DISABLED, PERIODIC_SNAPSHOT, PERIODIC_SNAPSHOT_WITH_WAL };
+    enum class Compression { NONE, LZ4 };
 
     std::filesystem::path storage_directory{"storage"};
 
     bool recover_on_startup{false};
+    // Number of threads used to load the snapshot, to apply the WAL
+    // transactions and to fill the indices during the recovery. The indices are filled with at least
+    // `schema_creation.num_threads` threads.
+    uint64_t recovery_thread_count{1};
 
     SnapshotWalMode snapshot_wal_mode{SnapshotWalMode::DISABLED};
 
     std::chrono::milliseconds snapshot_interval{std::chrono::minutes(2)};
     uint64_t snapshot_retention_count{3};
+    // Number of threads used to write the edges and vertices of a snapshot.
+    // Each thread writes its own segments of the snapshot.
+    uint64_t snapshot_thread_count{1};
+    // Number of incremental snapshots created between two full snapshots. An
+    // incremental snapshot contains only the objects modified since the
+    // previous snapshot. `0` creates only full snapshots.
+    uint64_t snapshot_incremental_count{0};
 
     uint64_t wal_file_size_kibibytes{20 * 1024};
     uint64_t wal_file_flush_every_n_tx{100000};
 
+    // Commits return only after their WAL records are synced, and the new
+    // transactions see a commit only after it is synced. The records of
+    // concurrent commits are synced together by a single thread, which waits
+    // at most `wal_group_commit_max_latency` for more commits to join a batch.
+    // `wal_file_flush_every_n_tx` isn't used when this is enabled.
+    bool wal_group_commit{false};
+    std::chrono::microseconds wal_group_commit_max_latency{0};
+
     bool snapshot_on_exit{false};
 
+    // Codec used to compress the snapshots and the WAL files in blocks. The
+    // files are still seekable because each block is compressed on its own.
+    Compression compression{Compression::NONE};
+
   } durability;
 
   struct Transaction {
     IsolationLevel isolation_level{IsolationLevel::SNAPSHOT_ISOLATION};
   } transaction;
+
+  struct SchemaCreation {
+    // Number of threads used to fill new indices and to validate the existing
+    // vertices against new constraints.
+    uint64_t num_threads{1};
+    // Label and label+property indices are filled while the transactions keep
+    // running, the storage is locked only to register the index and to mark it
+    // as ready.
+    bool online_index_build{false};
+  } schema_creation;
 };
 
 }  // namespace storage
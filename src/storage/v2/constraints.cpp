@@ -56,10 +56,10 @@ bool LastCommittedVersionHasLabelProperty(const Vertex &vertex, LabelId label, c
   bool deleted;
   bool has_label;
   {
-    std::lock_guard<utils::SpinLock> guard(vertex.lock);
+    std::lock_guard<utils::SeqLock> guard(vertex.lock);
     delta = vertex.delta;
     deleted = vertex.deleted;
-    has_label = utils::Contains(vertex.labels, label);
+    has_label = vertex.labels.Contains(label);
 
     size_t i = 0;
     for (const auto &property : properties) {
@@ -141,8 +141,8 @@ bool AnyVersionHasLabelProperty(const Vertex &vertex, LabelId label, const std::
   bool deleted;
   Delta *delta;
   {
-    std::lock_guard<utils::SpinLock> guard(vertex.lock);
-    has_label = utils::Contains(vertex.labels, label);
+    std::lock_guard<utils::SeqLock> guard(vertex.lock);
+    has_label = vertex.labels.Contains(label);
     deleted = vertex.deleted;
     delta = vertex.delta;
 
@@ -267,7 +267,7 @@ bool UniqueConstraints::Entry::operator==(const std::vector<PropertyValue> &rhs)
 
 void UniqueConstraints::UpdateBeforeCommit(const Vertex *vertex, const Transaction &tx) {
   for (auto &[label_props, storage] : constraints_) {
-    if (!utils::Contains(vertex->labels, label_props.first)) {
+    if (!vertex->labels.Contains(label_props.first)) {
       continue;
     }
     auto values = ExtractPropertyValues(*vertex, label_props.second);
@@ -279,7 +279,8 @@ void UniqueConstraints::UpdateBeforeCommit(const Vertex *vertex, const Transacti
 }
 
 utils::BasicResult<ConstraintViolation, UniqueConstraints::CreationStatus> UniqueConstraints::CreateConstraint(
-    LabelId label, const std::set<PropertyId> &properties, utils::SkipList<Vertex>::Accessor vertices) {
+    LabelId label, const std::set<PropertyId> &properties, utils::SkipList<Vertex>::Accessor vertices,
+    uint64_t num_threads) {
   if (properties.empty()) {
     return CreationStatus::EMPTY_PROPERTIES;
   }
@@ -300,24 +301,39 @@ utils::BasicResult<ConstraintViolation, UniqueConstraints::CreationStatus> Uniqu
   {
     auto acc = constraint->second.access();
 
-    for (const Vertex &vertex : vertices) {
-      if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
-        continue;
+    auto validate = [&](Vertex &vertex) {
+      if (vertex.deleted || !vertex.labels.Contains(label)) {
+        return true;
       }
       auto values = ExtractPropertyValues(vertex, properties);
       if (!values) {
-        continue;
+        return true;
       }
 
       // Check whether there already is a vertex with the same values for the
       // given label and property.
       auto it = acc.find_equal_or_greater(*values);
       if (it != acc.end() && it->values == *values) {
-        violation_found = true;
-        break;
+        return false;
       }
 
       acc.insert(Entry{std::move(*values), &vertex, 0});
+      return true;
+    };
+    violation_found = !ParallelScanVertices(&vertices, num_threads, "Unique constraint validation", validate);
+
+    if (!violation_found && num_threads > 1) {
+      // Two threads could have inserted vertices with the same values at the
+      // same time without noticing each other. Such entries are adjacent in
+      // the constraint storage because the entries are sorted by the values.
+      const Entry *prev = nullptr;
+      for (const auto &entry : acc) {
+        if (prev != nullptr && prev->values == entry.values) {
+          violation_found = true;
+          break;
+        }
+        prev = &entry;
+      }
     }
   }
 
@@ -352,7 +368,7 @@ std::optional<ConstraintViolation> UniqueConstraints::Validate(const Vertex &ver
   for (const auto &[label_props, storage] : constraints_) {
     const auto &label = label_props.first;
     const auto &properties = label_props.second;
-    if (!utils::Contains(vertex.labels, label)) {
+    if (!vertex.labels.Contains(label)) {
       continue;
     }
 
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "storage/v2/id_types.hpp"
+#include "storage/v2/parallel_vertex_scan.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex.hpp"
 #include "utils/logging.hpp"
@@ -104,11 +105,13 @@ class UniqueConstraints {
   /// given list of properties is empty,
   /// `CreationStatus::PROPERTIES_SIZE_LIMIT_EXCEEDED` if the list of properties
   /// exceeds the maximum allowed number of properties, and
-  /// `CreationStatus::SUCCESS` on success.
+  /// `CreationStatus::SUCCESS` on success. The existing vertices are validated
+  /// using `num_threads` threads.
   /// @throw std::bad_alloc
   utils::BasicResult<ConstraintViolation, CreationStatus> CreateConstraint(LabelId label,
                                                                            const std::set<PropertyId> &properties,
-                                                                           utils::SkipList<Vertex>::Accessor vertices);
+                                                                           utils::SkipList<Vertex>::Accessor vertices,
+                                                                           uint64_t num_threads);
 
   /// Deletes the specified constraint. Returns `DeletionStatus::NOT_FOUND` if
   /// there is not such constraint in the storage,
@@ -148,19 +151,22 @@ struct Constraints {
 /// Adds a unique constraint to `constraints`. Returns true if the constraint
 /// was successfully added, false if it already exists and a
 /// `ConstraintViolation` if there is an existing vertex violating the
-/// constraint.
+/// constraint. The existing vertices are validated using `num_threads`
+/// threads.
 ///
 /// @throw std::bad_alloc
 /// @throw std::length_error
 inline utils::BasicResult<ConstraintViolation, bool> CreateExistenceConstraint(
-    Constraints *constraints, LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices) {
+    Constraints *constraints, LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+    uint64_t num_threads) {
   if (utils::Contains(constraints->existence_constraints, std::make_pair(label, property))) {
     return false;
   }
-  for (const auto &vertex : vertices) {
-    if (!vertex.deleted && utils::Contains(vertex.labels, label) && !vertex.properties.HasProperty(property)) {
-      return ConstraintViolation{ConstraintViolation::Type::EXISTENCE, label, std::set<PropertyId>{property}};
-    }
+  auto valid = ParallelScanVertices(&vertices, num_threads, "Existence constraint validation", [&](Vertex &vertex) {
+    return vertex.deleted || !vertex.labels.Contains(label) || vertex.properties.HasProperty(property);
+  });
+  if (!valid) {
+    return ConstraintViolation{ConstraintViolation::Type::EXISTENCE, label, std::set<PropertyId>{property}};
   }
   constraints->existence_constraints.emplace_back(label, property);
   return true;
@@ -184,7 +190,7 @@ inline bool DropExistenceConstraint(Constraints *constraints, LabelId label, Pro
 [[nodiscard]] inline std::optional<ConstraintViolation> ValidateExistenceConstraints(const Vertex &vertex,
                                                                                      const Constraints &constraints) {
   for (const auto &[label, property] : constraints.existence_constraints) {
-    if (!vertex.deleted && utils::Contains(vertex.labels, label) && !vertex.properties.HasProperty(property)) {
+    if (!vertex.deleted && vertex.labels.Contains(label) && !vertex.properties.HasProperty(property)) {
       return ConstraintViolation{ConstraintViolation::Type::EXISTENCE, label, std::set<PropertyId>{property}};
     }
   }
@@ -0,0 +1,207 @@
+// Copyright 2021 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include "storage/v2/delta.hpp"
+
+namespace storage {
+
+/// Container that holds the deltas (undo buffer) of a single transaction.
+///
+/// The deltas are constructed in place inside of memory blocks that are
+/// chained into a singly linked list. A delta is never moved after it is
+/// created, so pointers to it stay valid until the container is destroyed,
+/// which is required because the deltas are linked into the version chains of
+/// vertices and edges. Compared to `std::list<Delta>` this avoids one heap
+/// allocation and two list pointers per delta.
+///
+/// The first block is small so that short transactions don't waste memory and
+/// every following block is twice as large as the previous one, up to
+/// `kMaxBlockCapacity` deltas. All deltas are destroyed and all blocks are
+/// released at once when the container is destroyed or cleared.
+///
+/// The container isn't thread-safe. Only the transaction that owns it (or the
+/// GC once the transaction is finished) may modify it.
+class DeltaContainer final {
+ private:
+  struct alignas(Delta) Block {
+    explicit Block(uint64_t capacity) : capacity(capacity) {}
+
+    Delta *Items() { return reinterpret_cast<Delta *>(this + 1); }
+    const Delta *Items() const { return reinterpret_cast<const Delta *>(this + 1); }
+
+    Block *next{nullptr};
+    uint64_t capacity;
+    uint64_t size{0};
+  };
+
+  static_assert(alignof(Delta) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                "The blocks must be suitably aligned for the deltas!");
+
+ public:
+  static constexpr uint64_t kInitialBlockCapacity = 8;
+  static constexpr uint64_t kMaxBlockCapacity = 1024;
+
+  template <typename TValue, typename TBlock>
+  class IteratorBase final {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Delta;
+    using difference_type = std::ptrdiff_t;
+    using pointer = TValue *;
+    using reference = TValue &;
+
+    IteratorBase() = default;
+    explicit IteratorBase(TBlock *block) : block_(block) { SkipEmptyBlocks(); }
+
+    reference operator*() const { return block_->Items()[index_]; }
+    pointer operator->() const { return &block_->Items()[index_]; }
+
+    IteratorBase &operator++() {
+      ++index_;
+      SkipEmptyBlocks();
+      return *this;
+    }
+
+    IteratorBase operator++(int) {
+      IteratorBase old(*this);
+      ++(*this);
+      return old;
+    }
+
+    bool operator==(const IteratorBase &other) const { return block_ == other.block_ && index_ == other.index_; }
+    bool operator!=(const IteratorBase &other) const { return !(*this == other); }
+
+   private:
+    // A block can be left empty only if a delta constructor has thrown.
+    void SkipEmptyBlocks() {
+      while (block_ != nullptr && index_ == block_->size) {
+        block_ = block_->next;
+        index_ = 0;
+      }
+    }
+
+    TBlock *block_{nullptr};
+    uint64_t index_{0};
+  };
+
+  using iterator = IteratorBase<Delta, Block>;
+  using const_iterator = IteratorBase<const Delta, const Block>;
+
+  DeltaContainer() = default;
+
+  DeltaContainer(DeltaContainer &&other) noexcept
+      : head_(std::exchange(other.head_, nullptr)),
+        tail_(std::exchange(other.tail_, nullptr)),
+        size_(std::exchange(other.size_, 0)) {}
+
+  DeltaContainer &operator=(DeltaContainer &&other) noexcept {
+    if (this == &other) return *this;
+    clear();
+    head_ = std::exchange(other.head_, nullptr);
+    tail_ = std::exchange(other.tail_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    return *this;
+  }
+
+  DeltaContainer(const DeltaContainer &) = delete;
+  DeltaContainer &operator=(const DeltaContainer &) = delete;
+
+  ~DeltaContainer() { clear(); }
+
+  /// Constructs a new delta at the end of the container and returns a
+  /// reference to it. The reference stays valid until the container is
+  /// destroyed or cleared.
+  /// @throw std::bad_alloc
+  template <typename... TArgs>
+  Delta &emplace_back(TArgs &&...args) {
+    if (tail_ == nullptr || tail_->size == tail_->capacity) {
+      AllocateBlock();
+    }
+    auto *delta = new (tail_->Items() + tail_->size) Delta(std::forward<TArgs>(args)...);
+    ++tail_->size;
+    ++size_;
+    return *delta;
+  }
+
+  /// Destroys all deltas in the order in which they were created and releases
+  /// all memory blocks.
+  void clear() {
+    while (head_ != nullptr) {
+      Block *next = head_->next;
+      auto *items = head_->Items();
+      for (uint64_t i = 0; i < head_->size; ++i) {
+        items[i].~Delta();
+      }
+      allocated_bytes_.fetch_sub(BlockSize(head_->capacity), std::memory_order_relaxed);
+      head_->~Block();
+      ::operator delete(head_);
+      head_ = next;
+    }
+    tail_ = nullptr;
+    size_ = 0;
+  }
+
+  bool empty() const { return size_ == 0; }
+  uint64_t size() const { return size_; }
+
+  /// Returns the number of bytes in the memory blocks that are currently
+  /// allocated by all containers.
+  static uint64_t AllocatedBytes() { return allocated_bytes_.load(std::memory_order_relaxed); }
+
+  /// Calls `func(Delta *deltas, uint64_t count)` for each non-empty memory
+  /// block of the container. The blocks are disjoint, so they can be processed
+  /// independently of each other (e.g. by different threads).
+  template <typename TFunc>
+  void ForEachBlock(TFunc &&func) {
+    for (Block *block = head_; block != nullptr; block = block->next) {
+      if (block->size != 0) func(block->Items(), block->size);
+    }
+  }
+
+  iterator begin() { return iterator(head_); }
+  iterator end() { return iterator(); }
+  const_iterator begin() const { return const_iterator(head_); }
+  const_iterator end() const { return const_iterator(); }
+
+ private:
+  static uint64_t BlockSize(uint64_t capacity) { return sizeof(Block) + capacity * sizeof(Delta); }
+
+  void AllocateBlock() {
+    uint64_t capacity = tail_ == nullptr ? kInitialBlockCapacity : std::min(tail_->capacity * 2, kMaxBlockCapacity);
+    void *memory = ::operator new(BlockSize(capacity));
+    allocated_bytes_.fetch_add(BlockSize(capacity), std::memory_order_relaxed);
+    auto *block = new (memory) Block(capacity);
+    if (tail_ == nullptr) {
+      head_ = block;
+    } else {
+      tail_->next = block;
+    }
+    tail_ = block;
+  }
+
+  Block *head_{nullptr};
+  Block *tail_{nullptr};
+  uint64_t size_{0};
+
+  inline static std::atomic<uint64_t> allocated_bytes_{0};
+};
+
+}  // namespace storage
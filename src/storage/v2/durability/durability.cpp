@@ -70,7 +70,8 @@ std::vector<SnapshotDurabilityInfo> GetSnapshotFiles(const std::filesystem::path
       try {
         auto info = ReadSnapshotInfo(item.path());
         if (uuid.empty() || info.uuid == uuid) {
-          snapshot_files.emplace_back(item.path(), std::move(info.uuid), info.start_timestamp);
+          snapshot_files.emplace_back(item.path(), std::move(info.uuid), info.start_timestamp, info.base_start_timestamp,
+                                      info.previous_start_timestamp);
         }
       } catch (const RecoveryFailure &) {
         continue;
@@ -82,6 +83,22 @@ std::vector<SnapshotDurabilityInfo> GetSnapshotFiles(const std::filesystem::path
   return snapshot_files;
 }
 
+std::optional<std::vector<const SnapshotDurabilityInfo *>> GetSnapshotChain(
+    const std::vector<SnapshotDurabilityInfo> &snapshot_files, const SnapshotDurabilityInfo &snapshot) {
+  std::vector<const SnapshotDurabilityInfo *> chain{&snapshot};
+  while (chain.back()->IsIncremental()) {
+    const auto *current = chain.back();
+    auto previous = std::find_if(snapshot_files.begin(), snapshot_files.end(), [current](const auto &file) {
+      return file.uuid == current->uuid && file.start_timestamp == current->previous_start_timestamp &&
+             file.base_start_timestamp == current->base_start_timestamp;
+    });
+    if (previous == snapshot_files.end()) return std::nullopt;
+    chain.push_back(&*previous);
+  }
+  std::reverse(chain.begin(), chain.end());
+  return chain;
+}
+
 std::optional<std::vector<WalDurabilityInfo>> GetWalFiles(const std::filesystem::path &wal_directory,
                                                           const std::string_view uuid,
                                                           const std::optional<size_t> current_seq_num) {
@@ -112,12 +129,12 @@ std::optional<std::vector<WalDurabilityInfo>> GetWalFiles(const std::filesystem:
 // to ensure that the indices and constraints are consistent at the end of the
 // recovery process.
 void RecoverIndicesAndConstraints(const RecoveredIndicesAndConstraints &indices_constraints, Indices *indices,
-                                  Constraints *constraints, utils::SkipList<Vertex> *vertices) {
+                                  Constraints *constraints, utils::SkipList<Vertex> *vertices, uint64_t num_threads) {
   spdlog::info("Recreating indices from metadata.");
   // Recover label indices.
   spdlog::info("Recreating {} label indices from metadata.", indices_constraints.indices.label.size());
   for (const auto &item : indices_constraints.indices.label) {
-    if (!indices->label_index.CreateIndex(item, vertices->access()))
+    if (!indices->label_index.CreateIndex(item, vertices->access(), num_threads))
       throw RecoveryFailure("The label index must be created here!");
     spdlog::info("A label index is recreated from metadata.");
   }
@@ -127,18 +144,47 @@ void RecoverIndicesAndConstraints(const RecoveredIndicesAndConstraints &indices_
   spdlog::info("Recreating {} label+property indices from metadata.",
                indices_constraints.indices.label_property.size());
   for (const auto &item : indices_constraints.indices.label_property) {
-    if (!indices->label_property_index.CreateIndex(item.first, item.second, vertices->access()))
+    if (!indices->label_property_index.CreateIndex(item.first, item.second, vertices->access(), num_threads))
       throw RecoveryFailure("The label+property index must be created here!");
     spdlog::info("A label+property index is recreated from metadata.");
   }
   spdlog::info("Label+property indices are recreated.");
+
+  // Recover edge type indices.
+  spdlog::info("Recreating {} edge type indices from metadata.", indices_constraints.indices.edge_type.size());
+  for (const auto &item : indices_constraints.indices.edge_type) {
+    if (!indices->edge_type_index.CreateIndex(item, vertices->access(), num_threads))
+      throw RecoveryFailure("The edge type index must be created here!");
+    spdlog::info("An edge type index is recreated from metadata.");
+  }
+  spdlog::info("Edge type indices are recreated.");
+
+  // Recover edge type+property indices.
+  spdlog::info("Recreating {} edge type+property indices from metadata.",
+               indices_constraints.indices.edge_type_property.size());
+  for (const auto &item : indices_constraints.indices.edge_type_property) {
+    if (!indices->edge_type_property_index.CreateIndex(item.first, item.second, vertices->access(), num_threads))
+      throw RecoveryFailure("The edge type+property index must be created here!");
+    spdlog::info("An edge type+property index is recreated from metadata.");
+  }
+  spdlog::info("Edge type+property indices are recreated.");
+
+  // Recover label+property composite indices.
+  spdlog::info("Recreating {} label+property composite indices from metadata.",
+               indices_constraints.indices.label_property_composite.size());
+  for (const auto &item : indices_constraints.indices.label_property_composite) {
+    if (!indices->label_property_composite_index.CreateIndex(item.first, item.second, vertices->access(), num_threads))
+      throw RecoveryFailure("The label+property composite index must be created here!");
+    spdlog::info("A label+property composite index is recreated from metadata.");
+  }
+  spdlog::info("Label+property composite indices are recreated.");
   spdlog::info("Indices are recreated.");
 
   spdlog::info("Recreating constraints from metadata.");
   // Recover existence constraints.
   spdlog::info("Recreating {} existence constraints from metadata.", indices_constraints.constraints.existence.size());
   for (const auto &item : indices_constraints.constraints.existence) {
-    auto ret = CreateExistenceConstraint(constraints, item.first, item.second, vertices->access());
+    auto ret = CreateExistenceConstraint(constraints, item.first, item.second, vertices->access(), num_threads);
     if (ret.HasError() || !ret.GetValue()) throw RecoveryFailure("The existence constraint must be created here!");
     spdlog::info("A existence constraint is recreated from metadata.");
   }
@@ -147,7 +193,8 @@ void RecoverIndicesAndConstraints(const RecoveredIndicesAndConstraints &indices_
   // Recover unique constraints.
   spdlog::info("Recreating {} unique constraints from metadata.", indices_constraints.constraints.unique.size());
   for (const auto &item : indices_constraints.constraints.unique) {
-    auto ret = constraints->unique_constraints.CreateConstraint(item.first, item.second, vertices->access());
+    auto ret =
+        constraints->unique_constraints.CreateConstraint(item.first, item.second, vertices->access(), num_threads);
     if (ret.HasError() || ret.GetValue() != UniqueConstraints::CreationStatus::SUCCESS)
       throw RecoveryFailure("The unique constraint must be created here!");
     spdlog::info("A unique constraint is recreated from metadata.");
@@ -163,6 +210,7 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
                                         utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges,
                                         std::atomic<uint64_t> *edge_count, NameIdMapper *name_id_mapper,
                                         Indices *indices, Constraints *constraints, Config::Items items,
+                                        uint64_t recovery_threads, uint64_t schema_creation_threads,
                                         uint64_t *wal_seq_num) {
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
   spdlog::info("Recovering persisted data using snapshot ({}) and WAL directory ({}).", snapshot_directory,
@@ -173,6 +221,7 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
   }
 
   auto snapshot_files = GetSnapshotFiles(snapshot_directory);
+  const auto index_threads = std::max(recovery_threads, schema_creation_threads);
 
   RecoveryInfo recovery_info;
   RecoveredIndicesAndConstraints indices_constraints;
@@ -186,18 +235,36 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
     *uuid = snapshot_files.back().uuid;
     std::optional<RecoveredSnapshot> recovered_snapshot;
     for (auto it = snapshot_files.rbegin(); it != snapshot_files.rend(); ++it) {
-      const auto &[path, file_uuid, _] = *it;
-      if (file_uuid != *uuid) {
+      const auto &path = it->path;
+      if (it->uuid != *uuid) {
         spdlog::warn("The snapshot file {} isn't related to the latest snapshot file!", path);
         continue;
       }
+      auto chain = GetSnapshotChain(snapshot_files, *it);
+      if (!chain) {
+        spdlog::warn("The snapshot file {} is incremental and the snapshots it is based on are missing!", path);
+        continue;
+      }
       spdlog::info("Starting snapshot recovery from {}.", path);
       try {
-        recovered_snapshot = LoadSnapshot(path, vertices, edges, epoch_history, name_id_mapper, edge_count, items);
+        // The incremental snapshots are applied on top of the full snapshot
+        // in the order of their creation.
+        for (const auto *file : *chain) {
+          if (file->IsIncremental()) spdlog::info("Applying incremental snapshot {}.", file->path);
+          auto snapshot = LoadSnapshot(file->path, vertices, edges, epoch_history, name_id_mapper, edge_count, items,
+                                       recovery_threads);
+          if (recovered_snapshot) {
+            auto &info = snapshot.recovery_info;
+            info.next_vertex_id = std::max(info.next_vertex_id, recovered_snapshot->recovery_info.next_vertex_id);
+            info.next_edge_id = std::max(info.next_edge_id, recovered_snapshot->recovery_info.next_edge_id);
+          }
+          recovered_snapshot = std::move(snapshot);
+        }
         spdlog::info("Snapshot recovery successful!");
         break;
       } catch (const RecoveryFailure &e) {
         spdlog::warn("Couldn't recover snapshot from {} because of: {}.", path, e.what());
+        recovered_snapshot.reset();
         continue;
       }
     }
@@ -211,7 +278,7 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
     *epoch_id = std::move(recovered_snapshot->snapshot_info.epoch_id);
 
     if (!utils::DirExists(wal_directory)) {
-      RecoverIndicesAndConstraints(indices_constraints, indices, constraints, vertices);
+      RecoverIndicesAndConstraints(indices_constraints, indices, constraints, vertices, index_threads);
       return recovered_snapshot->recovery_info;
     }
   } else {
@@ -316,7 +383,7 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
       }
       try {
         auto info = LoadWal(wal_file.path, &indices_constraints, last_loaded_timestamp, vertices, edges, name_id_mapper,
-                            edge_count, items);
+                            edge_count, items, recovery_threads);
         recovery_info.next_vertex_id = std::max(recovery_info.next_vertex_id, info.next_vertex_id);
         recovery_info.next_edge_id = std::max(recovery_info.next_edge_id, info.next_edge_id);
         recovery_info.next_timestamp = std::max(recovery_info.next_timestamp, info.next_timestamp);
@@ -337,7 +404,7 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
     spdlog::info("All necessary WAL files are loaded successfully.");
   }
 
-  RecoverIndicesAndConstraints(indices_constraints, indices, constraints, vertices);
+  RecoverIndicesAndConstraints(indices_constraints, indices, constraints, vertices, index_threads);
   return recovery_info;
 }
 
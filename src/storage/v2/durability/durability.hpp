@@ -37,12 +37,23 @@ void VerifyStorageDirectoryOwnerAndProcessUserOrDie(const std::filesystem::path
 
 // Used to capture the snapshot's data related to durability
 struct SnapshotDurabilityInfo {
-  explicit SnapshotDurabilityInfo(std::filesystem::path path, std::string uuid, const uint64_t start_timestamp)
-      : path(std::move(path)), uuid(std::move(uuid)), start_timestamp(start_timestamp) {}
+  explicit SnapshotDurabilityInfo(std::filesystem::path path, std::string uuid, const uint64_t start_timestamp,
+                                  const uint64_t base_start_timestamp, const uint64_t previous_start_timestamp)
+      : path(std::move(path)),
+        uuid(std::move(uuid)),
+        start_timestamp(start_timestamp),
+        base_start_timestamp(base_start_timestamp),
+        previous_start_timestamp(previous_start_timestamp) {}
+
+  bool IsIncremental() const { return previous_start_timestamp != start_timestamp; }
 
   std::filesystem::path path;
   std::string uuid;
   uint64_t start_timestamp;
+  // Start timestamps of the full snapshot that an incremental snapshot is
+  // based on and of the snapshot it is relative to.
+  uint64_t base_start_timestamp;
+  uint64_t previous_start_timestamp;
 
   auto operator<=>(const SnapshotDurabilityInfo &) const = default;
 };
@@ -56,6 +67,12 @@ struct SnapshotDurabilityInfo {
 std::vector<SnapshotDurabilityInfo> GetSnapshotFiles(const std::filesystem::path &snapshot_directory,
                                                      std::string_view uuid = "");
 
+/// Get the snapshots needed to recover the given snapshot, starting with the
+/// full snapshot that it is based on and ending with the snapshot itself.
+/// @return `std::nullopt` if any of the needed snapshots is missing.
+std::optional<std::vector<const SnapshotDurabilityInfo *>> GetSnapshotChain(
+    const std::vector<SnapshotDurabilityInfo> &snapshot_files, const SnapshotDurabilityInfo &snapshot);
+
 /// Used to capture a WAL's data related to durability
 struct WalDurabilityInfo {
   explicit WalDurabilityInfo(const uint64_t seq_num, const uint64_t from_timestamp, const uint64_t to_timestamp,
@@ -94,10 +111,11 @@ std::optional<std::vector<WalDurabilityInfo>> GetWalFiles(const std::filesystem:
 // Helper function used to recover all discovered indices and constraints. The
 // indices and constraints must be recovered after the data recovery is done
 // to ensure that the indices and constraints are consistent at the end of the
-// recovery process.
+// recovery process. The indices are filled and the constraints are validated
+// using `num_threads` threads.
 /// @throw RecoveryFailure
 void RecoverIndicesAndConstraints(const RecoveredIndicesAndConstraints &indices_constraints, Indices *indices,
-                                  Constraints *constraints, utils::SkipList<Vertex> *vertices);
+                                  Constraints *constraints, utils::SkipList<Vertex> *vertices, uint64_t num_threads);
 
 /// Recovers data either from a snapshot and/or WAL files.
 /// @throw RecoveryFailure
@@ -109,6 +127,7 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
                                         utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges,
                                         std::atomic<uint64_t> *edge_count, NameIdMapper *name_id_mapper,
                                         Indices *indices, Constraints *constraints, Config::Items items,
+                                        uint64_t recovery_threads, uint64_t schema_creation_threads,
                                         uint64_t *wal_seq_num);
 
 }  // namespace storage::durability
@@ -0,0 +1,85 @@
+// Copyright 2021 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/durability/group_commit.hpp"
+
+#include <algorithm>
+
+#include "utils/thread.hpp"
+#include "utils/timer.hpp"
+
+namespace storage::durability {
+
+GroupCommit::GroupCommit(std::chrono::microseconds max_batch_latency, std::function<uint64_t()> written,
+                         std::function<uint64_t()> sync)
+    : max_batch_latency_(max_batch_latency),
+      written_(std::move(written)),
+      sync_(std::move(sync)),
+      flusher_([this] { FlushLoop(); }) {}
+
+GroupCommit::~GroupCommit() {
+  {
+    std::lock_guard guard(lock_);
+    stop_ = true;
+  }
+  flush_cv_.notify_one();
+  flusher_.join();
+}
+
+void GroupCommit::WaitForSync(uint64_t transaction_count) {
+  std::unique_lock guard(lock_);
+  if (synced_ >= transaction_count) return;
+  if (transaction_count > requested_) {
+    requested_ = transaction_count;
+    flush_cv_.notify_one();
+  }
+  synced_cv_.wait(guard, [&] { return synced_ >= transaction_count; });
+}
+
+GroupCommitStats GroupCommit::GetStats() const {
+  std::lock_guard guard(lock_);
+  return stats_;
+}
+
+void GroupCommit::FlushLoop() {
+  utils::ThreadSetName("WAL sync");
+
+  std::unique_lock guard(lock_);
+  while (true) {
+    flush_cv_.wait(guard, [this] { return stop_ || requested_ > synced_; });
+    // The transactions that are still waiting are synced before stopping.
+    if (requested_ <= synced_) break;
+
+    // Give the other transactions that have written to the WAL a chance to
+    // join the batch. There is no point in waiting once all of them wait.
+    if (max_batch_latency_.count() > 0) {
+      flush_cv_.wait_for(guard, max_batch_latency_, [this] { return stop_ || requested_ >= written_(); });
+    }
+
+    guard.unlock();
+    utils::Timer timer;
+    const auto synced = sync_();
+    const auto sync_time = timer.Elapsed<std::chrono::microseconds>().count();
+    guard.lock();
+
+    if (synced > synced_) {
+      const auto batch_size = synced - synced_;
+      ++stats_.batches;
+      stats_.transactions += batch_size;
+      stats_.max_batch_size = std::max(stats_.max_batch_size, batch_size);
+      stats_.sync_time_us += sync_time;
+      synced_ = synced;
+    }
+    synced_cv_.notify_all();
+  }
+}
+
+}  // namespace storage::durability
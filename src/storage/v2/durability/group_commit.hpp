@@ -0,0 +1,88 @@
+// Copyright 2021 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace storage::durability {
+
+/// Statistics of the WAL group commit.
+struct GroupCommitStats {
+  // Number of batches synced to disk.
+  uint64_t batches{0};
+  // Total number of WAL transactions synced in all of the batches.
+  uint64_t transactions{0};
+  // The largest number of WAL transactions synced in a single batch.
+  uint64_t max_batch_size{0};
+  // Total time (in microseconds) spent syncing the batches.
+  uint64_t sync_time_us{0};
+};
+
+/// Syncs the WAL on behalf of the committing transactions. A committing
+/// transaction writes its WAL records (without syncing them) and then waits
+/// until a single flusher thread syncs them. All transactions whose records
+/// were written before a sync started are released together when it finishes,
+/// so the cost of one `fdatasync` is shared by the whole batch.
+class GroupCommit final {
+ public:
+  /// `sync` is called from the flusher thread. It must sync all of the WAL
+  /// transactions that were written so far and return their total count.
+  /// `written` returns the number of WAL transactions written so far without
+  /// syncing them. After the first transaction of a batch starts waiting, the
+  /// flusher waits at most `max_batch_latency` for the other written
+  /// transactions to join the batch. The batch is synced as soon as all of
+  /// them are waiting.
+  ///
+  /// @throw std::system_error
+  GroupCommit(std::chrono::microseconds max_batch_latency, std::function<uint64_t()> written,
+              std::function<uint64_t()> sync);
+
+  GroupCommit(const GroupCommit &) = delete;
+  GroupCommit(GroupCommit &&) = delete;
+  GroupCommit &operator=(const GroupCommit &) = delete;
+  GroupCommit &operator=(GroupCommit &&) = delete;
+
+  /// Syncs the transactions that are still waiting and stops the flusher.
+  ~GroupCommit();
+
+  /// Blocks until the first `transaction_count` WAL transactions are synced.
+  void WaitForSync(uint64_t transaction_count);
+
+  GroupCommitStats GetStats() const;
+
+ private:
+  void FlushLoop();
+
+  const std::chrono::microseconds max_batch_latency_;
+  const std::function<uint64_t()> written_;
+  const std::function<uint64_t()> sync_;
+
+  mutable std::mutex lock_;
+  // Wakes up the flusher when a transaction starts waiting for a position
+  // that no other transaction waits for.
+  std::condition_variable flush_cv_;
+  // Wakes up the waiting transactions when a batch is synced.
+  std::condition_variable synced_cv_;
+  uint64_t requested_{0};
+  uint64_t synced_{0};
+  bool stop_{false};
+  GroupCommitStats stats_;
+
+  std::thread flusher_;
+};
+
+}  // namespace storage::durability
@@ -28,6 +28,8 @@ enum class Marker : uint8_t {
   TYPE_MAP = 0x16,
   TYPE_PROPERTY_VALUE = 0x17,
   TYPE_TEMPORAL_DATA = 0x18,
+  TYPE_INTERNED_STRING = 0x19,
+  TYPE_INTERNED_STRING_DEFINITION = 0x1a,
 
   SECTION_VERTEX = 0x20,
   SECTION_EDGE = 0x21,
@@ -37,6 +39,8 @@ enum class Marker : uint8_t {
   SECTION_CONSTRAINTS = 0x25,
   SECTION_DELTA = 0x26,
   SECTION_EPOCH_HISTORY = 0x27,
+  SECTION_SEGMENTS = 0x28,
+  SECTION_DELETED_OBJECTS = 0x29,
   SECTION_OFFSETS = 0x42,
 
   DELTA_VERTEX_CREATE = 0x50,
@@ -56,6 +60,12 @@ enum class Marker : uint8_t {
   DELTA_EXISTENCE_CONSTRAINT_DROP = 0x5e,
   DELTA_UNIQUE_CONSTRAINT_CREATE = 0x5f,
   DELTA_UNIQUE_CONSTRAINT_DROP = 0x60,
+  DELTA_EDGE_TYPE_INDEX_CREATE = 0x61,
+  DELTA_EDGE_TYPE_INDEX_DROP = 0x62,
+  DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE = 0x63,
+  DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP = 0x64,
+  DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE = 0x65,
+  DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP = 0x66,
 
   VALUE_FALSE = 0x00,
   VALUE_TRUE = 0xff,
@@ -73,6 +83,8 @@ static const Marker kMarkersAll[] = {
     Marker::TYPE_MAP,
     Marker::TYPE_TEMPORAL_DATA,
     Marker::TYPE_PROPERTY_VALUE,
+    Marker::TYPE_INTERNED_STRING,
+    Marker::TYPE_INTERNED_STRING_DEFINITION,
     Marker::SECTION_VERTEX,
     Marker::SECTION_EDGE,
     Marker::SECTION_MAPPER,
@@ -81,6 +93,8 @@ static const Marker kMarkersAll[] = {
     Marker::SECTION_CONSTRAINTS,
     Marker::SECTION_DELTA,
     Marker::SECTION_EPOCH_HISTORY,
+    Marker::SECTION_SEGMENTS,
+    Marker::SECTION_DELETED_OBJECTS,
     Marker::SECTION_OFFSETS,
     Marker::DELTA_VERTEX_CREATE,
     Marker::DELTA_VERTEX_DELETE,
@@ -99,6 +113,12 @@ static const Marker kMarkersAll[] = {
     Marker::DELTA_EXISTENCE_CONSTRAINT_DROP,
     Marker::DELTA_UNIQUE_CONSTRAINT_CREATE,
     Marker::DELTA_UNIQUE_CONSTRAINT_DROP,
+    Marker::DELTA_EDGE_TYPE_INDEX_CREATE,
+    Marker::DELTA_EDGE_TYPE_INDEX_DROP,
+    Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE,
+    Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP,
+    Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+    Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
     Marker::VALUE_FALSE,
     Marker::VALUE_TRUE,
 };
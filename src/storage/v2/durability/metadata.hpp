@@ -36,6 +36,9 @@ struct RecoveredIndicesAndConstraints {
   struct {
     std::vector<LabelId> label;
     std::vector<std::pair<LabelId, PropertyId>> label_property;
+    std::vector<EdgeTypeId> edge_type;
+    std::vector<std::pair<EdgeTypeId, PropertyId>> edge_type_property;
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_property_composite;
   } indices;
 
   struct {
@@ -11,11 +11,74 @@
 
 #include "storage/v2/durability/serialization.hpp"
 
+#include <lz4.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "storage/v2/durability/version.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/temporal.hpp"
 #include "utils/endian.hpp"
+#include "utils/logging.hpp"
+#include "utils/timer.hpp"
 
 namespace storage::durability {
 
+// Compression format:
+//
+// The compression header follows the version in files of version
+// `kCompressionVersion` and newer. It isn't compressed and consists of:
+//     * codec (see `Config::Durability::Compression`)
+//     * position of the first compressed block, 0 if nothing is compressed
+//     * position of the block index, 0 if the file wasn't finalized
+//
+// Each block is written as:
+//     * size of the uncompressed data (32 bits)
+//     * size of the stored data (32 bits), the data is stored uncompressed if
+//       the sizes are equal
+//     * stored data
+//
+// The block index has an entry for each block followed by an entry for the end
+// of the data. Each entry consists of the position in the uncompressed data
+// and the position in the file.
+//
+// All numbers are little-endian.
+//
+// Interned strings format:
+//
+// In files of version `kInternedStringsVersion` and newer, string property
+// values that are interned in the `StringDictionary` are written in full only
+// once per part of the file that is decoded on its own (the deltas of a WAL or
+// a snapshot segment). The first occurrence is written as:
+//     * `TYPE_INTERNED_STRING_DEFINITION` marker
+//     * file-local ID of the string (16 bits)
+//     * the string
+// and the following occurrences only as:
+//     * `TYPE_INTERNED_STRING` marker
+//     * file-local ID of the string (16 bits)
+// The IDs are local to the file so that they don't depend on the IDs the
+// strings have in the dictionary while the file is written or recovered.
+
+CompressionStats &CompressionStats::operator+=(const CompressionStats &other) {
+  uncompressed_bytes += other.uncompressed_bytes;
+  compressed_bytes += other.compressed_bytes;
+  duration += other.duration;
+  return *this;
+}
+
+double CompressionStats::Ratio() const {
+  if (compressed_bytes == 0) return 1.0;
+  return static_cast<double>(uncompressed_bytes) / static_cast<double>(compressed_bytes);
+}
+
+double CompressionStats::Throughput() const {
+  const auto seconds = std::chrono::duration<double>(duration).count();
+  if (seconds == 0) return 0.0;
+  return static_cast<double>(uncompressed_bytes) / 1024.0 / 1024.0 / seconds;
+}
+
 //////////////////////////
 // Encoder implementation.
 //////////////////////////
@@ -25,6 +88,20 @@ void WriteSize(Encoder *encoder, uint64_t size) {
   size = utils::HostToLittleEndian(size);
   encoder->Write(reinterpret_cast<const uint8_t *>(&size), sizeof(size));
 }
+
+void WriteRawUint(utils::OutputFile *file, uint64_t value) {
+  value = utils::HostToLittleEndian(value);
+  file->Write(reinterpret_cast<const uint8_t *>(&value), sizeof(value));
+}
+
+// The file-local IDs of the interned strings are written in 16 bits, so a file
+// can't define more strings than the dictionary can hold at once.
+static_assert(StringDictionary::kCapacity <= std::numeric_limits<uint16_t>::max() + 1);
+
+void WriteInternedStringId(Encoder *encoder, uint64_t id) {
+  auto id_encoded = utils::HostToLittleEndian(static_cast<uint16_t>(id));
+  encoder->Write(reinterpret_cast<const uint8_t *>(&id_encoded), sizeof(id_encoded));
+}
 }  // namespace
 
 void Encoder::Initialize(const std::filesystem::path &path, const std::string_view &magic, uint64_t version) {
@@ -32,19 +109,95 @@ void Encoder::Initialize(const std::filesystem::path &path, const std::string_vi
   Write(reinterpret_cast<const uint8_t *>(magic.data()), magic.size());
   auto version_encoded = utils::HostToLittleEndian(version);
   Write(reinterpret_cast<const uint8_t *>(&version_encoded), sizeof(version_encoded));
+  write_interned_strings_ = version >= kInternedStringsVersion;
+  if (version >= kCompressionVersion) {
+    compression_header_ = file_.GetPosition();
+    WriteRawUint(&file_, static_cast<uint64_t>(Config::Durability::Compression::NONE));
+    WriteRawUint(&file_, 0);
+    WriteRawUint(&file_, 0);
+  }
+}
+
+void Encoder::StartCompression(Config::Durability::Compression compression) {
+  if (compression == Config::Durability::Compression::NONE) return;
+  MG_ASSERT(compression_header_ != 0, "The file doesn't support compression!");
+  MG_ASSERT(compressed_from_ == 0, "The compression is already started!");
+  compression_ = compression;
+  compressed_from_ = file_.GetPosition();
+  block_position_ = compressed_from_;
+  block_.reserve(kCompressionBlockSize);
+  file_.SetPosition(utils::OutputFile::Position::SET, static_cast<ssize_t>(compression_header_));
+  WriteRawUint(&file_, static_cast<uint64_t>(compression_));
+  WriteRawUint(&file_, compressed_from_);
+  file_.SetPosition(utils::OutputFile::Position::SET, static_cast<ssize_t>(compressed_from_));
 }
 
 void Encoder::OpenExisting(const std::filesystem::path &path) {
   file_.Open(path, utils::OutputFile::Mode::APPEND_TO_EXISTING);
 }
 
+void Encoder::InitializeMemory(uint64_t version) {
+  in_memory_ = true;
+  write_interned_strings_ = version >= kInternedStringsVersion;
+}
+
 void Encoder::Close() {
   if (file_.IsOpen()) {
     file_.Close();
   }
 }
 
-void Encoder::Write(const uint8_t *data, uint64_t size) { file_.Write(data, size); }
+void Encoder::Write(const uint8_t *data, uint64_t size) {
+  if (in_memory_) {
+    memory_.insert(memory_.end(), data, data + size);
+    return;
+  }
+  if (compressed_from_ == 0 || overwriting_) {
+    file_.Write(data, size);
+    return;
+  }
+  while (size > 0) {
+    const auto to_copy = std::min(size, kCompressionBlockSize - block_.size());
+    block_.insert(block_.end(), data, data + to_copy);
+    data += to_copy;
+    size -= to_copy;
+    if (block_.size() == kCompressionBlockSize) FlushBlock();
+  }
+}
+
+void Encoder::FlushBlock() {
+  if (block_.empty()) return;
+  utils::Timer timer;
+  const auto *stored = reinterpret_cast<const char *>(block_.data());
+  uint32_t stored_size = block_.size();
+  switch (compression_) {
+    case Config::Durability::Compression::LZ4: {
+      compressed_block_.resize(LZ4_compressBound(static_cast<int>(block_.size())));
+      const auto compressed_size =
+          LZ4_compress_default(reinterpret_cast<const char *>(block_.data()), compressed_block_.data(),
+                               static_cast<int>(block_.size()), static_cast<int>(compressed_block_.size()));
+      // Blocks that don't compress are stored as they are.
+      if (compressed_size > 0 && static_cast<uint64_t>(compressed_size) < block_.size()) {
+        stored = compressed_block_.data();
+        stored_size = compressed_size;
+      }
+      break;
+    }
+    case Config::Durability::Compression::NONE:
+      LOG_FATAL("Invalid compression!");
+  }
+  stats_.duration += timer.Elapsed<std::chrono::nanoseconds>();
+
+  blocks_.emplace_back(block_position_, file_.GetPosition());
+  uint32_t header[2] = {utils::HostToLittleEndian(static_cast<uint32_t>(block_.size())),
+                        utils::HostToLittleEndian(stored_size)};
+  file_.Write(reinterpret_cast<const uint8_t *>(header), sizeof(header));
+  file_.Write(reinterpret_cast<const uint8_t *>(stored), stored_size);
+  stats_.uncompressed_bytes += block_.size();
+  stats_.compressed_bytes += sizeof(header) + stored_size;
+  block_position_ += block_.size();
+  block_.clear();
+}
 
 void Encoder::WriteMarker(Marker marker) {
   auto value = static_cast<uint8_t>(marker);
@@ -99,7 +252,7 @@ void Encoder::WritePropertyValue(const PropertyValue &value) {
       break;
     }
     case PropertyValue::Type::String: {
-      WriteString(value.ValueString());
+      WritePropertyString(value.ValueString());
       break;
     }
     case PropertyValue::Type::List: {
@@ -131,22 +284,102 @@ void Encoder::WritePropertyValue(const PropertyValue &value) {
   }
 }
 
-uint64_t Encoder::GetPosition() { return file_.GetPosition(); }
+void Encoder::WritePropertyString(const std::string &value) {
+  if (!write_interned_strings_) {
+    WriteString(value);
+    return;
+  }
+  if (auto found = interned_strings_.find(value); found != interned_strings_.end()) {
+    WriteMarker(Marker::TYPE_INTERNED_STRING);
+    WriteInternedStringId(this, found->second);
+    return;
+  }
+  // Only the strings that are interned are written by their IDs, so the number
+  // of IDs is limited in the same way as the dictionary is.
+  if (interned_strings_.size() >= StringDictionary::kCapacity || !StringDictionary::Global().Contains(value)) {
+    WriteString(value);
+    return;
+  }
+  const uint64_t id = interned_strings_.size();
+  interned_strings_.emplace(value, id);
+  WriteMarker(Marker::TYPE_INTERNED_STRING_DEFINITION);
+  WriteInternedStringId(this, id);
+  WriteString(value);
+}
+
+void Encoder::ResetInternedStrings() { interned_strings_.clear(); }
+
+uint64_t Encoder::GetPosition() {
+  if (in_memory_) return memory_.size();
+  if (compressed_from_ == 0 || overwriting_) return file_.GetPosition();
+  return block_position_ + block_.size();
+}
+
+void Encoder::SetPosition(uint64_t position) {
+  if (compressed_from_ == 0) {
+    file_.SetPosition(utils::OutputFile::Position::SET, position);
+    return;
+  }
+  // Only the data before the compressed blocks can be overwritten, the
+  // compressed data can only be appended.
+  if (position < compressed_from_) {
+    FlushBlock();
+    file_.SetPosition(utils::OutputFile::Position::SET, static_cast<ssize_t>(position));
+    overwriting_ = true;
+    return;
+  }
+  MG_ASSERT(position == block_position_ + block_.size(), "Compressed data can't be overwritten!");
+  if (overwriting_) {
+    file_.SetPosition(utils::OutputFile::Position::RELATIVE_TO_END, 0);
+    overwriting_ = false;
+  }
+}
 
-void Encoder::SetPosition(uint64_t position) { file_.SetPosition(utils::OutputFile::Position::SET, position); }
+void Encoder::Sync() {
+  if (!overwriting_) FlushBlock();
+  file_.Sync();
+}
 
-void Encoder::Sync() { file_.Sync(); }
+utils::OutputFileSyncHandle Encoder::FlushForSync() {
+  if (!overwriting_) FlushBlock();
+  return file_.FlushForSync();
+}
 
 void Encoder::Finalize() {
+  if (compressed_from_ != 0) {
+    if (overwriting_) {
+      file_.SetPosition(utils::OutputFile::Position::RELATIVE_TO_END, 0);
+      overwriting_ = false;
+    }
+    FlushBlock();
+    const auto index_position = file_.GetPosition();
+    for (const auto &[position, file_position] : blocks_) {
+      WriteRawUint(&file_, position);
+      WriteRawUint(&file_, file_position);
+    }
+    WriteRawUint(&file_, block_position_);
+    WriteRawUint(&file_, index_position);
+    file_.SetPosition(utils::OutputFile::Position::SET,
+                      static_cast<ssize_t>(compression_header_ + 2 * sizeof(uint64_t)));
+    WriteRawUint(&file_, index_position);
+  }
   file_.Sync();
   file_.Close();
 }
 
-void Encoder::DisableFlushing() { file_.DisableFlushing(); }
+// The current block is written before the flushing is disabled so that the
+// file and the internal buffer contain all written data.
+void Encoder::DisableFlushing() {
+  if (!overwriting_) FlushBlock();
+  file_.DisableFlushing();
+}
 
 void Encoder::EnableFlushing() { file_.EnableFlushing(); }
 
-void Encoder::TryFlushing() { file_.TryFlushing(); }
+void Encoder::TryFlushing() {
+  if (!overwriting_) FlushBlock();
+  file_.TryFlushing();
+}
 
 std::pair<const uint8_t *, size_t> Encoder::CurrentFileBuffer() const { return file_.CurrentBuffer(); }
 
@@ -172,6 +405,12 @@ std::optional<uint64_t> ReadSize(Decoder *decoder) {
   size = utils::LittleEndianToHost(size);
   return size;
 }
+
+std::optional<uint64_t> ReadInternedStringId(Decoder *decoder) {
+  uint16_t id;
+  if (!decoder->Read(reinterpret_cast<uint8_t *>(&id), sizeof(id))) return std::nullopt;
+  return utils::LittleEndianToHost(id);
+}
 }  // namespace
 
 std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, const std::string &magic) {
@@ -181,12 +420,146 @@ std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, c
   if (file_magic != magic) return std::nullopt;
   uint64_t version_encoded;
   if (!Read(reinterpret_cast<uint8_t *>(&version_encoded), sizeof(version_encoded))) return std::nullopt;
-  return utils::LittleEndianToHost(version_encoded);
+  const auto version = utils::LittleEndianToHost(version_encoded);
+  if (version >= kCompressionVersion) {
+    uint64_t header[3];
+    if (!Read(reinterpret_cast<uint8_t *>(header), sizeof(header))) return std::nullopt;
+    const auto compression = utils::LittleEndianToHost(header[0]);
+    const auto compressed_from = utils::LittleEndianToHost(header[1]);
+    const auto index_position = utils::LittleEndianToHost(header[2]);
+    switch (compression) {
+      case static_cast<uint64_t>(Config::Durability::Compression::NONE):
+        break;
+      case static_cast<uint64_t>(Config::Durability::Compression::LZ4):
+        if (compressed_from != 0) {
+          position_ = file_.GetPosition();
+          if (compressed_from < position_) return std::nullopt;
+          compressed_from_ = compressed_from;
+          if (!ReadBlocks(index_position)) return std::nullopt;
+          if (!file_.SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(position_))) {
+            return std::nullopt;
+          }
+        }
+        break;
+      default:
+        return std::nullopt;
+    }
+  }
+  return version;
+}
+
+bool Decoder::ReadBlocks(uint64_t index_position) {
+  const auto file_size = file_.GetSize();
+  if (index_position != 0) {
+    constexpr auto kEntrySize = 2 * sizeof(uint64_t);
+    if (index_position < compressed_from_ || index_position > file_size ||
+        (file_size - index_position) % kEntrySize != 0) {
+      return false;
+    }
+    if (!file_.SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(index_position))) return false;
+    blocks_.resize((file_size - index_position) / kEntrySize);
+    for (auto &[position, file_position] : blocks_) {
+      uint64_t entry[2];
+      if (!file_.Read(reinterpret_cast<uint8_t *>(entry), sizeof(entry))) return false;
+      position = utils::LittleEndianToHost(entry[0]);
+      file_position = utils::LittleEndianToHost(entry[1]);
+    }
+    if (blocks_.empty() || blocks_.front().first != compressed_from_ || blocks_.back().second != index_position) {
+      return false;
+    }
+    return true;
+  }
+
+  // The file wasn't finalized so the last block could be incomplete. All
+  // complete blocks are used, the same as all complete deltas are used from an
+  // uncompressed WAL.
+  uint64_t position = compressed_from_;
+  uint64_t file_position = compressed_from_;
+  if (!file_.SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(file_position))) return false;
+  while (true) {
+    uint32_t header[2];
+    if (file_size - file_position < sizeof(header)) break;
+    if (!file_.Read(reinterpret_cast<uint8_t *>(header), sizeof(header))) break;
+    const auto size = utils::LittleEndianToHost(header[0]);
+    const auto stored_size = utils::LittleEndianToHost(header[1]);
+    if (size == 0 || size > kCompressionBlockSize || stored_size > size) break;
+    if (file_size - file_position - sizeof(header) < stored_size) break;
+    blocks_.emplace_back(position, file_position);
+    position += size;
+    file_position += sizeof(header) + stored_size;
+    if (!file_.SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(file_position))) return false;
+  }
+  blocks_.emplace_back(position, file_position);
+  return true;
+}
+
+bool Decoder::LoadBlock() {
+  // The last entry only marks the end of the data.
+  auto it = std::upper_bound(blocks_.begin(), blocks_.end(), position_,
+                             [](uint64_t position, const auto &block) { return position < block.first; });
+  if (it == blocks_.begin() || it == blocks_.end()) return false;
+  const uint64_t index = std::distance(blocks_.begin(), it) - 1;
+  if (block_index_ == index) return true;
+  block_index_ = std::nullopt;
+
+  const auto [position, file_position] = blocks_[index];
+  const auto expected_size = blocks_[index + 1].first - position;
+  if (!file_.SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(file_position))) return false;
+  uint32_t header[2];
+  if (!file_.Read(reinterpret_cast<uint8_t *>(header), sizeof(header))) return false;
+  const auto size = utils::LittleEndianToHost(header[0]);
+  const auto stored_size = utils::LittleEndianToHost(header[1]);
+  if (size != expected_size || size > kCompressionBlockSize ||
+      stored_size > static_cast<uint64_t>(LZ4_compressBound(static_cast<int>(size)))) {
+    return false;
+  }
+
+  block_.resize(size);
+  if (stored_size == size) {
+    if (!file_.Read(block_.data(), size)) return false;
+  } else {
+    compressed_block_.resize(stored_size);
+    if (!file_.Read(reinterpret_cast<uint8_t *>(compressed_block_.data()), stored_size)) return false;
+    utils::Timer timer;
+    const auto decompressed_size =
+        LZ4_decompress_safe(compressed_block_.data(), reinterpret_cast<char *>(block_.data()),
+                            static_cast<int>(stored_size), static_cast<int>(size));
+    stats_.duration += timer.Elapsed<std::chrono::nanoseconds>();
+    if (decompressed_size < 0 || static_cast<uint64_t>(decompressed_size) != size) return false;
+  }
+  stats_.uncompressed_bytes += size;
+  stats_.compressed_bytes += sizeof(header) + stored_size;
+  block_index_ = index;
+  return true;
 }
 
-bool Decoder::Read(uint8_t *data, size_t size) { return file_.Read(data, size); }
+bool Decoder::Read(uint8_t *data, size_t size) {
+  if (compressed_from_ == 0) return file_.Read(data, size);
+  while (size > 0) {
+    uint64_t to_read = 0;
+    if (position_ < compressed_from_) {
+      to_read = std::min(static_cast<uint64_t>(size), compressed_from_ - position_);
+      if (!file_.Read(data, to_read)) return false;
+    } else {
+      if (!LoadBlock()) return false;
+      const auto offset = position_ - blocks_[*block_index_].first;
+      to_read = std::min(static_cast<uint64_t>(size), block_.size() - offset);
+      memcpy(data, block_.data() + offset, to_read);
+    }
+    data += to_read;
+    size -= to_read;
+    position_ += to_read;
+  }
+  return true;
+}
 
-bool Decoder::Peek(uint8_t *data, size_t size) { return file_.Peek(data, size); }
+bool Decoder::Peek(uint8_t *data, size_t size) {
+  if (compressed_from_ == 0) return file_.Peek(data, size);
+  const auto position = position_;
+  const auto ret = Read(data, size);
+  if (!SetPosition(position)) return false;
+  return ret;
+}
 
 std::optional<Marker> Decoder::PeekMarker() {
   uint8_t value;
@@ -256,6 +629,26 @@ std::optional<TemporalData> ReadTemporalData(Decoder &decoder) {
 }
 }  // namespace
 
+std::optional<std::string> Decoder::ReadInternedString() {
+  auto marker = ReadMarker();
+  if (!marker || (*marker != Marker::TYPE_INTERNED_STRING && *marker != Marker::TYPE_INTERNED_STRING_DEFINITION)) {
+    return std::nullopt;
+  }
+  auto id = ReadInternedStringId(this);
+  if (!id) return std::nullopt;
+  if (*marker == Marker::TYPE_INTERNED_STRING_DEFINITION) {
+    auto value = ReadString();
+    if (!value) return std::nullopt;
+    if (interned_strings_.size() <= *id) interned_strings_.resize(*id + 1);
+    interned_strings_[*id] = *value;
+    return value;
+  }
+  if (*id >= interned_strings_.size()) return std::nullopt;
+  return interned_strings_[*id];
+}
+
+void Decoder::ResetInternedStrings() { interned_strings_.clear(); }
+
 std::optional<PropertyValue> Decoder::ReadPropertyValue() {
   auto pv_marker = ReadMarker();
   if (!pv_marker || *pv_marker != Marker::TYPE_PROPERTY_VALUE) return std::nullopt;
@@ -288,6 +681,12 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
       if (!value) return std::nullopt;
       return PropertyValue(std::move(*value));
     }
+    case Marker::TYPE_INTERNED_STRING:
+    case Marker::TYPE_INTERNED_STRING_DEFINITION: {
+      auto value = ReadInternedString();
+      if (!value) return std::nullopt;
+      return PropertyValue(std::move(*value));
+    }
     case Marker::TYPE_LIST: {
       auto inner_marker = ReadMarker();
       if (!inner_marker || *inner_marker != Marker::TYPE_LIST) return std::nullopt;
@@ -332,6 +731,8 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
     case Marker::SECTION_CONSTRAINTS:
     case Marker::SECTION_DELTA:
     case Marker::SECTION_EPOCH_HISTORY:
+    case Marker::SECTION_SEGMENTS:
+    case Marker::SECTION_DELETED_OBJECTS:
     case Marker::SECTION_OFFSETS:
     case Marker::DELTA_VERTEX_CREATE:
     case Marker::DELTA_VERTEX_DELETE:
@@ -350,6 +751,12 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
     case Marker::DELTA_EXISTENCE_CONSTRAINT_DROP:
     case Marker::DELTA_UNIQUE_CONSTRAINT_CREATE:
     case Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
+    case Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
+    case Marker::DELTA_EDGE_TYPE_INDEX_DROP:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       return std::nullopt;
@@ -397,6 +804,12 @@ bool Decoder::SkipPropertyValue() {
     case Marker::TYPE_STRING: {
       return SkipString();
     }
+    case Marker::TYPE_INTERNED_STRING:
+    case Marker::TYPE_INTERNED_STRING_DEFINITION: {
+      // The definitions have to be read even when skipped because the
+      // following values can refer to them.
+      return !!ReadInternedString();
+    }
     case Marker::TYPE_LIST: {
       auto inner_marker = ReadMarker();
       if (!inner_marker || *inner_marker != Marker::TYPE_LIST) return false;
@@ -431,6 +844,8 @@ bool Decoder::SkipPropertyValue() {
     case Marker::SECTION_CONSTRAINTS:
     case Marker::SECTION_DELTA:
     case Marker::SECTION_EPOCH_HISTORY:
+    case Marker::SECTION_SEGMENTS:
+    case Marker::SECTION_DELETED_OBJECTS:
     case Marker::SECTION_OFFSETS:
     case Marker::DELTA_VERTEX_CREATE:
     case Marker::DELTA_VERTEX_DELETE:
@@ -449,16 +864,38 @@ bool Decoder::SkipPropertyValue() {
     case Marker::DELTA_EXISTENCE_CONSTRAINT_DROP:
     case Marker::DELTA_UNIQUE_CONSTRAINT_CREATE:
     case Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
+    case Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
+    case Marker::DELTA_EDGE_TYPE_INDEX_DROP:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       return false;
   }
 }
 
-std::optional<uint64_t> Decoder::GetSize() { return file_.GetSize(); }
+std::optional<uint64_t> Decoder::GetSize() {
+  if (compressed_from_ == 0) return file_.GetSize();
+  return blocks_.back().first;
+}
 
-std::optional<uint64_t> Decoder::GetPosition() { return file_.GetPosition(); }
+std::optional<uint64_t> Decoder::GetPosition() {
+  if (compressed_from_ == 0) return file_.GetPosition();
+  return position_;
+}
 
-bool Decoder::SetPosition(uint64_t position) { return !!file_.SetPosition(utils::InputFile::Position::SET, position); }
+bool Decoder::SetPosition(uint64_t position) {
+  if (compressed_from_ == 0) return !!file_.SetPosition(utils::InputFile::Position::SET, position);
+  if (position > blocks_.back().first) return false;
+  // The blocks are positioned in the file when they are read.
+  if (position < compressed_from_ &&
+      !file_.SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(position))) {
+    return false;
+  }
+  position_ = position;
+  return true;
+}
 
 }  // namespace storage::durability
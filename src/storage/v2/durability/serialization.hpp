@@ -11,9 +11,14 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/durability/marker.hpp"
@@ -23,6 +28,24 @@
 
 namespace storage::durability {
 
+/// Size of the uncompressed data in a single compressed block of a
+/// snapshot/WAL.
+constexpr uint64_t kCompressionBlockSize = 64 * 1024;
+
+/// Amount of data that went through the compressed blocks of a snapshot/WAL
+/// and the time spent compressing or decompressing it.
+struct CompressionStats {
+  CompressionStats &operator+=(const CompressionStats &other);
+
+  double Ratio() const;
+  // Throughput of the (de)compression in MiB of uncompressed data per second.
+  double Throughput() const;
+
+  uint64_t uncompressed_bytes{0};
+  uint64_t compressed_bytes{0};
+  std::chrono::nanoseconds duration{0};
+};
+
 /// Encoder interface class. Used to implement streams to different targets
 /// (e.g. file and network).
 class BaseEncoder {
@@ -39,12 +62,35 @@ class BaseEncoder {
 };
 
 /// Encoder that is used to generate a snapshot/WAL.
+///
+/// Files of version `kCompressionVersion` and newer have a compression header
+/// after the version. Once `StartCompression` is called, all data written
+/// after that point is split into blocks of `kCompressionBlockSize` bytes that
+/// are compressed on their own. The positions returned by `GetPosition` are
+/// positions in the uncompressed data so they can still be used to seek in the
+/// file. `Finalize` appends the index of the blocks to the file.
+///
+/// In files of version `kInternedStringsVersion` and newer, string property
+/// values that are interned in the `StringDictionary` are written in full only
+/// the first time after `ResetInternedStrings` and by a file-local ID after
+/// that.
 class Encoder final : public BaseEncoder {
  public:
   void Initialize(const std::filesystem::path &path, const std::string_view &magic, uint64_t version);
 
+  // Compresses all data written from now on. The data written before can still
+  // be overwritten using `SetPosition`.
+  void StartCompression(Config::Durability::Compression compression);
+
   void OpenExisting(const std::filesystem::path &path);
 
+  // Writes all data to a memory buffer instead of a file. The buffer can be
+  // appended to a file by another encoder using `Write`.
+  void InitializeMemory(uint64_t version);
+
+  const std::vector<uint8_t> &GetMemory() const { return memory_; }
+  void ClearMemory() { memory_.clear(); }
+
   void Close();
   // Main write function, the only one that is allowed to write to the `file_`
   // directly.
@@ -60,8 +106,15 @@ class Encoder final : public BaseEncoder {
   uint64_t GetPosition();
   void SetPosition(uint64_t position);
 
+  // Forgets the interned strings that were written so far, so that the data
+  // written from now on can be decoded without the data before it.
+  void ResetInternedStrings();
+
   void Sync();
 
+  // Write the internal buffer to the file and get a handle that syncs it.
+  utils::OutputFileSyncHandle FlushForSync();
+
   void Finalize();
 
   // Disable flushing of the internal buffer.
@@ -76,8 +129,39 @@ class Encoder final : public BaseEncoder {
   // Get the total size of the current file.
   size_t GetSize();
 
+  const CompressionStats &GetCompressionStats() const { return stats_; }
+
  private:
+  // Compresses the current block and writes it to the file.
+  void FlushBlock();
+
+  // Writes a string property value, by its file-local ID if it is interned.
+  void WritePropertyString(const std::string &value);
+
   utils::OutputFile file_;
+  // Data written by an encoder that isn't writing to a file.
+  bool in_memory_{false};
+  std::vector<uint8_t> memory_;
+
+  // Position of the compression header, 0 if the file doesn't have it.
+  uint64_t compression_header_{0};
+  Config::Durability::Compression compression_{Config::Durability::Compression::NONE};
+  // Position of the first compressed block, 0 if the data isn't compressed.
+  uint64_t compressed_from_{0};
+  // Whether the data before the compressed blocks is being overwritten.
+  bool overwriting_{false};
+  // Uncompressed data of the current block and its position.
+  std::vector<uint8_t> block_;
+  uint64_t block_position_{0};
+  std::vector<char> compressed_block_;
+  // Positions of the blocks in the uncompressed data and in the file.
+  std::vector<std::pair<uint64_t, uint64_t>> blocks_;
+  CompressionStats stats_;
+  // File-local IDs of the interned strings written since the last reset. The
+  // strings are written this way only in files of version
+  // `kInternedStringsVersion` and newer.
+  bool write_interned_strings_{false};
+  std::unordered_map<std::string, uint64_t> interned_strings_;
 };
 
 /// Decoder interface class. Used to implement streams from different sources
@@ -120,12 +204,43 @@ class Decoder final : public BaseDecoder {
   bool SkipString() override;
   bool SkipPropertyValue() override;
 
+  // The size and the positions are in the uncompressed data.
   std::optional<uint64_t> GetSize();
   std::optional<uint64_t> GetPosition();
   bool SetPosition(uint64_t position);
 
+  // Forgets the interned strings that were read so far. It should be called
+  // at the positions where the encoder reset its interned strings.
+  void ResetInternedStrings();
+
+  const CompressionStats &GetCompressionStats() const { return stats_; }
+
  private:
+  // Reads the ID of an interned string and, for a definition, the string
+  // itself. Returns the interned string.
+  std::optional<std::string> ReadInternedString();
+
+  // Reads the positions of the compressed blocks either from the block index
+  // or, if the file wasn't finalized, from the headers of the blocks.
+  bool ReadBlocks(uint64_t index_position);
+  // Decompresses the block that contains the current position.
+  bool LoadBlock();
+
   utils::InputFile file_;
+
+  // Position of the first compressed block, 0 if the data isn't compressed.
+  uint64_t compressed_from_{0};
+  uint64_t position_{0};
+  // Positions of the blocks in the uncompressed data and in the file. The last
+  // entry holds the end of the data.
+  std::vector<std::pair<uint64_t, uint64_t>> blocks_;
+  // Uncompressed data of the currently loaded block.
+  std::optional<uint64_t> block_index_;
+  std::vector<uint8_t> block_;
+  std::vector<char> compressed_block_;
+  CompressionStats stats_;
+  // Interned strings by their file-local IDs.
+  std::vector<std::optional<std::string>> interned_strings_;
 };
 
 }  // namespace storage::durability
@@ -11,6 +11,11 @@
 
 #include "storage/v2/durability/snapshot.hpp"
 
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "storage/v2/durability/exceptions.hpp"
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/serialization.hpp"
@@ -22,15 +27,29 @@
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
+#include "utils/memory_tracker.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/timer.hpp"
 
 namespace storage::durability {
 
 // Snapshot format:
 //
+// A snapshot is either full or incremental (from version 20). An incremental
+// snapshot contains only the edges and vertices that were modified since the
+// previous snapshot, and the gids of the deleted ones. It is recovered by
+// loading the full snapshot that starts its chain and applying all of the
+// incremental snapshots of the chain in order. All other sections of an
+// incremental snapshot are complete.
+//
 // 1) Magic string (non-encoded)
 //
 // 2) Snapshot version (non-encoded, little-endian)
 //
+// 2a) Compression header (non-encoded, from version 19); everything after the
+//     section offsets is stored in (optionally) compressed blocks, see
+//     `serialization.cpp`
+//
 // 3) Section offsets:
 //     * offset to the first edge in the snapshot (`0` if properties on edges
 //       are disabled)
@@ -38,14 +57,19 @@ namespace storage::durability {
 //     * offset to the indices section
 //     * offset to the constraints section
 //     * offset to the mapper section
+//     * offset to the epoch history section
 //     * offset to the metadata section
+//     * offset to the segments section (from version 18)
+//     * offset to the deleted objects section (from version 20, `0` for full
+//       snapshots)
 //
-// 4) Encoded edges (if properties on edges are enabled); each edge is written
-//    in the following format:
+// 4) Encoded edges (if properties on edges are enabled), ordered by their gid;
+//    each edge is written in the following format:
 //     * gid
 //     * properties
 //
-// 5) Encoded vertices; each vertex is written in the following format:
+// 5) Encoded vertices, ordered by their gid; each vertex is written in the
+//    following format:
 //     * gid
 //     * labels
 //     * properties
@@ -64,6 +88,14 @@ namespace storage::durability {
 //     * label+property indices
 //         * label
 //         * property
+//     * edge type indices (from version 15)
+//         * edge type
+//     * edge type+property indices (from version 16)
+//         * edge type
+//         * property
+//     * label+property composite indices (from version 17)
+//         * label
+//         * properties (in the order of the index)
 //
 // 7) Constraints
 //     * existence constraints
@@ -78,13 +110,37 @@ namespace storage::durability {
 //         * id
 //         * name
 //
-// 9) Metadata
+// 9) Epoch history
+//     * number of epochs
+//     * epoch id and last commit timestamp of each epoch
+//
+// 10) Segments (from version 18); the edges and vertices are split into
+//     segments that are written in parallel and can be read independently,
+//     so each segment defines its own interned strings (from version 21);
+//     the segments are listed in the order of the gids of their objects,
+//     which needn't be their order in the file
+//     * edge segments
+//         * offset of the first edge in the segment
+//         * number of edges in the segment
+//     * vertex segments
+//         * offset of the first vertex in the segment
+//         * number of vertices in the segment
+//
+// 11) Deleted objects (from version 20, only in incremental snapshots)
+//     * gids of the deleted edges
+//     * gids of the deleted vertices
+//
+// 12) Metadata
 //     * storage UUID
 //     * snapshot transaction start timestamp (required when recovering
 //       from snapshot combined with WAL to determine what deltas need to be
 //       applied)
 //     * number of edges
 //     * number of vertices
+//     * start timestamp of the full snapshot that starts the chain (from
+//       version 20)
+//     * start timestamp of the previous snapshot in the chain (from version
+//       20, equal to the snapshot start timestamp for full snapshots)
 //
 // IMPORTANT: When changing snapshot encoding/decoding bump the snapshot/WAL
 // version in `version.hpp`.
@@ -123,6 +179,12 @@ SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
     info.offset_mapper = read_offset();
     info.offset_epoch_history = read_offset();
     info.offset_metadata = read_offset();
+    if (*version >= kSnapshotSegmentsVersion) {
+      info.offset_segments = read_offset();
+    }
+    if (*version >= kIncrementalSnapshotVersion) {
+      info.offset_deleted_objects = read_offset();
+    }
   }
 
   // Read metadata.
@@ -151,17 +213,158 @@ SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
     auto maybe_vertices = snapshot.ReadUint();
     if (!maybe_vertices) throw RecoveryFailure("Invalid snapshot data!");
     info.vertices_count = *maybe_vertices;
+
+    info.base_start_timestamp = info.start_timestamp;
+    info.previous_start_timestamp = info.start_timestamp;
+    if (*version >= kIncrementalSnapshotVersion) {
+      auto maybe_base_timestamp = snapshot.ReadUint();
+      if (!maybe_base_timestamp) throw RecoveryFailure("Invalid snapshot data!");
+      info.base_start_timestamp = *maybe_base_timestamp;
+
+      auto maybe_previous_timestamp = snapshot.ReadUint();
+      if (!maybe_previous_timestamp) throw RecoveryFailure("Invalid snapshot data!");
+      info.previous_start_timestamp = *maybe_previous_timestamp;
+
+      if (info.base_start_timestamp > info.previous_start_timestamp ||
+          info.previous_start_timestamp > info.start_timestamp ||
+          info.IsIncremental() != (info.offset_deleted_objects != 0)) {
+        throw RecoveryFailure("Invalid snapshot data!");
+      }
+    }
+  }
+
+  // Read segments.
+  if (*version >= kSnapshotSegmentsVersion) {
+    if (!snapshot.SetPosition(info.offset_segments)) throw RecoveryFailure("Couldn't read data from snapshot!");
+
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_SEGMENTS) throw RecoveryFailure("Invalid snapshot data!");
+
+    auto read_segments = [&snapshot](std::vector<SnapshotSegment> *segments, uint64_t expected_count) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      segments->reserve(*size);
+      uint64_t total_count = 0;
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto offset = snapshot.ReadUint();
+        if (!offset) throw RecoveryFailure("Invalid snapshot data!");
+        auto count = snapshot.ReadUint();
+        if (!count) throw RecoveryFailure("Invalid snapshot data!");
+        segments->push_back({*offset, *count});
+        total_count += *count;
+      }
+      if (total_count != expected_count) throw RecoveryFailure("Invalid snapshot data!");
+    };
+    read_segments(&info.edge_segments, info.offset_edges != 0 ? info.edges_count : 0);
+    read_segments(&info.vertex_segments, info.vertices_count);
+  } else {
+    if (info.offset_edges != 0) {
+      info.edge_segments.push_back({info.offset_edges, info.edges_count});
+    }
+    info.vertex_segments.push_back({info.offset_vertices, info.vertices_count});
   }
 
   return info;
 }
 
+namespace {
+
+// Gids of the first and the last object in a snapshot segment.
+struct SegmentGids {
+  // Checks that the objects of the segment are ordered by their gids.
+  void Add(uint64_t gid) {
+    if (first && gid <= last) throw RecoveryFailure("Invalid snapshot data!");
+    if (!first) first = gid;
+    last = gid;
+  }
+
+  std::optional<uint64_t> first;
+  uint64_t last{0};
+};
+
+// Checks that the segments are ordered by the gids of their objects and
+// returns the largest gid.
+uint64_t CheckSegmentGids(const std::vector<SegmentGids> &segment_gids) {
+  uint64_t last_gid = 0;
+  bool has_objects = false;
+  for (const auto &gids : segment_gids) {
+    if (!gids.first) continue;
+    if (has_objects && *gids.first <= last_gid) throw RecoveryFailure("Invalid snapshot data!");
+    has_objects = true;
+    last_gid = gids.last;
+  }
+  return last_gid;
+}
+
+// Calls `func(index, decoder)` for each of the snapshot segments using
+// `num_threads` threads (including the calling thread). Each thread reads the
+// snapshot with its own decoder that is positioned at the start of the segment
+// before `func` is called and doesn't know the interned strings of the other
+// segments. The first exception thrown by `func` is rethrown in
+// the calling thread after all threads finish. The decompression statistics
+// of all threads are added to `stats`.
+template <typename TFunc>
+void ForEachSegment(const std::filesystem::path &path, const std::vector<SnapshotSegment> &segments,
+                    uint64_t num_threads, CompressionStats *stats, const TFunc &func) {
+  const bool oom_exception_enabled = utils::MemoryTracker::OutOfMemoryExceptionEnabler::CanThrow();
+  std::atomic<uint64_t> next_segment{0};
+  std::atomic<bool> stop{false};
+  std::mutex lock;
+  std::exception_ptr exception;
+
+  auto worker = [&] {
+    std::optional<utils::MemoryTracker::OutOfMemoryExceptionEnabler> oom_exception;
+    if (oom_exception_enabled) oom_exception.emplace();
+    Decoder decoder;
+    try {
+      if (!decoder.Initialize(path, kSnapshotMagic)) {
+        throw RecoveryFailure("Couldn't read snapshot magic and/or version!");
+      }
+      while (!stop.load(std::memory_order_acquire)) {
+        const auto index = next_segment.fetch_add(1, std::memory_order_acq_rel);
+        if (index >= segments.size()) break;
+        if (!decoder.SetPosition(segments[index].offset)) throw RecoveryFailure("Couldn't read data from snapshot!");
+        decoder.ResetInternedStrings();
+        func(index, &decoder);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> guard(lock);
+      if (!exception) exception = std::current_exception();
+      stop.store(true, std::memory_order_release);
+    }
+    std::lock_guard<std::mutex> guard(lock);
+    *stats += decoder.GetCompressionStats();
+  };
+
+  {
+    std::vector<std::thread> threads;
+    utils::OnScopeExit join_threads{[&] {
+      for (auto &thread : threads) {
+        thread.join();
+      }
+    }};
+    const uint64_t num_workers = std::max(std::min(num_threads, static_cast<uint64_t>(segments.size())), uint64_t{1});
+    threads.reserve(num_workers - 1);
+    for (uint64_t i = 1; i < num_workers; ++i) {
+      threads.emplace_back(worker);
+    }
+    worker();
+  }
+
+  if (exception) std::rethrow_exception(exception);
+}
+
+}  // namespace
+
 RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipList<Vertex> *vertices,
                                utils::SkipList<Edge> *edges,
                                std::deque<std::pair<std::string, uint64_t>> *epoch_history,
-                               NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, Config::Items items) {
+                               NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, Config::Items items,
+                               uint64_t num_threads) {
   RecoveryInfo ret;
   RecoveredIndicesAndConstraints indices_constraints;
+  // Decompression statistics of the segment threads.
+  CompressionStats stats;
 
   Decoder snapshot;
   auto version = snapshot.Initialize(path, kSnapshotMagic);
@@ -183,6 +386,8 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   spdlog::info("Recovering {} vertices and {} edges.", info.vertices_count, info.edges_count);
   // Check for edges.
   bool snapshot_has_edges = info.offset_edges != 0;
+  // The objects of an incremental snapshot replace the already loaded ones.
+  const bool incremental = info.IsIncremental();
 
   // Recover mapper.
   std::unordered_map<uint64_t, uint64_t> snapshot_id_map;
@@ -223,264 +428,322 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   };
 
   // Reset current edge count.
-  edge_count->store(0, std::memory_order_release);
+  if (!incremental) edge_count->store(0, std::memory_order_release);
 
   {
     // Recover edges.
-    auto edge_acc = edges->access();
     uint64_t last_edge_gid = 0;
     if (snapshot_has_edges) {
-      spdlog::info("Recovering {} edges.", info.edges_count);
-      if (!snapshot.SetPosition(info.offset_edges)) throw RecoveryFailure("Couldn't read data from snapshot!");
-      for (uint64_t i = 0; i < info.edges_count; ++i) {
-        {
-          const auto marker = snapshot.ReadMarker();
-          if (!marker || *marker != Marker::SECTION_EDGE) throw RecoveryFailure("Invalid snapshot data!");
-        }
-
-        if (items.properties_on_edges) {
-          // Insert edge.
-          auto gid = snapshot.ReadUint();
-          if (!gid) throw RecoveryFailure("Invalid snapshot data!");
-          if (i > 0 && *gid <= last_edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-          last_edge_gid = *gid;
-          spdlog::debug("Recovering edge {} with properties.", *gid);
-          auto [it, inserted] = edge_acc.insert(Edge{Gid::FromUint(*gid), nullptr});
-          if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
-
-          // Recover properties.
+      spdlog::info("Recovering {} edges in {} segments.", info.edges_count, info.edge_segments.size());
+      std::vector<SegmentGids> segment_gids(info.edge_segments.size());
+      ForEachSegment(path, info.edge_segments, num_threads, &stats, [&](uint64_t index, Decoder *decoder) {
+        auto edge_acc = edges->access();
+        auto &gids = segment_gids[index];
+        for (uint64_t i = 0; i < info.edge_segments[index].count; ++i) {
           {
-            auto props_size = snapshot.ReadUint();
-            if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-            auto &props = it->properties;
-            for (uint64_t j = 0; j < *props_size; ++j) {
-              auto key = snapshot.ReadUint();
-              if (!key) throw RecoveryFailure("Invalid snapshot data!");
-              auto value = snapshot.ReadPropertyValue();
-              if (!value) throw RecoveryFailure("Invalid snapshot data!");
-              SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for edge {}.",
-                           name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
-              props.SetProperty(get_property_from_id(*key), *value);
-            }
+            const auto marker = decoder->ReadMarker();
+            if (!marker || *marker != Marker::SECTION_EDGE) throw RecoveryFailure("Invalid snapshot data!");
           }
-        } else {
+
           // Read edge GID.
-          auto gid = snapshot.ReadUint();
+          auto gid = decoder->ReadUint();
           if (!gid) throw RecoveryFailure("Invalid snapshot data!");
-          if (i > 0 && *gid <= last_edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-          last_edge_gid = *gid;
+          gids.Add(*gid);
 
-          spdlog::debug("Ensuring edge {} doesn't have any properties.", *gid);
-          // Read properties.
-          {
-            auto props_size = snapshot.ReadUint();
-            if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-            if (*props_size != 0)
-              throw RecoveryFailure(
-                  "The snapshot has properties on edges, but the storage is "
-                  "configured without properties on edges!");
+          if (items.properties_on_edges) {
+            // Insert edge.
+            spdlog::debug("Recovering edge {} with properties.", *gid);
+            auto [it, inserted] = edge_acc.insert(Edge{Gid::FromUint(*gid), nullptr});
+            if (!inserted) {
+              if (!incremental) throw RecoveryFailure("The edge must be inserted here!");
+              it->properties.ClearProperties();
+            }
+
+            // Recover properties.
+            {
+              auto props_size = decoder->ReadUint();
+              if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
+              auto &props = it->properties;
+              for (uint64_t j = 0; j < *props_size; ++j) {
+                auto key = decoder->ReadUint();
+                if (!key) throw RecoveryFailure("Invalid snapshot data!");
+                auto value = decoder->ReadPropertyValue();
+                if (!value) throw RecoveryFailure("Invalid snapshot data!");
+                SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for edge {}.",
+                             name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
+                props.SetProperty(get_property_from_id(*key), *value);
+              }
+            }
+          } else {
+            spdlog::debug("Ensuring edge {} doesn't have any properties.", *gid);
+            // Read properties.
+            {
+              auto props_size = decoder->ReadUint();
+              if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
+              if (*props_size != 0)
+                throw RecoveryFailure(
+                    "The snapshot has properties on edges, but the storage is "
+                    "configured without properties on edges!");
+            }
           }
         }
-      }
+      });
+      last_edge_gid = CheckSegmentGids(segment_gids);
       spdlog::info("Edges are recovered.");
     }
 
     // Recover vertices (labels and properties).
-    if (!snapshot.SetPosition(info.offset_vertices)) throw RecoveryFailure("Couldn't read data from snapshot!");
-    auto vertex_acc = vertices->access();
-    uint64_t last_vertex_gid = 0;
-    spdlog::info("Recovering {} vertices.", info.vertices_count);
-    for (uint64_t i = 0; i < info.vertices_count; ++i) {
-      {
-        auto marker = snapshot.ReadMarker();
-        if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Invalid snapshot data!");
-      }
+    spdlog::info("Recovering {} vertices in {} segments.", info.vertices_count, info.vertex_segments.size());
+    std::vector<SegmentGids> segment_gids(info.vertex_segments.size());
+    ForEachSegment(path, info.vertex_segments, num_threads, &stats, [&](uint64_t index, Decoder *decoder) {
+      auto vertex_acc = vertices->access();
+      auto &gids = segment_gids[index];
+      for (uint64_t i = 0; i < info.vertex_segments[index].count; ++i) {
+        {
+          auto marker = decoder->ReadMarker();
+          if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Invalid snapshot data!");
+        }
 
-      // Insert vertex.
-      auto gid = snapshot.ReadUint();
-      if (!gid) throw RecoveryFailure("Invalid snapshot data!");
-      if (i > 0 && *gid <= last_vertex_gid) {
-        throw RecoveryFailure("Invalid snapshot data!");
-      }
-      last_vertex_gid = *gid;
-      spdlog::debug("Recovering vertex {}.", *gid);
-      auto [it, inserted] = vertex_acc.insert(Vertex{Gid::FromUint(*gid), nullptr});
-      if (!inserted) throw RecoveryFailure("The vertex must be inserted here!");
+        // Insert vertex.
+        auto gid = decoder->ReadUint();
+        if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+        gids.Add(*gid);
+        spdlog::debug("Recovering vertex {}.", *gid);
+        auto [it, inserted] = vertex_acc.insert(Vertex{Gid::FromUint(*gid), nullptr});
+        if (!inserted) {
+          if (!incremental) throw RecoveryFailure("The vertex must be inserted here!");
+          it->labels = LabelSet();
+          it->properties.ClearProperties();
+        }
 
-      // Recover labels.
-      spdlog::trace("Recovering labels for vertex {}.", *gid);
-      {
-        auto labels_size = snapshot.ReadUint();
-        if (!labels_size) throw RecoveryFailure("Invalid snapshot data!");
-        auto &labels = it->labels;
-        labels.reserve(*labels_size);
-        for (uint64_t j = 0; j < *labels_size; ++j) {
-          auto label = snapshot.ReadUint();
-          if (!label) throw RecoveryFailure("Invalid snapshot data!");
-          SPDLOG_TRACE("Recovered label \"{}\" for vertex {}.", name_id_mapper->IdToName(snapshot_id_map.at(*label)),
-                       *gid);
-          labels.emplace_back(get_label_from_id(*label));
+        // Recover labels.
+        spdlog::trace("Recovering labels for vertex {}.", *gid);
+        {
+          auto labels_size = decoder->ReadUint();
+          if (!labels_size) throw RecoveryFailure("Invalid snapshot data!");
+          auto &labels = it->labels;
+          for (uint64_t j = 0; j < *labels_size; ++j) {
+            auto label = decoder->ReadUint();
+            if (!label) throw RecoveryFailure("Invalid snapshot data!");
+            SPDLOG_TRACE("Recovered label \"{}\" for vertex {}.", name_id_mapper->IdToName(snapshot_id_map.at(*label)),
+                         *gid);
+            if (!labels.Insert(get_label_from_id(*label))) throw RecoveryFailure("Invalid snapshot data!");
+          }
         }
-      }
 
-      // Recover properties.
-      spdlog::trace("Recovering properties for vertex {}.", *gid);
-      {
-        auto props_size = snapshot.ReadUint();
-        if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-        auto &props = it->properties;
-        for (uint64_t j = 0; j < *props_size; ++j) {
-          auto key = snapshot.ReadUint();
-          if (!key) throw RecoveryFailure("Invalid snapshot data!");
-          auto value = snapshot.ReadPropertyValue();
-          if (!value) throw RecoveryFailure("Invalid snapshot data!");
-          SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for vertex {}.",
-                       name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
-          props.SetProperty(get_property_from_id(*key), *value);
+        // Recover properties.
+        spdlog::trace("Recovering properties for vertex {}.", *gid);
+        {
+          auto props_size = decoder->ReadUint();
+          if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
+          auto &props = it->properties;
+          for (uint64_t j = 0; j < *props_size; ++j) {
+            auto key = decoder->ReadUint();
+            if (!key) throw RecoveryFailure("Invalid snapshot data!");
+            auto value = decoder->ReadPropertyValue();
+            if (!value) throw RecoveryFailure("Invalid snapshot data!");
+            SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for vertex {}.",
+                         name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
+            props.SetProperty(get_property_from_id(*key), *value);
+          }
         }
-      }
 
-      // Skip in edges.
-      {
-        auto in_size = snapshot.ReadUint();
-        if (!in_size) throw RecoveryFailure("Invalid snapshot data!");
-        for (uint64_t j = 0; j < *in_size; ++j) {
-          auto edge_gid = snapshot.ReadUint();
+        // Skip in edges.
+        {
+          auto in_size = decoder->ReadUint();
+          if (!in_size) throw RecoveryFailure("Invalid snapshot data!");
+          for (uint64_t j = 0; j < *in_size; ++j) {
+            auto edge_gid = decoder->ReadUint();
+            if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
+            auto from_gid = decoder->ReadUint();
+            if (!from_gid) throw RecoveryFailure("Invalid snapshot data!");
+            auto edge_type = decoder->ReadUint();
+            if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+          }
+        }
+
+        // Skip out edges.
+        auto out_size = decoder->ReadUint();
+        if (!out_size) throw RecoveryFailure("Invalid snapshot data!");
+        for (uint64_t j = 0; j < *out_size; ++j) {
+          auto edge_gid = decoder->ReadUint();
           if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-          auto from_gid = snapshot.ReadUint();
-          if (!from_gid) throw RecoveryFailure("Invalid snapshot data!");
-          auto edge_type = snapshot.ReadUint();
+          auto to_gid = decoder->ReadUint();
+          if (!to_gid) throw RecoveryFailure("Invalid snapshot data!");
+          auto edge_type = decoder->ReadUint();
           if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
         }
       }
-
-      // Skip out edges.
-      auto out_size = snapshot.ReadUint();
-      if (!out_size) throw RecoveryFailure("Invalid snapshot data!");
-      for (uint64_t j = 0; j < *out_size; ++j) {
-        auto edge_gid = snapshot.ReadUint();
-        if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-        auto to_gid = snapshot.ReadUint();
-        if (!to_gid) throw RecoveryFailure("Invalid snapshot data!");
-        auto edge_type = snapshot.ReadUint();
-        if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
-      }
-    }
+    });
+    const auto last_vertex_gid = CheckSegmentGids(segment_gids);
     spdlog::info("Vertices are recovered.");
 
-    // Recover vertices (in/out edges).
+    // Recover vertices (in/out edges). All vertices exist at this point, so
+    // the edges of each vertex can be recovered independently of the others.
     spdlog::info("Recovering connectivity.");
-    if (!snapshot.SetPosition(info.offset_vertices)) throw RecoveryFailure("Couldn't read data from snapshot!");
-    for (auto &vertex : vertex_acc) {
-      {
-        auto marker = snapshot.ReadMarker();
-        if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Invalid snapshot data!");
-      }
-
-      spdlog::trace("Recovering connectivity for vertex {}.", vertex.gid.AsUint());
-      // Check vertex.
-      auto gid = snapshot.ReadUint();
-      if (!gid) throw RecoveryFailure("Invalid snapshot data!");
-      if (gid != vertex.gid.AsUint()) throw RecoveryFailure("Invalid snapshot data!");
+    std::vector<uint64_t> segment_last_edge_gids(info.vertex_segments.size(), 0);
+    ForEachSegment(path, info.vertex_segments, num_threads, &stats, [&](uint64_t index, Decoder *decoder) {
+      auto edge_acc = edges->access();
+      auto vertex_acc = vertices->access();
+      auto &segment_last_edge_gid = segment_last_edge_gids[index];
+      // Returns the reference of the edge, the edges without properties are
+      // created when they are first seen.
+      auto get_edge_ref = [&](uint64_t edge_gid) {
+        EdgeRef edge_ref(Gid::FromUint(edge_gid));
+        if (items.properties_on_edges) {
+          if (snapshot_has_edges) {
+            auto edge = edge_acc.find(Gid::FromUint(edge_gid));
+            if (edge == edge_acc.end()) throw RecoveryFailure("Invalid edge!");
+            edge_ref = EdgeRef(&*edge);
+          } else {
+            auto [edge, inserted] = edge_acc.insert(Edge{Gid::FromUint(edge_gid), nullptr});
+            edge_ref = EdgeRef(&*edge);
+          }
+        }
+        return edge_ref;
+      };
 
-      // Skip labels.
-      {
-        auto labels_size = snapshot.ReadUint();
-        if (!labels_size) throw RecoveryFailure("Invalid snapshot data!");
-        for (uint64_t j = 0; j < *labels_size; ++j) {
-          auto label = snapshot.ReadUint();
-          if (!label) throw RecoveryFailure("Invalid snapshot data!");
+      for (uint64_t i = 0; i < info.vertex_segments[index].count; ++i) {
+        {
+          auto marker = decoder->ReadMarker();
+          if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Invalid snapshot data!");
         }
-      }
 
-      // Skip properties.
-      {
-        auto props_size = snapshot.ReadUint();
-        if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-        for (uint64_t j = 0; j < *props_size; ++j) {
-          auto key = snapshot.ReadUint();
-          if (!key) throw RecoveryFailure("Invalid snapshot data!");
-          auto value = snapshot.SkipPropertyValue();
-          if (!value) throw RecoveryFailure("Invalid snapshot data!");
+        // Find vertex.
+        auto gid = decoder->ReadUint();
+        if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+        auto vertex_it = vertex_acc.find(Gid::FromUint(*gid));
+        if (vertex_it == vertex_acc.end()) throw RecoveryFailure("Invalid snapshot data!");
+        auto &vertex = *vertex_it;
+        spdlog::trace("Recovering connectivity for vertex {}.", vertex.gid.AsUint());
+        if (incremental) {
+          edge_count->fetch_sub(vertex.out_edges.size(), std::memory_order_acq_rel);
+          vertex.in_edges = AdjacencyList();
+          vertex.out_edges = AdjacencyList();
         }
-      }
 
-      // Recover in edges.
-      {
-        spdlog::trace("Recovering inbound edges for vertex {}.", vertex.gid.AsUint());
-        auto in_size = snapshot.ReadUint();
-        if (!in_size) throw RecoveryFailure("Invalid snapshot data!");
-        vertex.in_edges.reserve(*in_size);
-        for (uint64_t j = 0; j < *in_size; ++j) {
-          auto edge_gid = snapshot.ReadUint();
-          if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-          last_edge_gid = std::max(last_edge_gid, *edge_gid);
+        // Skip labels.
+        {
+          auto labels_size = decoder->ReadUint();
+          if (!labels_size) throw RecoveryFailure("Invalid snapshot data!");
+          for (uint64_t j = 0; j < *labels_size; ++j) {
+            auto label = decoder->ReadUint();
+            if (!label) throw RecoveryFailure("Invalid snapshot data!");
+          }
+        }
 
-          auto from_gid = snapshot.ReadUint();
-          if (!from_gid) throw RecoveryFailure("Invalid snapshot data!");
-          auto edge_type = snapshot.ReadUint();
-          if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+        // Skip properties.
+        {
+          auto props_size = decoder->ReadUint();
+          if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
+          for (uint64_t j = 0; j < *props_size; ++j) {
+            auto key = decoder->ReadUint();
+            if (!key) throw RecoveryFailure("Invalid snapshot data!");
+            auto value = decoder->SkipPropertyValue();
+            if (!value) throw RecoveryFailure("Invalid snapshot data!");
+          }
+        }
 
-          auto from_vertex = vertex_acc.find(Gid::FromUint(*from_gid));
-          if (from_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid from vertex!");
+        // Recover in edges.
+        {
+          spdlog::trace("Recovering inbound edges for vertex {}.", vertex.gid.AsUint());
+          auto in_size = decoder->ReadUint();
+          if (!in_size) throw RecoveryFailure("Invalid snapshot data!");
+          vertex.in_edges.reserve(*in_size);
+          for (uint64_t j = 0; j < *in_size; ++j) {
+            auto edge_gid = decoder->ReadUint();
+            if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
+            segment_last_edge_gid = std::max(segment_last_edge_gid, *edge_gid);
+
+            auto from_gid = decoder->ReadUint();
+            if (!from_gid) throw RecoveryFailure("Invalid snapshot data!");
+            auto edge_type = decoder->ReadUint();
+            if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+
+            auto from_vertex = vertex_acc.find(Gid::FromUint(*from_gid));
+            if (from_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid from vertex!");
+
+            auto edge_ref = get_edge_ref(*edge_gid);
+            SPDLOG_TRACE("Recovered inbound edge {} with label \"{}\" from vertex {}.", *edge_gid,
+                         name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), from_vertex->gid.AsUint());
+            vertex.in_edges.Insert(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
+          }
+        }
 
-          EdgeRef edge_ref(Gid::FromUint(*edge_gid));
-          if (items.properties_on_edges) {
-            if (snapshot_has_edges) {
-              auto edge = edge_acc.find(Gid::FromUint(*edge_gid));
-              if (edge == edge_acc.end()) throw RecoveryFailure("Invalid edge!");
-              edge_ref = EdgeRef(&*edge);
-            } else {
-              auto [edge, inserted] = edge_acc.insert(Edge{Gid::FromUint(*edge_gid), nullptr});
-              edge_ref = EdgeRef(&*edge);
-            }
+        // Recover out edges.
+        {
+          spdlog::trace("Recovering outbound edges for vertex {}.", vertex.gid.AsUint());
+          auto out_size = decoder->ReadUint();
+          if (!out_size) throw RecoveryFailure("Invalid snapshot data!");
+          vertex.out_edges.reserve(*out_size);
+          for (uint64_t j = 0; j < *out_size; ++j) {
+            auto edge_gid = decoder->ReadUint();
+            if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
+            segment_last_edge_gid = std::max(segment_last_edge_gid, *edge_gid);
+
+            auto to_gid = decoder->ReadUint();
+            if (!to_gid) throw RecoveryFailure("Invalid snapshot data!");
+            auto edge_type = decoder->ReadUint();
+            if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+
+            auto to_vertex = vertex_acc.find(Gid::FromUint(*to_gid));
+            if (to_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid to vertex!");
+
+            auto edge_ref = get_edge_ref(*edge_gid);
+            SPDLOG_TRACE("Recovered outbound edge {} with label \"{}\" to vertex {}.", *edge_gid,
+                         name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), to_vertex->gid.AsUint());
+            vertex.out_edges.Insert(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
           }
-          SPDLOG_TRACE("Recovered inbound edge {} with label \"{}\" from vertex {}.", *edge_gid,
-                       name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), from_vertex->gid.AsUint());
-          vertex.in_edges.emplace_back(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
+          // Increment edge count. We only increment the count here because the
+          // information is duplicated in in_edges.
+          edge_count->fetch_add(*out_size, std::memory_order_acq_rel);
         }
       }
+    });
+    for (const auto segment_last_edge_gid : segment_last_edge_gids) {
+      last_edge_gid = std::max(last_edge_gid, segment_last_edge_gid);
+    }
+    spdlog::info("Connectivity is recovered.");
 
-      // Recover out edges.
-      {
-        spdlog::trace("Recovering outbound edges for vertex {}.", vertex.gid.AsUint());
-        auto out_size = snapshot.ReadUint();
-        if (!out_size) throw RecoveryFailure("Invalid snapshot data!");
-        vertex.out_edges.reserve(*out_size);
-        for (uint64_t j = 0; j < *out_size; ++j) {
-          auto edge_gid = snapshot.ReadUint();
-          if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
-          last_edge_gid = std::max(last_edge_gid, *edge_gid);
+    // Remove deleted objects. The edges of the deleted vertices were removed
+    // from the other vertices when their connectivity was recovered above.
+    if (incremental) {
+      spdlog::info("Removing deleted objects.");
+      if (!snapshot.SetPosition(info.offset_deleted_objects)) {
+        throw RecoveryFailure("Couldn't read data from snapshot!");
+      }
 
-          auto to_gid = snapshot.ReadUint();
-          if (!to_gid) throw RecoveryFailure("Invalid snapshot data!");
-          auto edge_type = snapshot.ReadUint();
-          if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+      auto marker = snapshot.ReadMarker();
+      if (!marker || *marker != Marker::SECTION_DELETED_OBJECTS) throw RecoveryFailure("Invalid snapshot data!");
 
-          auto to_vertex = vertex_acc.find(Gid::FromUint(*to_gid));
-          if (to_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid to vertex!");
+      {
+        auto edge_acc = edges->access();
+        auto size = snapshot.ReadUint();
+        if (!size) throw RecoveryFailure("Invalid snapshot data!");
+        for (uint64_t i = 0; i < *size; ++i) {
+          auto gid = snapshot.ReadUint();
+          if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+          // The object could be created and deleted after the previous
+          // snapshot.
+          edge_acc.remove(Gid::FromUint(*gid));
+        }
+      }
 
-          EdgeRef edge_ref(Gid::FromUint(*edge_gid));
-          if (items.properties_on_edges) {
-            if (snapshot_has_edges) {
-              auto edge = edge_acc.find(Gid::FromUint(*edge_gid));
-              if (edge == edge_acc.end()) throw RecoveryFailure("Invalid edge!");
-              edge_ref = EdgeRef(&*edge);
-            } else {
-              auto [edge, inserted] = edge_acc.insert(Edge{Gid::FromUint(*edge_gid), nullptr});
-              edge_ref = EdgeRef(&*edge);
-            }
-          }
-          SPDLOG_TRACE("Recovered outbound edge {} with label \"{}\" to vertex {}.", *edge_gid,
-                       name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), to_vertex->gid.AsUint());
-          vertex.out_edges.emplace_back(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
+      {
+        auto vertex_acc = vertices->access();
+        auto size = snapshot.ReadUint();
+        if (!size) throw RecoveryFailure("Invalid snapshot data!");
+        for (uint64_t i = 0; i < *size; ++i) {
+          auto gid = snapshot.ReadUint();
+          if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+          auto vertex = vertex_acc.find(Gid::FromUint(*gid));
+          if (vertex == vertex_acc.end()) continue;
+          edge_count->fetch_sub(vertex->out_edges.size(), std::memory_order_acq_rel);
+          vertex_acc.remove(Gid::FromUint(*gid));
         }
-        // Increment edge count. We only increment the count here because the
-        // information is duplicated in in_edges.
-        edge_count->fetch_add(*out_size, std::memory_order_acq_rel);
       }
+      spdlog::info("Deleted objects are removed.");
     }
-    spdlog::info("Connectivity is recovered.");
 
     // Set initial values for edge/vertex ID generators.
     ret.next_edge_id = last_edge_gid + 1;
@@ -529,6 +792,74 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       }
       spdlog::info("Metadata of label+property indices are recovered.");
     }
+
+    // Snapshot version should be checked since edge type indices were
+    // implemented in later versions of snapshot.
+    if (*version >= kEdgeTypeIndexVersion) {
+      // Recover edge type indices.
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} edge type indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto edge_type = snapshot.ReadUint();
+        if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.edge_type, get_edge_type_from_id(*edge_type),
+                                    "The edge type index already exists!");
+        SPDLOG_TRACE("Recovered metadata of edge type index for :{}",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)));
+      }
+      spdlog::info("Metadata of edge type indices are recovered.");
+    }
+
+    // Snapshot version should be checked since edge type+property indices
+    // were implemented in later versions of snapshot.
+    if (*version >= kEdgeTypePropertyIndexVersion) {
+      // Recover edge type+property indices.
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} edge type+property indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto edge_type = snapshot.ReadUint();
+        if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+        auto property = snapshot.ReadUint();
+        if (!property) throw RecoveryFailure("Invalid snapshot data!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.edge_type_property,
+                                    {get_edge_type_from_id(*edge_type), get_property_from_id(*property)},
+                                    "The edge type+property index already exists!");
+        SPDLOG_TRACE("Recovered metadata of edge type+property index for :{}({})",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)),
+                     name_id_mapper->IdToName(snapshot_id_map.at(*property)));
+      }
+      spdlog::info("Metadata of edge type+property indices are recovered.");
+    }
+
+    // Snapshot version should be checked since composite indices were
+    // implemented in later versions of snapshot.
+    if (*version >= kLabelPropertyCompositeIndexVersion) {
+      // Recover label+property composite indices.
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} label+property composite indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Invalid snapshot data!");
+        auto properties_count = snapshot.ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid snapshot data!");
+        std::vector<PropertyId> properties;
+        properties.reserve(*properties_count);
+        for (uint64_t j = 0; j < *properties_count; ++j) {
+          auto property = snapshot.ReadUint();
+          if (!property) throw RecoveryFailure("Invalid snapshot data!");
+          properties.push_back(get_property_from_id(*property));
+        }
+        AddRecoveredIndexConstraint(&indices_constraints.indices.label_property_composite,
+                                    {get_label_from_id(*label), std::move(properties)},
+                                    "The label+property composite index already exists!");
+        SPDLOG_TRACE("Recovered metadata of label+property composite index for :{}",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)));
+      }
+      spdlog::info("Metadata of label+property composite indices are recovered.");
+    }
     spdlog::info("Metadata of indices are recovered.");
   }
 
@@ -601,6 +932,9 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       throw RecoveryFailure("Invalid snapshot data!");
     }
 
+    // Each snapshot of a chain contains the whole epoch history.
+    epoch_history->clear();
+
     for (int i = 0; i < *history_size; ++i) {
       auto maybe_epoch_id = snapshot.ReadString();
       if (!maybe_epoch_id) {
@@ -615,6 +949,11 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   }
 
   spdlog::info("Metadata recovered.");
+  stats += snapshot.GetCompressionStats();
+  if (stats.compressed_bytes != 0) {
+    spdlog::info("Snapshot decompressed from {} to {} bytes ({:.2f}x) at {:.2f} MiB/s.", stats.compressed_bytes,
+                 stats.uncompressed_bytes, stats.Ratio(), stats.Throughput());
+  }
   // Recover timestamp.
   ret.next_timestamp = info.start_timestamp + 1;
 
@@ -624,12 +963,275 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   return {info, ret, std::move(indices_constraints)};
 }
 
+namespace {
+
+// Number of chunks of the edges and the vertices per snapshot thread. Having
+// more chunks than threads balances the work between the threads.
+constexpr uint64_t kSnapshotSegmentsPerThread = 8;
+// Size after which a snapshot segment is ended, which bounds the memory that a
+// snapshot thread uses to encode a segment.
+constexpr uint64_t kSnapshotSegmentBufferSize = 16ULL * 1024 * 1024;
+
+template <typename TId>
+void WriteMapping(Encoder *snapshot, std::unordered_set<uint64_t> *used_ids, TId mapping) {
+  used_ids->insert(mapping.AsUint());
+  snapshot->WriteUint(mapping.AsUint());
+}
+
+// Writes the edge if it is visible to the transaction and returns whether it
+// was written.
+bool WriteEdge(Encoder *snapshot, Edge &edge, Transaction *transaction, Indices *indices, Constraints *constraints,
+               Config::Items items, std::unordered_set<uint64_t> *used_ids) {
+  // The edge visibility check must be done here manually because we don't
+  // allow direct access to the edges through the public API.
+  bool is_visible = true;
+  Delta *delta = nullptr;
+  {
+    std::lock_guard<utils::SeqLock> guard(edge.lock);
+    is_visible = !edge.deleted;
+    delta = edge.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+      case Delta::Action::RECREATE_OBJECT: {
+        is_visible = true;
+        break;
+      }
+      case Delta::Action::DELETE_OBJECT: {
+        is_visible = false;
+        break;
+      }
+    }
+  });
+  if (!is_visible) return false;
+  EdgeRef edge_ref(&edge);
+  // Here we create an edge accessor that we will use to get the
+  // properties of the edge. The accessor is created with an invalid
+  // type and invalid from/to pointers because we don't know them here,
+  // but that isn't an issue because we won't use that part of the API
+  // here.
+  auto ea = EdgeAccessor{edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, transaction, indices, constraints, items};
+
+  // Get edge data.
+  auto maybe_props = ea.Properties(View::OLD);
+  MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+
+  // Store the edge.
+  snapshot->WriteMarker(Marker::SECTION_EDGE);
+  snapshot->WriteUint(edge.gid.AsUint());
+  const auto &props = maybe_props.GetValue();
+  snapshot->WriteUint(props.size());
+  for (const auto &item : props) {
+    WriteMapping(snapshot, used_ids, item.first);
+    snapshot->WritePropertyValue(item.second);
+  }
+  return true;
+}
+
+// Writes the vertex if it is visible to the transaction and returns whether it
+// was written.
+bool WriteVertex(Encoder *snapshot, Vertex &vertex, Transaction *transaction, Indices *indices,
+                 Constraints *constraints, Config::Items items, std::unordered_set<uint64_t> *used_ids) {
+  // The visibility check is implemented for vertices so we use it here.
+  auto va = VertexAccessor::Create(&vertex, transaction, indices, constraints, items, View::OLD);
+  if (!va) return false;
+
+  // Get vertex data.
+  // TODO (mferencevic): All of these functions could be written into a
+  // single function so that we traverse the undo deltas only once.
+  auto maybe_labels = va->Labels(View::OLD);
+  MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
+  auto maybe_props = va->Properties(View::OLD);
+  MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+  auto maybe_in_edges = va->InEdges(View::OLD);
+  MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
+  auto maybe_out_edges = va->OutEdges(View::OLD);
+  MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
+
+  // Store the vertex.
+  snapshot->WriteMarker(Marker::SECTION_VERTEX);
+  snapshot->WriteUint(vertex.gid.AsUint());
+  const auto &labels = maybe_labels.GetValue();
+  snapshot->WriteUint(labels.size());
+  for (const auto &item : labels) {
+    WriteMapping(snapshot, used_ids, item);
+  }
+  const auto &props = maybe_props.GetValue();
+  snapshot->WriteUint(props.size());
+  for (const auto &item : props) {
+    WriteMapping(snapshot, used_ids, item.first);
+    snapshot->WritePropertyValue(item.second);
+  }
+  const auto &in_edges = maybe_in_edges.GetValue();
+  snapshot->WriteUint(in_edges.size());
+  for (const auto &item : in_edges) {
+    snapshot->WriteUint(item.Gid().AsUint());
+    snapshot->WriteUint(item.FromVertex().Gid().AsUint());
+    WriteMapping(snapshot, used_ids, item.EdgeType());
+  }
+  const auto &out_edges = maybe_out_edges.GetValue();
+  snapshot->WriteUint(out_edges.size());
+  for (const auto &item : out_edges) {
+    snapshot->WriteUint(item.Gid().AsUint());
+    snapshot->WriteUint(item.ToVertex().Gid().AsUint());
+    WriteMapping(snapshot, used_ids, item.EdgeType());
+  }
+  return true;
+}
+
+// Splits the objects of the skip list into chunks and writes them to the
+// snapshot using `num_threads` threads. A chunk is written as a new segment
+// every `kSnapshotSegmentBufferSize` bytes. With more than one thread each
+// thread encodes the segments into memory and appends them to the snapshot
+// once they are complete, so no temporary files are needed. The segments are
+// stored in the snapshot in the order in which they were appended, but they are
+// returned in the order of the gids of their objects. `write_object(encoder,
+// object, used_ids)` writes a single object and returns whether it was
+// written.
+template <typename TAccessor, typename TFunc>
+std::vector<SnapshotSegment> WriteSegments(Encoder *snapshot, std::string_view description, TAccessor *acc,
+                                           uint64_t num_threads, std::vector<std::unordered_set<uint64_t>> *used_ids,
+                                           const TFunc &write_object) {
+  const auto chunks = acc->partition(num_threads * kSnapshotSegmentsPerThread);
+  const auto list_end = acc->end();
+
+  // Calls `end_segment(count)` after each segment of the chunk is written.
+  auto write_chunk = [&](Encoder *encoder, uint64_t index, std::unordered_set<uint64_t> *chunk_used_ids,
+                         const auto &end_segment) {
+    utils::Timer timer;
+    const auto &[begin, end] = chunks[index];
+    // The object at the end of the chunk can be removed from the skip list
+    // while we iterate, in which case the iterator wouldn't stop at it, so
+    // the end of the chunk is also checked by the gid.
+    std::optional<Gid> end_gid;
+    if (end != list_end) end_gid = end->gid;
+    // Each segment is decoded on its own.
+    encoder->ResetInternedStrings();
+    uint64_t count = 0;
+    uint64_t segment_count = 0;
+    uint64_t segment_begin = encoder->GetPosition();
+    for (auto it = begin; it != end; ++it) {
+      if (end_gid && it->gid >= *end_gid) break;
+      if (!write_object(encoder, *it, chunk_used_ids)) continue;
+      ++count;
+      ++segment_count;
+      if (encoder->GetPosition() - segment_begin >= kSnapshotSegmentBufferSize) {
+        end_segment(segment_count);
+        encoder->ResetInternedStrings();
+        segment_count = 0;
+        segment_begin = encoder->GetPosition();
+      }
+    }
+    // A chunk without objects is written as an empty segment.
+    if (segment_count > 0 || count == 0) end_segment(segment_count);
+    const auto elapsed = timer.Elapsed().count();
+    spdlog::info("Snapshot chunk {}/{} of {} written: {} objects in {:.3f}s ({:.0f} objects/s).", index + 1,
+                 chunks.size(), description, count, elapsed, elapsed > 0 ? static_cast<double>(count) / elapsed : 0.0);
+  };
+
+  std::vector<SnapshotSegment> segments;
+  const uint64_t num_workers = std::min(num_threads, static_cast<uint64_t>(chunks.size()));
+  if (num_workers <= 1) {
+    for (uint64_t i = 0; i < chunks.size(); ++i) {
+      auto offset = snapshot->GetPosition();
+      write_chunk(snapshot, i, &(*used_ids)[0], [&](uint64_t segment_count) {
+        segments.push_back({offset, segment_count});
+        offset = snapshot->GetPosition();
+      });
+    }
+    return segments;
+  }
+
+  // Segments of each chunk.
+  std::vector<std::vector<SnapshotSegment>> chunk_segments(chunks.size());
+  std::mutex snapshot_lock;
+  std::atomic<uint64_t> next_chunk{0};
+  std::atomic<bool> stop{false};
+  std::mutex exception_lock;
+  std::exception_ptr exception;
+  auto worker = [&](uint64_t worker_id) {
+    try {
+      Encoder encoder;
+      encoder.InitializeMemory(kVersion);
+      while (!stop.load(std::memory_order_acquire)) {
+        const auto index = next_chunk.fetch_add(1, std::memory_order_acq_rel);
+        if (index >= chunks.size()) break;
+        write_chunk(&encoder, index, &(*used_ids)[worker_id], [&](uint64_t segment_count) {
+          const auto &memory = encoder.GetMemory();
+          {
+            std::lock_guard<std::mutex> guard(snapshot_lock);
+            chunk_segments[index].push_back({snapshot->GetPosition(), segment_count});
+            snapshot->Write(memory.data(), memory.size());
+          }
+          encoder.ClearMemory();
+        });
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> guard(exception_lock);
+      if (!exception) exception = std::current_exception();
+      stop.store(true, std::memory_order_release);
+    }
+  };
+
+  {
+    std::vector<std::thread> threads;
+    utils::OnScopeExit join_threads{[&] {
+      for (auto &thread : threads) {
+        thread.join();
+      }
+    }};
+    threads.reserve(num_workers - 1);
+    for (uint64_t i = 1; i < num_workers; ++i) {
+      threads.emplace_back(worker, i);
+    }
+    worker(0);
+  }
+  if (exception) std::rethrow_exception(exception);
+
+  for (auto &chunk : chunk_segments) {
+    segments.insert(segments.end(), chunk.begin(), chunk.end());
+  }
+  return segments;
+}
+
+// Writes the objects of the skip list with the given gids as a single segment.
+// The gids of the objects that don't exist anymore are appended to
+// `deleted_gids`.
+template <typename TAccessor, typename TFunc>
+SnapshotSegment WriteChangedObjects(Encoder *snapshot, TAccessor *acc, const std::vector<Gid> &gids,
+                                    std::vector<Gid> *deleted_gids, const TFunc &write_object) {
+  SnapshotSegment segment{snapshot->GetPosition(), 0};
+  snapshot->ResetInternedStrings();
+  for (const auto gid : gids) {
+    auto it = acc->find(gid);
+    if (it != acc->end() && write_object(snapshot, *it)) {
+      ++segment.count;
+    } else {
+      deleted_gids->push_back(gid);
+    }
+  }
+  return segment;
+}
+
+}  // namespace
+
 void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snapshot_directory,
                     const std::filesystem::path &wal_directory, uint64_t snapshot_retention_count,
+                    uint64_t num_threads, Config::Durability::Compression compression, const SnapshotChanges *changes,
                     utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper,
                     Indices *indices, Constraints *constraints, Config::Items items, const std::string &uuid,
                     const std::string_view epoch_id, const std::deque<std::pair<std::string, uint64_t>> &epoch_history,
                     utils::FileRetainer *file_retainer) {
+  if (num_threads == 0) num_threads = 1;
+
   // Ensure that the storage directory exists.
   utils::EnsureDirOrDie(snapshot_directory);
 
@@ -648,6 +1250,8 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
   uint64_t offset_mapper = 0;
   uint64_t offset_metadata = 0;
   uint64_t offset_epoch_history = 0;
+  uint64_t offset_segments = 0;
+  uint64_t offset_deleted_objects = 0;
   {
     snapshot.WriteMarker(Marker::SECTION_OFFSETS);
     offset_offsets = snapshot.GetPosition();
@@ -658,139 +1262,68 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     snapshot.WriteUint(offset_mapper);
     snapshot.WriteUint(offset_epoch_history);
     snapshot.WriteUint(offset_metadata);
+    snapshot.WriteUint(offset_segments);
+    snapshot.WriteUint(offset_deleted_objects);
   }
 
-  // Object counters.
-  uint64_t edges_count = 0;
-  uint64_t vertices_count = 0;
+  // The offsets are patched at the end so only the data after them is
+  // compressed.
+  snapshot.StartCompression(compression);
 
   // Mapper data.
-  std::unordered_set<uint64_t> used_ids;
-  auto write_mapping = [&snapshot, &used_ids](auto mapping) {
-    used_ids.insert(mapping.AsUint());
-    snapshot.WriteUint(mapping.AsUint());
-  };
+  std::vector<std::unordered_set<uint64_t>> used_ids(num_threads);
+  auto write_mapping = [&snapshot, &used_ids](auto mapping) { WriteMapping(&snapshot, &used_ids[0], mapping); };
 
-  // Store all edges.
+  // Store all edges. An incremental snapshot stores only the modified ones.
+  std::vector<SnapshotSegment> edge_segments;
+  std::vector<Gid> deleted_edges;
   if (items.properties_on_edges) {
     offset_edges = snapshot.GetPosition();
     auto acc = edges->access();
-    for (auto &edge : acc) {
-      // The edge visibility check must be done here manually because we don't
-      // allow direct access to the edges through the public API.
-      bool is_visible = true;
-      Delta *delta = nullptr;
-      {
-        std::lock_guard<utils::SpinLock> guard(edge.lock);
-        is_visible = !edge.deleted;
-        delta = edge.delta;
-      }
-      ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
-        switch (delta.action) {
-          case Delta::Action::ADD_LABEL:
-          case Delta::Action::REMOVE_LABEL:
-          case Delta::Action::SET_PROPERTY:
-          case Delta::Action::ADD_IN_EDGE:
-          case Delta::Action::ADD_OUT_EDGE:
-          case Delta::Action::REMOVE_IN_EDGE:
-          case Delta::Action::REMOVE_OUT_EDGE:
-            break;
-          case Delta::Action::RECREATE_OBJECT: {
-            is_visible = true;
-            break;
-          }
-          case Delta::Action::DELETE_OBJECT: {
-            is_visible = false;
-            break;
-          }
-        }
-      });
-      if (!is_visible) continue;
-      EdgeRef edge_ref(&edge);
-      // Here we create an edge accessor that we will use to get the
-      // properties of the edge. The accessor is created with an invalid
-      // type and invalid from/to pointers because we don't know them here,
-      // but that isn't an issue because we won't use that part of the API
-      // here.
-      auto ea =
-          EdgeAccessor{edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, transaction, indices, constraints, items};
-
-      // Get edge data.
-      auto maybe_props = ea.Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-
-      // Store the edge.
-      {
-        snapshot.WriteMarker(Marker::SECTION_EDGE);
-        snapshot.WriteUint(edge.gid.AsUint());
-        const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
-        }
-      }
-
-      ++edges_count;
+    if (changes) {
+      edge_segments.push_back(
+          WriteChangedObjects(&snapshot, &acc, changes->edges, &deleted_edges, [&](Encoder *encoder, Edge &edge) {
+            return WriteEdge(encoder, edge, transaction, indices, constraints, items, &used_ids[0]);
+          }));
+    } else {
+      edge_segments = WriteSegments(
+          &snapshot, "edges", &acc, num_threads, &used_ids,
+          [&](Encoder *encoder, Edge &edge, std::unordered_set<uint64_t> *segment_used_ids) {
+            return WriteEdge(encoder, edge, transaction, indices, constraints, items, segment_used_ids);
+          });
     }
   }
 
-  // Store all vertices.
+  // Store all vertices. An incremental snapshot stores only the modified ones.
+  std::vector<SnapshotSegment> vertex_segments;
+  std::vector<Gid> deleted_vertices;
   {
     offset_vertices = snapshot.GetPosition();
     auto acc = vertices->access();
-    for (auto &vertex : acc) {
-      // The visibility check is implemented for vertices so we use it here.
-      auto va = VertexAccessor::Create(&vertex, transaction, indices, constraints, items, View::OLD);
-      if (!va) continue;
-
-      // Get vertex data.
-      // TODO (mferencevic): All of these functions could be written into a
-      // single function so that we traverse the undo deltas only once.
-      auto maybe_labels = va->Labels(View::OLD);
-      MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
-      auto maybe_props = va->Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-      auto maybe_in_edges = va->InEdges(View::OLD);
-      MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
-      auto maybe_out_edges = va->OutEdges(View::OLD);
-      MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
-
-      // Store the vertex.
-      {
-        snapshot.WriteMarker(Marker::SECTION_VERTEX);
-        snapshot.WriteUint(vertex.gid.AsUint());
-        const auto &labels = maybe_labels.GetValue();
-        snapshot.WriteUint(labels.size());
-        for (const auto &item : labels) {
-          write_mapping(item);
-        }
-        const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
-        }
-        const auto &in_edges = maybe_in_edges.GetValue();
-        snapshot.WriteUint(in_edges.size());
-        for (const auto &item : in_edges) {
-          snapshot.WriteUint(item.Gid().AsUint());
-          snapshot.WriteUint(item.FromVertex().Gid().AsUint());
-          write_mapping(item.EdgeType());
-        }
-        const auto &out_edges = maybe_out_edges.GetValue();
-        snapshot.WriteUint(out_edges.size());
-        for (const auto &item : out_edges) {
-          snapshot.WriteUint(item.Gid().AsUint());
-          snapshot.WriteUint(item.ToVertex().Gid().AsUint());
-          write_mapping(item.EdgeType());
-        }
-      }
-
-      ++vertices_count;
+    if (changes) {
+      vertex_segments.push_back(WriteChangedObjects(
+          &snapshot, &acc, changes->vertices, &deleted_vertices, [&](Encoder *encoder, Vertex &vertex) {
+            return WriteVertex(encoder, vertex, transaction, indices, constraints, items, &used_ids[0]);
+          }));
+    } else {
+      vertex_segments = WriteSegments(
+          &snapshot, "vertices", &acc, num_threads, &used_ids,
+          [&](Encoder *encoder, Vertex &vertex, std::unordered_set<uint64_t> *segment_used_ids) {
+            return WriteVertex(encoder, vertex, transaction, indices, constraints, items, segment_used_ids);
+          });
     }
   }
 
+  // Object counters.
+  uint64_t edges_count = 0;
+  uint64_t vertices_count = 0;
+  for (const auto &segment : edge_segments) {
+    edges_count += segment.count;
+  }
+  for (const auto &segment : vertex_segments) {
+    vertices_count += segment.count;
+  }
+
   // Write indices.
   {
     offset_indices = snapshot.GetPosition();
@@ -814,6 +1347,38 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
         write_mapping(item.second);
       }
     }
+
+    // Write edge type indices.
+    {
+      auto edge_type = indices->edge_type_index.ListIndices();
+      snapshot.WriteUint(edge_type.size());
+      for (const auto &item : edge_type) {
+        write_mapping(item);
+      }
+    }
+
+    // Write edge type+property indices.
+    {
+      auto edge_type_property = indices->edge_type_property_index.ListIndices();
+      snapshot.WriteUint(edge_type_property.size());
+      for (const auto &item : edge_type_property) {
+        write_mapping(item.first);
+        write_mapping(item.second);
+      }
+    }
+
+    // Write label+property composite indices.
+    {
+      auto label_property_composite = indices->label_property_composite_index.ListIndices();
+      snapshot.WriteUint(label_property_composite.size());
+      for (const auto &item : label_property_composite) {
+        write_mapping(item.first);
+        snapshot.WriteUint(item.second.size());
+        for (const auto &property : item.second) {
+          write_mapping(property);
+        }
+      }
+    }
   }
 
   // Write constraints.
@@ -849,8 +1414,11 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
   {
     offset_mapper = snapshot.GetPosition();
     snapshot.WriteMarker(Marker::SECTION_MAPPER);
-    snapshot.WriteUint(used_ids.size());
-    for (auto item : used_ids) {
+    for (uint64_t i = 1; i < used_ids.size(); ++i) {
+      used_ids[0].merge(used_ids[i]);
+    }
+    snapshot.WriteUint(used_ids[0].size());
+    for (auto item : used_ids[0]) {
       snapshot.WriteUint(item);
       snapshot.WriteString(name_id_mapper->IdToName(item));
     }
@@ -867,6 +1435,31 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     }
   }
 
+  // Write segments.
+  {
+    offset_segments = snapshot.GetPosition();
+    snapshot.WriteMarker(Marker::SECTION_SEGMENTS);
+    for (const auto *segments : {&edge_segments, &vertex_segments}) {
+      snapshot.WriteUint(segments->size());
+      for (const auto &segment : *segments) {
+        snapshot.WriteUint(segment.offset);
+        snapshot.WriteUint(segment.count);
+      }
+    }
+  }
+
+  // Write deleted objects.
+  if (changes) {
+    offset_deleted_objects = snapshot.GetPosition();
+    snapshot.WriteMarker(Marker::SECTION_DELETED_OBJECTS);
+    for (const auto *gids : {&deleted_edges, &deleted_vertices}) {
+      snapshot.WriteUint(gids->size());
+      for (const auto gid : *gids) {
+        snapshot.WriteUint(gid.AsUint());
+      }
+    }
+  }
+
   // Write metadata.
   {
     offset_metadata = snapshot.GetPosition();
@@ -876,6 +1469,8 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     snapshot.WriteUint(transaction->start_timestamp);
     snapshot.WriteUint(edges_count);
     snapshot.WriteUint(vertices_count);
+    snapshot.WriteUint(changes ? changes->base_start_timestamp : transaction->start_timestamp);
+    snapshot.WriteUint(changes ? changes->previous_start_timestamp : transaction->start_timestamp);
   }
 
   // Write true offsets.
@@ -888,14 +1483,22 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     snapshot.WriteUint(offset_mapper);
     snapshot.WriteUint(offset_epoch_history);
     snapshot.WriteUint(offset_metadata);
+    snapshot.WriteUint(offset_segments);
+    snapshot.WriteUint(offset_deleted_objects);
   }
 
   // Finalize snapshot file.
   snapshot.Finalize();
+  if (compression != Config::Durability::Compression::NONE) {
+    const auto &stats = snapshot.GetCompressionStats();
+    spdlog::info("Snapshot compressed from {} to {} bytes ({:.2f}x) at {:.2f} MiB/s.", stats.uncompressed_bytes,
+                 stats.compressed_bytes, stats.Ratio(), stats.Throughput());
+  }
   spdlog::info("Snapshot creation successful!");
 
-  // Ensure exactly `snapshot_retention_count` snapshots exist.
-  std::vector<std::pair<uint64_t, std::filesystem::path>> old_snapshot_files;
+  // Ensure exactly `snapshot_retention_count` snapshots exist. The snapshots
+  // that the retained incremental snapshots are based on are kept as well.
+  std::vector<std::tuple<uint64_t, uint64_t, std::filesystem::path>> old_snapshot_files;
   {
     std::error_code error_code;
     for (const auto &item : std::filesystem::directory_iterator(snapshot_directory, error_code)) {
@@ -904,7 +1507,7 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
       try {
         auto info = ReadSnapshotInfo(item.path());
         if (info.uuid != uuid) continue;
-        old_snapshot_files.emplace_back(info.start_timestamp, item.path());
+        old_snapshot_files.emplace_back(info.start_timestamp, info.base_start_timestamp, item.path());
       } catch (const RecoveryFailure &e) {
         spdlog::warn("Found a corrupt snapshot file {} becuase of: {}", item.path(), e.what());
         continue;
@@ -920,8 +1523,15 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     std::sort(old_snapshot_files.begin(), old_snapshot_files.end());
     if (old_snapshot_files.size() > snapshot_retention_count - 1) {
       auto num_to_erase = old_snapshot_files.size() - (snapshot_retention_count - 1);
+      uint64_t oldest_base_timestamp = changes ? changes->base_start_timestamp : transaction->start_timestamp;
+      for (size_t i = num_to_erase; i < old_snapshot_files.size(); ++i) {
+        oldest_base_timestamp = std::min(oldest_base_timestamp, std::get<1>(old_snapshot_files[i]));
+      }
+      while (num_to_erase > 0 && std::get<0>(old_snapshot_files[num_to_erase - 1]) >= oldest_base_timestamp) {
+        --num_to_erase;
+      }
       for (size_t i = 0; i < num_to_erase; ++i) {
-        const auto &[start_timestamp, snapshot_path] = old_snapshot_files[i];
+        const auto &[start_timestamp, base_start_timestamp, snapshot_path] = old_snapshot_files[i];
         file_retainer->DeleteFile(snapshot_path);
       }
       old_snapshot_files.erase(old_snapshot_files.begin(), old_snapshot_files.begin() + num_to_erase);
@@ -929,7 +1539,7 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
   }
 
   // Ensure that only the absolutely necessary WAL files exist.
-  if (old_snapshot_files.size() == snapshot_retention_count - 1 && utils::DirExists(wal_directory)) {
+  if (old_snapshot_files.size() >= snapshot_retention_count - 1 && utils::DirExists(wal_directory)) {
     std::vector<std::tuple<uint64_t, uint64_t, uint64_t, std::filesystem::path>> wal_files;
     std::error_code error_code;
     for (const auto &item : std::filesystem::directory_iterator(wal_directory, error_code)) {
@@ -952,7 +1562,7 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     std::sort(wal_files.begin(), wal_files.end());
     uint64_t snapshot_start_timestamp = transaction->start_timestamp;
     if (!old_snapshot_files.empty()) {
-      snapshot_start_timestamp = old_snapshot_files.front().first;
+      snapshot_start_timestamp = std::get<0>(old_snapshot_files.front());
     }
     std::optional<uint64_t> pos = 0;
     for (uint64_t i = 0; i < wal_files.size(); ++i) {
@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/constraints.hpp"
@@ -28,6 +29,14 @@
 
 namespace storage::durability {
 
+/// Contiguous part of the edges or the vertices of a snapshot. The segments
+/// are written in parallel when the snapshot is created and they can be read
+/// independently of each other.
+struct SnapshotSegment {
+  uint64_t offset;
+  uint64_t count;
+};
+
 /// Structure used to hold information about a snapshot.
 struct SnapshotInfo {
   uint64_t offset_edges;
@@ -37,12 +46,39 @@ struct SnapshotInfo {
   uint64_t offset_mapper;
   uint64_t offset_epoch_history;
   uint64_t offset_metadata;
+  // `0` for snapshots written before the segments were introduced.
+  uint64_t offset_segments{0};
+  // `0` for full snapshots.
+  uint64_t offset_deleted_objects{0};
 
   std::string uuid;
   std::string epoch_id;
   uint64_t start_timestamp;
   uint64_t edges_count;
   uint64_t vertices_count;
+  // Start timestamps of the full snapshot that starts the chain of the
+  // snapshot and of the snapshot it is relative to. Both are equal to
+  // `start_timestamp` for full snapshots.
+  uint64_t base_start_timestamp;
+  uint64_t previous_start_timestamp;
+
+  // Segments of the edges and vertices sections in the order of their gids.
+  // Older snapshots are described with a single segment for each section.
+  std::vector<SnapshotSegment> edge_segments;
+  std::vector<SnapshotSegment> vertex_segments;
+
+  bool IsIncremental() const { return previous_start_timestamp != start_timestamp; }
+};
+
+/// Objects modified since the previous snapshot. An incremental snapshot
+/// contains only these objects and it is applied on top of the previous
+/// snapshot during the recovery.
+struct SnapshotChanges {
+  uint64_t base_start_timestamp;
+  uint64_t previous_start_timestamp;
+  // Gids of the modified objects, sorted.
+  std::vector<Gid> vertices;
+  std::vector<Gid> edges;
 };
 
 /// Structure used to hold information about the snapshot that has been
@@ -57,16 +93,25 @@ struct RecoveredSnapshot {
 /// @throw RecoveryFailure
 SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path);
 
-/// Function used to load the snapshot data into the storage.
+/// Function used to load the snapshot data into the storage. The segments of
+/// the edges and vertices are loaded using `num_threads` threads (including
+/// the calling thread). An incremental snapshot is applied on top of the data
+/// loaded from the previous snapshot of its chain.
 /// @throw RecoveryFailure
 RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipList<Vertex> *vertices,
                                utils::SkipList<Edge> *edges,
                                std::deque<std::pair<std::string, uint64_t>> *epoch_history,
-                               NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, Config::Items items);
+                               NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, Config::Items items,
+                               uint64_t num_threads);
 
-/// Function used to create a snapshot using the given transaction.
+/// Function used to create a snapshot using the given transaction. The edges
+/// and vertices are split into segments that are written by `num_threads`
+/// threads (including the calling thread). The data after the section offsets
+/// is compressed using `compression`. If `changes` isn't `nullptr` an
+/// incremental snapshot that contains only the modified objects is created.
 void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snapshot_directory,
                     const std::filesystem::path &wal_directory, uint64_t snapshot_retention_count,
+                    uint64_t num_threads, Config::Durability::Compression compression, const SnapshotChanges *changes,
                     utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper,
                     Indices *indices, Constraints *constraints, Config::Items items, const std::string &uuid,
                     std::string_view epoch_id, const std::deque<std::pair<std::string, uint64_t>> &epoch_history,
@@ -20,10 +20,17 @@ namespace storage::durability {
 // The current version of snapshot and WAL encoding / decoding.
 // IMPORTANT: Please bump this version for every snapshot and/or WAL format
 // change!!!
-const uint64_t kVersion{14};
+const uint64_t kVersion{21};
 
 const uint64_t kOldestSupportedVersion{14};
 const uint64_t kUniqueConstraintVersion{13};
+const uint64_t kEdgeTypeIndexVersion{15};
+const uint64_t kEdgeTypePropertyIndexVersion{16};
+const uint64_t kLabelPropertyCompositeIndexVersion{17};
+const uint64_t kSnapshotSegmentsVersion{18};
+const uint64_t kCompressionVersion{19};
+const uint64_t kIncrementalSnapshotVersion{20};
+const uint64_t kInternedStringsVersion{21};
 
 // Magic values written to the start of a snapshot/WAL file to identify it.
 const std::string kSnapshotMagic{"MGsn"};
@@ -11,6 +11,13 @@
 
 #include "storage/v2/durability/wal.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
 #include "storage/v2/delta.hpp"
 #include "storage/v2/durability/exceptions.hpp"
 #include "storage/v2/durability/paths.hpp"
@@ -19,6 +26,9 @@
 #include "storage/v2/vertex.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
+#include "utils/memory_tracker.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace storage::durability {
 
@@ -69,6 +79,18 @@ namespace storage::durability {
 //         * unique constraint create, unique constraint drop
 //              * label name
 //              * property names
+//         * edge type index create, edge type index drop (from version 15)
+//              * edge type name
+//         * edge type property index create, edge type property index drop
+//           (from version 16)
+//              * edge type name
+//              * property name
+//         * label property composite index create, label property composite
+//           index drop (from version 17)
+//              * label name
+//              * property names (in the order of the index)
+//     The deltas of a WAL file share its interned strings (from version 21), so
+//     they have to be read in order.
 //
 // IMPORTANT: When changing WAL encoding/decoding bump the snapshot/WAL version
 // in `version.hpp`.
@@ -93,6 +115,18 @@ Marker OperationToMarker(StorageGlobalOperation operation) {
       return Marker::DELTA_UNIQUE_CONSTRAINT_CREATE;
     case StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
       return Marker::DELTA_UNIQUE_CONSTRAINT_DROP;
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE:
+      return Marker::DELTA_EDGE_TYPE_INDEX_CREATE;
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_DROP:
+      return Marker::DELTA_EDGE_TYPE_INDEX_DROP;
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+      return Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE;
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+      return Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP;
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      return Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE;
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP;
   }
 }
 
@@ -161,6 +195,18 @@ WalDeltaData::Type MarkerToWalDeltaDataType(Marker marker) {
       return WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE;
     case Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
       return WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP;
+    case Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
+      return WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE;
+    case Marker::DELTA_EDGE_TYPE_INDEX_DROP:
+      return WalDeltaData::Type::EDGE_TYPE_INDEX_DROP;
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+      return WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE;
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
+      return WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP;
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      return WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE;
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP;
 
     case Marker::TYPE_NULL:
     case Marker::TYPE_BOOL:
@@ -171,6 +217,8 @@ WalDeltaData::Type MarkerToWalDeltaDataType(Marker marker) {
     case Marker::TYPE_MAP:
     case Marker::TYPE_TEMPORAL_DATA:
     case Marker::TYPE_PROPERTY_VALUE:
+    case Marker::TYPE_INTERNED_STRING:
+    case Marker::TYPE_INTERNED_STRING_DEFINITION:
     case Marker::SECTION_VERTEX:
     case Marker::SECTION_EDGE:
     case Marker::SECTION_MAPPER:
@@ -179,6 +227,8 @@ WalDeltaData::Type MarkerToWalDeltaDataType(Marker marker) {
     case Marker::SECTION_CONSTRAINTS:
     case Marker::SECTION_DELTA:
     case Marker::SECTION_EPOCH_HISTORY:
+    case Marker::SECTION_SEGMENTS:
+    case Marker::SECTION_DELETED_OBJECTS:
     case Marker::SECTION_OFFSETS:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
@@ -309,6 +359,56 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
           if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
         }
       }
+      break;
+    }
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto edge_type = decoder->ReadString();
+        if (!edge_type) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_edge_type.edge_type = std::move(*edge_type);
+      } else {
+        if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+      }
+      break;
+    }
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto edge_type = decoder->ReadString();
+        if (!edge_type) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_edge_type_property.edge_type = std::move(*edge_type);
+        auto property = decoder->ReadString();
+        if (!property) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_edge_type_property.property = std::move(*property);
+      } else {
+        if (!decoder->SkipString() || !decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+      }
+      break;
+    }
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto label = decoder->ReadString();
+        if (!label) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_label_ordered_properties.label = std::move(*label);
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_label_ordered_properties.properties.reserve(*properties_count);
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          auto property = decoder->ReadString();
+          if (!property) throw RecoveryFailure("Invalid WAL data!");
+          delta.operation_label_ordered_properties.properties.push_back(std::move(*property));
+        }
+      } else {
+        if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        }
+      }
+      break;
     }
   }
 
@@ -456,6 +556,17 @@ bool operator==(const WalDeltaData &a, const WalDeltaData &b) {
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP:
       return a.operation_label_properties.label == b.operation_label_properties.label &&
              a.operation_label_properties.properties == b.operation_label_properties.properties;
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_DROP:
+      return a.operation_edge_type.edge_type == b.operation_edge_type.edge_type;
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP:
+      return a.operation_edge_type_property.edge_type == b.operation_edge_type_property.edge_type &&
+             a.operation_edge_type_property.property == b.operation_edge_type_property.property;
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return a.operation_label_ordered_properties.label == b.operation_label_ordered_properties.label &&
+             a.operation_label_ordered_properties.properties == b.operation_label_ordered_properties.properties;
   }
 }
 bool operator!=(const WalDeltaData &a, const WalDeltaData &b) { return !(a == b); }
@@ -489,7 +600,7 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Config::Ite
   // actions.
   encoder->WriteMarker(Marker::SECTION_DELTA);
   encoder->WriteUint(timestamp);
-  std::lock_guard<utils::SpinLock> guard(vertex.lock);
+  std::lock_guard<utils::SeqLock> guard(vertex.lock);
   switch (delta.action) {
     case Delta::Action::DELETE_OBJECT:
     case Delta::Action::RECREATE_OBJECT: {
@@ -544,7 +655,7 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, const Delta
   // actions.
   encoder->WriteMarker(Marker::SECTION_DELTA);
   encoder->WriteUint(timestamp);
-  std::lock_guard<utils::SpinLock> guard(edge.lock);
+  std::lock_guard<utils::SeqLock> guard(edge.lock);
   switch (delta.action) {
     case Delta::Action::SET_PROPERTY: {
       encoder->WriteMarker(Marker::DELTA_EDGE_SET_PROPERTY);
@@ -583,7 +694,7 @@ void EncodeTransactionEnd(BaseEncoder *encoder, uint64_t timestamp) {
 }
 
 void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
-                     LabelId label, const std::set<PropertyId> &properties, uint64_t timestamp) {
+                     LabelId label, const std::vector<PropertyId> &properties, uint64_t timestamp) {
   encoder->WriteMarker(Marker::SECTION_DELTA);
   encoder->WriteUint(timestamp);
   switch (operation) {
@@ -605,7 +716,9 @@ void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Storage
       break;
     }
     case StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE:
-    case StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP: {
+    case StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
       MG_ASSERT(!properties.empty(), "Invalid function call!");
       encoder->WriteMarker(OperationToMarker(operation));
       encoder->WriteString(name_id_mapper->IdToName(label.AsUint()));
@@ -615,13 +728,147 @@ void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Storage
       }
       break;
     }
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_DROP:
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+      // These operations are encoded with the edge type overload of this
+      // function.
+      LOG_FATAL("Invalid function call!");
+  }
+}
+
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
+                     EdgeTypeId edge_type, const std::set<PropertyId> &properties, uint64_t timestamp) {
+  encoder->WriteMarker(Marker::SECTION_DELTA);
+  encoder->WriteUint(timestamp);
+  switch (operation) {
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_DROP: {
+      MG_ASSERT(properties.empty(), "Invalid function call!");
+      encoder->WriteMarker(OperationToMarker(operation));
+      encoder->WriteString(name_id_mapper->IdToName(edge_type.AsUint()));
+      break;
+    }
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP: {
+      MG_ASSERT(properties.size() == 1, "Invalid function call!");
+      encoder->WriteMarker(OperationToMarker(operation));
+      encoder->WriteString(name_id_mapper->IdToName(edge_type.AsUint()));
+      encoder->WriteString(name_id_mapper->IdToName((*properties.begin()).AsUint()));
+      break;
+    }
+    case StorageGlobalOperation::LABEL_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_INDEX_DROP:
+    case StorageGlobalOperation::LABEL_PROPERTY_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_PROPERTY_INDEX_DROP:
+    case StorageGlobalOperation::EXISTENCE_CONSTRAINT_CREATE:
+    case StorageGlobalOperation::EXISTENCE_CONSTRAINT_DROP:
+    case StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE:
+    case StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      LOG_FATAL("Invalid function call!");
   }
 }
 
+namespace {
+
+// Number of batches that are read ahead of the batch that is being applied.
+constexpr uint64_t kWalBatchQueueSize = 4;
+// Maximum number of transactions in a single batch.
+constexpr uint64_t kWalBatchMaxTransactions = 1024;
+
+// Deltas of a single transaction or of a single global operation read from the
+// WAL, together with the objects they modify.
+struct WalTransaction {
+  void Add(WalDeltaData &&delta, uint64_t delta_timestamp) {
+    timestamp = delta_timestamp;
+    switch (delta.type) {
+      case WalDeltaData::Type::VERTEX_CREATE:
+      case WalDeltaData::Type::VERTEX_DELETE:
+        vertices.push_back(delta.vertex_create_delete.gid);
+        break;
+      case WalDeltaData::Type::VERTEX_ADD_LABEL:
+      case WalDeltaData::Type::VERTEX_REMOVE_LABEL:
+        vertices.push_back(delta.vertex_add_remove_label.gid);
+        break;
+      case WalDeltaData::Type::VERTEX_SET_PROPERTY:
+        vertices.push_back(delta.vertex_edge_set_property.gid);
+        break;
+      case WalDeltaData::Type::EDGE_CREATE:
+      case WalDeltaData::Type::EDGE_DELETE:
+        edges.push_back(delta.edge_create_delete.gid);
+        vertices.push_back(delta.edge_create_delete.from_vertex);
+        vertices.push_back(delta.edge_create_delete.to_vertex);
+        break;
+      case WalDeltaData::Type::EDGE_SET_PROPERTY:
+        edges.push_back(delta.vertex_edge_set_property.gid);
+        break;
+      case WalDeltaData::Type::TRANSACTION_END:
+        break;
+      // Global operations modify the recovered indices and constraints.
+      case WalDeltaData::Type::LABEL_INDEX_CREATE:
+      case WalDeltaData::Type::LABEL_INDEX_DROP:
+      case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE:
+      case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
+      case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE:
+      case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP:
+      case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE:
+      case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP:
+      case WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE:
+      case WalDeltaData::Type::EDGE_TYPE_INDEX_DROP:
+      case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+      case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP:
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+        global_operation = true;
+        break;
+    }
+    deltas.push_back(std::move(delta));
+  }
+
+  std::vector<WalDeltaData> deltas;
+  uint64_t timestamp{0};
+  std::vector<Gid> vertices;
+  std::vector<Gid> edges;
+  bool global_operation{false};
+};
+
+// Consecutive transactions that modify disjoint objects, so applying them in
+// any order (or concurrently) gives the same result as applying them in the
+// order in which they were committed. A global operation is always alone in its
+// batch.
+struct WalBatch {
+  bool CanAdd(const WalTransaction &transaction) const {
+    if (transactions.empty()) return true;
+    if (global_operation || transaction.global_operation) return false;
+    if (transactions.size() >= kWalBatchMaxTransactions) return false;
+    return std::none_of(transaction.vertices.begin(), transaction.vertices.end(),
+                        [this](const auto gid) { return vertices.contains(gid); }) &&
+           std::none_of(transaction.edges.begin(), transaction.edges.end(),
+                        [this](const auto gid) { return edges.contains(gid); });
+  }
+
+  void Add(WalTransaction &&transaction) {
+    vertices.insert(transaction.vertices.begin(), transaction.vertices.end());
+    edges.insert(transaction.edges.begin(), transaction.edges.end());
+    global_operation = global_operation || transaction.global_operation;
+    transactions.push_back(std::move(transaction));
+  }
+
+  std::vector<WalTransaction> transactions;
+  std::unordered_set<Gid> vertices;
+  std::unordered_set<Gid> edges;
+  bool global_operation{false};
+};
+
+}  // namespace
+
 RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConstraints *indices_constraints,
                      const std::optional<uint64_t> last_loaded_timestamp, utils::SkipList<Vertex> *vertices,
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
-                     Config::Items items) {
+                     Config::Items items, uint64_t num_threads) {
   spdlog::info("Trying to load WAL file {}.", path);
   RecoveryInfo ret;
 
@@ -640,222 +887,395 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
     return ret;
   }
 
-  // Recover deltas.
+  // Recover deltas. The deltas are read and grouped into batches by a separate
+  // thread while the previously read batches are applied. The transactions of a
+  // batch are applied by `num_threads` threads (including the calling thread).
   wal.SetPosition(info.offset_deltas);
-  uint64_t deltas_applied = 0;
-  auto edge_acc = edges->access();
-  auto vertex_acc = vertices->access();
   spdlog::info("WAL file contains {} deltas.", info.num_deltas);
-  for (uint64_t i = 0; i < info.num_deltas; ++i) {
-    // Read WAL delta header to find out the delta timestamp.
-    auto timestamp = ReadWalDeltaHeader(&wal);
 
-    if (!last_loaded_timestamp || timestamp > *last_loaded_timestamp) {
-      // This delta should be loaded.
-      auto delta = ReadWalDeltaData(&wal);
-      switch (delta.type) {
-        case WalDeltaData::Type::VERTEX_CREATE: {
-          auto [vertex, inserted] = vertex_acc.insert(Vertex{delta.vertex_create_delete.gid, nullptr});
-          if (!inserted) throw RecoveryFailure("The vertex must be inserted here!");
+  std::mutex queue_lock;
+  std::condition_variable queue_cv;
+  std::deque<WalBatch> queue;
+  bool reading_finished = false;
+  bool stop_reading = false;
+  std::exception_ptr reading_exception;
+  uint64_t deltas_applied = 0;
 
-          ret.next_vertex_id = std::max(ret.next_vertex_id, delta.vertex_create_delete.gid.AsUint() + 1);
+  // Returns false if the reading should stop because applying the deltas
+  // failed.
+  auto push_batch = [&](WalBatch &&batch) {
+    std::unique_lock<std::mutex> guard(queue_lock);
+    queue_cv.wait(guard, [&] { return stop_reading || queue.size() < kWalBatchQueueSize; });
+    if (stop_reading) return false;
+    queue.push_back(std::move(batch));
+    queue_cv.notify_all();
+    return true;
+  };
 
-          break;
+  std::thread reader([&] {
+    try {
+      WalBatch batch;
+      WalTransaction transaction;
+      auto finish_transaction = [&] {
+        if (!batch.CanAdd(transaction)) {
+          if (!push_batch(std::move(batch))) return false;
+          batch = WalBatch();
+        }
+        batch.Add(std::move(transaction));
+        transaction = WalTransaction();
+        return true;
+      };
+      for (uint64_t i = 0; i < info.num_deltas; ++i) {
+        // Read WAL delta header to find out the delta timestamp.
+        auto timestamp = ReadWalDeltaHeader(&wal);
+
+        if (last_loaded_timestamp && timestamp <= *last_loaded_timestamp) {
+          // This delta should be skipped.
+          SkipWalDeltaData(&wal);
+          continue;
         }
-        case WalDeltaData::Type::VERTEX_DELETE: {
-          auto vertex = vertex_acc.find(delta.vertex_create_delete.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
-          if (!vertex->in_edges.empty() || !vertex->out_edges.empty())
-            throw RecoveryFailure("The vertex can't be deleted because it still has edges!");
 
-          if (!vertex_acc.remove(delta.vertex_create_delete.gid))
-            throw RecoveryFailure("The vertex must be removed here!");
+        // This delta should be loaded.
+        auto delta = ReadWalDeltaData(&wal);
+        const bool transaction_end = IsWalDeltaDataTypeTransactionEnd(delta.type);
+        transaction.Add(std::move(delta), timestamp);
+        ++deltas_applied;
+        if (transaction_end && !finish_transaction()) return;
+      }
+      if (!transaction.deltas.empty() && !finish_transaction()) return;
+      if (!batch.transactions.empty()) push_batch(std::move(batch));
+    } catch (...) {
+      reading_exception = std::current_exception();
+    }
+    std::lock_guard<std::mutex> guard(queue_lock);
+    reading_finished = true;
+    queue_cv.notify_all();
+  });
+  utils::OnScopeExit join_reader{[&] {
+    {
+      std::lock_guard<std::mutex> guard(queue_lock);
+      stop_reading = true;
+      queue_cv.notify_all();
+    }
+    reader.join();
+  }};
 
-          break;
-        }
-        case WalDeltaData::Type::VERTEX_ADD_LABEL:
-        case WalDeltaData::Type::VERTEX_REMOVE_LABEL: {
-          auto vertex = vertex_acc.find(delta.vertex_add_remove_label.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
-
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.vertex_add_remove_label.label));
-          auto it = std::find(vertex->labels.begin(), vertex->labels.end(), label_id);
-
-          if (delta.type == WalDeltaData::Type::VERTEX_ADD_LABEL) {
-            if (it != vertex->labels.end()) throw RecoveryFailure("The vertex already has the label!");
-            vertex->labels.push_back(label_id);
-          } else {
-            if (it == vertex->labels.end()) throw RecoveryFailure("The vertex doesn't have the label!");
-            std::swap(*it, vertex->labels.back());
-            vertex->labels.pop_back();
-          }
+  auto apply_delta = [&](const WalDeltaData &delta, utils::SkipList<Vertex>::Accessor &vertex_acc,
+                         utils::SkipList<Edge>::Accessor &edge_acc, RecoveryInfo *recovery_info) {
+    switch (delta.type) {
+      case WalDeltaData::Type::VERTEX_CREATE: {
+        auto [vertex, inserted] = vertex_acc.insert(Vertex{delta.vertex_create_delete.gid, nullptr});
+        if (!inserted) throw RecoveryFailure("The vertex must be inserted here!");
 
-          break;
-        }
-        case WalDeltaData::Type::VERTEX_SET_PROPERTY: {
-          auto vertex = vertex_acc.find(delta.vertex_edge_set_property.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
+        recovery_info->next_vertex_id =
+            std::max(recovery_info->next_vertex_id, delta.vertex_create_delete.gid.AsUint() + 1);
 
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
-          auto &property_value = delta.vertex_edge_set_property.value;
+        break;
+      }
+      case WalDeltaData::Type::VERTEX_DELETE: {
+        auto vertex = vertex_acc.find(delta.vertex_create_delete.gid);
+        if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
+        if (!vertex->in_edges.empty() || !vertex->out_edges.empty())
+          throw RecoveryFailure("The vertex can't be deleted because it still has edges!");
 
-          vertex->properties.SetProperty(property_id, property_value);
+        if (!vertex_acc.remove(delta.vertex_create_delete.gid))
+          throw RecoveryFailure("The vertex must be removed here!");
 
-          break;
+        break;
+      }
+      case WalDeltaData::Type::VERTEX_ADD_LABEL:
+      case WalDeltaData::Type::VERTEX_REMOVE_LABEL: {
+        auto vertex = vertex_acc.find(delta.vertex_add_remove_label.gid);
+        if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
+
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.vertex_add_remove_label.label));
+        if (delta.type == WalDeltaData::Type::VERTEX_ADD_LABEL) {
+          if (!vertex->labels.Insert(label_id)) throw RecoveryFailure("The vertex already has the label!");
+        } else {
+          if (!vertex->labels.Erase(label_id)) throw RecoveryFailure("The vertex doesn't have the label!");
         }
-        case WalDeltaData::Type::EDGE_CREATE: {
-          auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
-          if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
-          auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
-          if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
-
-          auto edge_gid = delta.edge_create_delete.gid;
-          auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
-          EdgeRef edge_ref(edge_gid);
-          if (items.properties_on_edges) {
-            auto [edge, inserted] = edge_acc.insert(Edge{edge_gid, nullptr});
-            if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
-            edge_ref = EdgeRef(&*edge);
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
-            if (it != from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex already has this edge!");
-            from_vertex->out_edges.push_back(link);
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
-            if (it != to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex already has this edge!");
-            to_vertex->in_edges.push_back(link);
-          }
 
-          ret.next_edge_id = std::max(ret.next_edge_id, edge_gid.AsUint() + 1);
+        break;
+      }
+      case WalDeltaData::Type::VERTEX_SET_PROPERTY: {
+        auto vertex = vertex_acc.find(delta.vertex_edge_set_property.gid);
+        if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
+
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
+        auto &property_value = delta.vertex_edge_set_property.value;
 
-          // Increment edge count.
-          edge_count->fetch_add(1, std::memory_order_acq_rel);
+        vertex->properties.SetProperty(property_id, property_value);
 
-          break;
+        break;
+      }
+      case WalDeltaData::Type::EDGE_CREATE: {
+        auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
+        if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
+        auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
+        if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
+
+        auto edge_gid = delta.edge_create_delete.gid;
+        auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
+        EdgeRef edge_ref(edge_gid);
+        if (items.properties_on_edges) {
+          auto [edge, inserted] = edge_acc.insert(Edge{edge_gid, nullptr});
+          if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
+          edge_ref = EdgeRef(&*edge);
+        }
+        {
+          std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
+          if (from_vertex->out_edges.Find(link) != from_vertex->out_edges.end())
+            throw RecoveryFailure("The from vertex already has this edge!");
+          from_vertex->out_edges.Insert(link);
+        }
+        {
+          std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
+          if (to_vertex->in_edges.Find(link) != to_vertex->in_edges.end())
+            throw RecoveryFailure("The to vertex already has this edge!");
+          to_vertex->in_edges.Insert(link);
         }
-        case WalDeltaData::Type::EDGE_DELETE: {
-          auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
-          if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
-          auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
-          if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
-
-          auto edge_gid = delta.edge_create_delete.gid;
-          auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
-          EdgeRef edge_ref(edge_gid);
-          if (items.properties_on_edges) {
-            auto edge = edge_acc.find(edge_gid);
-            if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
-            edge_ref = EdgeRef(&*edge);
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
-            if (it == from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex doesn't have this edge!");
-            std::swap(*it, from_vertex->out_edges.back());
-            from_vertex->out_edges.pop_back();
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
-            if (it == to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex doesn't have this edge!");
-            std::swap(*it, to_vertex->in_edges.back());
-            to_vertex->in_edges.pop_back();
-          }
-          if (items.properties_on_edges) {
-            if (!edge_acc.remove(edge_gid)) throw RecoveryFailure("The edge must be removed here!");
-          }
 
-          // Decrement edge count.
-          edge_count->fetch_add(-1, std::memory_order_acq_rel);
+        recovery_info->next_edge_id = std::max(recovery_info->next_edge_id, edge_gid.AsUint() + 1);
 
-          break;
-        }
-        case WalDeltaData::Type::EDGE_SET_PROPERTY: {
-          if (!items.properties_on_edges)
-            throw RecoveryFailure(
-                "The WAL has properties on edges, but the storage is "
-                "configured without properties on edges!");
-          auto edge = edge_acc.find(delta.vertex_edge_set_property.gid);
+        // Increment edge count.
+        edge_count->fetch_add(1, std::memory_order_acq_rel);
+
+        break;
+      }
+      case WalDeltaData::Type::EDGE_DELETE: {
+        auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
+        if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
+        auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
+        if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
+
+        auto edge_gid = delta.edge_create_delete.gid;
+        auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
+        EdgeRef edge_ref(edge_gid);
+        if (items.properties_on_edges) {
+          auto edge = edge_acc.find(edge_gid);
           if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
-          auto &property_value = delta.vertex_edge_set_property.value;
-          edge->properties.SetProperty(property_id, property_value);
-          break;
+          edge_ref = EdgeRef(&*edge);
         }
-        case WalDeltaData::Type::TRANSACTION_END:
-          break;
-        case WalDeltaData::Type::LABEL_INDEX_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
-          AddRecoveredIndexConstraint(&indices_constraints->indices.label, label_id, "The label index already exists!");
-          break;
+        {
+          std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
+          if (!from_vertex->out_edges.Remove(link)) throw RecoveryFailure("The from vertex doesn't have this edge!");
         }
-        case WalDeltaData::Type::LABEL_INDEX_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
-          RemoveRecoveredIndexConstraint(&indices_constraints->indices.label, label_id,
-                                         "The label index doesn't exist!");
-          break;
+        {
+          std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
+          if (!to_vertex->in_edges.Remove(link)) throw RecoveryFailure("The to vertex doesn't have this edge!");
         }
-        case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          AddRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
-                                      "The label property index already exists!");
-          break;
+        if (items.properties_on_edges) {
+          if (!edge_acc.remove(edge_gid)) throw RecoveryFailure("The edge must be removed here!");
         }
-        case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
-                                         "The label property index doesn't exist!");
-          break;
+
+        // Decrement edge count.
+        edge_count->fetch_add(-1, std::memory_order_acq_rel);
+
+        break;
+      }
+      case WalDeltaData::Type::EDGE_SET_PROPERTY: {
+        if (!items.properties_on_edges)
+          throw RecoveryFailure(
+              "The WAL has properties on edges, but the storage is "
+              "configured without properties on edges!");
+        auto edge = edge_acc.find(delta.vertex_edge_set_property.gid);
+        if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
+        auto &property_value = delta.vertex_edge_set_property.value;
+        edge->properties.SetProperty(property_id, property_value);
+        break;
+      }
+      case WalDeltaData::Type::TRANSACTION_END:
+        break;
+      case WalDeltaData::Type::LABEL_INDEX_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
+        AddRecoveredIndexConstraint(&indices_constraints->indices.label, label_id, "The label index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::LABEL_INDEX_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.label, label_id, "The label index doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+        AddRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
+                                    "The label property index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
+                                       "The label property index doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+        AddRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
+                                    "The existence constraint already exists!");
+        break;
+      }
+      case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+        RemoveRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
+                                       "The existence constraint doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
+        std::set<PropertyId> property_ids;
+        for (const auto &prop : delta.operation_label_properties.properties) {
+          property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
         }
-        case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          AddRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
-                                      "The existence constraint already exists!");
-          break;
+        AddRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
+                                    "The unique constraint already exists!");
+        break;
+      }
+      case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
+        std::set<PropertyId> property_ids;
+        for (const auto &prop : delta.operation_label_properties.properties) {
+          property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
         }
-        case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          RemoveRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
-                                         "The existence constraint doesn't exist!");
-          break;
+        RemoveRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
+                                       "The unique constraint doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE: {
+        auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type.edge_type));
+        AddRecoveredIndexConstraint(&indices_constraints->indices.edge_type, edge_type_id,
+                                    "The edge type index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::EDGE_TYPE_INDEX_DROP: {
+        auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type.edge_type));
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.edge_type, edge_type_id,
+                                       "The edge type index doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE: {
+        auto edge_type_id =
+            EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
+        AddRecoveredIndexConstraint(&indices_constraints->indices.edge_type_property, {edge_type_id, property_id},
+                                    "The edge type+property index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP: {
+        auto edge_type_id =
+            EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.edge_type_property, {edge_type_id, property_id},
+                                       "The edge type+property index doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_ordered_properties.label));
+        std::vector<PropertyId> property_ids;
+        for (const auto &prop : delta.operation_label_ordered_properties.properties) {
+          property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
         }
-        case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
-          std::set<PropertyId> property_ids;
-          for (const auto &prop : delta.operation_label_properties.properties) {
-            property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
-          }
-          AddRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
-                                      "The unique constraint already exists!");
-          break;
+        AddRecoveredIndexConstraint(&indices_constraints->indices.label_property_composite,
+                                    {label_id, std::move(property_ids)},
+                                    "The label property composite index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_ordered_properties.label));
+        std::vector<PropertyId> property_ids;
+        for (const auto &prop : delta.operation_label_ordered_properties.properties) {
+          property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
         }
-        case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
-          std::set<PropertyId> property_ids;
-          for (const auto &prop : delta.operation_label_properties.properties) {
-            property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property_composite,
+                                       {label_id, std::move(property_ids)},
+                                       "The label property composite index doesn't exist!");
+        break;
+      }
+    }
+  };
+
+  std::optional<utils::ThreadPool> thread_pool;
+  if (num_threads > 1) {
+    thread_pool.emplace(num_threads - 1);
+  }
+  const bool oom_exception_enabled = utils::MemoryTracker::OutOfMemoryExceptionEnabler::CanThrow();
+
+  auto apply_batch = [&](const WalBatch &batch) {
+    // The transactions are taken one by one by all threads, so that the threads
+    // that get cheaper transactions don't end up waiting for the others.
+    std::atomic<uint64_t> next_transaction{0};
+    std::mutex finished_lock;
+    std::condition_variable finished_cv;
+    uint64_t finished = 0;
+    std::exception_ptr exception;
+    auto apply_transactions = [&] {
+      std::optional<utils::MemoryTracker::OutOfMemoryExceptionEnabler> oom_exception;
+      if (oom_exception_enabled) oom_exception.emplace();
+      RecoveryInfo applied;
+      std::exception_ptr apply_exception;
+      try {
+        auto vertex_acc = vertices->access();
+        auto edge_acc = edges->access();
+        while (true) {
+          const auto index = next_transaction.fetch_add(1, std::memory_order_acq_rel);
+          if (index >= batch.transactions.size()) break;
+          const auto &transaction = batch.transactions[index];
+          for (const auto &delta : transaction.deltas) {
+            apply_delta(delta, vertex_acc, edge_acc, &applied);
           }
-          RemoveRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
-                                         "The unique constraint doesn't exist!");
-          break;
+          applied.next_timestamp = std::max(applied.next_timestamp, transaction.timestamp + 1);
         }
+      } catch (...) {
+        apply_exception = std::current_exception();
+        next_transaction.store(batch.transactions.size(), std::memory_order_release);
       }
-      ret.next_timestamp = std::max(ret.next_timestamp, timestamp + 1);
-      ++deltas_applied;
-    } else {
-      // This delta should be skipped.
-      SkipWalDeltaData(&wal);
+      std::lock_guard<std::mutex> guard(finished_lock);
+      if (apply_exception && !exception) exception = apply_exception;
+      ret.next_vertex_id = std::max(ret.next_vertex_id, applied.next_vertex_id);
+      ret.next_edge_id = std::max(ret.next_edge_id, applied.next_edge_id);
+      ret.next_timestamp = std::max(ret.next_timestamp, applied.next_timestamp);
+    };
+
+    const uint64_t workers = thread_pool ? std::min(num_threads - 1, batch.transactions.size() - 1) : 0;
+    for (uint64_t i = 0; i < workers; ++i) {
+      thread_pool->AddTask([&] {
+        apply_transactions();
+        // Notify while holding the lock because the condition variable is
+        // destroyed as soon as the waiting thread sees that all workers finished.
+        std::lock_guard<std::mutex> guard(finished_lock);
+        ++finished;
+        finished_cv.notify_one();
+      });
+    }
+    apply_transactions();
+    std::unique_lock<std::mutex> guard(finished_lock);
+    finished_cv.wait(guard, [&] { return finished == workers; });
+    if (exception) std::rethrow_exception(exception);
+  };
+
+  while (true) {
+    WalBatch batch;
+    {
+      std::unique_lock<std::mutex> guard(queue_lock);
+      queue_cv.wait(guard, [&] { return !queue.empty() || reading_finished; });
+      if (queue.empty()) break;
+      batch = std::move(queue.front());
+      queue.pop_front();
+      queue_cv.notify_all();
     }
+    apply_batch(batch);
   }
+  if (reading_exception) std::rethrow_exception(reading_exception);
 
+  // The reader is done with the decoder once it finished reading.
+  if (const auto &stats = wal.GetCompressionStats(); stats.compressed_bytes != 0) {
+    spdlog::info("WAL decompressed from {} to {} bytes ({:.2f}x) at {:.2f} MiB/s.", stats.compressed_bytes,
+                 stats.uncompressed_bytes, stats.Ratio(), stats.Throughput());
+  }
   spdlog::info("Applied {} deltas from WAL. Skipped {} deltas, because they were too old.", deltas_applied,
                info.num_deltas - deltas_applied);
 
@@ -863,8 +1283,8 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
 }
 
 WalFile::WalFile(const std::filesystem::path &wal_directory, const std::string_view uuid,
-                 const std::string_view epoch_id, Config::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num,
-                 utils::FileRetainer *file_retainer)
+                 const std::string_view epoch_id, Config::Items items, Config::Durability::Compression compression,
+                 NameIdMapper *name_id_mapper, uint64_t seq_num, utils::FileRetainer *file_retainer)
     : items_(items),
       name_id_mapper_(name_id_mapper),
       path_(wal_directory / MakeWalName()),
@@ -902,6 +1322,10 @@ WalFile::WalFile(const std::filesystem::path &wal_directory, const std::string_v
   wal_.WriteUint(offset_deltas);
   wal_.SetPosition(offset_deltas);
 
+  // The deltas are compressed in blocks. Each flush of the WAL closes the
+  // current block so the file on disk is always readable.
+  wal_.StartCompression(compression);
+
   // Sync the initial data.
   wal_.Sync();
 }
@@ -923,6 +1347,10 @@ WalFile::WalFile(std::filesystem::path current_wal_path, Config::Items items, Na
 void WalFile::FinalizeWal() {
   if (count_ != 0) {
     wal_.Finalize();
+    if (const auto &stats = wal_.GetCompressionStats(); stats.compressed_bytes != 0) {
+      spdlog::debug("WAL {} compressed from {} to {} bytes ({:.2f}x) at {:.2f} MiB/s.", path_, stats.uncompressed_bytes,
+                    stats.compressed_bytes, stats.Ratio(), stats.Throughput());
+    }
     // Rename file.
     std::filesystem::path new_path(path_);
     new_path.replace_filename(RemakeWalName(path_.filename(), from_timestamp_, to_timestamp_));
@@ -961,14 +1389,22 @@ void WalFile::AppendTransactionEnd(uint64_t timestamp) {
   UpdateStats(timestamp);
 }
 
-void WalFile::AppendOperation(StorageGlobalOperation operation, LabelId label, const std::set<PropertyId> &properties,
-                              uint64_t timestamp) {
+void WalFile::AppendOperation(StorageGlobalOperation operation, LabelId label,
+                              const std::vector<PropertyId> &properties, uint64_t timestamp) {
   EncodeOperation(&wal_, name_id_mapper_, operation, label, properties, timestamp);
   UpdateStats(timestamp);
 }
 
+void WalFile::AppendOperation(StorageGlobalOperation operation, EdgeTypeId edge_type,
+                              const std::set<PropertyId> &properties, uint64_t timestamp) {
+  EncodeOperation(&wal_, name_id_mapper_, operation, edge_type, properties, timestamp);
+  UpdateStats(timestamp);
+}
+
 void WalFile::Sync() { wal_.Sync(); }
 
+utils::OutputFileSyncHandle WalFile::FlushForSync() { return wal_.FlushForSync(); }
+
 uint64_t WalFile::GetSize() { return wal_.GetSize(); }
 
 uint64_t WalFile::SequenceNumber() const { return seq_num_; }
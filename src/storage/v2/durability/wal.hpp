@@ -15,6 +15,7 @@
 #include <filesystem>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/delta.hpp"
@@ -63,6 +64,12 @@ struct WalDeltaData {
     EXISTENCE_CONSTRAINT_DROP,
     UNIQUE_CONSTRAINT_CREATE,
     UNIQUE_CONSTRAINT_DROP,
+    EDGE_TYPE_INDEX_CREATE,
+    EDGE_TYPE_INDEX_DROP,
+    EDGE_TYPE_PROPERTY_INDEX_CREATE,
+    EDGE_TYPE_PROPERTY_INDEX_DROP,
+    LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+    LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
   };
 
   Type type{Type::TRANSACTION_END};
@@ -102,6 +109,20 @@ struct WalDeltaData {
     std::string label;
     std::set<std::string> properties;
   } operation_label_properties;
+
+  struct {
+    std::string edge_type;
+  } operation_edge_type;
+
+  struct {
+    std::string edge_type;
+    std::string property;
+  } operation_edge_type_property;
+
+  struct {
+    std::string label;
+    std::vector<std::string> properties;
+  } operation_label_ordered_properties;
 };
 
 bool operator==(const WalDeltaData &a, const WalDeltaData &b);
@@ -117,6 +138,12 @@ enum class StorageGlobalOperation {
   EXISTENCE_CONSTRAINT_DROP,
   UNIQUE_CONSTRAINT_CREATE,
   UNIQUE_CONSTRAINT_DROP,
+  EDGE_TYPE_INDEX_CREATE,
+  EDGE_TYPE_INDEX_DROP,
+  EDGE_TYPE_PROPERTY_INDEX_CREATE,
+  EDGE_TYPE_PROPERTY_INDEX_DROP,
+  LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+  LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
 };
 
 constexpr bool IsWalDeltaDataTypeTransactionEnd(const WalDeltaData::Type type) {
@@ -148,6 +175,12 @@ constexpr bool IsWalDeltaDataTypeTransactionEnd(const WalDeltaData::Type type) {
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP:
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP:
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_DROP:
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
       return true;
   }
 }
@@ -184,22 +217,33 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, const Delta
 /// Function used to encode the transaction end.
 void EncodeTransactionEnd(BaseEncoder *encoder, uint64_t timestamp);
 
-/// Function used to encode non-transactional operation.
+/// Function used to encode non-transactional operation. The properties are
+/// encoded in the given order because the order of the properties of a
+/// composite index is significant.
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
+                     LabelId label, const std::vector<PropertyId> &properties, uint64_t timestamp);
+
+/// Function used to encode non-transactional operation on an edge type.
 void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
-                     LabelId label, const std::set<PropertyId> &properties, uint64_t timestamp);
+                     EdgeTypeId edge_type, const std::set<PropertyId> &properties, uint64_t timestamp);
 
-/// Function used to load the WAL data into the storage.
+/// Function used to load the WAL data into the storage. The deltas are read
+/// by a separate thread while the transactions that modify disjoint objects are
+/// applied concurrently by `num_threads` threads (including the calling
+/// thread). The result is the same as if the transactions were applied one by
+/// one in the order of their commits.
 /// @throw RecoveryFailure
 RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConstraints *indices_constraints,
                      std::optional<uint64_t> last_loaded_timestamp, utils::SkipList<Vertex> *vertices,
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
-                     Config::Items items);
+                     Config::Items items, uint64_t num_threads);
 
 /// WalFile class used to append deltas and operations to the WAL file.
 class WalFile {
  public:
   WalFile(const std::filesystem::path &wal_directory, std::string_view uuid, std::string_view epoch_id,
-          Config::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num, utils::FileRetainer *file_retainer);
+          Config::Items items, Config::Durability::Compression compression, NameIdMapper *name_id_mapper,
+          uint64_t seq_num, utils::FileRetainer *file_retainer);
   WalFile(std::filesystem::path current_wal_path, Config::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num,
           uint64_t from_timestamp, uint64_t to_timestamp, uint64_t count, utils::FileRetainer *file_retainer);
 
@@ -215,11 +259,16 @@ class WalFile {
 
   void AppendTransactionEnd(uint64_t timestamp);
 
-  void AppendOperation(StorageGlobalOperation operation, LabelId label, const std::set<PropertyId> &properties,
+  void AppendOperation(StorageGlobalOperation operation, LabelId label, const std::vector<PropertyId> &properties,
+                       uint64_t timestamp);
+
+  void AppendOperation(StorageGlobalOperation operation, EdgeTypeId edge_type, const std::set<PropertyId> &properties,
                        uint64_t timestamp);
 
   void Sync();
 
+  utils::OutputFileSyncHandle FlushForSync();
+
   uint64_t GetSize();
 
   uint64_t SequenceNumber() const;
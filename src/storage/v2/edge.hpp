@@ -17,7 +17,7 @@
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_store.hpp"
 #include "utils/logging.hpp"
-#include "utils/spin_lock.hpp"
+#include "utils/seq_lock.hpp"
 
 namespace storage {
 
@@ -33,7 +33,10 @@ struct Edge {
 
   PropertyStore properties;
 
-  mutable utils::SpinLock lock;
+  // Guards all of the fields below and the properties. Readers
+  // that only copy the state of the edge can do so optimistically, without
+  // taking the lock.
+  mutable utils::SeqLock lock;
   bool deleted;
   // uint8_t PAD;
   // uint16_t PAD;
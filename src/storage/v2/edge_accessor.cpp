@@ -13,6 +13,7 @@
 
 #include <memory>
 
+#include "storage/v2/indices.hpp"
 #include "storage/v2/mvcc.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/vertex_accessor.hpp"
@@ -24,10 +25,14 @@ bool EdgeAccessor::IsVisible(const View view) const {
   bool deleted = true;
   bool exists = true;
   Delta *delta = nullptr;
-  {
-    std::lock_guard<utils::SpinLock> guard(edge_.ptr->lock);
+  auto read = [&] {
     deleted = edge_.ptr->deleted;
     delta = edge_.ptr->delta;
+    return true;
+  };
+  if (!edge_.ptr->lock.TryOptimisticRead(read)) {
+    std::lock_guard<utils::SeqLock> guard(edge_.ptr->lock);
+    read();
   }
   ApplyDeltasForRead(transaction_, delta, view, [&](const Delta &delta) {
     switch (delta.action) {
@@ -65,7 +70,7 @@ Result<storage::PropertyValue> EdgeAccessor::SetProperty(PropertyId property, co
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
   if (!config_.properties_on_edges) return Error::PROPERTIES_DISABLED;
 
-  std::lock_guard<utils::SpinLock> guard(edge_.ptr->lock);
+  std::lock_guard<utils::SeqLock> guard(edge_.ptr->lock);
 
   if (!PrepareForWrite(transaction_, edge_.ptr)) return Error::SERIALIZATION_ERROR;
 
@@ -81,13 +86,15 @@ Result<storage::PropertyValue> EdgeAccessor::SetProperty(PropertyId property, co
   CreateAndLinkDelta(transaction_, edge_.ptr, Delta::SetPropertyTag(), property, current_value);
   edge_.ptr->properties.SetProperty(property, value);
 
+  UpdateOnSetProperty(indices_, edge_type_, property, value, from_vertex_, to_vertex_, edge_.ptr, *transaction_);
+
   return std::move(current_value);
 }
 
 Result<std::map<PropertyId, PropertyValue>> EdgeAccessor::ClearProperties() {
   if (!config_.properties_on_edges) return Error::PROPERTIES_DISABLED;
 
-  std::lock_guard<utils::SpinLock> guard(edge_.ptr->lock);
+  std::lock_guard<utils::SeqLock> guard(edge_.ptr->lock);
 
   if (!PrepareForWrite(transaction_, edge_.ptr)) return Error::SERIALIZATION_ERROR;
 
@@ -109,8 +116,20 @@ Result<PropertyValue> EdgeAccessor::GetProperty(PropertyId property, View view)
   bool deleted = false;
   PropertyValue value;
   Delta *delta = nullptr;
-  {
-    std::lock_guard<utils::SpinLock> guard(edge_.ptr->lock);
+  std::optional<PropertyValue> copied_value;
+  PropertyStore::RawCopy properties;
+  if (edge_.ptr->lock.TryOptimisticRead([&] {
+        deleted = edge_.ptr->deleted;
+        properties = PropertyStore::RawCopy(edge_.ptr->properties);
+        delta = edge_.ptr->delta;
+        return properties.IsInline();
+      })) {
+    copied_value = properties.GetProperty(property);
+  }
+  if (copied_value) {
+    value = std::move(*copied_value);
+  } else {
+    std::lock_guard<utils::SeqLock> guard(edge_.ptr->lock);
     deleted = edge_.ptr->deleted;
     value = edge_.ptr->properties.GetProperty(property);
     delta = edge_.ptr->delta;
@@ -151,8 +170,20 @@ Result<std::map<PropertyId, PropertyValue>> EdgeAccessor::Properties(View view)
   bool deleted = false;
   std::map<PropertyId, PropertyValue> properties;
   Delta *delta = nullptr;
-  {
-    std::lock_guard<utils::SpinLock> guard(edge_.ptr->lock);
+  std::optional<std::map<PropertyId, PropertyValue>> copied_properties;
+  PropertyStore::RawCopy properties_copy;
+  if (edge_.ptr->lock.TryOptimisticRead([&] {
+        deleted = edge_.ptr->deleted;
+        properties_copy = PropertyStore::RawCopy(edge_.ptr->properties);
+        delta = edge_.ptr->delta;
+        return properties_copy.IsInline();
+      })) {
+    copied_properties = properties_copy.Properties();
+  }
+  if (copied_properties) {
+    properties = std::move(*copied_properties);
+  } else {
+    std::lock_guard<utils::SeqLock> guard(edge_.ptr->lock);
     deleted = edge_.ptr->deleted;
     properties = edge_.ptr->properties.Properties();
     delta = edge_.ptr->delta;
@@ -10,9 +10,12 @@
 // licenses/APL.txt.
 
 #include "indices.hpp"
+#include <algorithm>
 #include <limits>
 
+#include "storage/v2/edge.hpp"
 #include "storage/v2/mvcc.hpp"
+#include "storage/v2/parallel_vertex_scan.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/bound.hpp"
 #include "utils/logging.hpp"
@@ -50,8 +53,8 @@ bool AnyVersionHasLabel(const Vertex &vertex, LabelId label, uint64_t timestamp)
   bool deleted;
   const Delta *delta;
   {
-    std::lock_guard<utils::SpinLock> guard(vertex.lock);
-    has_label = utils::Contains(vertex.labels, label);
+    std::lock_guard<utils::SeqLock> guard(vertex.lock);
+    has_label = vertex.labels.Contains(label);
     deleted = vertex.deleted;
     delta = vertex.delta;
   }
@@ -103,8 +106,8 @@ bool AnyVersionHasLabelProperty(const Vertex &vertex, LabelId label, PropertyId
   bool deleted;
   const Delta *delta;
   {
-    std::lock_guard<utils::SpinLock> guard(vertex.lock);
-    has_label = utils::Contains(vertex.labels, label);
+    std::lock_guard<utils::SeqLock> guard(vertex.lock);
+    has_label = vertex.labels.Contains(label);
     current_value_equal_to_value = vertex.properties.IsPropertyEqual(key, value);
     deleted = vertex.deleted;
     delta = vertex.delta;
@@ -162,9 +165,9 @@ bool CurrentVersionHasLabel(const Vertex &vertex, LabelId label, Transaction *tr
   bool has_label;
   const Delta *delta;
   {
-    std::lock_guard<utils::SpinLock> guard(vertex.lock);
+    std::lock_guard<utils::SeqLock> guard(vertex.lock);
     deleted = vertex.deleted;
-    has_label = utils::Contains(vertex.labels, label);
+    has_label = vertex.labels.Contains(label);
     delta = vertex.delta;
   }
   ApplyDeltasForRead(transaction, delta, view, [&deleted, &has_label, label](const Delta &delta) {
@@ -206,85 +209,1300 @@ bool CurrentVersionHasLabel(const Vertex &vertex, LabelId label, Transaction *tr
 
 // Helper function for iterating through label-property index. Returns true if
 // this transaction can see the given vertex, and the visible version has the
-// given label and property.
+// given label and property. `string_id` is the dictionary ID of `value` if it
+// is an interned string.
 bool CurrentVersionHasLabelProperty(const Vertex &vertex, LabelId label, PropertyId key, const PropertyValue &value,
-                                    Transaction *transaction, View view) {
+                                    Transaction *transaction, View view, std::optional<uint64_t> string_id) {
   bool deleted;
   bool has_label;
   bool current_value_equal_to_value = value.IsNull();
   const Delta *delta;
   {
-    std::lock_guard<utils::SpinLock> guard(vertex.lock);
+    std::lock_guard<utils::SeqLock> guard(vertex.lock);
     deleted = vertex.deleted;
-    has_label = utils::Contains(vertex.labels, label);
-    current_value_equal_to_value = vertex.properties.IsPropertyEqual(key, value);
+    has_label = vertex.labels.Contains(label);
+    current_value_equal_to_value = vertex.properties.IsPropertyEqual(key, value, string_id);
+    delta = vertex.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, view,
+                     [&deleted, &has_label, &current_value_equal_to_value, key, label, &value](const Delta &delta) {
+                       switch (delta.action) {
+                         case Delta::Action::SET_PROPERTY: {
+                           if (delta.property.key == key) {
+                             current_value_equal_to_value = delta.property.value == value;
+                           }
+                           break;
+                         }
+                         case Delta::Action::DELETE_OBJECT: {
+                           MG_ASSERT(!deleted, "Invalid database state!");
+                           deleted = true;
+                           break;
+                         }
+                         case Delta::Action::RECREATE_OBJECT: {
+                           MG_ASSERT(deleted, "Invalid database state!");
+                           deleted = false;
+                           break;
+                         }
+                         case Delta::Action::ADD_LABEL:
+                           if (delta.label == label) {
+                             MG_ASSERT(!has_label, "Invalid database state!");
+                             has_label = true;
+                           }
+                           break;
+                         case Delta::Action::REMOVE_LABEL:
+                           if (delta.label == label) {
+                             MG_ASSERT(has_label, "Invalid database state!");
+                             has_label = false;
+                           }
+                           break;
+                         case Delta::Action::ADD_IN_EDGE:
+                         case Delta::Action::ADD_OUT_EDGE:
+                         case Delta::Action::REMOVE_IN_EDGE:
+                         case Delta::Action::REMOVE_OUT_EDGE:
+                           break;
+                       }
+                     });
+  return !deleted && has_label && current_value_equal_to_value;
+}
+
+/// Helper function for composite label-property index garbage collection.
+/// Returns true if there's a reachable version of the vertex that has the
+/// given label and the given values of all the properties.
+bool AnyVersionHasLabelProperties(const Vertex &vertex, LabelId label, const std::vector<PropertyId> &keys,
+                                  const std::vector<PropertyValue> &values, uint64_t timestamp) {
+  bool has_label;
+  std::vector<bool> current_values_equal(keys.size());
+  bool deleted;
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SeqLock> guard(vertex.lock);
+    has_label = vertex.labels.Contains(label);
+    for (size_t i = 0; i < keys.size(); ++i) {
+      current_values_equal[i] = vertex.properties.IsPropertyEqual(keys[i], values[i]);
+    }
+    deleted = vertex.deleted;
+    delta = vertex.delta;
+  }
+
+  auto all_equal = [&current_values_equal] {
+    return std::all_of(current_values_equal.begin(), current_values_equal.end(), [](bool equal) { return equal; });
+  };
+  if (!deleted && has_label && all_equal()) {
+    return true;
+  }
+
+  return AnyVersionSatisfiesPredicate(
+      timestamp, delta,
+      [&has_label, &current_values_equal, &deleted, &all_equal, label, &keys, &values](const Delta &delta) {
+        switch (delta.action) {
+          case Delta::Action::ADD_LABEL:
+            if (delta.label == label) {
+              MG_ASSERT(!has_label, "Invalid database state!");
+              has_label = true;
+            }
+            break;
+          case Delta::Action::REMOVE_LABEL:
+            if (delta.label == label) {
+              MG_ASSERT(has_label, "Invalid database state!");
+              has_label = false;
+            }
+            break;
+          case Delta::Action::SET_PROPERTY:
+            for (size_t i = 0; i < keys.size(); ++i) {
+              if (delta.property.key == keys[i]) {
+                current_values_equal[i] = delta.property.value == values[i];
+              }
+            }
+            break;
+          case Delta::Action::RECREATE_OBJECT: {
+            MG_ASSERT(deleted, "Invalid database state!");
+            deleted = false;
+            break;
+          }
+          case Delta::Action::DELETE_OBJECT: {
+            MG_ASSERT(!deleted, "Invalid database state!");
+            deleted = true;
+            break;
+          }
+          case Delta::Action::ADD_IN_EDGE:
+          case Delta::Action::ADD_OUT_EDGE:
+          case Delta::Action::REMOVE_IN_EDGE:
+          case Delta::Action::REMOVE_OUT_EDGE:
+            break;
+        }
+        return !deleted && has_label && all_equal();
+      });
+}
+
+// Helper function for iterating through composite label-property index.
+// Returns true if this transaction can see the given vertex, and the visible
+// version has the given label and the given values of all the properties.
+bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, const std::vector<PropertyId> &keys,
+                                      const std::vector<PropertyValue> &values, Transaction *transaction, View view) {
+  bool deleted;
+  bool has_label;
+  std::vector<bool> current_values_equal(keys.size());
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SeqLock> guard(vertex.lock);
+    deleted = vertex.deleted;
+    has_label = vertex.labels.Contains(label);
+    for (size_t i = 0; i < keys.size(); ++i) {
+      current_values_equal[i] = vertex.properties.IsPropertyEqual(keys[i], values[i]);
+    }
     delta = vertex.delta;
   }
-  ApplyDeltasForRead(transaction, delta, view,
-                     [&deleted, &has_label, &current_value_equal_to_value, key, label, &value](const Delta &delta) {
-                       switch (delta.action) {
-                         case Delta::Action::SET_PROPERTY: {
-                           if (delta.property.key == key) {
-                             current_value_equal_to_value = delta.property.value == value;
-                           }
-                           break;
-                         }
-                         case Delta::Action::DELETE_OBJECT: {
-                           MG_ASSERT(!deleted, "Invalid database state!");
-                           deleted = true;
-                           break;
-                         }
-                         case Delta::Action::RECREATE_OBJECT: {
-                           MG_ASSERT(deleted, "Invalid database state!");
-                           deleted = false;
-                           break;
-                         }
-                         case Delta::Action::ADD_LABEL:
-                           if (delta.label == label) {
-                             MG_ASSERT(!has_label, "Invalid database state!");
-                             has_label = true;
-                           }
-                           break;
-                         case Delta::Action::REMOVE_LABEL:
-                           if (delta.label == label) {
-                             MG_ASSERT(has_label, "Invalid database state!");
-                             has_label = false;
-                           }
-                           break;
-                         case Delta::Action::ADD_IN_EDGE:
-                         case Delta::Action::ADD_OUT_EDGE:
-                         case Delta::Action::REMOVE_IN_EDGE:
-                         case Delta::Action::REMOVE_OUT_EDGE:
-                           break;
-                       }
-                     });
-  return !deleted && has_label && current_value_equal_to_value;
+  ApplyDeltasForRead(transaction, delta, view,
+                     [&deleted, &has_label, &current_values_equal, &keys, label, &values](const Delta &delta) {
+                       switch (delta.action) {
+                         case Delta::Action::SET_PROPERTY: {
+                           for (size_t i = 0; i < keys.size(); ++i) {
+                             if (delta.property.key == keys[i]) {
+                               current_values_equal[i] = delta.property.value == values[i];
+                             }
+                           }
+                           break;
+                         }
+                         case Delta::Action::DELETE_OBJECT: {
+                           MG_ASSERT(!deleted, "Invalid database state!");
+                           deleted = true;
+                           break;
+                         }
+                         case Delta::Action::RECREATE_OBJECT: {
+                           MG_ASSERT(deleted, "Invalid database state!");
+                           deleted = false;
+                           break;
+                         }
+                         case Delta::Action::ADD_LABEL:
+                           if (delta.label == label) {
+                             MG_ASSERT(!has_label, "Invalid database state!");
+                             has_label = true;
+                           }
+                           break;
+                         case Delta::Action::REMOVE_LABEL:
+                           if (delta.label == label) {
+                             MG_ASSERT(has_label, "Invalid database state!");
+                             has_label = false;
+                           }
+                           break;
+                         case Delta::Action::ADD_IN_EDGE:
+                         case Delta::Action::ADD_OUT_EDGE:
+                         case Delta::Action::REMOVE_IN_EDGE:
+                         case Delta::Action::REMOVE_OUT_EDGE:
+                           break;
+                       }
+                     });
+  return !deleted && has_label &&
+         std::all_of(current_values_equal.begin(), current_values_equal.end(), [](bool equal) { return equal; });
+}
+
+/// Helper function for edge type index garbage collection. Returns true if
+/// there's a reachable version of the edge. When properties on edges are
+/// disabled the edge exists only in the adjacency lists, so the out edges of
+/// the `from_vertex` are inspected instead.
+bool AnyVersionHasEdge(EdgeRef edge, EdgeTypeId edge_type, Vertex *from_vertex, Vertex *to_vertex, uint64_t timestamp,
+                       Config::Items config) {
+  if (config.properties_on_edges) {
+    bool deleted;
+    const Delta *delta;
+    {
+      std::lock_guard<utils::SeqLock> guard(edge.ptr->lock);
+      deleted = edge.ptr->deleted;
+      delta = edge.ptr->delta;
+    }
+    if (!deleted) {
+      return true;
+    }
+    return AnyVersionSatisfiesPredicate(timestamp, delta, [&deleted](const Delta &delta) {
+      switch (delta.action) {
+        case Delta::Action::RECREATE_OBJECT:
+          deleted = false;
+          break;
+        case Delta::Action::DELETE_OBJECT:
+          deleted = true;
+          break;
+        case Delta::Action::ADD_LABEL:
+        case Delta::Action::REMOVE_LABEL:
+        case Delta::Action::SET_PROPERTY:
+        case Delta::Action::ADD_IN_EDGE:
+        case Delta::Action::ADD_OUT_EDGE:
+        case Delta::Action::REMOVE_IN_EDGE:
+        case Delta::Action::REMOVE_OUT_EDGE:
+          break;
+      }
+      return !deleted;
+    });
+  }
+
+  bool exists;
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SeqLock> guard(from_vertex->lock);
+    exists = from_vertex->out_edges.Find({edge_type, to_vertex, edge}) != from_vertex->out_edges.end();
+    delta = from_vertex->delta;
+  }
+  if (exists) {
+    return true;
+  }
+  return AnyVersionSatisfiesPredicate(timestamp, delta, [&exists, edge](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_OUT_EDGE:
+        if (delta.vertex_edge.edge == edge) {
+          exists = true;
+        }
+        break;
+      case Delta::Action::REMOVE_OUT_EDGE:
+        if (delta.vertex_edge.edge == edge) {
+          exists = false;
+        }
+        break;
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::DELETE_OBJECT:
+      case Delta::Action::RECREATE_OBJECT:
+        break;
+    }
+    return exists;
+  });
+}
+
+// Helper function for iterating through edge type index. Returns true if this
+// transaction can see the given edge.
+bool CurrentVersionHasEdge(EdgeRef edge, EdgeTypeId edge_type, Vertex *from_vertex, Vertex *to_vertex,
+                           Transaction *transaction, View view, Config::Items config) {
+  if (config.properties_on_edges) {
+    bool deleted;
+    bool exists = true;
+    const Delta *delta;
+    {
+      std::lock_guard<utils::SeqLock> guard(edge.ptr->lock);
+      deleted = edge.ptr->deleted;
+      delta = edge.ptr->delta;
+    }
+    ApplyDeltasForRead(transaction, delta, view, [&deleted, &exists](const Delta &delta) {
+      switch (delta.action) {
+        case Delta::Action::RECREATE_OBJECT:
+          deleted = false;
+          break;
+        case Delta::Action::DELETE_OBJECT:
+          exists = false;
+          break;
+        case Delta::Action::ADD_LABEL:
+        case Delta::Action::REMOVE_LABEL:
+        case Delta::Action::SET_PROPERTY:
+        case Delta::Action::ADD_IN_EDGE:
+        case Delta::Action::ADD_OUT_EDGE:
+        case Delta::Action::REMOVE_IN_EDGE:
+        case Delta::Action::REMOVE_OUT_EDGE:
+          break;
+      }
+    });
+    return exists && !deleted;
+  }
+
+  bool exists;
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SeqLock> guard(from_vertex->lock);
+    exists = from_vertex->out_edges.Find({edge_type, to_vertex, edge}) != from_vertex->out_edges.end();
+    delta = from_vertex->delta;
+  }
+  ApplyDeltasForRead(transaction, delta, view, [&exists, edge](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_OUT_EDGE:
+        if (delta.vertex_edge.edge == edge) {
+          MG_ASSERT(!exists, "Invalid database state!");
+          exists = true;
+        }
+        break;
+      case Delta::Action::REMOVE_OUT_EDGE:
+        if (delta.vertex_edge.edge == edge) {
+          MG_ASSERT(exists, "Invalid database state!");
+          exists = false;
+        }
+        break;
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::DELETE_OBJECT:
+      case Delta::Action::RECREATE_OBJECT:
+        break;
+    }
+  });
+  return exists;
+}
+
+/// Helper function for edge type+property index garbage collection. Returns
+/// true if there's a reachable version of the edge that has the given property
+/// value. The edge type of an edge never changes, so it isn't checked.
+bool AnyVersionHasEdgeProperty(const Edge &edge, PropertyId key, const PropertyValue &value, uint64_t timestamp) {
+  bool current_value_equal_to_value = value.IsNull();
+  bool deleted;
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SeqLock> guard(edge.lock);
+    current_value_equal_to_value = edge.properties.IsPropertyEqual(key, value);
+    deleted = edge.deleted;
+    delta = edge.delta;
+  }
+
+  if (!deleted && current_value_equal_to_value) {
+    return true;
+  }
+
+  return AnyVersionSatisfiesPredicate(
+      timestamp, delta, [&current_value_equal_to_value, &deleted, key, &value](const Delta &delta) {
+        switch (delta.action) {
+          case Delta::Action::SET_PROPERTY:
+            if (delta.property.key == key) {
+              current_value_equal_to_value = delta.property.value == value;
+            }
+            break;
+          case Delta::Action::RECREATE_OBJECT: {
+            MG_ASSERT(deleted, "Invalid database state!");
+            deleted = false;
+            break;
+          }
+          case Delta::Action::DELETE_OBJECT: {
+            MG_ASSERT(!deleted, "Invalid database state!");
+            deleted = true;
+            break;
+          }
+          case Delta::Action::ADD_LABEL:
+          case Delta::Action::REMOVE_LABEL:
+          case Delta::Action::ADD_IN_EDGE:
+          case Delta::Action::ADD_OUT_EDGE:
+          case Delta::Action::REMOVE_IN_EDGE:
+          case Delta::Action::REMOVE_OUT_EDGE:
+            break;
+        }
+        return !deleted && current_value_equal_to_value;
+      });
+}
+
+// Helper function for iterating through edge type+property index. Returns true
+// if this transaction can see the given edge, and the visible version has the
+// given property value. `string_id` is the dictionary ID of `value` if it is an
+// interned string.
+bool CurrentVersionHasEdgeProperty(const Edge &edge, PropertyId key, const PropertyValue &value,
+                                   Transaction *transaction, View view, std::optional<uint64_t> string_id) {
+  bool deleted;
+  bool current_value_equal_to_value = value.IsNull();
+  const Delta *delta;
+  {
+    std::lock_guard<utils::SeqLock> guard(edge.lock);
+    deleted = edge.deleted;
+    current_value_equal_to_value = edge.properties.IsPropertyEqual(key, value, string_id);
+    delta = edge.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, view,
+                     [&deleted, &current_value_equal_to_value, key, &value](const Delta &delta) {
+                       switch (delta.action) {
+                         case Delta::Action::SET_PROPERTY: {
+                           if (delta.property.key == key) {
+                             current_value_equal_to_value = delta.property.value == value;
+                           }
+                           break;
+                         }
+                         case Delta::Action::DELETE_OBJECT: {
+                           MG_ASSERT(!deleted, "Invalid database state!");
+                           deleted = true;
+                           break;
+                         }
+                         case Delta::Action::RECREATE_OBJECT: {
+                           MG_ASSERT(deleted, "Invalid database state!");
+                           deleted = false;
+                           break;
+                         }
+                         case Delta::Action::ADD_LABEL:
+                         case Delta::Action::REMOVE_LABEL:
+                         case Delta::Action::ADD_IN_EDGE:
+                         case Delta::Action::ADD_OUT_EDGE:
+                         case Delta::Action::REMOVE_IN_EDGE:
+                         case Delta::Action::REMOVE_OUT_EDGE:
+                           break;
+                       }
+                     });
+  return !deleted && current_value_equal_to_value;
+}
+
+}  // namespace
+
+void LabelIndex::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) {
+  auto it = index_.find(label);
+  if (it == index_.end()) return;
+  auto acc = it->second.access();
+  acc.insert(Entry{vertex, tx.start_timestamp});
+}
+
+bool LabelIndex::CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices, uint64_t num_threads) {
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto [it, emplaced] = index_.emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+  try {
+    auto acc = it->second.access();
+    ParallelScanVertices(&vertices, num_threads, "Label index creation", [&](Vertex &vertex) {
+      if (!vertex.deleted && vertex.labels.Contains(label)) {
+        acc.insert(Entry{&vertex, 0});
+      }
+      return true;
+    });
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index_.erase(it);
+    throw;
+  }
+  return true;
+}
+
+utils::SkipList<LabelIndex::Entry> *LabelIndex::StartIndexBuild(LabelId label) {
+  auto [it, emplaced] = index_.emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return nullptr;
+  }
+  try {
+    building_.insert(label);
+  } catch (...) {
+    index_.erase(it);
+    throw;
+  }
+  return &it->second;
+}
+
+void LabelIndex::BuildIndex(utils::SkipList<Entry> *index, LabelId label, utils::SkipList<Vertex>::Accessor vertices,
+                            uint64_t num_threads) {
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto acc = index->access();
+  ParallelScanVertices(&vertices, num_threads, "Online label index creation", [&](Vertex &vertex) {
+    // The entry is inserted while holding the lock so that the GC can't unlink
+    // the deltas of the vertex and remove it from the index in between.
+    std::lock_guard<utils::SeqLock> guard(vertex.lock);
+    // Transactions that run concurrently with the build may still see an older
+    // version of the vertex, so vertices that have any deltas are indexed
+    // regardless of their labels. The entries that aren't needed are removed
+    // by the GC.
+    if (vertex.delta != nullptr || (!vertex.deleted && vertex.labels.Contains(label))) {
+      acc.insert(Entry{&vertex, 0});
+    }
+    return true;
+  });
+}
+
+void LabelIndex::AbortIndexBuild(LabelId label) {
+  utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+  building_.erase(label);
+  index_.erase(label);
+}
+
+std::vector<LabelId> LabelIndex::ListIndices() const {
+  std::vector<LabelId> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    if (building_.contains(item.first)) continue;
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void LabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  for (auto &label_storage : index_) {
+    auto vertices_acc = label_storage.second.access();
+    for (auto it = vertices_acc.begin(); it != vertices_acc.end();) {
+      auto next_it = it;
+      ++next_it;
+
+      if (it->timestamp >= oldest_active_start_timestamp) {
+        it = next_it;
+        continue;
+      }
+
+      if ((next_it != vertices_acc.end() && it->vertex == next_it->vertex) ||
+          !AnyVersionHasLabel(*it->vertex, label_storage.first, oldest_active_start_timestamp)) {
+        vertices_acc.remove(*it);
+      }
+
+      it = next_it;
+    }
+  }
+}
+
+LabelIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_),
+      current_vertex_(nullptr) {
+  AdvanceUntilValid();
+}
+
+LabelIndex::Iterable::Iterator &LabelIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void LabelIndex::Iterable::Iterator::AdvanceUntilValid() {
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (index_iterator_->vertex == current_vertex_) {
+      continue;
+    }
+    if (CurrentVersionHasLabel(*index_iterator_->vertex, self_->label_, self_->transaction_, self_->view_)) {
+      current_vertex_ = index_iterator_->vertex;
+      current_vertex_accessor_ =
+          VertexAccessor{current_vertex_, self_->transaction_, self_->indices_, self_->constraints_, self_->config_};
+      break;
+    }
+  }
+}
+
+LabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, View view,
+                               Transaction *transaction, Indices *indices, Constraints *constraints,
+                               Config::Items config)
+    : index_accessor_(std::move(index_accessor)),
+      label_(label),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {}
+
+void LabelIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+bool LabelPropertyIndex::Entry::operator<(const Entry &rhs) {
+  if (value < rhs.value) {
+    return true;
+  }
+  if (rhs.value < value) {
+    return false;
+  }
+  return std::make_tuple(vertex, timestamp) < std::make_tuple(rhs.vertex, rhs.timestamp);
+}
+
+bool LabelPropertyIndex::Entry::operator==(const Entry &rhs) {
+  return value == rhs.value && vertex == rhs.vertex && timestamp == rhs.timestamp;
+}
+
+bool LabelPropertyIndex::Entry::operator<(const PropertyValue &rhs) { return value < rhs; }
+
+bool LabelPropertyIndex::Entry::operator==(const PropertyValue &rhs) { return value == rhs; }
+
+void LabelPropertyIndex::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) {
+  for (auto &[label_prop, storage] : index_) {
+    if (label_prop.first != label) {
+      continue;
+    }
+    auto prop_value = vertex->properties.GetProperty(label_prop.second);
+    if (!prop_value.IsNull()) {
+      auto acc = storage.access();
+      acc.insert(Entry{std::move(prop_value), vertex, tx.start_timestamp});
+    }
+  }
+}
+
+void LabelPropertyIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                             const Transaction &tx) {
+  if (value.IsNull()) {
+    return;
+  }
+  for (auto &[label_prop, storage] : index_) {
+    if (label_prop.second != property) {
+      continue;
+    }
+    if (vertex->labels.Contains(label_prop.first)) {
+      auto acc = storage.access();
+      acc.insert(Entry{value, vertex, tx.start_timestamp});
+    }
+  }
+}
+
+bool LabelPropertyIndex::CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+                                     uint64_t num_threads) {
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+  try {
+    auto acc = it->second.access();
+    ParallelScanVertices(&vertices, num_threads, "Label+property index creation", [&](Vertex &vertex) {
+      if (vertex.deleted || !vertex.labels.Contains(label)) {
+        return true;
+      }
+      auto value = vertex.properties.GetProperty(property);
+      if (!value.IsNull()) {
+        acc.insert(Entry{std::move(value), &vertex, 0});
+      }
+      return true;
+    });
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index_.erase(it);
+    throw;
+  }
+  return true;
+}
+
+utils::SkipList<LabelPropertyIndex::Entry> *LabelPropertyIndex::StartIndexBuild(LabelId label, PropertyId property) {
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return nullptr;
+  }
+  try {
+    building_.emplace(label, property);
+  } catch (...) {
+    index_.erase(it);
+    throw;
+  }
+  return &it->second;
+}
+
+void LabelPropertyIndex::BuildIndex(utils::SkipList<Entry> *index, LabelId label, PropertyId property,
+                                    utils::SkipList<Vertex>::Accessor vertices, uint64_t num_threads) {
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto acc = index->access();
+  ParallelScanVertices(&vertices, num_threads, "Online label+property index creation", [&](Vertex &vertex) {
+    // See `LabelIndex::BuildIndex` for the reason why the lock is held.
+    std::lock_guard<utils::SeqLock> guard(vertex.lock);
+    if (vertex.delta == nullptr && (vertex.deleted || !vertex.labels.Contains(label))) {
+      return true;
+    }
+    auto value = vertex.properties.GetProperty(property);
+    if (!value.IsNull()) {
+      acc.insert(Entry{std::move(value), &vertex, 0});
+    }
+    // Older versions of the vertex may still be visible to the transactions
+    // that run concurrently with the build, so all values of the property from
+    // the version chain are indexed. The entries that aren't needed are
+    // removed by the GC.
+    for (const Delta *delta = vertex.delta; delta != nullptr; delta = delta->next.load(std::memory_order_acquire)) {
+      if (delta->action == Delta::Action::SET_PROPERTY && delta->property.key == property &&
+          !delta->property.value.IsNull()) {
+        acc.insert(Entry{delta->property.value, &vertex, 0});
+      }
+    }
+    return true;
+  });
+}
+
+void LabelPropertyIndex::AbortIndexBuild(LabelId label, PropertyId property) {
+  utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+  building_.erase({label, property});
+  index_.erase({label, property});
+}
+
+std::vector<std::pair<LabelId, PropertyId>> LabelPropertyIndex::ListIndices() const {
+  std::vector<std::pair<LabelId, PropertyId>> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    if (building_.contains(item.first)) continue;
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void LabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  for (auto &[label_property, index] : index_) {
+    auto index_acc = index.access();
+    for (auto it = index_acc.begin(); it != index_acc.end();) {
+      auto next_it = it;
+      ++next_it;
+
+      if (it->timestamp >= oldest_active_start_timestamp) {
+        it = next_it;
+        continue;
+      }
+
+      if ((next_it != index_acc.end() && it->vertex == next_it->vertex && it->value == next_it->value) ||
+          !AnyVersionHasLabelProperty(*it->vertex, label_property.first, label_property.second, it->value,
+                                      oldest_active_start_timestamp)) {
+        index_acc.remove(*it);
+      }
+      it = next_it;
+    }
+  }
+}
+
+LabelPropertyIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_),
+      current_vertex_(nullptr) {
+  AdvanceUntilValid();
+}
+
+LabelPropertyIndex::Iterable::Iterator &LabelPropertyIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void LabelPropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (index_iterator_->vertex == current_vertex_) {
+      continue;
+    }
+
+    if (self_->lower_bound_) {
+      if (index_iterator_->value < self_->lower_bound_->value()) {
+        continue;
+      }
+      if (!self_->lower_bound_->IsInclusive() && index_iterator_->value == self_->lower_bound_->value()) {
+        continue;
+      }
+    }
+    if (self_->upper_bound_) {
+      if (self_->upper_bound_->value() < index_iterator_->value) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+      if (!self_->upper_bound_->IsInclusive() && index_iterator_->value == self_->upper_bound_->value()) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+    }
+
+    if (CurrentVersionHasLabelProperty(*index_iterator_->vertex, self_->label_, self_->property_,
+                                       index_iterator_->value, self_->transaction_, self_->view_,
+                                       self_->equal_string_.Id())) {
+      current_vertex_ = index_iterator_->vertex;
+      current_vertex_accessor_ =
+          VertexAccessor(current_vertex_, self_->transaction_, self_->indices_, self_->constraints_, self_->config_);
+      break;
+    }
+  }
+}
+
+// These constants represent the smallest possible value of each type that is
+// contained in a `PropertyValue`. Note that numbers (integers and doubles) are
+// treated as the same "type" in `PropertyValue`.
+const PropertyValue kSmallestBool = PropertyValue(false);
+static_assert(-std::numeric_limits<double>::infinity() < std::numeric_limits<int64_t>::min());
+const PropertyValue kSmallestNumber = PropertyValue(-std::numeric_limits<double>::infinity());
+const PropertyValue kSmallestString = PropertyValue("");
+const PropertyValue kSmallestList = PropertyValue(std::vector<PropertyValue>());
+const PropertyValue kSmallestMap = PropertyValue(std::map<std::string, PropertyValue>());
+const PropertyValue kSmallestTemporalData =
+    PropertyValue(TemporalData{static_cast<TemporalType>(0), std::numeric_limits<int64_t>::min()});
+
+namespace {
+
+/// Fixes the bounds that the user provided to a property index lookup so that
+/// only values of the same type as the bounds are returned. Returns false if
+/// the bounds aren't of comparable types, in which case no values should be
+/// returned.
+bool MakeBoundsOfTheSameType(std::optional<utils::Bound<PropertyValue>> *lower_bound,
+                             std::optional<utils::Bound<PropertyValue>> *upper_bound) {
+  // We have to fix the bounds that the user provided to us. If the user
+  // provided only one bound we should make sure that only values of that type
+  // are returned by the iterator. We ensure this by supplying either an
+  // inclusive lower bound of the same type, or an exclusive upper bound of the
+  // following type. If neither bound is set we yield all items in the index.
+
+  // First we statically verify that our assumptions about the `PropertyValue`
+  // type ordering holds.
+  static_assert(PropertyValue::Type::Bool < PropertyValue::Type::Int);
+  static_assert(PropertyValue::Type::Int < PropertyValue::Type::Double);
+  static_assert(PropertyValue::Type::Double < PropertyValue::Type::String);
+  static_assert(PropertyValue::Type::String < PropertyValue::Type::List);
+  static_assert(PropertyValue::Type::List < PropertyValue::Type::Map);
+
+  // Remove any bounds that are set to `Null` because that isn't a valid value.
+  if (*lower_bound && (*lower_bound)->value().IsNull()) {
+    *lower_bound = std::nullopt;
+  }
+  if (*upper_bound && (*upper_bound)->value().IsNull()) {
+    *upper_bound = std::nullopt;
+  }
+
+  // Check whether the bounds are of comparable types if both are supplied.
+  if (*lower_bound && *upper_bound &&
+      !PropertyValue::AreComparableTypes((*lower_bound)->value().type(), (*upper_bound)->value().type())) {
+    return false;
+  }
+
+  // Set missing bounds.
+  if (*lower_bound && !*upper_bound) {
+    // Here we need to supply an upper bound. The upper bound is set to an
+    // exclusive lower bound of the following type.
+    switch ((*lower_bound)->value().type()) {
+      case PropertyValue::Type::Null:
+        // This shouldn't happen because of the nullopt-ing above.
+        LOG_FATAL("Invalid database state!");
+        break;
+      case PropertyValue::Type::Bool:
+        *upper_bound = utils::MakeBoundExclusive(kSmallestNumber);
+        break;
+      case PropertyValue::Type::Int:
+      case PropertyValue::Type::Double:
+        // Both integers and doubles are treated as the same type in
+        // `PropertyValue` and they are interleaved when sorted.
+        *upper_bound = utils::MakeBoundExclusive(kSmallestString);
+        break;
+      case PropertyValue::Type::String:
+        *upper_bound = utils::MakeBoundExclusive(kSmallestList);
+        break;
+      case PropertyValue::Type::List:
+        *upper_bound = utils::MakeBoundExclusive(kSmallestMap);
+        break;
+      case PropertyValue::Type::Map:
+        *upper_bound = utils::MakeBoundExclusive(kSmallestTemporalData);
+        break;
+      case PropertyValue::Type::TemporalData:
+        // This is the last type in the order so we leave the upper bound empty.
+        break;
+    }
+  }
+  if (*upper_bound && !*lower_bound) {
+    // Here we need to supply a lower bound. The lower bound is set to an
+    // inclusive lower bound of the current type.
+    switch ((*upper_bound)->value().type()) {
+      case PropertyValue::Type::Null:
+        // This shouldn't happen because of the nullopt-ing above.
+        LOG_FATAL("Invalid database state!");
+        break;
+      case PropertyValue::Type::Bool:
+        *lower_bound = utils::MakeBoundInclusive(kSmallestBool);
+        break;
+      case PropertyValue::Type::Int:
+      case PropertyValue::Type::Double:
+        // Both integers and doubles are treated as the same type in
+        // `PropertyValue` and they are interleaved when sorted.
+        *lower_bound = utils::MakeBoundInclusive(kSmallestNumber);
+        break;
+      case PropertyValue::Type::String:
+        *lower_bound = utils::MakeBoundInclusive(kSmallestString);
+        break;
+      case PropertyValue::Type::List:
+        *lower_bound = utils::MakeBoundInclusive(kSmallestList);
+        break;
+      case PropertyValue::Type::Map:
+        *lower_bound = utils::MakeBoundInclusive(kSmallestMap);
+        break;
+      case PropertyValue::Type::TemporalData:
+        *lower_bound = utils::MakeBoundInclusive(kSmallestTemporalData);
+        break;
+    }
+  }
+  return true;
+}
+
+// Returns a reference to the interned string that is searched for if the
+// bounds only match a single string value. The reference is empty otherwise.
+StringDictionary::Reference MakeEqualStringReference(const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                                     const std::optional<utils::Bound<PropertyValue>> &upper_bound) {
+  if (!lower_bound || !upper_bound || !lower_bound->IsInclusive() || !upper_bound->IsInclusive()) return {};
+  const auto &value = lower_bound->value();
+  if (!value.IsString() || !(value == upper_bound->value())) return {};
+  return {&StringDictionary::Global(), value.ValueString()};
+}
+
+}  // namespace
+
+LabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label,
+                                       PropertyId property,
+                                       const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                       const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
+                                       Transaction *transaction, Indices *indices, Constraints *constraints,
+                                       Config::Items config)
+    : index_accessor_(std::move(index_accessor)),
+      label_(label),
+      property_(property),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {
+  bounds_valid_ = MakeBoundsOfTheSameType(&lower_bound_, &upper_bound_);
+  equal_string_ = MakeEqualStringReference(lower_bound_, upper_bound_);
+}
+
+LabelPropertyIndex::Iterable::Iterator LabelPropertyIndex::Iterable::begin() {
+  // If the bounds are set and don't have comparable types we don't yield any
+  // items from the index.
+  if (!bounds_valid_) return Iterator(this, index_accessor_.end());
+  auto index_iterator = index_accessor_.begin();
+  if (lower_bound_) {
+    index_iterator = index_accessor_.find_equal_or_greater(lower_bound_->value());
+  }
+  return Iterator(this, index_iterator);
+}
+
+LabelPropertyIndex::Iterable::Iterator LabelPropertyIndex::Iterable::end() {
+  return Iterator(this, index_accessor_.end());
+}
+
+int64_t LabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property,
+                                                   const PropertyValue &value) const {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
+  auto acc = it->second.access();
+  if (!value.IsNull()) {
+    return acc.estimate_count(value, utils::SkipListLayerForCountEstimation(acc.size()));
+  } else {
+    // The value `Null` won't ever appear in the index because it indicates that
+    // the property shouldn't exist. Instead, this value is used as an indicator
+    // to estimate the average number of equal elements in the list (for any
+    // given value).
+    return acc.estimate_average_number_of_equals(
+        [](const auto &first, const auto &second) { return first.value == second.value; },
+        utils::SkipListLayerForAverageEqualsEstimation(acc.size()));
+  }
+}
+
+int64_t LabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property,
+                                                   const std::optional<utils::Bound<PropertyValue>> &lower,
+                                                   const std::optional<utils::Bound<PropertyValue>> &upper) const {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
+  auto acc = it->second.access();
+  return acc.estimate_range_count(lower, upper, utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+void LabelPropertyIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+bool LabelPropertyCompositeIndex::Entry::operator<(const Entry &rhs) {
+  if (values < rhs.values) {
+    return true;
+  }
+  if (rhs.values < values) {
+    return false;
+  }
+  return std::make_tuple(vertex, timestamp) < std::make_tuple(rhs.vertex, rhs.timestamp);
+}
+
+bool LabelPropertyCompositeIndex::Entry::operator==(const Entry &rhs) {
+  return values == rhs.values && vertex == rhs.vertex && timestamp == rhs.timestamp;
+}
+
+bool LabelPropertyCompositeIndex::Entry::operator<(const std::vector<PropertyValue> &rhs) {
+  MG_ASSERT(rhs.size() <= values.size(), "Composite index lookup uses too many values!");
+  return std::lexicographical_compare(values.begin(), values.begin() + rhs.size(), rhs.begin(), rhs.end());
+}
+
+bool LabelPropertyCompositeIndex::Entry::operator==(const std::vector<PropertyValue> &rhs) {
+  MG_ASSERT(rhs.size() <= values.size(), "Composite index lookup uses too many values!");
+  return std::equal(rhs.begin(), rhs.end(), values.begin());
+}
+
+namespace {
+
+bool AllNull(const std::vector<PropertyValue> &values) {
+  return std::all_of(values.begin(), values.end(), [](const auto &value) { return value.IsNull(); });
+}
+
+}  // namespace
+
+void LabelPropertyCompositeIndex::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) {
+  for (auto &[label_props, storage] : index_) {
+    if (label_props.first != label) {
+      continue;
+    }
+    std::vector<PropertyValue> values;
+    values.reserve(label_props.second.size());
+    for (const auto property : label_props.second) {
+      values.push_back(vertex->properties.GetProperty(property));
+    }
+    if (!AllNull(values)) {
+      auto acc = storage.access();
+      acc.insert(Entry{std::move(values), vertex, tx.start_timestamp});
+    }
+  }
+}
+
+void LabelPropertyCompositeIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue &value,
+                                                      Vertex *vertex, const Transaction &tx) {
+  for (auto &[label_props, storage] : index_) {
+    const auto &properties = label_props.second;
+    if (!utils::Contains(properties, property) || !vertex->labels.Contains(label_props.first)) {
+      continue;
+    }
+    std::vector<PropertyValue> values;
+    values.reserve(properties.size());
+    for (const auto key : properties) {
+      values.push_back(key == property ? value : vertex->properties.GetProperty(key));
+    }
+    if (!AllNull(values)) {
+      auto acc = storage.access();
+      acc.insert(Entry{std::move(values), vertex, tx.start_timestamp});
+    }
+  }
+}
+
+bool LabelPropertyCompositeIndex::CreateIndex(LabelId label, const std::vector<PropertyId> &properties,
+                                              utils::SkipList<Vertex>::Accessor vertices, uint64_t num_threads) {
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, properties), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+  try {
+    auto acc = it->second.access();
+    ParallelScanVertices(&vertices, num_threads, "Label+property composite index creation", [&](Vertex &vertex) {
+      if (vertex.deleted || !vertex.labels.Contains(label)) {
+        return true;
+      }
+      std::vector<PropertyValue> values;
+      values.reserve(properties.size());
+      for (const auto property : properties) {
+        values.push_back(vertex.properties.GetProperty(property));
+      }
+      if (!AllNull(values)) {
+        acc.insert(Entry{std::move(values), &vertex, 0});
+      }
+      return true;
+    });
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index_.erase(it);
+    throw;
+  }
+  return true;
+}
+
+std::vector<std::pair<LabelId, std::vector<PropertyId>>> LabelPropertyCompositeIndex::ListIndices() const {
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void LabelPropertyCompositeIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  for (auto &[label_props, index] : index_) {
+    auto index_acc = index.access();
+    for (auto it = index_acc.begin(); it != index_acc.end();) {
+      auto next_it = it;
+      ++next_it;
+
+      if (it->timestamp >= oldest_active_start_timestamp) {
+        it = next_it;
+        continue;
+      }
+
+      if ((next_it != index_acc.end() && it->vertex == next_it->vertex && it->values == next_it->values) ||
+          !AnyVersionHasLabelProperties(*it->vertex, label_props.first, label_props.second, it->values,
+                                        oldest_active_start_timestamp)) {
+        index_acc.remove(*it);
+      }
+      it = next_it;
+    }
+  }
+}
+
+LabelPropertyCompositeIndex::Iterable::Iterator::Iterator(Iterable *self,
+                                                          utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_),
+      current_vertex_(nullptr) {
+  AdvanceUntilValid();
+}
+
+LabelPropertyCompositeIndex::Iterable::Iterator &LabelPropertyCompositeIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void LabelPropertyCompositeIndex::Iterable::Iterator::AdvanceUntilValid() {
+  const auto &prefix = self_->prefix_;
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (index_iterator_->vertex == current_vertex_) {
+      continue;
+    }
+
+    const auto &values = index_iterator_->values;
+    // The iteration starts at the first entry with the given prefix and the
+    // entries are sorted by their values, so the first entry with a different
+    // prefix is past all of the matching ones.
+    if (!std::equal(prefix.begin(), prefix.end(), values.begin())) {
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+    if (self_->lower_bound_) {
+      const auto &value = values[prefix.size()];
+      if (value < self_->lower_bound_->value()) {
+        continue;
+      }
+      if (!self_->lower_bound_->IsInclusive() && value == self_->lower_bound_->value()) {
+        continue;
+      }
+    }
+    if (self_->upper_bound_) {
+      const auto &value = values[prefix.size()];
+      if (self_->upper_bound_->value() < value) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+      if (!self_->upper_bound_->IsInclusive() && value == self_->upper_bound_->value()) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+    }
+
+    if (CurrentVersionHasLabelProperties(*index_iterator_->vertex, self_->label_, self_->properties_, values,
+                                         self_->transaction_, self_->view_)) {
+      current_vertex_ = index_iterator_->vertex;
+      current_vertex_accessor_ =
+          VertexAccessor(current_vertex_, self_->transaction_, self_->indices_, self_->constraints_, self_->config_);
+      break;
+    }
+  }
+}
+
+LabelPropertyCompositeIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label,
+                                                const std::vector<PropertyId> &properties,
+                                                const std::vector<PropertyValue> &prefix,
+                                                const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                                const std::optional<utils::Bound<PropertyValue>> &upper_bound,
+                                                View view, Transaction *transaction, Indices *indices,
+                                                Constraints *constraints, Config::Items config)
+    : index_accessor_(std::move(index_accessor)),
+      label_(label),
+      properties_(properties),
+      prefix_(prefix),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {
+  MG_ASSERT(prefix_.size() < properties_.size() || (prefix_.size() == properties_.size() && !lower_bound_ &&
+                                                    !upper_bound_),
+            "Composite index lookup uses too many values!");
+  // `Null` is never equal to any value, so no vertex can match such a prefix.
+  bounds_valid_ = std::none_of(prefix_.begin(), prefix_.end(), [](const auto &value) { return value.IsNull(); }) &&
+                  MakeBoundsOfTheSameType(&lower_bound_, &upper_bound_);
+}
+
+LabelPropertyCompositeIndex::Iterable::Iterator LabelPropertyCompositeIndex::Iterable::begin() {
+  // If the bounds are set and don't have comparable types we don't yield any
+  // items from the index.
+  if (!bounds_valid_) return Iterator(this, index_accessor_.end());
+  auto key = prefix_;
+  if (lower_bound_) {
+    key.push_back(lower_bound_->value());
+  }
+  if (key.empty()) {
+    return Iterator(this, index_accessor_.begin());
+  }
+  return Iterator(this, index_accessor_.find_equal_or_greater(key));
+}
+
+LabelPropertyCompositeIndex::Iterable::Iterator LabelPropertyCompositeIndex::Iterable::end() {
+  return Iterator(this, index_accessor_.end());
+}
+
+int64_t LabelPropertyCompositeIndex::ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                                            const std::vector<PropertyValue> &prefix) const {
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  MG_ASSERT(prefix.size() <= properties.size(), "Composite index lookup uses too many values!");
+  auto acc = it->second.access();
+  if (prefix.empty()) {
+    return acc.size();
+  }
+  if (std::none_of(prefix.begin(), prefix.end(), [](const auto &value) { return value.IsNull(); })) {
+    return acc.estimate_count(prefix, utils::SkipListLayerForCountEstimation(acc.size()));
+  }
+  // Similarly to the single property index, `Null` is used as an indicator to
+  // estimate the average number of vertices that share the same prefix.
+  return acc.estimate_average_number_of_equals(
+      [size = prefix.size()](const auto &first, const auto &second) {
+        return std::equal(first.values.begin(), first.values.begin() + size, second.values.begin());
+      },
+      utils::SkipListLayerForAverageEqualsEstimation(acc.size()));
 }
 
-}  // namespace
+int64_t LabelPropertyCompositeIndex::ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                                            const std::vector<PropertyValue> &prefix,
+                                                            const std::optional<utils::Bound<PropertyValue>> &lower,
+                                                            const std::optional<utils::Bound<PropertyValue>> &upper)
+    const {
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  MG_ASSERT(prefix.size() < properties.size(), "Composite index lookup uses too many values!");
+  // A missing bound is replaced with the prefix itself which, because only the
+  // prefix is compared, includes all of the entries with that prefix.
+  auto make_bound = [&prefix](const std::optional<utils::Bound<PropertyValue>> &bound)
+      -> std::optional<utils::Bound<std::vector<PropertyValue>>> {
+    if (!bound) {
+      if (prefix.empty()) return std::nullopt;
+      return utils::MakeBoundInclusive(prefix);
+    }
+    auto key = prefix;
+    key.push_back(bound->value());
+    return utils::Bound<std::vector<PropertyValue>>(std::move(key), bound->type());
+  };
+  auto acc = it->second.access();
+  return acc.estimate_range_count(make_bound(lower), make_bound(upper),
+                                  utils::SkipListLayerForCountEstimation(acc.size()));
+}
 
-void LabelIndex::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) {
-  auto it = index_.find(label);
+void LabelPropertyCompositeIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+void EdgeTypeIndex::UpdateOnEdgeCreation(EdgeTypeId edge_type, Vertex *from_vertex, Vertex *to_vertex, EdgeRef edge,
+                                         const Transaction &tx) {
+  auto it = index_.find(edge_type);
   if (it == index_.end()) return;
+  auto gid = config_.properties_on_edges ? edge.ptr->gid : edge.gid;
   auto acc = it->second.access();
-  acc.insert(Entry{vertex, tx.start_timestamp});
+  acc.insert(Entry{gid, edge, from_vertex, to_vertex, tx.start_timestamp});
 }
 
-bool LabelIndex::CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices) {
+bool EdgeTypeIndex::CreateIndex(EdgeTypeId edge_type, utils::SkipList<Vertex>::Accessor vertices,
+                                uint64_t num_threads) {
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-  auto [it, emplaced] = index_.emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple());
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(edge_type), std::forward_as_tuple());
   if (!emplaced) {
     // Index already exists.
     return false;
   }
   try {
     auto acc = it->second.access();
-    for (Vertex &vertex : vertices) {
-      if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
-        continue;
+    ParallelScanVertices(&vertices, num_threads, "Edge type index creation", [&](Vertex &from_vertex) {
+      if (from_vertex.deleted) {
+        return true;
       }
-      acc.insert(Entry{&vertex, 0});
-    }
+      auto [first, last] = from_vertex.out_edges.EdgeTypeRange(edge_type);
+      for (auto link = first; link != last; ++link) {
+        const auto &[type, to_vertex, edge] = *link;
+        auto gid = config_.properties_on_edges ? edge.ptr->gid : edge.gid;
+        acc.insert(Entry{gid, edge, &from_vertex, to_vertex, 0});
+      }
+      return true;
+    });
   } catch (const utils::OutOfMemoryException &) {
     utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
     index_.erase(it);
@@ -293,8 +1511,8 @@ bool LabelIndex::CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor ve
   return true;
 }
 
-std::vector<LabelId> LabelIndex::ListIndices() const {
-  std::vector<LabelId> ret;
+std::vector<EdgeTypeId> EdgeTypeIndex::ListIndices() const {
+  std::vector<EdgeTypeId> ret;
   ret.reserve(index_.size());
   for (const auto &item : index_) {
     ret.push_back(item.first);
@@ -302,10 +1520,10 @@ std::vector<LabelId> LabelIndex::ListIndices() const {
   return ret;
 }
 
-void LabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
-  for (auto &label_storage : index_) {
-    auto vertices_acc = label_storage.second.access();
-    for (auto it = vertices_acc.begin(); it != vertices_acc.end();) {
+void EdgeTypeIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  for (auto &[edge_type, edges] : index_) {
+    auto edges_acc = edges.access();
+    for (auto it = edges_acc.begin(); it != edges_acc.end();) {
       auto next_it = it;
       ++next_it;
 
@@ -314,9 +1532,10 @@ void LabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
         continue;
       }
 
-      if ((next_it != vertices_acc.end() && it->vertex == next_it->vertex) ||
-          !AnyVersionHasLabel(*it->vertex, label_storage.first, oldest_active_start_timestamp)) {
-        vertices_acc.remove(*it);
+      if ((next_it != edges_acc.end() && it->gid == next_it->gid) ||
+          !AnyVersionHasEdge(it->edge, edge_type, it->from_vertex, it->to_vertex, oldest_active_start_timestamp,
+                             config_)) {
+        edges_acc.remove(*it);
       }
 
       it = next_it;
@@ -324,118 +1543,109 @@ void LabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
   }
 }
 
-LabelIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
+EdgeTypeIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
     : self_(self),
       index_iterator_(index_iterator),
-      current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_),
-      current_vertex_(nullptr) {
+      current_edge_accessor_(EdgeRef(nullptr), EdgeTypeId::FromUint(0), nullptr, nullptr, nullptr, nullptr, nullptr,
+                             self_->config_) {
   AdvanceUntilValid();
 }
 
-LabelIndex::Iterable::Iterator &LabelIndex::Iterable::Iterator::operator++() {
+EdgeTypeIndex::Iterable::Iterator &EdgeTypeIndex::Iterable::Iterator::operator++() {
   ++index_iterator_;
   AdvanceUntilValid();
   return *this;
 }
 
-void LabelIndex::Iterable::Iterator::AdvanceUntilValid() {
+void EdgeTypeIndex::Iterable::Iterator::AdvanceUntilValid() {
   for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
-    if (index_iterator_->vertex == current_vertex_) {
-      continue;
-    }
-    if (CurrentVersionHasLabel(*index_iterator_->vertex, self_->label_, self_->transaction_, self_->view_)) {
-      current_vertex_ = index_iterator_->vertex;
-      current_vertex_accessor_ =
-          VertexAccessor{current_vertex_, self_->transaction_, self_->indices_, self_->constraints_, self_->config_};
+    const auto &entry = *index_iterator_;
+    if (CurrentVersionHasEdge(entry.edge, self_->edge_type_, entry.from_vertex, entry.to_vertex, self_->transaction_,
+                              self_->view_, self_->config_)) {
+      current_edge_accessor_ = EdgeAccessor(entry.edge, self_->edge_type_, entry.from_vertex, entry.to_vertex,
+                                            self_->transaction_, self_->indices_, self_->constraints_, self_->config_);
       break;
     }
   }
 }
 
-LabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, View view,
-                               Transaction *transaction, Indices *indices, Constraints *constraints,
-                               Config::Items config)
+EdgeTypeIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type, View view,
+                                  Transaction *transaction, Indices *indices, Constraints *constraints,
+                                  Config::Items config)
     : index_accessor_(std::move(index_accessor)),
-      label_(label),
+      edge_type_(edge_type),
       view_(view),
       transaction_(transaction),
       indices_(indices),
       constraints_(constraints),
       config_(config) {}
 
-void LabelIndex::RunGC() {
+void EdgeTypeIndex::RunGC() {
   for (auto &index_entry : index_) {
     index_entry.second.run_gc();
   }
 }
 
-bool LabelPropertyIndex::Entry::operator<(const Entry &rhs) {
+bool EdgeTypePropertyIndex::Entry::operator<(const Entry &rhs) {
   if (value < rhs.value) {
     return true;
   }
   if (rhs.value < value) {
     return false;
   }
-  return std::make_tuple(vertex, timestamp) < std::make_tuple(rhs.vertex, rhs.timestamp);
+  return std::make_tuple(edge, timestamp) < std::make_tuple(rhs.edge, rhs.timestamp);
 }
 
-bool LabelPropertyIndex::Entry::operator==(const Entry &rhs) {
-  return value == rhs.value && vertex == rhs.vertex && timestamp == rhs.timestamp;
+bool EdgeTypePropertyIndex::Entry::operator==(const Entry &rhs) {
+  return value == rhs.value && edge == rhs.edge && timestamp == rhs.timestamp;
 }
 
-bool LabelPropertyIndex::Entry::operator<(const PropertyValue &rhs) { return value < rhs; }
-
-bool LabelPropertyIndex::Entry::operator==(const PropertyValue &rhs) { return value == rhs; }
+bool EdgeTypePropertyIndex::Entry::operator<(const PropertyValue &rhs) { return value < rhs; }
 
-void LabelPropertyIndex::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) {
-  for (auto &[label_prop, storage] : index_) {
-    if (label_prop.first != label) {
-      continue;
-    }
-    auto prop_value = vertex->properties.GetProperty(label_prop.second);
-    if (!prop_value.IsNull()) {
-      auto acc = storage.access();
-      acc.insert(Entry{std::move(prop_value), vertex, tx.start_timestamp});
-    }
-  }
-}
+bool EdgeTypePropertyIndex::Entry::operator==(const PropertyValue &rhs) { return value == rhs; }
 
-void LabelPropertyIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
-                                             const Transaction &tx) {
+void EdgeTypePropertyIndex::UpdateOnSetProperty(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value,
+                                                Vertex *from_vertex, Vertex *to_vertex, Edge *edge,
+                                                const Transaction &tx) {
   if (value.IsNull()) {
     return;
   }
-  for (auto &[label_prop, storage] : index_) {
-    if (label_prop.second != property) {
-      continue;
-    }
-    if (utils::Contains(vertex->labels, label_prop.first)) {
-      auto acc = storage.access();
-      acc.insert(Entry{value, vertex, tx.start_timestamp});
-    }
-  }
+  auto it = index_.find({edge_type, property});
+  if (it == index_.end()) return;
+  auto acc = it->second.access();
+  acc.insert(Entry{value, edge, from_vertex, to_vertex, tx.start_timestamp});
 }
 
-bool LabelPropertyIndex::CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices) {
+bool EdgeTypePropertyIndex::CreateIndex(EdgeTypeId edge_type, PropertyId property,
+                                        utils::SkipList<Vertex>::Accessor vertices, uint64_t num_threads) {
+  MG_ASSERT(config_.properties_on_edges, "Edge type+property index requires properties on edges!");
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
   auto [it, emplaced] =
-      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple());
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(edge_type, property), std::forward_as_tuple());
   if (!emplaced) {
     // Index already exists.
     return false;
   }
   try {
     auto acc = it->second.access();
-    for (Vertex &vertex : vertices) {
-      if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
-        continue;
+    ParallelScanVertices(&vertices, num_threads, "Edge type+property index creation", [&](Vertex &from_vertex) {
+      if (from_vertex.deleted) {
+        return true;
       }
-      auto value = vertex.properties.GetProperty(property);
-      if (value.IsNull()) {
-        continue;
+      auto [first, last] = from_vertex.out_edges.EdgeTypeRange(edge_type);
+      for (auto link = first; link != last; ++link) {
+        const auto &[type, to_vertex, edge] = *link;
+        if (edge.ptr->deleted) {
+          continue;
+        }
+        auto value = edge.ptr->properties.GetProperty(property);
+        if (value.IsNull()) {
+          continue;
+        }
+        acc.insert(Entry{std::move(value), edge.ptr, &from_vertex, to_vertex, 0});
       }
-      acc.insert(Entry{std::move(value), &vertex, 0});
-    }
+      return true;
+    });
   } catch (const utils::OutOfMemoryException &) {
     utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
     index_.erase(it);
@@ -444,8 +1654,8 @@ bool LabelPropertyIndex::CreateIndex(LabelId label, PropertyId property, utils::
   return true;
 }
 
-std::vector<std::pair<LabelId, PropertyId>> LabelPropertyIndex::ListIndices() const {
-  std::vector<std::pair<LabelId, PropertyId>> ret;
+std::vector<std::pair<EdgeTypeId, PropertyId>> EdgeTypePropertyIndex::ListIndices() const {
+  std::vector<std::pair<EdgeTypeId, PropertyId>> ret;
   ret.reserve(index_.size());
   for (const auto &item : index_) {
     ret.push_back(item.first);
@@ -453,8 +1663,8 @@ std::vector<std::pair<LabelId, PropertyId>> LabelPropertyIndex::ListIndices() co
   return ret;
 }
 
-void LabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
-  for (auto &[label_property, index] : index_) {
+void EdgeTypePropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  for (auto &[edge_type_property, index] : index_) {
     auto index_acc = index.access();
     for (auto it = index_acc.begin(); it != index_acc.end();) {
       auto next_it = it;
@@ -465,9 +1675,8 @@ void LabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_time
         continue;
       }
 
-      if ((next_it != index_acc.end() && it->vertex == next_it->vertex && it->value == next_it->value) ||
-          !AnyVersionHasLabelProperty(*it->vertex, label_property.first, label_property.second, it->value,
-                                      oldest_active_start_timestamp)) {
+      if ((next_it != index_acc.end() && it->edge == next_it->edge && it->value == next_it->value) ||
+          !AnyVersionHasEdgeProperty(*it->edge, edge_type_property.second, it->value, oldest_active_start_timestamp)) {
         index_acc.remove(*it);
       }
       it = next_it;
@@ -475,23 +1684,24 @@ void LabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_time
   }
 }
 
-LabelPropertyIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
+EdgeTypePropertyIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
     : self_(self),
       index_iterator_(index_iterator),
-      current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_),
-      current_vertex_(nullptr) {
+      current_edge_accessor_(EdgeRef(nullptr), EdgeTypeId::FromUint(0), nullptr, nullptr, nullptr, nullptr, nullptr,
+                             self_->config_),
+      current_edge_(nullptr) {
   AdvanceUntilValid();
 }
 
-LabelPropertyIndex::Iterable::Iterator &LabelPropertyIndex::Iterable::Iterator::operator++() {
+EdgeTypePropertyIndex::Iterable::Iterator &EdgeTypePropertyIndex::Iterable::Iterator::operator++() {
   ++index_iterator_;
   AdvanceUntilValid();
   return *this;
 }
 
-void LabelPropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
+void EdgeTypePropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
   for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
-    if (index_iterator_->vertex == current_vertex_) {
+    if (index_iterator_->edge == current_edge_) {
       continue;
     }
 
@@ -514,36 +1724,26 @@ void LabelPropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
       }
     }
 
-    if (CurrentVersionHasLabelProperty(*index_iterator_->vertex, self_->label_, self_->property_,
-                                       index_iterator_->value, self_->transaction_, self_->view_)) {
-      current_vertex_ = index_iterator_->vertex;
-      current_vertex_accessor_ =
-          VertexAccessor(current_vertex_, self_->transaction_, self_->indices_, self_->constraints_, self_->config_);
+    if (CurrentVersionHasEdgeProperty(*index_iterator_->edge, self_->property_, index_iterator_->value,
+                                      self_->transaction_, self_->view_, self_->equal_string_.Id())) {
+      current_edge_ = index_iterator_->edge;
+      current_edge_accessor_ =
+          EdgeAccessor(EdgeRef(current_edge_), self_->edge_type_, index_iterator_->from_vertex,
+                       index_iterator_->to_vertex, self_->transaction_, self_->indices_, self_->constraints_,
+                       self_->config_);
       break;
     }
   }
 }
 
-// These constants represent the smallest possible value of each type that is
-// contained in a `PropertyValue`. Note that numbers (integers and doubles) are
-// treated as the same "type" in `PropertyValue`.
-const PropertyValue kSmallestBool = PropertyValue(false);
-static_assert(-std::numeric_limits<double>::infinity() < std::numeric_limits<int64_t>::min());
-const PropertyValue kSmallestNumber = PropertyValue(-std::numeric_limits<double>::infinity());
-const PropertyValue kSmallestString = PropertyValue("");
-const PropertyValue kSmallestList = PropertyValue(std::vector<PropertyValue>());
-const PropertyValue kSmallestMap = PropertyValue(std::map<std::string, PropertyValue>());
-const PropertyValue kSmallestTemporalData =
-    PropertyValue(TemporalData{static_cast<TemporalType>(0), std::numeric_limits<int64_t>::min()});
-
-LabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label,
-                                       PropertyId property,
-                                       const std::optional<utils::Bound<PropertyValue>> &lower_bound,
-                                       const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
-                                       Transaction *transaction, Indices *indices, Constraints *constraints,
-                                       Config::Items config)
+EdgeTypePropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type,
+                                          PropertyId property,
+                                          const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                          const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
+                                          Transaction *transaction, Indices *indices, Constraints *constraints,
+                                          Config::Items config)
     : index_accessor_(std::move(index_accessor)),
-      label_(label),
+      edge_type_(edge_type),
       property_(property),
       lower_bound_(lower_bound),
       upper_bound_(upper_bound),
@@ -552,101 +1752,11 @@ LabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_ac
       indices_(indices),
       constraints_(constraints),
       config_(config) {
-  // We have to fix the bounds that the user provided to us. If the user
-  // provided only one bound we should make sure that only values of that type
-  // are returned by the iterator. We ensure this by supplying either an
-  // inclusive lower bound of the same type, or an exclusive upper bound of the
-  // following type. If neither bound is set we yield all items in the index.
-
-  // First we statically verify that our assumptions about the `PropertyValue`
-  // type ordering holds.
-  static_assert(PropertyValue::Type::Bool < PropertyValue::Type::Int);
-  static_assert(PropertyValue::Type::Int < PropertyValue::Type::Double);
-  static_assert(PropertyValue::Type::Double < PropertyValue::Type::String);
-  static_assert(PropertyValue::Type::String < PropertyValue::Type::List);
-  static_assert(PropertyValue::Type::List < PropertyValue::Type::Map);
-
-  // Remove any bounds that are set to `Null` because that isn't a valid value.
-  if (lower_bound_ && lower_bound_->value().IsNull()) {
-    lower_bound_ = std::nullopt;
-  }
-  if (upper_bound_ && upper_bound_->value().IsNull()) {
-    upper_bound_ = std::nullopt;
-  }
-
-  // Check whether the bounds are of comparable types if both are supplied.
-  if (lower_bound_ && upper_bound_ &&
-      !PropertyValue::AreComparableTypes(lower_bound_->value().type(), upper_bound_->value().type())) {
-    bounds_valid_ = false;
-    return;
-  }
-
-  // Set missing bounds.
-  if (lower_bound_ && !upper_bound_) {
-    // Here we need to supply an upper bound. The upper bound is set to an
-    // exclusive lower bound of the following type.
-    switch (lower_bound_->value().type()) {
-      case PropertyValue::Type::Null:
-        // This shouldn't happen because of the nullopt-ing above.
-        LOG_FATAL("Invalid database state!");
-        break;
-      case PropertyValue::Type::Bool:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestNumber);
-        break;
-      case PropertyValue::Type::Int:
-      case PropertyValue::Type::Double:
-        // Both integers and doubles are treated as the same type in
-        // `PropertyValue` and they are interleaved when sorted.
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestString);
-        break;
-      case PropertyValue::Type::String:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestList);
-        break;
-      case PropertyValue::Type::List:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestMap);
-        break;
-      case PropertyValue::Type::Map:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestTemporalData);
-        break;
-      case PropertyValue::Type::TemporalData:
-        // This is the last type in the order so we leave the upper bound empty.
-        break;
-    }
-  }
-  if (upper_bound_ && !lower_bound_) {
-    // Here we need to supply a lower bound. The lower bound is set to an
-    // inclusive lower bound of the current type.
-    switch (upper_bound_->value().type()) {
-      case PropertyValue::Type::Null:
-        // This shouldn't happen because of the nullopt-ing above.
-        LOG_FATAL("Invalid database state!");
-        break;
-      case PropertyValue::Type::Bool:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestBool);
-        break;
-      case PropertyValue::Type::Int:
-      case PropertyValue::Type::Double:
-        // Both integers and doubles are treated as the same type in
-        // `PropertyValue` and they are interleaved when sorted.
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestNumber);
-        break;
-      case PropertyValue::Type::String:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestString);
-        break;
-      case PropertyValue::Type::List:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestList);
-        break;
-      case PropertyValue::Type::Map:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestMap);
-        break;
-      case PropertyValue::Type::TemporalData:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestTemporalData);
-        break;
-    }
-  }
+  bounds_valid_ = MakeBoundsOfTheSameType(&lower_bound_, &upper_bound_);
+  equal_string_ = MakeEqualStringReference(lower_bound_, upper_bound_);
 }
 
-LabelPropertyIndex::Iterable::Iterator LabelPropertyIndex::Iterable::begin() {
+EdgeTypePropertyIndex::Iterable::Iterator EdgeTypePropertyIndex::Iterable::begin() {
   // If the bounds are set and don't have comparable types we don't yield any
   // items from the index.
   if (!bounds_valid_) return Iterator(this, index_accessor_.end());
@@ -657,56 +1767,79 @@ LabelPropertyIndex::Iterable::Iterator LabelPropertyIndex::Iterable::begin() {
   return Iterator(this, index_iterator);
 }
 
-LabelPropertyIndex::Iterable::Iterator LabelPropertyIndex::Iterable::end() {
+EdgeTypePropertyIndex::Iterable::Iterator EdgeTypePropertyIndex::Iterable::end() {
   return Iterator(this, index_accessor_.end());
 }
 
-int64_t LabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property,
-                                                   const PropertyValue &value) const {
-  auto it = index_.find({label, property});
-  MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
+int64_t EdgeTypePropertyIndex::ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                                    const PropertyValue &value) const {
+  auto it = index_.find({edge_type, property});
+  MG_ASSERT(it != index_.end(), "Index for edge type {} and property {} doesn't exist", edge_type.AsUint(),
+            property.AsUint());
   auto acc = it->second.access();
   if (!value.IsNull()) {
     return acc.estimate_count(value, utils::SkipListLayerForCountEstimation(acc.size()));
   } else {
-    // The value `Null` won't ever appear in the index because it indicates that
-    // the property shouldn't exist. Instead, this value is used as an indicator
-    // to estimate the average number of equal elements in the list (for any
-    // given value).
+    // See `LabelPropertyIndex::ApproximateVertexCount` for why `Null` is used
+    // to estimate the average number of equal elements.
     return acc.estimate_average_number_of_equals(
         [](const auto &first, const auto &second) { return first.value == second.value; },
         utils::SkipListLayerForAverageEqualsEstimation(acc.size()));
   }
 }
 
-int64_t LabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property,
-                                                   const std::optional<utils::Bound<PropertyValue>> &lower,
-                                                   const std::optional<utils::Bound<PropertyValue>> &upper) const {
-  auto it = index_.find({label, property});
-  MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
+int64_t EdgeTypePropertyIndex::ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                                    const std::optional<utils::Bound<PropertyValue>> &lower,
+                                                    const std::optional<utils::Bound<PropertyValue>> &upper) const {
+  auto it = index_.find({edge_type, property});
+  MG_ASSERT(it != index_.end(), "Index for edge type {} and property {} doesn't exist", edge_type.AsUint(),
+            property.AsUint());
   auto acc = it->second.access();
   return acc.estimate_range_count(lower, upper, utils::SkipListLayerForCountEstimation(acc.size()));
 }
 
-void LabelPropertyIndex::RunGC() {
+void EdgeTypePropertyIndex::RunGC() {
   for (auto &index_entry : index_) {
     index_entry.second.run_gc();
   }
 }
 
 void RemoveObsoleteEntries(Indices *indices, uint64_t oldest_active_start_timestamp) {
-  indices->label_index.RemoveObsoleteEntries(oldest_active_start_timestamp);
-  indices->label_property_index.RemoveObsoleteEntries(oldest_active_start_timestamp);
+  for (const auto &cleanup : ObsoleteEntriesCleanups(indices, oldest_active_start_timestamp)) {
+    cleanup();
+  }
+}
+
+std::vector<std::function<void()>> ObsoleteEntriesCleanups(Indices *indices, uint64_t oldest_active_start_timestamp) {
+  return {
+      [=] { indices->label_index.RemoveObsoleteEntries(oldest_active_start_timestamp); },
+      [=] { indices->label_property_index.RemoveObsoleteEntries(oldest_active_start_timestamp); },
+      [=] { indices->label_property_composite_index.RemoveObsoleteEntries(oldest_active_start_timestamp); },
+      [=] { indices->edge_type_index.RemoveObsoleteEntries(oldest_active_start_timestamp); },
+      [=] { indices->edge_type_property_index.RemoveObsoleteEntries(oldest_active_start_timestamp); },
+  };
 }
 
 void UpdateOnAddLabel(Indices *indices, LabelId label, Vertex *vertex, const Transaction &tx) {
   indices->label_index.UpdateOnAddLabel(label, vertex, tx);
   indices->label_property_index.UpdateOnAddLabel(label, vertex, tx);
+  indices->label_property_composite_index.UpdateOnAddLabel(label, vertex, tx);
 }
 
 void UpdateOnSetProperty(Indices *indices, PropertyId property, const PropertyValue &value, Vertex *vertex,
                          const Transaction &tx) {
   indices->label_property_index.UpdateOnSetProperty(property, value, vertex, tx);
+  indices->label_property_composite_index.UpdateOnSetProperty(property, value, vertex, tx);
+}
+
+void UpdateOnSetProperty(Indices *indices, EdgeTypeId edge_type, PropertyId property, const PropertyValue &value,
+                         Vertex *from_vertex, Vertex *to_vertex, Edge *edge, const Transaction &tx) {
+  indices->edge_type_property_index.UpdateOnSetProperty(edge_type, property, value, from_vertex, to_vertex, edge, tx);
+}
+
+void UpdateOnEdgeCreation(Indices *indices, EdgeTypeId edge_type, Vertex *from_vertex, Vertex *to_vertex,
+                          EdgeRef edge, const Transaction &tx) {
+  indices->edge_type_index.UpdateOnEdgeCreation(edge_type, from_vertex, to_vertex, edge, tx);
 }
 
 }  // namespace storage
@@ -11,12 +11,18 @@
 
 #pragma once
 
+#include <functional>
 #include <optional>
+#include <set>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "storage/v2/config.hpp"
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/edge_ref.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/bound.hpp"
@@ -57,15 +63,44 @@ class LabelIndex {
   /// @throw std::bad_alloc
   void UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx);
 
+  /// Creates the index and fills it using `num_threads` threads.
   /// @throw std::bad_alloc
-  bool CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices);
+  bool CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices, uint64_t num_threads);
+
+  /// Registers an empty index that is then filled by `BuildIndex` while the
+  /// transactions keep running. Writers update the index as soon as it is
+  /// registered, but it isn't reported by `IndexExists` and `ListIndices` until
+  /// `FinishIndexBuild` is called. Must be called while holding the unique
+  /// storage lock.
+  /// @return the index that should be passed to `BuildIndex` or `nullptr` if
+  ///         the index already exists
+  /// @throw std::bad_alloc
+  utils::SkipList<Entry> *StartIndexBuild(LabelId label);
+
+  /// Fills the index registered by `StartIndexBuild` using `num_threads`
+  /// threads. Must be called without holding the storage lock.
+  /// @throw std::bad_alloc
+  static void BuildIndex(utils::SkipList<Entry> *index, LabelId label, utils::SkipList<Vertex>::Accessor vertices,
+                         uint64_t num_threads);
+
+  /// Marks the index as ready. Must be called while holding the unique storage
+  /// lock.
+  void FinishIndexBuild(LabelId label) { building_.erase(label); }
+
+  /// Removes the index after a failed build. Must be called while holding the
+  /// unique storage lock.
+  void AbortIndexBuild(LabelId label);
 
-  bool DropIndex(LabelId label) { return index_.erase(label) > 0; }
+  /// Indices that are being built can't be dropped until they are ready.
+  bool DropIndex(LabelId label) { return !building_.contains(label) && index_.erase(label) > 0; }
 
-  bool IndexExists(LabelId label) const { return index_.find(label) != index_.end(); }
+  bool IndexExists(LabelId label) const { return index_.find(label) != index_.end() && !building_.contains(label); }
 
+  /// Lists the ready indices.
   std::vector<LabelId> ListIndices() const;
 
+  std::vector<LabelId> ListBuildingIndices() const { return {building_.begin(), building_.end()}; }
+
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
 
   class Iterable {
@@ -119,12 +154,26 @@ class LabelIndex {
     return it->second.size();
   }
 
-  void Clear() { index_.clear(); }
+  /// Returns the approximate number of bytes used by the index entries.
+  uint64_t ApproximateMemoryUsage() const {
+    uint64_t usage = 0;
+    for (const auto &[key, index] : index_) {
+      usage += index.size() * utils::AverageSkipListNodeSize<Entry>();
+    }
+    return usage;
+  }
+
+  void Clear() {
+    index_.clear();
+    building_.clear();
+  }
 
   void RunGC();
 
  private:
   std::map<LabelId, utils::SkipList<Entry>> index_;
+  // Indices from `index_` that are still being built.
+  std::set<LabelId> building_;
   Indices *indices_;
   Constraints *constraints_;
   Config::Items config_;
@@ -154,15 +203,38 @@ class LabelPropertyIndex {
   /// @throw std::bad_alloc
   void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex, const Transaction &tx);
 
+  /// Creates the index and fills it using `num_threads` threads.
   /// @throw std::bad_alloc
-  bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices);
+  bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+                   uint64_t num_threads);
 
-  bool DropIndex(LabelId label, PropertyId property) { return index_.erase({label, property}) > 0; }
+  /// Online counterparts of `CreateIndex`, see `LabelIndex::StartIndexBuild`.
+  /// @throw std::bad_alloc
+  utils::SkipList<Entry> *StartIndexBuild(LabelId label, PropertyId property);
+
+  /// @throw std::bad_alloc
+  static void BuildIndex(utils::SkipList<Entry> *index, LabelId label, PropertyId property,
+                         utils::SkipList<Vertex>::Accessor vertices, uint64_t num_threads);
+
+  void FinishIndexBuild(LabelId label, PropertyId property) { building_.erase({label, property}); }
+
+  void AbortIndexBuild(LabelId label, PropertyId property);
+
+  bool DropIndex(LabelId label, PropertyId property) {
+    return !building_.contains({label, property}) && index_.erase({label, property}) > 0;
+  }
 
-  bool IndexExists(LabelId label, PropertyId property) const { return index_.find({label, property}) != index_.end(); }
+  bool IndexExists(LabelId label, PropertyId property) const {
+    return index_.find({label, property}) != index_.end() && !building_.contains({label, property});
+  }
 
+  /// Lists the ready indices.
   std::vector<std::pair<LabelId, PropertyId>> ListIndices() const;
 
+  std::vector<std::pair<LabelId, PropertyId>> ListBuildingIndices() const {
+    return {building_.begin(), building_.end()};
+  }
+
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
 
   class Iterable {
@@ -202,6 +274,9 @@ class LabelPropertyIndex {
     std::optional<utils::Bound<PropertyValue>> lower_bound_;
     std::optional<utils::Bound<PropertyValue>> upper_bound_;
     bool bounds_valid_{true};
+    // Set when both bounds are the same interned string, so the property values
+    // are compared by their dictionary IDs.
+    StringDictionary::Reference equal_string_;
     View view_;
     Transaction *transaction_;
     Indices *indices_;
@@ -236,12 +311,415 @@ class LabelPropertyIndex {
                                  const std::optional<utils::Bound<PropertyValue>> &lower,
                                  const std::optional<utils::Bound<PropertyValue>> &upper) const;
 
-  void Clear() { index_.clear(); }
+  /// Returns the approximate number of bytes used by the index entries.
+  uint64_t ApproximateMemoryUsage() const {
+    uint64_t usage = 0;
+    for (const auto &[key, index] : index_) {
+      usage += index.size() * utils::AverageSkipListNodeSize<Entry>();
+    }
+    return usage;
+  }
+
+  void Clear() {
+    index_.clear();
+    building_.clear();
+  }
 
   void RunGC();
 
  private:
   std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>> index_;
+  // Indices from `index_` that are still being built.
+  std::set<std::pair<LabelId, PropertyId>> building_;
+  Indices *indices_;
+  Constraints *constraints_;
+  Config::Items config_;
+};
+
+/// Index of vertices that have a given label, ordered by the values of an
+/// ordered list of properties. A vertex is indexed as soon as at least one of
+/// the properties is set; the properties that aren't set are stored as `Null`.
+/// That way a lookup by any prefix of the property list (optionally bounded
+/// on the following property) returns all vertices with the matching values.
+class LabelPropertyCompositeIndex {
+ private:
+  struct Entry {
+    std::vector<PropertyValue> values;
+    Vertex *vertex;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs);
+    bool operator==(const Entry &rhs);
+
+    /// The comparisons with a list of values compare only the prefix of the
+    /// entry's values that has the same length as the list.
+    bool operator<(const std::vector<PropertyValue> &rhs);
+    bool operator==(const std::vector<PropertyValue> &rhs);
+  };
+
+ public:
+  LabelPropertyCompositeIndex(Indices *indices, Constraints *constraints, Config::Items config)
+      : indices_(indices), constraints_(constraints), config_(config) {}
+
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx);
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex, const Transaction &tx);
+
+  /// Creates the index and fills it using `num_threads` threads.
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, const std::vector<PropertyId> &properties,
+                   utils::SkipList<Vertex>::Accessor vertices, uint64_t num_threads);
+
+  bool DropIndex(LabelId label, const std::vector<PropertyId> &properties) {
+    return index_.erase({label, properties}) > 0;
+  }
+
+  bool IndexExists(LabelId label, const std::vector<PropertyId> &properties) const {
+    return index_.find({label, properties}) != index_.end();
+  }
+
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> ListIndices() const;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, const std::vector<PropertyId> &properties,
+             const std::vector<PropertyValue> &prefix, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+             Indices *indices, Constraints *constraints, Config::Items config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      VertexAccessor operator*() const { return current_vertex_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      VertexAccessor current_vertex_accessor_;
+      Vertex *current_vertex_;
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    LabelId label_;
+    std::vector<PropertyId> properties_;
+    std::vector<PropertyValue> prefix_;
+    std::optional<utils::Bound<PropertyValue>> lower_bound_;
+    std::optional<utils::Bound<PropertyValue>> upper_bound_;
+    bool bounds_valid_{true};
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config::Items config_;
+  };
+
+  /// Returns the vertices whose first `prefix.size()` property values are
+  /// equal to `prefix`. The bounds, if supplied, limit the value of the
+  /// property that follows the prefix.
+  Iterable Vertices(LabelId label, const std::vector<PropertyId> &properties, const std::vector<PropertyValue> &prefix,
+                    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
+                    Transaction *transaction) {
+    auto it = index_.find({label, properties});
+    MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+    return Iterable(it->second.access(), label, properties, prefix, lower_bound, upper_bound, view, transaction,
+                    indices_, constraints_, config_);
+  }
+
+  int64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const {
+    auto it = index_.find({label, properties});
+    MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+    return it->second.size();
+  }
+
+  /// Returns an estimated count of vertices whose first `prefix.size()`
+  /// property values are equal to `prefix`. If any of the values is `Null`, an
+  /// average number of vertices sharing a prefix of that length is returned.
+  int64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                 const std::vector<PropertyValue> &prefix) const;
+
+  int64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                 const std::vector<PropertyValue> &prefix,
+                                 const std::optional<utils::Bound<PropertyValue>> &lower,
+                                 const std::optional<utils::Bound<PropertyValue>> &upper) const;
+
+  /// Returns the approximate number of bytes used by the index entries.
+  uint64_t ApproximateMemoryUsage() const {
+    uint64_t usage = 0;
+    for (const auto &[key, index] : index_) {
+      usage += index.size() * utils::AverageSkipListNodeSize<Entry>();
+    }
+    return usage;
+  }
+
+  void Clear() { index_.clear(); }
+
+  void RunGC();
+
+ private:
+  std::map<std::pair<LabelId, std::vector<PropertyId>>, utils::SkipList<Entry>> index_;
+  Indices *indices_;
+  Constraints *constraints_;
+  Config::Items config_;
+};
+
+/// Index of all edges that have a given edge type. Every entry holds both
+/// endpoints of the edge, so the edges can be returned without traversing the
+/// adjacency lists of the vertices.
+class EdgeTypeIndex {
+ private:
+  struct Entry {
+    Gid gid;
+    EdgeRef edge;
+    Vertex *from_vertex;
+    Vertex *to_vertex;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs) {
+      return std::make_tuple(gid, timestamp) < std::make_tuple(rhs.gid, rhs.timestamp);
+    }
+    bool operator==(const Entry &rhs) { return gid == rhs.gid && timestamp == rhs.timestamp; }
+  };
+
+ public:
+  EdgeTypeIndex(Indices *indices, Constraints *constraints, Config::Items config)
+      : indices_(indices), constraints_(constraints), config_(config) {}
+
+  /// @throw std::bad_alloc
+  void UpdateOnEdgeCreation(EdgeTypeId edge_type, Vertex *from_vertex, Vertex *to_vertex, EdgeRef edge,
+                            const Transaction &tx);
+
+  /// Creates the index and fills it using `num_threads` threads.
+  /// @throw std::bad_alloc
+  bool CreateIndex(EdgeTypeId edge_type, utils::SkipList<Vertex>::Accessor vertices, uint64_t num_threads);
+
+  bool DropIndex(EdgeTypeId edge_type) { return index_.erase(edge_type) > 0; }
+
+  bool IndexExists(EdgeTypeId edge_type) const { return index_.find(edge_type) != index_.end(); }
+
+  std::vector<EdgeTypeId> ListIndices() const;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type, View view,
+             Transaction *transaction, Indices *indices, Constraints *constraints, Config::Items config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      EdgeAccessor operator*() const { return current_edge_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      EdgeAccessor current_edge_accessor_;
+    };
+
+    Iterator begin() { return Iterator(this, index_accessor_.begin()); }
+    Iterator end() { return Iterator(this, index_accessor_.end()); }
+
+   private:
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    EdgeTypeId edge_type_;
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config::Items config_;
+  };
+
+  /// Returns an iterable with the edges visible from the given transaction.
+  /// The edges are returned ordered by their gid.
+  Iterable Edges(EdgeTypeId edge_type, View view, Transaction *transaction) {
+    auto it = index_.find(edge_type);
+    MG_ASSERT(it != index_.end(), "Index for edge type {} doesn't exist", edge_type.AsUint());
+    return Iterable(it->second.access(), edge_type, view, transaction, indices_, constraints_, config_);
+  }
+
+  int64_t ApproximateEdgeCount(EdgeTypeId edge_type) const {
+    auto it = index_.find(edge_type);
+    MG_ASSERT(it != index_.end(), "Index for edge type {} doesn't exist", edge_type.AsUint());
+    return it->second.size();
+  }
+
+  /// Returns the approximate number of bytes used by the index entries.
+  uint64_t ApproximateMemoryUsage() const {
+    uint64_t usage = 0;
+    for (const auto &[key, index] : index_) {
+      usage += index.size() * utils::AverageSkipListNodeSize<Entry>();
+    }
+    return usage;
+  }
+
+  void Clear() { index_.clear(); }
+
+  void RunGC();
+
+ private:
+  std::map<EdgeTypeId, utils::SkipList<Entry>> index_;
+  Indices *indices_;
+  Constraints *constraints_;
+  Config::Items config_;
+};
+
+/// Index of edges that have a given edge type and a value of the given
+/// property, ordered by the property value. Edge properties are stored only
+/// when properties on edges are enabled, so the index can be used only in
+/// that case.
+class EdgeTypePropertyIndex {
+ private:
+  struct Entry {
+    PropertyValue value;
+    Edge *edge;
+    Vertex *from_vertex;
+    Vertex *to_vertex;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs);
+    bool operator==(const Entry &rhs);
+
+    bool operator<(const PropertyValue &rhs);
+    bool operator==(const PropertyValue &rhs);
+  };
+
+ public:
+  EdgeTypePropertyIndex(Indices *indices, Constraints *constraints, Config::Items config)
+      : indices_(indices), constraints_(constraints), config_(config) {}
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, Vertex *from_vertex,
+                           Vertex *to_vertex, Edge *edge, const Transaction &tx);
+
+  /// Creates the index and fills it using `num_threads` threads.
+  /// @throw std::bad_alloc
+  bool CreateIndex(EdgeTypeId edge_type, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+                   uint64_t num_threads);
+
+  bool DropIndex(EdgeTypeId edge_type, PropertyId property) { return index_.erase({edge_type, property}) > 0; }
+
+  bool IndexExists(EdgeTypeId edge_type, PropertyId property) const {
+    return index_.find({edge_type, property}) != index_.end();
+  }
+
+  std::vector<std::pair<EdgeTypeId, PropertyId>> ListIndices() const;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type, PropertyId property,
+             const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+             Indices *indices, Constraints *constraints, Config::Items config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      EdgeAccessor operator*() const { return current_edge_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      EdgeAccessor current_edge_accessor_;
+      Edge *current_edge_;
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    EdgeTypeId edge_type_;
+    PropertyId property_;
+    std::optional<utils::Bound<PropertyValue>> lower_bound_;
+    std::optional<utils::Bound<PropertyValue>> upper_bound_;
+    bool bounds_valid_{true};
+    // Set when both bounds are the same interned string, so the property values
+    // are compared by their dictionary IDs.
+    StringDictionary::Reference equal_string_;
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config::Items config_;
+  };
+
+  Iterable Edges(EdgeTypeId edge_type, PropertyId property,
+                 const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                 const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction) {
+    auto it = index_.find({edge_type, property});
+    MG_ASSERT(it != index_.end(), "Index for edge type {} and property {} doesn't exist", edge_type.AsUint(),
+              property.AsUint());
+    return Iterable(it->second.access(), edge_type, property, lower_bound, upper_bound, view, transaction, indices_,
+                    constraints_, config_);
+  }
+
+  int64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const {
+    auto it = index_.find({edge_type, property});
+    MG_ASSERT(it != index_.end(), "Index for edge type {} and property {} doesn't exist", edge_type.AsUint(),
+              property.AsUint());
+    return it->second.size();
+  }
+
+  /// Supplying a specific value into the count estimation function will return
+  /// an estimated count of edges which have their property's value set to
+  /// `value`. If the `value` specified is `Null`, then an average number of
+  /// equal elements is returned.
+  int64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value) const;
+
+  int64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                               const std::optional<utils::Bound<PropertyValue>> &lower,
+                               const std::optional<utils::Bound<PropertyValue>> &upper) const;
+
+  /// Returns the approximate number of bytes used by the index entries.
+  uint64_t ApproximateMemoryUsage() const {
+    uint64_t usage = 0;
+    for (const auto &[key, index] : index_) {
+      usage += index.size() * utils::AverageSkipListNodeSize<Entry>();
+    }
+    return usage;
+  }
+
+  void Clear() { index_.clear(); }
+
+  void RunGC();
+
+ private:
+  std::map<std::pair<EdgeTypeId, PropertyId>, utils::SkipList<Entry>> index_;
   Indices *indices_;
   Constraints *constraints_;
   Config::Items config_;
@@ -249,7 +727,11 @@ class LabelPropertyIndex {
 
 struct Indices {
   Indices(Constraints *constraints, Config::Items config)
-      : label_index(this, constraints, config), label_property_index(this, constraints, config) {}
+      : label_index(this, constraints, config),
+        label_property_index(this, constraints, config),
+        label_property_composite_index(this, constraints, config),
+        edge_type_index(this, constraints, config),
+        edge_type_property_index(this, constraints, config) {}
 
   // Disable copy and move because members hold pointer to `this`.
   Indices(const Indices &) = delete;
@@ -260,12 +742,20 @@ struct Indices {
 
   LabelIndex label_index;
   LabelPropertyIndex label_property_index;
+  LabelPropertyCompositeIndex label_property_composite_index;
+  EdgeTypeIndex edge_type_index;
+  EdgeTypePropertyIndex edge_type_property_index;
 };
 
 /// This function should be called from garbage collection to clean-up the
 /// index.
 void RemoveObsoleteEntries(Indices *indices, uint64_t oldest_active_start_timestamp);
 
+/// Returns functions that clean up the individual indices. Each of them
+/// cleans up a different index, so they can be executed concurrently. Calling
+/// all of them is equivalent to calling `RemoveObsoleteEntries`.
+std::vector<std::function<void()>> ObsoleteEntriesCleanups(Indices *indices, uint64_t oldest_active_start_timestamp);
+
 // Indices are updated whenever an update occurs, instead of only on commit or
 // advance command. This is necessary because we want indices to support `NEW`
 // view for use in Merge.
@@ -278,4 +768,14 @@ void UpdateOnAddLabel(Indices *indices, LabelId label, Vertex *vertex, const Tra
 /// @throw std::bad_alloc
 void UpdateOnSetProperty(Indices *indices, PropertyId property, const PropertyValue &value, Vertex *vertex,
                          const Transaction &tx);
+
+/// This function should be called whenever a property is modified on an edge.
+/// @throw std::bad_alloc
+void UpdateOnSetProperty(Indices *indices, EdgeTypeId edge_type, PropertyId property, const PropertyValue &value,
+                         Vertex *from_vertex, Vertex *to_vertex, Edge *edge, const Transaction &tx);
+
+/// This function should be called whenever an edge is created.
+/// @throw std::bad_alloc
+void UpdateOnEdgeCreation(Indices *indices, EdgeTypeId edge_type, Vertex *from_vertex, Vertex *to_vertex,
+                          EdgeRef edge, const Transaction &tx);
 }  // namespace storage
@@ -0,0 +1,210 @@
+// Copyright 2021 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+#include "storage/v2/id_types.hpp"
+#include "utils/logging.hpp"
+
+namespace storage {
+
+/// Set of labels of a vertex. Most vertices have only one or two labels, so
+/// the labels are stored inline (without any memory allocations) until there
+/// are more than `kInlineCapacity` of them. Only then are they moved to an
+/// external buffer. Label IDs are stored as 32-bit integers, which makes the
+/// whole set 16 bytes large (compared to 24 bytes of a `std::vector` that
+/// additionally always allocates memory).
+///
+/// The order of the labels is the insertion order, except that removing a
+/// label moves the last label into its place.
+///
+/// The class isn't thread-safe, all accesses should be guarded by the lock of
+/// the vertex that owns the set, except for making a `RawCopy`.
+class LabelSet final {
+ public:
+  static constexpr uint32_t kInlineCapacity = 2;
+
+  class Iterator final {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = LabelId;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const LabelId *;
+    using reference = LabelId;
+
+    explicit Iterator(const uint32_t *ptr) : ptr_(ptr) {}
+
+    LabelId operator*() const { return LabelId::FromUint(*ptr_); }
+
+    Iterator &operator++() {
+      ++ptr_;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto old = *this;
+      ++ptr_;
+      return old;
+    }
+
+    bool operator==(const Iterator &other) const { return ptr_ == other.ptr_; }
+    bool operator!=(const Iterator &other) const { return ptr_ != other.ptr_; }
+
+   private:
+    const uint32_t *ptr_;
+  };
+
+  using value_type = LabelId;
+  using const_iterator = Iterator;
+  using iterator = const_iterator;
+
+  /// Copy of a set that is made without following the pointer to the external
+  /// buffer. It can be made by optimistic readers (see `utils::SeqLock`) while
+  /// the set is being modified and used once the read is validated. Only copies
+  /// of sets that are stored inline hold the labels.
+  class RawCopy final {
+   public:
+    RawCopy() = default;
+
+    explicit RawCopy(const LabelSet &labels) : size_(labels.size_), capacity_(labels.capacity_) {
+      memcpy(labels_, &labels.data_, sizeof(labels_));
+    }
+
+    bool IsInline() const { return capacity_ == kInlineCapacity && size_ <= kInlineCapacity; }
+
+    const_iterator begin() const { return Iterator(labels_); }
+    const_iterator end() const { return Iterator(labels_ + size_); }
+
+    bool Contains(LabelId label) const { return std::find(begin(), end(), label) != end(); }
+
+   private:
+    uint32_t size_{0};
+    uint32_t capacity_{kInlineCapacity};
+    uint32_t labels_[kInlineCapacity]{};
+  };
+
+  LabelSet() = default;
+
+  LabelSet(const LabelSet &) = delete;
+  LabelSet &operator=(const LabelSet &) = delete;
+
+  LabelSet(LabelSet &&other) noexcept : size_(other.size_), capacity_(other.capacity_), data_(other.data_) {
+    other.size_ = 0;
+    other.capacity_ = kInlineCapacity;
+  }
+
+  LabelSet &operator=(LabelSet &&other) noexcept {
+    if (this == &other) return *this;
+    if (!IsInline()) delete[] data_.heap;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    data_ = other.data_;
+    other.size_ = 0;
+    other.capacity_ = kInlineCapacity;
+    return *this;
+  }
+
+  ~LabelSet() {
+    if (!IsInline()) delete[] data_.heap;
+  }
+
+  const_iterator begin() const { return Iterator(Data()); }
+  const_iterator end() const { return Iterator(Data() + size_); }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  /// Returns the size in bytes of the external buffer, or 0 if the labels are
+  /// stored inline.
+  size_t ExternalBufferSize() const { return IsInline() ? 0 : capacity_ * sizeof(uint32_t); }
+
+  /// Checks whether the set contains `label`. For sets that are stored inline
+  /// the check doesn't branch on the stored labels.
+  bool Contains(LabelId label) const {
+    if (IsInline()) {
+      static_assert(kInlineCapacity == 2);
+      const auto value = label.AsUint();
+      return static_cast<bool>((static_cast<int>(size_ > 0) & static_cast<int>(data_.inline_labels[0] == value)) |
+                               (static_cast<int>(size_ > 1) & static_cast<int>(data_.inline_labels[1] == value)));
+    }
+    const auto value = ToValue(label);
+    for (uint32_t i = 0; i < size_; ++i) {
+      if (data_.heap[i] == value) return true;
+    }
+    return false;
+  }
+
+  /// Inserts `label` into the set. Returns `false` if the label already exists.
+  /// @throw std::bad_alloc
+  bool Insert(LabelId label) {
+    if (Contains(label)) return false;
+    if (size_ == capacity_) Grow();
+    Data()[size_++] = ToValue(label);
+    return true;
+  }
+
+  /// Removes `label` from the set. Returns `false` if the label doesn't exist.
+  bool Erase(LabelId label) {
+    auto *data = Data();
+    const auto value = ToValue(label);
+    for (uint32_t i = 0; i < size_; ++i) {
+      if (data[i] != value) continue;
+      data[i] = data[--size_];
+      if (!IsInline() && size_ <= kInlineCapacity) {
+        // Move the labels back inline to free the external buffer.
+        auto *heap = data_.heap;
+        memcpy(data_.inline_labels, heap, size_ * sizeof(uint32_t));
+        delete[] heap;
+        capacity_ = kInlineCapacity;
+      }
+      return true;
+    }
+    return false;
+  }
+
+ private:
+  static uint32_t ToValue(LabelId label) {
+    MG_ASSERT(label.AsUint() <= std::numeric_limits<uint32_t>::max(), "Label ID is too large!");
+    return static_cast<uint32_t>(label.AsUint());
+  }
+
+  bool IsInline() const { return capacity_ == kInlineCapacity; }
+
+  uint32_t *Data() { return IsInline() ? data_.inline_labels : data_.heap; }
+  const uint32_t *Data() const { return IsInline() ? data_.inline_labels : data_.heap; }
+
+  void Grow() {
+    const uint32_t new_capacity = capacity_ * 2;
+    auto *heap = new uint32_t[new_capacity];
+    memcpy(heap, Data(), size_ * sizeof(uint32_t));
+    if (!IsInline()) delete[] data_.heap;
+    data_.heap = heap;
+    capacity_ = new_capacity;
+  }
+
+  uint32_t size_{0};
+  uint32_t capacity_{kInlineCapacity};
+  union {
+    uint32_t inline_labels[kInlineCapacity];
+    uint32_t *heap;
+  } data_{};
+};
+
+static_assert(sizeof(LabelSet) == 16, "The LabelSet should be 16 bytes large!");
+
+}  // namespace storage
@@ -91,19 +91,27 @@ inline bool PrepareForWrite(Transaction *transaction, TObj *object) {
 /// This function creates a `DELETE_OBJECT` delta in the transaction and returns
 /// a pointer to the created delta. It doesn't perform any linking of the delta
 /// and is primarily used to create the first delta for an object (that must be
-/// a `DELETE_OBJECT` delta).
+/// a `DELETE_OBJECT` delta). In the analytical storage mode no delta is created
+/// and `nullptr` is returned.
 /// @throw std::bad_alloc
 inline Delta *CreateDeleteObjectDelta(Transaction *transaction) {
+  if (transaction->storage_mode == StorageMode::IN_MEMORY_ANALYTICAL) {
+    return nullptr;
+  }
   transaction->EnsureCommitTimestampExists();
   return &transaction->deltas.emplace_back(Delta::DeleteObjectTag(), transaction->commit_timestamp.get(),
                                            transaction->command_id);
 }
 
 /// This function creates a delta in the transaction for the object and links
-/// the delta into the object's delta list.
+/// the delta into the object's delta list. In the analytical storage mode the
+/// object is modified without a delta, so nothing is done.
 /// @throw std::bad_alloc
 template <typename TObj, class... Args>
 inline void CreateAndLinkDelta(Transaction *transaction, TObj *object, Args &&...args) {
+  if (transaction->storage_mode == StorageMode::IN_MEMORY_ANALYTICAL) {
+    return;
+  }
   transaction->EnsureCommitTimestampExists();
   auto delta = &transaction->deltas.emplace_back(std::forward<Args>(args)..., transaction->commit_timestamp.get(),
                                                  transaction->command_id);
@@ -74,6 +74,17 @@ class NameIdMapper final {
     return id;
   }
 
+  /// Returns the approximate number of bytes used by both mappings.
+  uint64_t ApproximateMemoryUsage() const {
+    uint64_t usage = name_to_id_.size() * utils::AverageSkipListNodeSize<MapNameToId>() +
+                     id_to_name_.size() * utils::AverageSkipListNodeSize<MapIdToName>();
+    // The names are stored in both mappings.
+    for (const auto &item : name_to_id_.access()) {
+      usage += 2 * item.name.size();
+    }
+    return usage;
+  }
+
   // NOTE: Currently this function returns a `const std::string &` instead of a
   // `std::string` to avoid making unnecessary copies of the string.
   // Usually, this wouldn't be correct because the accessor to the
@@ -0,0 +1,138 @@
+// Copyright 2021 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "storage/v2/vertex.hpp"
+#include "utils/logging.hpp"
+#include "utils/memory_tracker.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/skip_list.hpp"
+
+namespace storage {
+
+/// Number of chunks of the vertex skip list per thread. Having more chunks than
+/// threads balances the work when some chunks are more expensive than others.
+constexpr uint64_t kParallelVertexScanChunksPerThread = 8;
+
+/// The progress of the scan is logged only for lists with at least this many
+/// vertices.
+constexpr uint64_t kParallelVertexScanProgressMinVertices = 1000000;
+
+/// Calls `func(vertex)` for all vertices in `vertices` using `num_threads`
+/// threads (including the calling thread). The skip list is split into chunks
+/// that are processed in parallel, so `func` must be thread-safe. The scan
+/// stops early when `func` returns `false`. The progress of the scan is logged
+/// for large lists, `description` is used to describe the scan in the log.
+///
+/// Vertices can be removed from the list during the scan (i.e. when the unique
+/// storage lock isn't held), so a chunk ends at the gid of the vertex that
+/// started the next chunk even if that vertex is no longer in the list.
+///
+/// Exceptions thrown by `func` are rethrown in the calling thread after all
+/// threads finish. If out-of-memory exceptions are enabled in the calling
+/// thread, they are also enabled in the other threads.
+///
+/// @return `false` if the scan was stopped by `func`, `true` otherwise
+/// @throw std::system_error
+template <typename TFunc>
+bool ParallelScanVertices(utils::SkipList<Vertex>::Accessor *vertices, uint64_t num_threads,
+                          std::string_view description, const TFunc &func) {
+  if (num_threads == 0) num_threads = 1;
+  const auto chunks = vertices->partition(num_threads * kParallelVertexScanChunksPerThread);
+  const auto list_end = vertices->end();
+  const bool oom_exception_enabled = utils::MemoryTracker::OutOfMemoryExceptionEnabler::CanThrow();
+
+  const uint64_t total = vertices->size();
+  const bool log_progress = total >= kParallelVertexScanProgressMinVertices;
+  // The processed vertices are counted locally by each thread and added to the
+  // shared counter in batches.
+  const uint64_t kProgressBatch = 1 << 16;
+  std::atomic<uint64_t> processed{0};
+  auto report_progress = [&](uint64_t count) {
+    if (!log_progress || count == 0) return;
+    const auto before = processed.fetch_add(count, std::memory_order_acq_rel);
+    const auto after = before + count;
+    if (before * 10 / total != after * 10 / total) {
+      spdlog::info("{}: {}% of {} vertices processed.", description, std::min(after * 100 / total, uint64_t{100}),
+                   total);
+    }
+  };
+
+  std::atomic<uint64_t> next_chunk{0};
+  std::atomic<bool> stop{false};
+  std::atomic<bool> stopped_by_func{false};
+  std::mutex exception_lock;
+  std::exception_ptr exception;
+
+  auto worker = [&] {
+    std::optional<utils::MemoryTracker::OutOfMemoryExceptionEnabler> oom_exception;
+    if (oom_exception_enabled) oom_exception.emplace();
+    try {
+      uint64_t count = 0;
+      while (!stop.load(std::memory_order_acquire)) {
+        const auto chunk = next_chunk.fetch_add(1, std::memory_order_acq_rel);
+        if (chunk >= chunks.size()) break;
+        const auto &[begin, end] = chunks[chunk];
+        // The iterator wouldn't stop at the end of the chunk if that vertex
+        // was removed from the list, so the end is also checked by the gid.
+        std::optional<Gid> end_gid;
+        if (end != list_end) end_gid = end->gid;
+        for (auto it = begin; it != end; ++it) {
+          if (end_gid && it->gid >= *end_gid) break;
+          if (!func(*it)) {
+            stopped_by_func.store(true, std::memory_order_release);
+            stop.store(true, std::memory_order_release);
+            break;
+          }
+          if (++count == kProgressBatch) {
+            report_progress(count);
+            count = 0;
+            if (stop.load(std::memory_order_acquire)) break;
+          }
+        }
+      }
+      report_progress(count);
+    } catch (...) {
+      std::lock_guard<std::mutex> guard(exception_lock);
+      if (!exception) exception = std::current_exception();
+      stop.store(true, std::memory_order_release);
+    }
+  };
+
+  {
+    std::vector<std::thread> threads;
+    utils::OnScopeExit join_threads{[&] {
+      for (auto &thread : threads) {
+        thread.join();
+      }
+    }};
+    const uint64_t num_workers = std::min(num_threads, static_cast<uint64_t>(chunks.size())) - 1;
+    threads.reserve(num_workers);
+    for (uint64_t i = 0; i < num_workers; ++i) {
+      threads.emplace_back(worker);
+    }
+    worker();
+  }
+
+  if (exception) std::rethrow_exception(exception);
+  return !stopped_by_func.load(std::memory_order_acquire);
+}
+
+}  // namespace storage
@@ -18,6 +18,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/temporal.hpp"
 #include "utils/cast.hpp"
 #include "utils/logging.hpp"
@@ -82,6 +83,24 @@ namespace {
 // each and every ID to value mapping. That is why every possible bit is used
 // to store some useful information. Increasing the size of the metadata field
 // will increase memory usage for every stored ID to value mapping.
+//
+// Finding a property in the buffer requires decoding all of the properties
+// that are stored before it. To avoid that for stores with many properties
+// (vertices and edges with tens or hundreds of properties aren't uncommon), the
+// buffer is prefixed with a sparse property directory once the store holds at
+// least `kPropertyDirectoryMinProperties` properties. The directory contains
+// the offset of every `kPropertyDirectoryStride`-th property. Because the
+// properties are sorted by their IDs, a lookup binary searches the directory
+// and then decodes at most `kPropertyDirectoryStride` properties. Stores with
+// fewer properties don't have a directory so their encoding stays compact.
+//
+// String property values that are interned (see `StringDictionary`) aren't
+// stored inline. Instead, only the ID of the string in the global
+// `StringDictionary` is stored. Because low-cardinality strings
+// are repeated in a lot of vertices and edges, that saves a lot of memory. Each
+// property buffer holds a reference to each of its interned strings, so the
+// references must be released whenever an interned string is removed from the
+// buffer (or the whole buffer is destroyed).
 
 enum class Size : uint8_t {
   INT8 = 0x00,
@@ -102,7 +121,9 @@ enum class Type : uint8_t {
   STRING = 0x50,
   LIST = 0x60,
   MAP = 0x70,
-  TEMPORAL_DATA = 0x80
+  TEMPORAL_DATA = 0x80,
+  DIRECTORY = 0x90,  // Special value used to indicate the property directory.
+  INTERNED_STRING = 0xa0,
 };
 
 const uint8_t kMaskType = 0xf0;
@@ -110,6 +131,9 @@ const uint8_t kMaskIdSize = 0x0c;
 const uint8_t kMaskPayloadSize = 0x03;
 const uint8_t kShiftIdSize = 2;
 
+const uint64_t kPropertyDirectoryMinProperties = 16;
+const uint64_t kPropertyDirectoryStride = 8;
+
 // Values are encoded as follows:
 //   * NULL
 //     - type; payload size is not used
@@ -164,6 +188,21 @@ const uint8_t kShiftIdSize = 2;
 //         or `uint64_t`
 //       + encoded temporal data type value
 //       + encoded microseconds value
+//   * INTERNED_STRING
+//     - type; payload size is used to indicate whether the string ID is encoded
+//       as `uint8_t`, `uint16_t`, `uint32_t` or `uint64_t`
+//     - encoded property ID
+//     - encoded ID of the string in the `StringDictionary`
+//
+// The property directory is encoded as follows:
+//   * DIRECTORY
+//     - type; id size is used to indicate whether the number of entries is
+//       encoded as `uint8_t`, `uint16_t`, `uint32_t` or `uint64_t`; payload
+//       size is used to indicate the size of each entry
+//     - encoded number of entries
+//     - entries; each entry is the offset (relative to the first property) of
+//       every `kPropertyDirectoryStride`-th property
+// If the directory exists, it is always stored at the beginning of the buffer.
 
 struct Metadata {
   Type type{Type::EMPTY};
@@ -232,6 +271,19 @@ class Writer {
     }
   }
 
+  bool WriteUint(uint64_t value, Size size) {
+    switch (size) {
+      case Size::INT8:
+        return InternalWriteInt<uint8_t>(value);
+      case Size::INT16:
+        return InternalWriteInt<uint16_t>(value);
+      case Size::INT32:
+        return InternalWriteInt<uint32_t>(value);
+      case Size::INT64:
+        return InternalWriteInt<uint64_t>(value);
+    }
+  }
+
   std::optional<Size> WriteDouble(double value) { return WriteUint(utils::MemcpyCast<uint64_t>(value)); }
 
   bool WriteBytes(const uint8_t *data, uint64_t size) {
@@ -492,7 +544,8 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 // @sa ComparePropertyValue
 [[nodiscard]] bool DecodePropertyValue(Reader *reader, Type type, Size payload_size, PropertyValue *value) {
   switch (type) {
-    case Type::EMPTY: {
+    case Type::EMPTY:
+    case Type::DIRECTORY: {
       return false;
     }
     case Type::NONE: {
@@ -603,6 +656,14 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 
       return true;
     }
+    case Type::INTERNED_STRING: {
+      auto string_id = reader->ReadUint(payload_size);
+      if (!string_id) return false;
+      if (value) {
+        *value = PropertyValue(std::string(StringDictionary::Global().Get(*string_id)));
+      }
+      return true;
+    }
   }
 }
 
@@ -616,7 +677,8 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 // @sa DecodePropertyValue
 [[nodiscard]] bool ComparePropertyValue(Reader *reader, Type type, Size payload_size, const PropertyValue &value) {
   switch (type) {
-    case Type::EMPTY: {
+    case Type::EMPTY:
+    case Type::DIRECTORY: {
       return false;
     }
     case Type::NONE: {
@@ -703,6 +765,12 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 
       return *maybe_temporal_data == value.ValueTemporalData();
     }
+    case Type::INTERNED_STRING: {
+      if (!value.IsString()) return false;
+      auto string_id = reader->ReadUint(payload_size);
+      if (!string_id) return false;
+      return StringDictionary::Global().Get(*string_id) == value.ValueString();
+    }
   }
 }
 
@@ -722,6 +790,22 @@ bool EncodeProperty(Writer *writer, PropertyId property, const PropertyValue &va
   return true;
 }
 
+// Function used to encode a property whose value is the interned string with
+// ID `string_id` into a byte stream.
+bool EncodeInternedStringProperty(Writer *writer, PropertyId property, uint64_t string_id) {
+  auto metadata = writer->WriteMetadata();
+  if (!metadata) return false;
+
+  auto id_size = writer->WriteUint(property.AsUint());
+  if (!id_size) return false;
+
+  auto string_id_size = writer->WriteUint(string_id);
+  if (!string_id_size) return false;
+
+  metadata->Set({Type::INTERNED_STRING, *id_size, *string_id_size});
+  return true;
+}
+
 // Enum used to return status from the `DecodeExpectedProperty` function.
 enum class DecodeExpectedPropertyStatus {
   MISSING_DATA,
@@ -792,11 +876,14 @@ enum class DecodeExpectedPropertyStatus {
 }
 
 // Function used to compare a property (PropertyId, PropertyValue) to current
-// property in the byte stream.
+// property in the byte stream. If `string_id` is given, it is the ID of the
+// interned string `value`, and an interned string in the byte stream is
+// compared by its ID.
 //
 // @sa DecodeExpectedProperty
 // @sa DecodeAnyProperty
-[[nodiscard]] bool CompareExpectedProperty(Reader *reader, PropertyId expected_property, const PropertyValue &value) {
+[[nodiscard]] bool CompareExpectedProperty(Reader *reader, PropertyId expected_property, const PropertyValue &value,
+                                           std::optional<uint64_t> string_id = std::nullopt) {
   auto metadata = reader->ReadMetadata();
   if (!metadata) return false;
 
@@ -804,6 +891,10 @@ enum class DecodeExpectedPropertyStatus {
   if (!property_id) return false;
   if (*property_id != expected_property.AsUint()) return false;
 
+  if (string_id && metadata->type == Type::INTERNED_STRING) {
+    auto read_id = reader->ReadUint(metadata->payload_size);
+    return read_id && *read_id == *string_id;
+  }
   return ComparePropertyValue(reader, metadata->type, metadata->payload_size, value);
 }
 
@@ -836,6 +927,7 @@ struct SpecificPropertyAndBufferInfo {
   uint64_t all_begin;
   uint64_t all_end;
   uint64_t all_size;
+  uint64_t all_count;
 };
 
 // Function used to find the position where the property should be in the data
@@ -846,7 +938,7 @@ struct SpecificPropertyAndBufferInfo {
 // If the function doesn't find the property, the `property_size` will be `0`
 // and `property_begin` will be equal to `property_end`. Positions and size of
 // all properties is always calculated (even if the specific property isn't
-// found).
+// found). The number of all properties is also returned.
 //
 // @sa FindSpecificProperty
 SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(Reader *reader, PropertyId property) {
@@ -854,11 +946,14 @@ SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(Reader *reader,
   uint64_t property_end = reader->GetPosition();
   uint64_t all_begin = reader->GetPosition();
   uint64_t all_end = reader->GetPosition();
+  uint64_t all_count = 0;
   while (true) {
     auto ret = DecodeExpectedProperty(reader, property, nullptr);
     if (ret == DecodeExpectedPropertyStatus::MISSING_DATA) {
       break;
-    } else if (ret == DecodeExpectedPropertyStatus::SMALLER) {
+    }
+    ++all_count;
+    if (ret == DecodeExpectedPropertyStatus::SMALLER) {
       property_begin = reader->GetPosition();
       property_end = reader->GetPosition();
     } else if (ret == DecodeExpectedPropertyStatus::EQUAL) {
@@ -866,7 +961,174 @@ SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(Reader *reader,
     }
     all_end = reader->GetPosition();
   }
-  return {property_begin, property_end, property_end - property_begin, all_begin, all_end, all_end - all_begin};
+  return {property_begin, property_end, property_end - property_begin, all_begin, all_end, all_end - all_begin,
+          all_count};
+}
+
+// Function used to move the properties that are stored before and after the
+// changed property (described by `info`) from the `src` buffer to their new
+// positions in the `dst` buffer. The buffers can be the same buffer, in which
+// case the moves are ordered so that no data is overwritten before it is moved.
+void MoveProperties(uint8_t *dst, const uint8_t *src, uint64_t directory_size, uint64_t new_directory_size,
+                    const SpecificPropertyAndBufferInfo &info, uint64_t property_size) {
+  auto move_before = [&] {
+    if (dst == src && directory_size == new_directory_size) return;
+    memmove(dst + new_directory_size, src + directory_size, info.property_begin);
+  };
+  auto move_after = [&] {
+    auto dst_pos = new_directory_size + info.property_begin + property_size;
+    auto src_pos = directory_size + info.property_end;
+    if (dst == src && dst_pos == src_pos) return;
+    memmove(dst + dst_pos, src + src_pos, info.all_end - info.property_end);
+  };
+  if (new_directory_size >= directory_size) {
+    move_after();
+    move_before();
+  } else {
+    move_before();
+    move_after();
+  }
+}
+
+uint64_t SizeToByteSize(Size size) { return 1ULL << static_cast<uint8_t>(size); }
+
+// Struct used to return info about the property directory.
+struct PropertyDirectoryInfo {
+  // Size of the whole directory, `0` if the buffer doesn't have a directory.
+  // The first property is stored immediately after the directory.
+  uint64_t size{0};
+  uint64_t entries_begin{0};
+  uint64_t entries_count{0};
+  Size entry_size{Size::INT8};
+};
+
+// Function used to read the property directory from the beginning of the data
+// buffer.
+PropertyDirectoryInfo ReadPropertyDirectory(const uint8_t *data, uint64_t size) {
+  Reader reader(data, size);
+  auto metadata = reader.ReadMetadata();
+  if (!metadata || metadata->type != Type::DIRECTORY) return {};
+  auto entries_count = reader.ReadUint(metadata->id_size);
+  MG_ASSERT(entries_count, "Invalid property directory!");
+  auto entries_begin = reader.GetPosition();
+  return {entries_begin + *entries_count * SizeToByteSize(metadata->payload_size), entries_begin,
+          static_cast<uint64_t>(*entries_count), metadata->payload_size};
+}
+
+// Function used to calculate the size of the property directory needed for
+// `properties_count` properties whose encoded size is `properties_size`. If
+// the properties should be stored without a directory, `0` is returned.
+uint64_t PropertyDirectorySize(uint64_t properties_count, uint64_t properties_size) {
+  if (properties_count < kPropertyDirectoryMinProperties) return 0;
+  auto entries_count = (properties_count + kPropertyDirectoryStride - 1) / kPropertyDirectoryStride;
+  Writer writer;
+  writer.WriteMetadata();
+  writer.WriteUint(entries_count);
+  Writer entry_writer;
+  auto entry_size = entry_writer.WriteUint(properties_size);
+  return writer.Written() + entries_count * SizeToByteSize(*entry_size);
+}
+
+// Function used to encode the property directory for the `properties_count`
+// properties that are stored in the buffer right after the directory. The
+// directory must have exactly the size calculated by `PropertyDirectorySize`.
+bool EncodePropertyDirectory(uint8_t *data, uint64_t directory_size, uint64_t properties_count,
+                             uint64_t properties_size) {
+  auto entries_count = (properties_count + kPropertyDirectoryStride - 1) / kPropertyDirectoryStride;
+  Writer entry_writer;
+  auto entry_size = entry_writer.WriteUint(properties_size);
+  if (!entry_size) return false;
+
+  Writer writer(data, directory_size);
+  auto metadata = writer.WriteMetadata();
+  if (!metadata) return false;
+  auto entries_count_size = writer.WriteUint(entries_count);
+  if (!entries_count_size) return false;
+
+  Reader reader(data + directory_size, properties_size);
+  for (uint64_t i = 0; i < properties_count; ++i) {
+    if (i % kPropertyDirectoryStride == 0 && !writer.WriteUint(reader.GetPosition(), *entry_size)) return false;
+    if (!DecodeAnyProperty(&reader, nullptr)) return false;
+  }
+
+  metadata->Set({Type::DIRECTORY, *entries_count_size, *entry_size});
+  return writer.Written() == directory_size;
+}
+
+// Function used to get a reader over the properties stored in the data buffer
+// that is positioned at the property from which the search for the property
+// whose ID is `property` should start. If the buffer has a property directory,
+// the directory is binary searched for the last indexed property whose ID
+// isn't greater than `property`. Otherwise, the reader is positioned at the
+// first property.
+//
+// @sa FindSpecificProperty
+Reader SeekProperty(const uint8_t *data, uint64_t size, PropertyId property) {
+  auto directory = ReadPropertyDirectory(data, size);
+  const uint8_t *properties = data + directory.size;
+  uint64_t properties_size = size - directory.size;
+  auto entry_byte_size = SizeToByteSize(directory.entry_size);
+
+  auto get_offset = [&](uint64_t entry) -> uint64_t {
+    Reader reader(data + directory.entries_begin + entry * entry_byte_size, entry_byte_size);
+    auto offset = reader.ReadUint(directory.entry_size);
+    MG_ASSERT(offset && static_cast<uint64_t>(*offset) < properties_size, "Invalid property directory!");
+    return *offset;
+  };
+  auto get_property_id = [&](uint64_t offset) -> uint64_t {
+    Reader reader(properties + offset, properties_size - offset);
+    auto metadata = reader.ReadMetadata();
+    MG_ASSERT(metadata, "Invalid property directory!");
+    auto property_id = reader.ReadUint(metadata->id_size);
+    MG_ASSERT(property_id, "Invalid property directory!");
+    return *property_id;
+  };
+
+  // Find the first entry whose property ID is greater than `property`.
+  uint64_t first = 0;
+  uint64_t count = directory.entries_count;
+  while (count > 0) {
+    auto step = count / 2;
+    if (get_property_id(get_offset(first + step)) <= property.AsUint()) {
+      first += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+
+  uint64_t offset = first == 0 ? 0 : get_offset(first - 1);
+  return Reader(properties + offset, properties_size - offset);
+}
+
+// Function used to get the ID of the interned string that is the value of the
+// encoded property stored in the buffer. If the property value isn't an
+// interned string, `std::nullopt` is returned.
+std::optional<uint64_t> ReadInternedStringId(const uint8_t *data, uint64_t size) {
+  Reader reader(data, size);
+  auto metadata = reader.ReadMetadata();
+  if (!metadata || metadata->type != Type::INTERNED_STRING) return std::nullopt;
+  if (!reader.ReadUint(metadata->id_size)) return std::nullopt;
+  auto string_id = reader.ReadUint(metadata->payload_size);
+  if (!string_id) return std::nullopt;
+  return *string_id;
+}
+
+// Function used to release the references to all interned strings that are
+// stored in the data buffer. It must be called before the buffer is freed.
+void ReleaseInternedStrings(const uint8_t *data, uint64_t size) {
+  auto &dictionary = StringDictionary::Global();
+  // If the dictionary is empty, no buffer can hold a reference to it.
+  if (dictionary.Size() == 0) return;
+  auto directory = ReadPropertyDirectory(data, size);
+  const uint8_t *properties = data + directory.size;
+  Reader reader(properties, size - directory.size);
+  while (true) {
+    auto property_begin = reader.GetPosition();
+    if (!DecodeAnyProperty(&reader, nullptr)) break;
+    auto string_id = ReadInternedStringId(properties + property_begin, reader.GetPosition() - property_begin);
+    if (string_id) dictionary.Release(*string_id);
+  }
 }
 
 // All data buffers will be allocated to a power of 8 size.
@@ -927,6 +1189,64 @@ void SetSizeData(uint8_t *buffer, uint64_t size, uint8_t *data) {
 
 }  // namespace
 
+PropertyStore::RawCopy::RawCopy() { memset(buffer_, 0, sizeof(buffer_)); }
+
+PropertyStore::RawCopy::RawCopy(const PropertyStore &store) { memcpy(buffer_, store.buffer_, sizeof(buffer_)); }
+
+bool PropertyStore::RawCopy::IsInline() const {
+  uint64_t size;
+  std::tie(size, std::ignore) = GetSizeData(buffer_);
+  // An empty store doesn't have an external buffer either.
+  return size % 8 != 0 || size == 0;
+}
+
+std::optional<PropertyValue> PropertyStore::RawCopy::GetProperty(PropertyId property) const {
+  MG_ASSERT(IsInline(), "Properties can't be read from a copy of an external buffer!");
+  uint64_t size;
+  const uint8_t *data;
+  std::tie(size, data) = GetSizeData(buffer_);
+  if (size % 8 != 0) {
+    size = sizeof(buffer_) - 1;
+    data = &buffer_[1];
+  }
+  auto reader = SeekProperty(data, size, property);
+  while (true) {
+    auto prop_reader = reader;
+    auto ret = DecodeExpectedProperty(&reader, property, nullptr);
+    if (ret == DecodeExpectedPropertyStatus::SMALLER) continue;
+    if (ret != DecodeExpectedPropertyStatus::EQUAL) return PropertyValue();
+    auto metadata = Reader(prop_reader).ReadMetadata();
+    if (metadata && metadata->type == Type::INTERNED_STRING) return std::nullopt;
+    PropertyValue value;
+    MG_ASSERT(DecodeExpectedProperty(&prop_reader, property, &value) == DecodeExpectedPropertyStatus::EQUAL,
+              "Invalid property buffer!");
+    return std::move(value);
+  }
+}
+
+std::optional<std::map<PropertyId, PropertyValue>> PropertyStore::RawCopy::Properties() const {
+  MG_ASSERT(IsInline(), "Properties can't be read from a copy of an external buffer!");
+  uint64_t size;
+  const uint8_t *data;
+  std::tie(size, data) = GetSizeData(buffer_);
+  if (size % 8 != 0) {
+    size = sizeof(buffer_) - 1;
+    data = &buffer_[1];
+  }
+  auto directory = ReadPropertyDirectory(data, size);
+  Reader reader(data + directory.size, size - directory.size);
+  std::map<PropertyId, PropertyValue> props;
+  while (true) {
+    auto metadata = Reader(reader).ReadMetadata();
+    if (metadata && metadata->type == Type::INTERNED_STRING) return std::nullopt;
+    PropertyValue value;
+    auto prop = DecodeAnyProperty(&reader, &value);
+    if (!prop) break;
+    props.emplace(*prop, std::move(value));
+  }
+  return std::move(props);
+}
+
 PropertyStore::PropertyStore() { memset(buffer_, 0, sizeof(buffer_)); }
 
 PropertyStore::PropertyStore(PropertyStore &&other) noexcept {
@@ -940,7 +1260,10 @@ PropertyStore &PropertyStore::operator=(PropertyStore &&other) noexcept {
   std::tie(size, data) = GetSizeData(buffer_);
   if (size % 8 == 0) {
     // We are storing the data in an external buffer.
+    ReleaseInternedStrings(data, size);
     delete[] data;
+  } else {
+    ReleaseInternedStrings(&buffer_[1], sizeof(buffer_) - 1);
   }
 
   memcpy(buffer_, other.buffer_, sizeof(buffer_));
@@ -955,7 +1278,10 @@ PropertyStore::~PropertyStore() {
   std::tie(size, data) = GetSizeData(buffer_);
   if (size % 8 == 0) {
     // We are storing the data in an external buffer.
+    ReleaseInternedStrings(data, size);
     delete[] data;
+  } else {
+    ReleaseInternedStrings(&buffer_[1], sizeof(buffer_) - 1);
   }
 }
 
@@ -968,7 +1294,7 @@ PropertyValue PropertyStore::GetProperty(PropertyId property) const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
-  Reader reader(data, size);
+  auto reader = SeekProperty(data, size, property);
   PropertyValue value;
   if (FindSpecificProperty(&reader, property, &value) != DecodeExpectedPropertyStatus::EQUAL) return PropertyValue();
   return value;
@@ -983,11 +1309,16 @@ bool PropertyStore::HasProperty(PropertyId property) const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
-  Reader reader(data, size);
+  auto reader = SeekProperty(data, size, property);
   return FindSpecificProperty(&reader, property, nullptr) == DecodeExpectedPropertyStatus::EQUAL;
 }
 
 bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &value) const {
+  return IsPropertyEqual(property, value, std::nullopt);
+}
+
+bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &value,
+                                    std::optional<uint64_t> string_id) const {
   uint64_t size;
   const uint8_t *data;
   std::tie(size, data) = GetSizeData(buffer_);
@@ -996,12 +1327,15 @@ bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &va
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
-  Reader reader(data, size);
-  auto info = FindSpecificPropertyAndBufferInfo(&reader, property);
-  if (info.property_size == 0) return value.IsNull();
-  Reader prop_reader(data + info.property_begin, info.property_size);
-  if (!CompareExpectedProperty(&prop_reader, property, value)) return false;
-  return prop_reader.GetPosition() == info.property_size;
+  auto reader = SeekProperty(data, size, property);
+  while (true) {
+    auto prop_reader = reader;
+    auto ret = DecodeExpectedProperty(&reader, property, nullptr);
+    if (ret == DecodeExpectedPropertyStatus::SMALLER) continue;
+    if (ret != DecodeExpectedPropertyStatus::EQUAL) return value.IsNull();
+    if (!CompareExpectedProperty(&prop_reader, property, value, string_id)) return false;
+    return prop_reader.GetPosition() == reader.GetPosition();
+  }
 }
 
 std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
@@ -1013,7 +1347,8 @@ std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
-  Reader reader(data, size);
+  auto directory = ReadPropertyDirectory(data, size);
+  Reader reader(data + directory.size, size - directory.size);
   std::map<PropertyId, PropertyValue> props;
   while (true) {
     PropertyValue value;
@@ -1024,11 +1359,27 @@ std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
   return props;
 }
 
+uint64_t PropertyStore::ExternalBufferSize() const {
+  uint64_t size;
+  std::tie(size, std::ignore) = GetSizeData(buffer_);
+  if (size % 8 != 0) return 0;
+  return size;
+}
+
 bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value) {
+  std::optional<uint64_t> string_id;
+  if (value.IsString()) {
+    string_id = StringDictionary::Global().Acquire(value.ValueString());
+  }
+  auto encode_property = [&](Writer *writer) {
+    if (string_id) return EncodeInternedStringProperty(writer, property, *string_id);
+    return EncodeProperty(writer, property, value);
+  };
+
   uint64_t property_size = 0;
   if (!value.IsNull()) {
     Writer writer;
-    EncodeProperty(&writer, property, value);
+    encode_property(&writer);
     property_size = writer.Written();
   }
 
@@ -1068,7 +1419,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
 
       // Encode the property into the data buffer.
       Writer writer(data, size);
-      MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+      MG_ASSERT(encode_property(&writer), "Invalid database state!");
       auto metadata = writer.WriteMetadata();
       if (metadata) {
         // If there is any space left in the buffer we add a tombstone to
@@ -1080,10 +1431,17 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
       // to set a property to `Null` (we are trying to remove the property).
     }
   } else {
-    Reader reader(data, size);
+    auto directory = ReadPropertyDirectory(data, size);
+    Reader reader(data + directory.size, size - directory.size);
     auto info = FindSpecificPropertyAndBufferInfo(&reader, property);
     existed = info.property_size != 0;
-    auto new_size = info.all_size - info.property_size + property_size;
+    // The reference to the old interned string (if any) is released once the
+    // old property is overwritten.
+    auto old_string_id = ReadInternedStringId(data + directory.size + info.property_begin, info.property_size);
+    auto new_properties_count = info.all_count - (existed ? 1 : 0) + (value.IsNull() ? 0 : 1);
+    auto new_properties_size = info.all_size - info.property_size + property_size;
+    auto new_directory_size = PropertyDirectorySize(new_properties_count, new_properties_size);
+    auto new_size = new_directory_size + new_properties_size;
     auto new_size_to_power_of_8 = ToPowerOf8(new_size);
     if (new_size_to_power_of_8 == 0) {
       // We don't have any data to encode anymore.
@@ -1108,11 +1466,8 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
         current_size = new_size_to_power_of_8;
         current_in_local_buffer = false;
       }
-      // Copy everything before the property to the new buffer.
-      memmove(current_data, data, info.property_begin);
-      // Copy everything after the property to the new buffer.
-      memmove(current_data + info.property_begin + property_size, data + info.property_end,
-              info.all_end - info.property_end);
+      // Copy everything before and after the property to the new buffer.
+      MoveProperties(current_data, data, directory.size, new_directory_size, info, property_size);
       // Free the old buffer.
       if (!in_local_buffer) delete[] data;
       // Permanently remember the new buffer.
@@ -1123,17 +1478,24 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
       data = current_data;
       size = current_size;
       in_local_buffer = current_in_local_buffer;
-    } else if (property_size != info.property_size) {
-      // We can keep the data in the same buffer, but the new property is
-      // larger/smaller than the old property. We need to move the following
-      // properties to the right/left.
-      memmove(data + info.property_begin + property_size, data + info.property_end, info.all_end - info.property_end);
+    } else {
+      // We can keep the data in the same buffer, but the new property (or the
+      // property directory) can be larger/smaller than the old one. We need to
+      // move the other properties to the right/left.
+      MoveProperties(data, data, directory.size, new_directory_size, info, property_size);
     }
 
     if (!value.IsNull()) {
       // We need to encode the new value.
-      Writer writer(data + info.property_begin, property_size);
-      MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+      Writer writer(data + new_directory_size + info.property_begin, property_size);
+      MG_ASSERT(encode_property(&writer), "Invalid database state!");
+    }
+
+    if (new_directory_size != 0) {
+      // We need to recreate the property directory because the offsets of the
+      // properties have changed.
+      MG_ASSERT(EncodePropertyDirectory(data, new_directory_size, new_properties_count, new_properties_size),
+                "Invalid database state!");
     }
 
     // We need to recreate the tombstone (if possible).
@@ -1142,6 +1504,8 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     if (metadata) {
       metadata->Set({Type::EMPTY});
     }
+
+    if (old_string_id) StringDictionary::Global().Release(*old_string_id);
   }
 
   return !existed;
@@ -1159,6 +1523,7 @@ bool PropertyStore::ClearProperties() {
     in_local_buffer = true;
   }
   if (!size) return false;
+  ReleaseInternedStrings(data, size);
   if (!in_local_buffer) delete[] data;
   SetSizeData(buffer_, 0, nullptr);
   return true;
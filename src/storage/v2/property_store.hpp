@@ -12,6 +12,7 @@
 #pragma once
 
 #include <map>
+#include <optional>
 
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
@@ -20,6 +21,36 @@ namespace storage {
 
 class PropertyStore {
  public:
+  /// Copy of the raw contents of a store. It doesn't follow the pointer to the
+  /// external buffer, so it can be made by optimistic readers (see
+  /// `utils::SeqLock`) while the store is being modified. The copy must only be
+  /// used once the read is validated and only if `IsInline` returns `true`.
+  class RawCopy final {
+   public:
+    RawCopy();
+
+    explicit RawCopy(const PropertyStore &store);
+
+    /// Checks whether the store didn't use an external buffer, i.e. whether
+    /// the properties can be read from the copy.
+    bool IsInline() const;
+
+    /// Returns the value of property `property` from the copy. `std::nullopt`
+    /// is returned if the value is an interned string; the string has to be
+    /// read from the store itself because the copy doesn't hold a reference to
+    /// it in the dictionary.
+    /// @throw std::bad_alloc
+    std::optional<PropertyValue> GetProperty(PropertyId property) const;
+
+    /// Returns all properties stored in the copy or `std::nullopt` if any of
+    /// them is an interned string.
+    /// @throw std::bad_alloc
+    std::optional<std::map<PropertyId, PropertyValue>> Properties() const;
+
+   private:
+    uint8_t buffer_[sizeof(uint64_t) + sizeof(uint8_t *)];
+  };
+
   PropertyStore();
 
   PropertyStore(const PropertyStore &) = delete;
@@ -31,20 +62,26 @@ class PropertyStore {
 
   /// Returns the currently stored value for property `property`. If the
   /// property doesn't exist a Null value is returned. The time complexity of
-  /// this function is O(n).
+  /// this function is O(log(n)).
   /// @throw std::bad_alloc
   PropertyValue GetProperty(PropertyId property) const;
 
   /// Checks whether the property `property` exists in the store. The time
-  /// complexity of this function is O(n).
+  /// complexity of this function is O(log(n)).
   bool HasProperty(PropertyId property) const;
 
   /// Checks whether the property `property` is equal to the specified value
   /// `value`. This function doesn't perform any memory allocations while
   /// performing the equality check. The time complexity of this function is
-  /// O(n).
+  /// O(log(n)).
   bool IsPropertyEqual(PropertyId property, const PropertyValue &value) const;
 
+  /// Same as `IsPropertyEqual`, but `string_id` is the ID of the interned
+  /// string `value` (see `StringDictionary::Reference`), so an interned string
+  /// in the store is compared by its ID instead of its contents. If
+  /// `string_id` is `std::nullopt`, this is the same as the function above.
+  bool IsPropertyEqual(PropertyId property, const PropertyValue &value, std::optional<uint64_t> string_id) const;
+
   /// Returns all properties currently stored in the store. The time complexity
   /// of this function is O(n).
   /// @throw std::bad_alloc
@@ -56,6 +93,10 @@ class PropertyStore {
   /// @throw std::bad_alloc
   bool SetProperty(PropertyId property, const PropertyValue &value);
 
+  /// Returns the size in bytes of the external buffer, or 0 if the properties
+  /// are stored in the inline buffer.
+  uint64_t ExternalBufferSize() const;
+
   /// Remove all properties and return `true` if any removal took place.
   /// `false` is returned if there were no properties to remove. The time
   /// complexity of this function is O(1).
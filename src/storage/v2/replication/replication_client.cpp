@@ -376,6 +376,9 @@ std::vector<Storage::ReplicationClient::RecoveryStep> Storage::ReplicationClient
   MG_ASSERT(wal_files, "Wal files could not be loaded");
 
   auto snapshot_files = durability::GetSnapshotFiles(storage_->snapshot_directory_, storage_->uuid_);
+  // The replica loads a single snapshot, so the incremental snapshots are
+  // skipped and the rest of the changes are sent with the WAL files.
+  std::erase_if(snapshot_files, [](const auto &snapshot_file) { return snapshot_file.IsIncremental(); });
   std::optional<durability::SnapshotDurabilityInfo> latest_snapshot;
   if (!snapshot_files.empty()) {
     std::sort(snapshot_files.begin(), snapshot_files.end());
@@ -552,12 +555,21 @@ void Storage::ReplicationClient::ReplicaStream::AppendTransactionEnd(uint64_t fi
 }
 
 void Storage::ReplicationClient::ReplicaStream::AppendOperation(durability::StorageGlobalOperation operation,
-                                                                LabelId label, const std::set<PropertyId> &properties,
+                                                                LabelId label,
+                                                                const std::vector<PropertyId> &properties,
                                                                 uint64_t timestamp) {
   replication::Encoder encoder(stream_.GetBuilder());
   EncodeOperation(&encoder, &self_->storage_->name_id_mapper_, operation, label, properties, timestamp);
 }
 
+void Storage::ReplicationClient::ReplicaStream::AppendOperation(durability::StorageGlobalOperation operation,
+                                                                EdgeTypeId edge_type,
+                                                                const std::set<PropertyId> &properties,
+                                                                uint64_t timestamp) {
+  replication::Encoder encoder(stream_.GetBuilder());
+  EncodeOperation(&encoder, &self_->storage_->name_id_mapper_, operation, edge_type, properties, timestamp);
+}
+
 AppendDeltasRes Storage::ReplicationClient::ReplicaStream::Finalize() { return stream_.AwaitResponse(); }
 
 ////// CurrentWalHandler //////
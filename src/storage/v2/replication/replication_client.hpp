@@ -60,6 +60,10 @@ class Storage::ReplicationClient {
 
     /// @throw rpc::RpcFailedException
     void AppendOperation(durability::StorageGlobalOperation operation, LabelId label,
+                         const std::vector<PropertyId> &properties, uint64_t timestamp);
+
+    /// @throw rpc::RpcFailedException
+    void AppendOperation(durability::StorageGlobalOperation operation, EdgeTypeId edge_type,
                          const std::set<PropertyId> &properties, uint64_t timestamp);
 
    private:
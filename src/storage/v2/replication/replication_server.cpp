@@ -147,6 +147,7 @@ void Storage::ReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::B
 
   std::unique_lock<utils::RWLock> storage_guard(storage_->main_lock_);
   // Clear the database
+  if (storage_->vertex_lookup_table_) storage_->vertex_lookup_table_->Clear();
   storage_->vertices_.clear();
   storage_->edges_.clear();
 
@@ -154,11 +155,18 @@ void Storage::ReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::B
   storage_->indices_.label_index = LabelIndex(&storage_->indices_, &storage_->constraints_, storage_->config_.items);
   storage_->indices_.label_property_index =
       LabelPropertyIndex(&storage_->indices_, &storage_->constraints_, storage_->config_.items);
+  storage_->indices_.edge_type_index =
+      EdgeTypeIndex(&storage_->indices_, &storage_->constraints_, storage_->config_.items);
+  storage_->indices_.edge_type_property_index =
+      EdgeTypePropertyIndex(&storage_->indices_, &storage_->constraints_, storage_->config_.items);
+  storage_->indices_.label_property_composite_index =
+      LabelPropertyCompositeIndex(&storage_->indices_, &storage_->constraints_, storage_->config_.items);
   try {
     spdlog::debug("Loading snapshot");
     auto recovered_snapshot = durability::LoadSnapshot(*maybe_snapshot_path, &storage_->vertices_, &storage_->edges_,
                                                        &storage_->epoch_history_, &storage_->name_id_mapper_,
-                                                       &storage_->edge_count_, storage_->config_.items);
+                                                       &storage_->edge_count_, storage_->config_.items,
+                                                       storage_->config_.durability.recovery_thread_count);
     spdlog::debug("Snapshot loaded successfully");
     // If this step is present it should always be the first step of
     // the recovery so we use the UUID we read from snasphost
@@ -167,10 +175,17 @@ void Storage::ReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::B
     const auto &recovery_info = recovered_snapshot.recovery_info;
     storage_->vertex_id_ = recovery_info.next_vertex_id;
     storage_->edge_id_ = recovery_info.next_edge_id;
-    storage_->timestamp_ = std::max(storage_->timestamp_, recovery_info.next_timestamp);
+    storage_->timestamp_ = std::max(storage_->timestamp_.load(), recovery_info.next_timestamp);
+    storage_->visible_timestamp_ = storage_->timestamp_.load();
+    if (storage_->vertex_lookup_table_) {
+      auto vertex_acc = storage_->vertices_.access();
+      storage_->vertex_lookup_table_->Rebuild(&vertex_acc);
+    }
 
     durability::RecoverIndicesAndConstraints(recovered_snapshot.indices_constraints, &storage_->indices_,
-                                             &storage_->constraints_, &storage_->vertices_);
+                                             &storage_->constraints_, &storage_->vertices_,
+                                             std::max(storage_->config_.durability.recovery_thread_count,
+                                                      storage_->config_.schema_creation.num_threads));
   } catch (const durability::RecoveryFailure &e) {
     LOG_FATAL("Couldn't load the snapshot because of: {}", e.what());
   }
@@ -181,9 +196,9 @@ void Storage::ReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::B
 
   // Delete other durability files
   auto snapshot_files = durability::GetSnapshotFiles(storage_->snapshot_directory_, storage_->uuid_);
-  for (const auto &[path, uuid, _] : snapshot_files) {
-    if (path != *maybe_snapshot_path) {
-      storage_->file_retainer_.DeleteFile(path);
+  for (const auto &snapshot_file : snapshot_files) {
+    if (snapshot_file.path != *maybe_snapshot_path) {
+      storage_->file_retainer_.DeleteFile(snapshot_file.path);
     }
   }
 
@@ -411,7 +426,7 @@ uint64_t Storage::ReplicationServer::ReadAndApplyDelta(durability::BaseDecoder *
           bool is_visible = true;
           Delta *delta = nullptr;
           {
-            std::lock_guard<utils::SpinLock> guard(edge->lock);
+            std::lock_guard<utils::SeqLock> guard(edge->lock);
             is_visible = !edge->deleted;
             delta = edge->delta;
           }
@@ -550,6 +565,69 @@ uint64_t Storage::ReplicationServer::ReadAndApplyDelta(durability::BaseDecoder *
         if (ret != UniqueConstraints::DeletionStatus::SUCCESS) throw utils::BasicException("Invalid transaction!");
         break;
       }
+      case durability::WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE: {
+        spdlog::trace("       Create edge type index on :{}", delta.operation_edge_type.edge_type);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (!storage_->CreateIndex(storage_->NameToEdgeType(delta.operation_edge_type.edge_type), timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::EDGE_TYPE_INDEX_DROP: {
+        spdlog::trace("       Drop edge type index on :{}", delta.operation_edge_type.edge_type);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (!storage_->DropIndex(storage_->NameToEdgeType(delta.operation_edge_type.edge_type), timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE: {
+        spdlog::trace("       Create edge type+property index on :{} ({})",
+                      delta.operation_edge_type_property.edge_type, delta.operation_edge_type_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        auto ret = storage_->CreateIndex(storage_->NameToEdgeType(delta.operation_edge_type_property.edge_type),
+                                         storage_->NameToProperty(delta.operation_edge_type_property.property),
+                                         timestamp);
+        if (ret.HasError() || !ret.GetValue()) throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP: {
+        spdlog::trace("       Drop edge type+property index on :{} ({})", delta.operation_edge_type_property.edge_type,
+                      delta.operation_edge_type_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (!storage_->DropIndex(storage_->NameToEdgeType(delta.operation_edge_type_property.edge_type),
+                                 storage_->NameToProperty(delta.operation_edge_type_property.property), timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE: {
+        std::stringstream ss;
+        utils::PrintIterable(ss, delta.operation_label_ordered_properties.properties);
+        spdlog::trace("       Create label+property composite index on :{} ({})",
+                      delta.operation_label_ordered_properties.label, ss.str());
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        std::vector<PropertyId> properties;
+        for (const auto &prop : delta.operation_label_ordered_properties.properties) {
+          properties.push_back(storage_->NameToProperty(prop));
+        }
+        if (!storage_->CreateIndex(storage_->NameToLabel(delta.operation_label_ordered_properties.label), properties,
+                                   timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        std::stringstream ss;
+        utils::PrintIterable(ss, delta.operation_label_ordered_properties.properties);
+        spdlog::trace("       Drop label+property composite index on :{} ({})",
+                      delta.operation_label_ordered_properties.label, ss.str());
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        std::vector<PropertyId> properties;
+        for (const auto &prop : delta.operation_label_ordered_properties.properties) {
+          properties.push_back(storage_->NameToProperty(prop));
+        }
+        if (!storage_->DropIndex(storage_->NameToLabel(delta.operation_label_ordered_properties.label), properties,
+                                 timestamp))
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
     }
   }
 
@@ -12,9 +12,11 @@
 #include "storage/v2/storage.hpp"
 #include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <variant>
+#include <vector>
 
 #include <gflags/gflags.h>
 
@@ -36,6 +38,7 @@
 #include "utils/rw_lock.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/stat.hpp"
+#include "utils/timer.hpp"
 #include "utils/uuid.hpp"
 
 /// REPLICATION ///
@@ -49,6 +52,11 @@ using OOMExceptionEnabler = utils::MemoryTracker::OutOfMemoryExceptionEnabler;
 
 namespace {
 [[maybe_unused]] constexpr uint16_t kEpochHistoryRetention = 1000;
+
+// The memory info samples at most `kMemoryInfoSampleChunks` evenly spaced
+// chunks of `kMemoryInfoSampleChunkSize` consecutive vertices.
+constexpr uint64_t kMemoryInfoSampleChunks = 64;
+constexpr uint64_t kMemoryInfoSampleChunkSize = 16;
 }  // namespace
 
 auto AdvanceToVisibleVertex(utils::SkipList<Vertex>::Iterator it, utils::SkipList<Vertex>::Iterator end,
@@ -91,6 +99,11 @@ VerticesIterable::VerticesIterable(LabelPropertyIndex::Iterable vertices) : type
   new (&vertices_by_label_property_) LabelPropertyIndex::Iterable(std::move(vertices));
 }
 
+VerticesIterable::VerticesIterable(LabelPropertyCompositeIndex::Iterable vertices)
+    : type_(Type::BY_LABEL_PROPERTY_COMPOSITE) {
+  new (&vertices_by_label_property_composite_) LabelPropertyCompositeIndex::Iterable(std::move(vertices));
+}
+
 VerticesIterable::VerticesIterable(VerticesIterable &&other) noexcept : type_(other.type_) {
   switch (other.type_) {
     case Type::ALL:
@@ -102,6 +115,10 @@ VerticesIterable::VerticesIterable(VerticesIterable &&other) noexcept : type_(ot
     case Type::BY_LABEL_PROPERTY:
       new (&vertices_by_label_property_) LabelPropertyIndex::Iterable(std::move(other.vertices_by_label_property_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&vertices_by_label_property_composite_)
+          LabelPropertyCompositeIndex::Iterable(std::move(other.vertices_by_label_property_composite_));
+      break;
   }
 }
 
@@ -116,6 +133,9 @@ VerticesIterable &VerticesIterable::operator=(VerticesIterable &&other) noexcept
     case Type::BY_LABEL_PROPERTY:
       vertices_by_label_property_.LabelPropertyIndex::Iterable::~Iterable();
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      vertices_by_label_property_composite_.LabelPropertyCompositeIndex::Iterable::~Iterable();
+      break;
   }
   type_ = other.type_;
   switch (other.type_) {
@@ -128,6 +148,10 @@ VerticesIterable &VerticesIterable::operator=(VerticesIterable &&other) noexcept
     case Type::BY_LABEL_PROPERTY:
       new (&vertices_by_label_property_) LabelPropertyIndex::Iterable(std::move(other.vertices_by_label_property_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&vertices_by_label_property_composite_)
+          LabelPropertyCompositeIndex::Iterable(std::move(other.vertices_by_label_property_composite_));
+      break;
   }
   return *this;
 }
@@ -143,6 +167,9 @@ VerticesIterable::~VerticesIterable() {
     case Type::BY_LABEL_PROPERTY:
       vertices_by_label_property_.LabelPropertyIndex::Iterable::~Iterable();
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      vertices_by_label_property_composite_.LabelPropertyCompositeIndex::Iterable::~Iterable();
+      break;
   }
 }
 
@@ -154,6 +181,8 @@ VerticesIterable::Iterator VerticesIterable::begin() {
       return Iterator(vertices_by_label_.begin());
     case Type::BY_LABEL_PROPERTY:
       return Iterator(vertices_by_label_property_.begin());
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      return Iterator(vertices_by_label_property_composite_.begin());
   }
 }
 
@@ -165,6 +194,8 @@ VerticesIterable::Iterator VerticesIterable::end() {
       return Iterator(vertices_by_label_.end());
     case Type::BY_LABEL_PROPERTY:
       return Iterator(vertices_by_label_property_.end());
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      return Iterator(vertices_by_label_property_composite_.end());
   }
 }
 
@@ -180,6 +211,11 @@ VerticesIterable::Iterator::Iterator(LabelPropertyIndex::Iterable::Iterator it)
   new (&by_label_property_it_) LabelPropertyIndex::Iterable::Iterator(std::move(it));
 }
 
+VerticesIterable::Iterator::Iterator(LabelPropertyCompositeIndex::Iterable::Iterator it)
+    : type_(Type::BY_LABEL_PROPERTY_COMPOSITE) {
+  new (&by_label_property_composite_it_) LabelPropertyCompositeIndex::Iterable::Iterator(std::move(it));
+}
+
 VerticesIterable::Iterator::Iterator(const VerticesIterable::Iterator &other) : type_(other.type_) {
   switch (other.type_) {
     case Type::ALL:
@@ -191,6 +227,10 @@ VerticesIterable::Iterator::Iterator(const VerticesIterable::Iterator &other) :
     case Type::BY_LABEL_PROPERTY:
       new (&by_label_property_it_) LabelPropertyIndex::Iterable::Iterator(other.by_label_property_it_);
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&by_label_property_composite_it_)
+          LabelPropertyCompositeIndex::Iterable::Iterator(other.by_label_property_composite_it_);
+      break;
   }
 }
 
@@ -207,6 +247,10 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator=(const Vertices
     case Type::BY_LABEL_PROPERTY:
       new (&by_label_property_it_) LabelPropertyIndex::Iterable::Iterator(other.by_label_property_it_);
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&by_label_property_composite_it_)
+          LabelPropertyCompositeIndex::Iterable::Iterator(other.by_label_property_composite_it_);
+      break;
   }
   return *this;
 }
@@ -222,6 +266,10 @@ VerticesIterable::Iterator::Iterator(VerticesIterable::Iterator &&other) noexcep
     case Type::BY_LABEL_PROPERTY:
       new (&by_label_property_it_) LabelPropertyIndex::Iterable::Iterator(std::move(other.by_label_property_it_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&by_label_property_composite_it_)
+          LabelPropertyCompositeIndex::Iterable::Iterator(std::move(other.by_label_property_composite_it_));
+      break;
   }
 }
 
@@ -238,6 +286,10 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator=(VerticesIterab
     case Type::BY_LABEL_PROPERTY:
       new (&by_label_property_it_) LabelPropertyIndex::Iterable::Iterator(std::move(other.by_label_property_it_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      new (&by_label_property_composite_it_)
+          LabelPropertyCompositeIndex::Iterable::Iterator(std::move(other.by_label_property_composite_it_));
+      break;
   }
   return *this;
 }
@@ -255,6 +307,9 @@ void VerticesIterable::Iterator::Destroy() noexcept {
     case Type::BY_LABEL_PROPERTY:
       by_label_property_it_.LabelPropertyIndex::Iterable::Iterator::~Iterator();
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      by_label_property_composite_it_.LabelPropertyCompositeIndex::Iterable::Iterator::~Iterator();
+      break;
   }
 }
 
@@ -266,6 +321,8 @@ VertexAccessor VerticesIterable::Iterator::operator*() const {
       return *by_label_it_;
     case Type::BY_LABEL_PROPERTY:
       return *by_label_property_it_;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      return *by_label_property_composite_it_;
   }
 }
 
@@ -280,6 +337,9 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator++() {
     case Type::BY_LABEL_PROPERTY:
       ++by_label_property_it_;
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      ++by_label_property_composite_it_;
+      break;
   }
   return *this;
 }
@@ -292,6 +352,184 @@ bool VerticesIterable::Iterator::operator==(const Iterator &other) const {
       return by_label_it_ == other.by_label_it_;
     case Type::BY_LABEL_PROPERTY:
       return by_label_property_it_ == other.by_label_property_it_;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE:
+      return by_label_property_composite_it_ == other.by_label_property_composite_it_;
+  }
+}
+
+IndexedEdgesIterable::IndexedEdgesIterable(EdgeTypeIndex::Iterable edges) : type_(Type::BY_EDGE_TYPE) {
+  new (&edges_by_edge_type_) EdgeTypeIndex::Iterable(std::move(edges));
+}
+
+IndexedEdgesIterable::IndexedEdgesIterable(EdgeTypePropertyIndex::Iterable edges) : type_(Type::BY_EDGE_TYPE_PROPERTY) {
+  new (&edges_by_edge_type_property_) EdgeTypePropertyIndex::Iterable(std::move(edges));
+}
+
+IndexedEdgesIterable::IndexedEdgesIterable(IndexedEdgesIterable &&other) noexcept : type_(other.type_) {
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&edges_by_edge_type_) EdgeTypeIndex::Iterable(std::move(other.edges_by_edge_type_));
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&edges_by_edge_type_property_)
+          EdgeTypePropertyIndex::Iterable(std::move(other.edges_by_edge_type_property_));
+      break;
+  }
+}
+
+IndexedEdgesIterable &IndexedEdgesIterable::operator=(IndexedEdgesIterable &&other) noexcept {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      edges_by_edge_type_.EdgeTypeIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      edges_by_edge_type_property_.EdgeTypePropertyIndex::Iterable::~Iterable();
+      break;
+  }
+  type_ = other.type_;
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&edges_by_edge_type_) EdgeTypeIndex::Iterable(std::move(other.edges_by_edge_type_));
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&edges_by_edge_type_property_)
+          EdgeTypePropertyIndex::Iterable(std::move(other.edges_by_edge_type_property_));
+      break;
+  }
+  return *this;
+}
+
+IndexedEdgesIterable::~IndexedEdgesIterable() {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      edges_by_edge_type_.EdgeTypeIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      edges_by_edge_type_property_.EdgeTypePropertyIndex::Iterable::~Iterable();
+      break;
+  }
+}
+
+IndexedEdgesIterable::Iterator IndexedEdgesIterable::begin() {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      return Iterator(edges_by_edge_type_.begin());
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      return Iterator(edges_by_edge_type_property_.begin());
+  }
+}
+
+IndexedEdgesIterable::Iterator IndexedEdgesIterable::end() {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      return Iterator(edges_by_edge_type_.end());
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      return Iterator(edges_by_edge_type_property_.end());
+  }
+}
+
+IndexedEdgesIterable::Iterator::Iterator(EdgeTypeIndex::Iterable::Iterator it) : type_(Type::BY_EDGE_TYPE) {
+  new (&by_edge_type_it_) EdgeTypeIndex::Iterable::Iterator(std::move(it));
+}
+
+IndexedEdgesIterable::Iterator::Iterator(EdgeTypePropertyIndex::Iterable::Iterator it)
+    : type_(Type::BY_EDGE_TYPE_PROPERTY) {
+  new (&by_edge_type_property_it_) EdgeTypePropertyIndex::Iterable::Iterator(std::move(it));
+}
+
+IndexedEdgesIterable::Iterator::Iterator(const IndexedEdgesIterable::Iterator &other) : type_(other.type_) {
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&by_edge_type_it_) EdgeTypeIndex::Iterable::Iterator(other.by_edge_type_it_);
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&by_edge_type_property_it_) EdgeTypePropertyIndex::Iterable::Iterator(other.by_edge_type_property_it_);
+      break;
+  }
+}
+
+IndexedEdgesIterable::Iterator &IndexedEdgesIterable::Iterator::operator=(const IndexedEdgesIterable::Iterator &other) {
+  Destroy();
+  type_ = other.type_;
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&by_edge_type_it_) EdgeTypeIndex::Iterable::Iterator(other.by_edge_type_it_);
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&by_edge_type_property_it_) EdgeTypePropertyIndex::Iterable::Iterator(other.by_edge_type_property_it_);
+      break;
+  }
+  return *this;
+}
+
+IndexedEdgesIterable::Iterator::Iterator(IndexedEdgesIterable::Iterator &&other) noexcept : type_(other.type_) {
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&by_edge_type_it_) EdgeTypeIndex::Iterable::Iterator(std::move(other.by_edge_type_it_));
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&by_edge_type_property_it_)
+          EdgeTypePropertyIndex::Iterable::Iterator(std::move(other.by_edge_type_property_it_));
+      break;
+  }
+}
+
+IndexedEdgesIterable::Iterator &IndexedEdgesIterable::Iterator::operator=(
+    IndexedEdgesIterable::Iterator &&other) noexcept {
+  Destroy();
+  type_ = other.type_;
+  switch (other.type_) {
+    case Type::BY_EDGE_TYPE:
+      new (&by_edge_type_it_) EdgeTypeIndex::Iterable::Iterator(std::move(other.by_edge_type_it_));
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      new (&by_edge_type_property_it_)
+          EdgeTypePropertyIndex::Iterable::Iterator(std::move(other.by_edge_type_property_it_));
+      break;
+  }
+  return *this;
+}
+
+IndexedEdgesIterable::Iterator::~Iterator() { Destroy(); }
+
+void IndexedEdgesIterable::Iterator::Destroy() noexcept {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      by_edge_type_it_.EdgeTypeIndex::Iterable::Iterator::~Iterator();
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      by_edge_type_property_it_.EdgeTypePropertyIndex::Iterable::Iterator::~Iterator();
+      break;
+  }
+}
+
+EdgeAccessor IndexedEdgesIterable::Iterator::operator*() const {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      return *by_edge_type_it_;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      return *by_edge_type_property_it_;
+  }
+}
+
+IndexedEdgesIterable::Iterator &IndexedEdgesIterable::Iterator::operator++() {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      ++by_edge_type_it_;
+      break;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      ++by_edge_type_property_it_;
+      break;
+  }
+  return *this;
+}
+
+bool IndexedEdgesIterable::Iterator::operator==(const Iterator &other) const {
+  switch (type_) {
+    case Type::BY_EDGE_TYPE:
+      return by_edge_type_it_ == other.by_edge_type_it_;
+    case Type::BY_EDGE_TYPE_PROPERTY:
+      return by_edge_type_property_it_ == other.by_edge_type_property_it_;
   }
 }
 
@@ -305,6 +543,7 @@ Storage::Storage(Config config)
       uuid_(utils::GenerateUUID()),
       epoch_id_(utils::GenerateUUID()),
       global_locker_(file_retainer_.AddLocker()) {
+  if (config_.items.vertex_lookup_table) vertex_lookup_table_.emplace();
   if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED ||
       config_.durability.snapshot_on_exit || config_.durability.recover_on_startup) {
     // Create the directory initially to crash the database in case of
@@ -333,15 +572,21 @@ Storage::Storage(Config config)
   if (config_.durability.recover_on_startup) {
     auto info = durability::RecoverData(snapshot_directory_, wal_directory_, &uuid_, &epoch_id_, &epoch_history_,
                                         &vertices_, &edges_, &edge_count_, &name_id_mapper_, &indices_, &constraints_,
-                                        config_.items, &wal_seq_num_);
+                                        config_.items, config_.durability.recovery_thread_count,
+                                        config_.schema_creation.num_threads, &wal_seq_num_);
     if (info) {
       vertex_id_ = info->next_vertex_id;
       edge_id_ = info->next_edge_id;
-      timestamp_ = std::max(timestamp_, info->next_timestamp);
+      timestamp_ = std::max(timestamp_.load(), info->next_timestamp);
+      visible_timestamp_ = timestamp_.load();
       if (info->last_commit_timestamp) {
         last_commit_timestamp_ = *info->last_commit_timestamp;
       }
     }
+    if (vertex_lookup_table_) {
+      auto vertex_acc = vertices_.access();
+      vertex_lookup_table_->Rebuild(&vertex_acc);
+    }
   } else if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED ||
              config_.durability.snapshot_on_exit) {
     bool files_moved = false;
@@ -382,6 +627,34 @@ Storage::Storage(Config config)
       }
     });
   }
+  if (config_.durability.snapshot_wal_mode == Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL &&
+      config_.durability.wal_group_commit) {
+    if (config_.durability.wal_file_flush_every_n_tx != Config::Durability().wal_file_flush_every_n_tx) {
+      spdlog::warn(
+          "The WAL file flush every n transactions setting isn't used because the WAL group commit syncs "
+          "every commit.");
+    }
+    wal_group_commit_.emplace(
+        config_.durability.wal_group_commit_max_latency,
+        [this] { return wal_written_transactions_.load(std::memory_order_relaxed); },
+        [this] {
+          std::optional<utils::OutputFileSyncHandle> sync_handle;
+          uint64_t written_transactions = 0;
+          {
+            std::lock_guard<utils::SpinLock> guard(engine_lock_);
+            written_transactions = wal_written_transactions_;
+            // Finalized WAL files are synced when they are closed so only the
+            // current one has to be synced.
+            if (wal_file_) sync_handle.emplace(wal_file_->FlushForSync());
+          }
+          // The committers can keep writing to the WAL while it is being synced.
+          if (sync_handle) sync_handle->Sync();
+          return written_transactions;
+        });
+  }
+  if (config_.gc.num_threads > 1) {
+    gc_thread_pool_.emplace(config_.gc.num_threads - 1);
+  }
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
     gc_runner_.Run("Storage GC", config_.gc.interval, [this] { this->CollectGarbage<false>(); });
   }
@@ -402,6 +675,7 @@ Storage::~Storage() {
     replication_server_.reset();
     replication_clients_.WithLock([&](auto &clients) { clients.clear(); });
   }
+  wal_group_commit_.reset();
   if (wal_file_) {
     wal_file_->FinalizeWal();
     wal_file_ = std::nullopt;
@@ -420,22 +694,27 @@ Storage::~Storage() {
   }
 }
 
-Storage::Accessor::Accessor(Storage *storage, IsolationLevel isolation_level)
+Storage::Accessor::Accessor(Storage *storage, IsolationLevel isolation_level, bool read_only)
     : storage_(storage),
       // The lock must be acquired before creating the transaction object to
       // prevent freshly created transactions from dangling in an active state
       // during exclusive operations.
       storage_guard_(storage_->main_lock_),
-      transaction_(storage->CreateTransaction(isolation_level)),
+      read_only_slot_(0),
+      transaction_(read_only ? storage->CreateReadOnlyTransaction(isolation_level, &read_only_slot_)
+                             : storage->CreateTransaction(isolation_level)),
       is_transaction_active_(true),
+      read_only_(read_only),
       config_(storage->config_.items) {}
 
 Storage::Accessor::Accessor(Accessor &&other) noexcept
     : storage_(other.storage_),
       storage_guard_(std::move(other.storage_guard_)),
+      read_only_slot_(other.read_only_slot_),
       transaction_(std::move(other.transaction_)),
       commit_timestamp_(other.commit_timestamp_),
       is_transaction_active_(other.is_transaction_active_),
+      read_only_(other.read_only_),
       config_(other.config_) {
   // Don't allow the other accessor to abort our transaction in destructor.
   other.is_transaction_active_ = false;
@@ -458,7 +737,8 @@ VertexAccessor Storage::Accessor::CreateVertex() {
   auto [it, inserted] = acc.insert(Vertex{storage::Gid::FromUint(gid), delta});
   MG_ASSERT(inserted, "The vertex must be inserted here!");
   MG_ASSERT(it != acc.end(), "Invalid Vertex accessor!");
-  delta->prev.Set(&*it);
+  if (delta) delta->prev.Set(&*it);
+  if (storage_->vertex_lookup_table_) storage_->vertex_lookup_table_->Insert(it->gid, &*it);
   return VertexAccessor(&*it, &transaction_, &storage_->indices_, &storage_->constraints_, config_);
 }
 
@@ -477,15 +757,23 @@ VertexAccessor Storage::Accessor::CreateVertex(storage::Gid gid) {
   auto [it, inserted] = acc.insert(Vertex{gid, delta});
   MG_ASSERT(inserted, "The vertex must be inserted here!");
   MG_ASSERT(it != acc.end(), "Invalid Vertex accessor!");
-  delta->prev.Set(&*it);
+  if (delta) delta->prev.Set(&*it);
+  if (storage_->vertex_lookup_table_) storage_->vertex_lookup_table_->Insert(gid, &*it);
   return VertexAccessor(&*it, &transaction_, &storage_->indices_, &storage_->constraints_, config_);
 }
 
 std::optional<VertexAccessor> Storage::Accessor::FindVertex(Gid gid, View view) {
+  // The accessor must be created before the lookup table is used so that the
+  // vertex can't be freed while it is being checked.
   auto acc = storage_->vertices_.access();
-  auto it = acc.find(gid);
-  if (it == acc.end()) return std::nullopt;
-  return VertexAccessor::Create(&*it, &transaction_, &storage_->indices_, &storage_->constraints_, config_, view);
+  Vertex *vertex = nullptr;
+  if (storage_->vertex_lookup_table_) vertex = storage_->vertex_lookup_table_->Find(gid);
+  if (vertex == nullptr) {
+    auto it = acc.find(gid);
+    if (it == acc.end()) return std::nullopt;
+    vertex = &*it;
+  }
+  return VertexAccessor::Create(vertex, &transaction_, &storage_->indices_, &storage_->constraints_, config_, view);
 }
 
 Result<std::optional<VertexAccessor>> Storage::Accessor::DeleteVertex(VertexAccessor *vertex) {
@@ -494,7 +782,7 @@ Result<std::optional<VertexAccessor>> Storage::Accessor::DeleteVertex(VertexAcce
             "accessor when deleting a vertex!");
   auto *vertex_ptr = vertex->vertex_;
 
-  std::lock_guard<utils::SpinLock> guard(vertex_ptr->lock);
+  std::lock_guard<utils::SeqLock> guard(vertex_ptr->lock);
 
   if (!PrepareForWrite(&transaction_, vertex_ptr)) return Error::SERIALIZATION_ERROR;
 
@@ -506,6 +794,13 @@ Result<std::optional<VertexAccessor>> Storage::Accessor::DeleteVertex(VertexAcce
 
   CreateAndLinkDelta(&transaction_, vertex_ptr, Delta::RecreateObjectTag());
   vertex_ptr->deleted = true;
+  if (transaction_.storage_mode == StorageMode::IN_MEMORY_ANALYTICAL && vertex_ptr->delta == nullptr) {
+    // Without a delta the GC can't find the deleted vertex, so it is handed
+    // over directly. A vertex that still has a delta from a transaction
+    // committed before the switch to the analytical mode is found by the GC
+    // when that delta is unlinked.
+    storage_->deleted_vertices_->push_back(vertex_ptr->gid);
+  }
 
   return std::make_optional<VertexAccessor>(vertex_ptr, &transaction_, &storage_->indices_, &storage_->constraints_,
                                             config_, true);
@@ -524,14 +819,14 @@ Result<std::optional<std::pair<VertexAccessor, std::vector<EdgeAccessor>>>> Stor
   std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
 
   {
-    std::lock_guard<utils::SpinLock> guard(vertex_ptr->lock);
+    std::lock_guard<utils::SeqLock> guard(vertex_ptr->lock);
 
     if (!PrepareForWrite(&transaction_, vertex_ptr)) return Error::SERIALIZATION_ERROR;
 
     if (vertex_ptr->deleted) return std::optional<ReturnType>{};
 
-    in_edges = vertex_ptr->in_edges;
-    out_edges = vertex_ptr->out_edges;
+    in_edges.assign(vertex_ptr->in_edges.begin(), vertex_ptr->in_edges.end());
+    out_edges.assign(vertex_ptr->out_edges.begin(), vertex_ptr->out_edges.end());
   }
 
   std::vector<EdgeAccessor> deleted_edges;
@@ -564,7 +859,7 @@ Result<std::optional<std::pair<VertexAccessor, std::vector<EdgeAccessor>>>> Stor
     }
   }
 
-  std::lock_guard<utils::SpinLock> guard(vertex_ptr->lock);
+  std::lock_guard<utils::SeqLock> guard(vertex_ptr->lock);
 
   // We need to check again for serialization errors because we unlocked the
   // vertex. Some other transaction could have modified the vertex in the
@@ -576,6 +871,13 @@ Result<std::optional<std::pair<VertexAccessor, std::vector<EdgeAccessor>>>> Stor
 
   CreateAndLinkDelta(&transaction_, vertex_ptr, Delta::RecreateObjectTag());
   vertex_ptr->deleted = true;
+  if (transaction_.storage_mode == StorageMode::IN_MEMORY_ANALYTICAL && vertex_ptr->delta == nullptr) {
+    // Without a delta the GC can't find the deleted vertex, so it is handed
+    // over directly. A vertex that still has a delta from a transaction
+    // committed before the switch to the analytical mode is found by the GC
+    // when that delta is unlinked.
+    storage_->deleted_vertices_->push_back(vertex_ptr->gid);
+  }
 
   return std::make_optional<ReturnType>(
       VertexAccessor{vertex_ptr, &transaction_, &storage_->indices_, &storage_->constraints_, config_, true},
@@ -595,8 +897,8 @@ Result<EdgeAccessor> Storage::Accessor::CreateEdge(VertexAccessor *from, VertexA
   auto to_vertex = to->vertex_;
 
   // Obtain the locks by `gid` order to avoid lock cycles.
-  std::unique_lock<utils::SpinLock> guard_from(from_vertex->lock, std::defer_lock);
-  std::unique_lock<utils::SpinLock> guard_to(to_vertex->lock, std::defer_lock);
+  std::unique_lock<utils::SeqLock> guard_from(from_vertex->lock, std::defer_lock);
+  std::unique_lock<utils::SeqLock> guard_to(to_vertex->lock, std::defer_lock);
   if (from_vertex->gid < to_vertex->gid) {
     guard_from.lock();
     guard_to.lock();
@@ -625,14 +927,18 @@ Result<EdgeAccessor> Storage::Accessor::CreateEdge(VertexAccessor *from, VertexA
     MG_ASSERT(inserted, "The edge must be inserted here!");
     MG_ASSERT(it != acc.end(), "Invalid Edge accessor!");
     edge = EdgeRef(&*it);
-    delta->prev.Set(&*it);
+    if (delta) delta->prev.Set(&*it);
   }
 
   CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-  from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+  from_vertex->out_edges.Insert(edge_type, to_vertex, edge);
+  ++from_vertex->edges_version;
 
   CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-  to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+  to_vertex->in_edges.Insert(edge_type, from_vertex, edge);
+  ++to_vertex->edges_version;
+
+  UpdateOnEdgeCreation(&storage_->indices_, edge_type, from_vertex, to_vertex, edge, transaction_);
 
   // Increment edge count.
   storage_->edge_count_.fetch_add(1, std::memory_order_acq_rel);
@@ -655,8 +961,8 @@ Result<EdgeAccessor> Storage::Accessor::CreateEdge(VertexAccessor *from, VertexA
   auto to_vertex = to->vertex_;
 
   // Obtain the locks by `gid` order to avoid lock cycles.
-  std::unique_lock<utils::SpinLock> guard_from(from_vertex->lock, std::defer_lock);
-  std::unique_lock<utils::SpinLock> guard_to(to_vertex->lock, std::defer_lock);
+  std::unique_lock<utils::SeqLock> guard_from(from_vertex->lock, std::defer_lock);
+  std::unique_lock<utils::SeqLock> guard_to(to_vertex->lock, std::defer_lock);
   if (from_vertex->gid < to_vertex->gid) {
     guard_from.lock();
     guard_to.lock();
@@ -693,14 +999,18 @@ Result<EdgeAccessor> Storage::Accessor::CreateEdge(VertexAccessor *from, VertexA
     MG_ASSERT(inserted, "The edge must be inserted here!");
     MG_ASSERT(it != acc.end(), "Invalid Edge accessor!");
     edge = EdgeRef(&*it);
-    delta->prev.Set(&*it);
+    if (delta) delta->prev.Set(&*it);
   }
 
   CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-  from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+  from_vertex->out_edges.Insert(edge_type, to_vertex, edge);
+  ++from_vertex->edges_version;
 
   CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-  to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+  to_vertex->in_edges.Insert(edge_type, from_vertex, edge);
+  ++to_vertex->edges_version;
+
+  UpdateOnEdgeCreation(&storage_->indices_, edge_type, from_vertex, to_vertex, edge, transaction_);
 
   // Increment edge count.
   storage_->edge_count_.fetch_add(1, std::memory_order_acq_rel);
@@ -716,10 +1026,10 @@ Result<std::optional<EdgeAccessor>> Storage::Accessor::DeleteEdge(EdgeAccessor *
   auto edge_ref = edge->edge_;
   auto edge_type = edge->edge_type_;
 
-  std::unique_lock<utils::SpinLock> guard;
+  std::unique_lock<utils::SeqLock> guard;
   if (config_.properties_on_edges) {
     auto edge_ptr = edge_ref.ptr;
-    guard = std::unique_lock<utils::SpinLock>(edge_ptr->lock);
+    guard = std::unique_lock<utils::SeqLock>(edge_ptr->lock);
 
     if (!PrepareForWrite(&transaction_, edge_ptr)) return Error::SERIALIZATION_ERROR;
 
@@ -730,8 +1040,8 @@ Result<std::optional<EdgeAccessor>> Storage::Accessor::DeleteEdge(EdgeAccessor *
   auto *to_vertex = edge->to_vertex_;
 
   // Obtain the locks by `gid` order to avoid lock cycles.
-  std::unique_lock<utils::SpinLock> guard_from(from_vertex->lock, std::defer_lock);
-  std::unique_lock<utils::SpinLock> guard_to(to_vertex->lock, std::defer_lock);
+  std::unique_lock<utils::SeqLock> guard_from(from_vertex->lock, std::defer_lock);
+  std::unique_lock<utils::SeqLock> guard_to(to_vertex->lock, std::defer_lock);
   if (from_vertex->gid < to_vertex->gid) {
     guard_from.lock();
     guard_to.lock();
@@ -752,20 +1062,17 @@ Result<std::optional<EdgeAccessor>> Storage::Accessor::DeleteEdge(EdgeAccessor *
   }
 
   auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges) {
-    std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
+    auto removed = edges->Remove(edge_type, vertex, edge_ref);
     if (config_.properties_on_edges) {
-      MG_ASSERT(it != edges->end(), "Invalid database state!");
-    } else if (it == edges->end()) {
-      return false;
+      MG_ASSERT(removed, "Invalid database state!");
     }
-    std::swap(*it, *edges->rbegin());
-    edges->pop_back();
-    return true;
+    return removed;
   };
 
   auto op1 = delete_edge_from_storage(to_vertex, &from_vertex->out_edges);
   auto op2 = delete_edge_from_storage(from_vertex, &to_vertex->in_edges);
+  if (op1) ++from_vertex->edges_version;
+  if (op2) ++to_vertex->edges_version;
 
   if (config_.properties_on_edges) {
     MG_ASSERT((op1 && op2), "Invalid database state!");
@@ -781,6 +1088,10 @@ Result<std::optional<EdgeAccessor>> Storage::Accessor::DeleteEdge(EdgeAccessor *
     auto *edge_ptr = edge_ref.ptr;
     CreateAndLinkDelta(&transaction_, edge_ptr, Delta::RecreateObjectTag());
     edge_ptr->deleted = true;
+    if (transaction_.storage_mode == StorageMode::IN_MEMORY_ANALYTICAL && edge_ptr->delta == nullptr) {
+      // See `DeleteVertex`.
+      storage_->deleted_edges_->push_back(edge_ptr->gid);
+    }
   }
 
   CreateAndLinkDelta(&transaction_, from_vertex, Delta::AddOutEdgeTag(), edge_type, to_vertex, edge_ref);
@@ -816,7 +1127,10 @@ utils::BasicResult<ConstraintViolation, void> Storage::Accessor::Commit(
   MG_ASSERT(is_transaction_active_, "The transaction is already terminated!");
   MG_ASSERT(!transaction_.must_abort, "The transaction can't be committed!");
 
-  if (transaction_.deltas.empty()) {
+  if (read_only_) {
+    MG_ASSERT(transaction_.deltas.empty(), "Read-only transaction modified the storage!");
+    storage_->FinishReadOnlyTransaction(read_only_slot_, transaction_.start_timestamp);
+  } else if (transaction_.deltas.empty()) {
     // We don't have to update the commit timestamp here because no one reads
     // it.
     storage_->commit_log_->MarkFinished(transaction_.start_timestamp);
@@ -845,6 +1159,14 @@ utils::BasicResult<ConstraintViolation, void> Storage::Accessor::Commit(
     // Save these so we can mark them used in the commit log.
     uint64_t start_timestamp = transaction_.start_timestamp;
 
+    // Number of WAL transactions that have to be synced before the commit is
+    // acknowledged, set only if the transaction was written to the WAL.
+    std::optional<uint64_t> wal_position;
+
+    // The modified objects are collected before the engine lock is taken so
+    // that only the collected gids are handed over under the lock.
+    auto modified_objects = storage_->CollectModifiedObjects(transaction_);
+
     {
       std::unique_lock<utils::SpinLock> engine_guard(storage_->engine_lock_);
       commit_timestamp_.emplace(storage_->CommitTimestamp(desired_commit_timestamp));
@@ -889,6 +1211,10 @@ utils::BasicResult<ConstraintViolation, void> Storage::Accessor::Commit(
         // so the Wal files are consistent
         if (storage_->replication_role_ == ReplicationRole::MAIN || desired_commit_timestamp.has_value()) {
           storage_->AppendToWal(transaction_, *commit_timestamp_);
+          wal_position = storage_->wal_written_transactions_;
+        }
+        if (modified_objects && storage_->replication_role_ == ReplicationRole::MAIN) {
+          storage_->TrackModifiedObjects(std::move(*modified_objects));
         }
 
         // Take committed_transactions lock while holding the engine lock to
@@ -899,6 +1225,16 @@ utils::BasicResult<ConstraintViolation, void> Storage::Accessor::Commit(
           // of the commit timestamp
           MG_ASSERT(transaction_.commit_timestamp != nullptr, "Invalid database state!");
           transaction_.commit_timestamp->store(*commit_timestamp_, std::memory_order_release);
+          if (wal_position && storage_->IsWalGroupCommitUsed()) {
+            // The new transactions see the commit only after it is synced,
+            // see `CreateTransaction`.
+            storage_->unsynced_commit_timestamp_ = *commit_timestamp_;
+            storage_->unsynced_wal_position_ = *wal_position;
+          } else {
+            // The commits are published in the order of their commit
+            // timestamps because the engine lock is still held.
+            storage_->AdvanceVisibleTimestamp(*commit_timestamp_ + 1);
+          }
           // Replica can only update the last commit timestamp with
           // the commits received from main.
           if (storage_->replication_role_ == ReplicationRole::MAIN || desired_commit_timestamp.has_value()) {
@@ -914,6 +1250,13 @@ utils::BasicResult<ConstraintViolation, void> Storage::Accessor::Commit(
       }
     }
 
+    if (wal_position) {
+      storage_->WaitForWalSync(*wal_position);
+      // The WAL is synced in the order of the commit timestamps, so all of the
+      // earlier commits are synced as well.
+      storage_->AdvanceVisibleTimestamp(*commit_timestamp_ + 1);
+    }
+
     if (unique_constraint_violation) {
       Abort();
       return *unique_constraint_violation;
@@ -927,6 +1270,13 @@ utils::BasicResult<ConstraintViolation, void> Storage::Accessor::Commit(
 void Storage::Accessor::Abort() {
   MG_ASSERT(is_transaction_active_, "The transaction is already terminated!");
 
+  if (read_only_) {
+    MG_ASSERT(transaction_.deltas.empty(), "Read-only transaction modified the storage!");
+    storage_->FinishReadOnlyTransaction(read_only_slot_, transaction_.start_timestamp);
+    is_transaction_active_ = false;
+    return;
+  }
+
   // We collect vertices and edges we've created here and then splice them into
   // `deleted_vertices_` and `deleted_edges_` lists, instead of adding them one
   // by one and acquiring lock every time.
@@ -938,22 +1288,17 @@ void Storage::Accessor::Abort() {
     switch (prev.type) {
       case PreviousPtr::Type::VERTEX: {
         auto vertex = prev.vertex;
-        std::lock_guard<utils::SpinLock> guard(vertex->lock);
+        std::lock_guard<utils::SeqLock> guard(vertex->lock);
         Delta *current = vertex->delta;
         while (current != nullptr &&
                current->timestamp->load(std::memory_order_acquire) == transaction_.transaction_id) {
           switch (current->action) {
             case Delta::Action::REMOVE_LABEL: {
-              auto it = std::find(vertex->labels.begin(), vertex->labels.end(), current->label);
-              MG_ASSERT(it != vertex->labels.end(), "Invalid database state!");
-              std::swap(*it, *vertex->labels.rbegin());
-              vertex->labels.pop_back();
+              MG_ASSERT(vertex->labels.Erase(current->label), "Invalid database state!");
               break;
             }
             case Delta::Action::ADD_LABEL: {
-              auto it = std::find(vertex->labels.begin(), vertex->labels.end(), current->label);
-              MG_ASSERT(it == vertex->labels.end(), "Invalid database state!");
-              vertex->labels.push_back(current->label);
+              MG_ASSERT(vertex->labels.Insert(current->label), "Invalid database state!");
               break;
             }
             case Delta::Action::SET_PROPERTY: {
@@ -963,17 +1308,17 @@ void Storage::Accessor::Abort() {
             case Delta::Action::ADD_IN_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
-              MG_ASSERT(it == vertex->in_edges.end(), "Invalid database state!");
-              vertex->in_edges.push_back(link);
+              MG_ASSERT(vertex->in_edges.Find(link) == vertex->in_edges.end(), "Invalid database state!");
+              vertex->in_edges.Insert(link);
+              ++vertex->edges_version;
               break;
             }
             case Delta::Action::ADD_OUT_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
-              MG_ASSERT(it == vertex->out_edges.end(), "Invalid database state!");
-              vertex->out_edges.push_back(link);
+              MG_ASSERT(vertex->out_edges.Find(link) == vertex->out_edges.end(), "Invalid database state!");
+              vertex->out_edges.Insert(link);
+              ++vertex->edges_version;
               // Increment edge count. We only increment the count here because
               // the information in `ADD_IN_EDGE` and `Edge/RECREATE_OBJECT` is
               // redundant. Also, `Edge/RECREATE_OBJECT` isn't available when
@@ -984,19 +1329,17 @@ void Storage::Accessor::Abort() {
             case Delta::Action::REMOVE_IN_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
-              MG_ASSERT(it != vertex->in_edges.end(), "Invalid database state!");
-              std::swap(*it, *vertex->in_edges.rbegin());
-              vertex->in_edges.pop_back();
+              auto removed = vertex->in_edges.Remove(link);
+              MG_ASSERT(removed, "Invalid database state!");
+              ++vertex->edges_version;
               break;
             }
             case Delta::Action::REMOVE_OUT_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
-              MG_ASSERT(it != vertex->out_edges.end(), "Invalid database state!");
-              std::swap(*it, *vertex->out_edges.rbegin());
-              vertex->out_edges.pop_back();
+              auto removed = vertex->out_edges.Remove(link);
+              MG_ASSERT(removed, "Invalid database state!");
+              ++vertex->edges_version;
               // Decrement edge count. We only decrement the count here because
               // the information in `REMOVE_IN_EDGE` and `Edge/DELETE_OBJECT` is
               // redundant. Also, `Edge/DELETE_OBJECT` isn't available when edge
@@ -1025,7 +1368,7 @@ void Storage::Accessor::Abort() {
       }
       case PreviousPtr::Type::EDGE: {
         auto edge = prev.edge;
-        std::lock_guard<utils::SpinLock> guard(edge->lock);
+        std::lock_guard<utils::SeqLock> guard(edge->lock);
         Delta *current = edge->delta;
         while (current != nullptr &&
                current->timestamp->load(std::memory_order_acquire) == transaction_.transaction_id) {
@@ -1119,7 +1462,23 @@ EdgeTypeId Storage::NameToEdgeType(const std::string_view &name) {
 
 bool Storage::CreateIndex(LabelId label, const std::optional<uint64_t> desired_commit_timestamp) {
   std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-  if (!indices_.label_index.CreateIndex(label, vertices_.access())) return false;
+  if (UseOnlineIndexBuild(desired_commit_timestamp)) {
+    auto *index = indices_.label_index.StartIndexBuild(label);
+    if (!index) return false;
+    storage_guard.unlock();
+    try {
+      LabelIndex::BuildIndex(index, label, vertices_.access(), config_.schema_creation.num_threads);
+    } catch (...) {
+      storage_guard.lock();
+      indices_.label_index.AbortIndexBuild(label);
+      throw;
+    }
+    // All transactions that start after this point see the complete index.
+    storage_guard.lock();
+    indices_.label_index.FinishIndexBuild(label);
+  } else if (!indices_.label_index.CreateIndex(label, vertices_.access(), config_.schema_creation.num_threads)) {
+    return false;
+  }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
   AppendToWal(durability::StorageGlobalOperation::LABEL_INDEX_CREATE, label, {}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
@@ -1129,7 +1488,23 @@ bool Storage::CreateIndex(LabelId label, const std::optional<uint64_t> desired_c
 
 bool Storage::CreateIndex(LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
   std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-  if (!indices_.label_property_index.CreateIndex(label, property, vertices_.access())) return false;
+  if (UseOnlineIndexBuild(desired_commit_timestamp)) {
+    auto *index = indices_.label_property_index.StartIndexBuild(label, property);
+    if (!index) return false;
+    storage_guard.unlock();
+    try {
+      LabelPropertyIndex::BuildIndex(index, label, property, vertices_.access(), config_.schema_creation.num_threads);
+    } catch (...) {
+      storage_guard.lock();
+      indices_.label_property_index.AbortIndexBuild(label, property);
+      throw;
+    }
+    storage_guard.lock();
+    indices_.label_property_index.FinishIndexBuild(label, property);
+  } else if (!indices_.label_property_index.CreateIndex(label, property, vertices_.access(),
+                                                        config_.schema_creation.num_threads)) {
+    return false;
+  }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
   AppendToWal(durability::StorageGlobalOperation::LABEL_PROPERTY_INDEX_CREATE, label, {property}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
@@ -1159,15 +1534,96 @@ bool Storage::DropIndex(LabelId label, PropertyId property, const std::optional<
   return true;
 }
 
+bool Storage::CreateIndex(EdgeTypeId edge_type, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.edge_type_index.CreateIndex(edge_type, vertices_.access(), config_.schema_creation.num_threads))
+    return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE, edge_type, {}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  return true;
+}
+
+bool Storage::DropIndex(EdgeTypeId edge_type, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.edge_type_index.DropIndex(edge_type)) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::EDGE_TYPE_INDEX_DROP, edge_type, {}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  return true;
+}
+
+Result<bool> Storage::CreateIndex(EdgeTypeId edge_type, PropertyId property,
+                                  const std::optional<uint64_t> desired_commit_timestamp) {
+  if (!config_.items.properties_on_edges) return Error::PROPERTIES_DISABLED;
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.edge_type_property_index.CreateIndex(edge_type, property, vertices_.access(),
+                                                     config_.schema_creation.num_threads))
+    return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE, edge_type, {property},
+              commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  return true;
+}
+
+bool Storage::DropIndex(EdgeTypeId edge_type, PropertyId property,
+                        const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.edge_type_property_index.DropIndex(edge_type, property)) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP, edge_type, {property},
+              commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  return true;
+}
+
+bool Storage::CreateIndex(LabelId label, const std::vector<PropertyId> &properties,
+                          const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.label_property_composite_index.CreateIndex(label, properties, vertices_.access(),
+                                                           config_.schema_creation.num_threads))
+    return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE, label, properties,
+              commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  return true;
+}
+
+bool Storage::DropIndex(LabelId label, const std::vector<PropertyId> &properties,
+                        const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  if (!indices_.label_property_composite_index.DropIndex(label, properties)) return false;
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP, label, properties,
+              commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  last_commit_timestamp_ = commit_timestamp;
+  return true;
+}
+
 IndicesInfo Storage::ListAllIndices() const {
   std::shared_lock<utils::RWLock> storage_guard_(main_lock_);
-  return {indices_.label_index.ListIndices(), indices_.label_property_index.ListIndices()};
+  return {indices_.label_index.ListIndices(),
+          indices_.label_property_index.ListIndices(),
+          indices_.edge_type_index.ListIndices(),
+          indices_.edge_type_property_index.ListIndices(),
+          indices_.label_property_composite_index.ListIndices(),
+          indices_.label_index.ListBuildingIndices(),
+          indices_.label_property_index.ListBuildingIndices()};
 }
 
 utils::BasicResult<ConstraintViolation, bool> Storage::CreateExistenceConstraint(
     LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
   std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-  auto ret = ::storage::CreateExistenceConstraint(&constraints_, label, property, vertices_.access());
+  auto ret = ::storage::CreateExistenceConstraint(&constraints_, label, property, vertices_.access(),
+                                                  config_.schema_creation.num_threads);
   if (ret.HasError() || !ret.GetValue()) return ret;
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
   AppendToWal(durability::StorageGlobalOperation::EXISTENCE_CONSTRAINT_CREATE, label, {property}, commit_timestamp);
@@ -1190,12 +1646,14 @@ bool Storage::DropExistenceConstraint(LabelId label, PropertyId property,
 utils::BasicResult<ConstraintViolation, UniqueConstraints::CreationStatus> Storage::CreateUniqueConstraint(
     LabelId label, const std::set<PropertyId> &properties, const std::optional<uint64_t> desired_commit_timestamp) {
   std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-  auto ret = constraints_.unique_constraints.CreateConstraint(label, properties, vertices_.access());
+  auto ret = constraints_.unique_constraints.CreateConstraint(label, properties, vertices_.access(),
+                                                              config_.schema_creation.num_threads);
   if (ret.HasError() || ret.GetValue() != UniqueConstraints::CreationStatus::SUCCESS) {
     return ret;
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
-  AppendToWal(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE, label, properties, commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE, label,
+              std::vector<PropertyId>(properties.begin(), properties.end()), commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   last_commit_timestamp_ = commit_timestamp;
   return UniqueConstraints::CreationStatus::SUCCESS;
@@ -1209,7 +1667,8 @@ UniqueConstraints::DeletionStatus Storage::DropUniqueConstraint(
     return ret;
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
-  AppendToWal(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP, label, properties, commit_timestamp);
+  AppendToWal(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP, label,
+              std::vector<PropertyId>(properties.begin(), properties.end()), commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   last_commit_timestamp_ = commit_timestamp;
   return UniqueConstraints::DeletionStatus::SUCCESS;
@@ -1223,12 +1682,118 @@ ConstraintsInfo Storage::ListAllConstraints() const {
 StorageInfo Storage::GetInfo() const {
   auto vertex_count = vertices_.size();
   auto edge_count = edge_count_.load(std::memory_order_acquire);
+  const auto wal_group_commit_stats = wal_group_commit_ ? wal_group_commit_->GetStats() : durability::GroupCommitStats{};
   double average_degree = 0.0;
   if (vertex_count) {
     average_degree = 2.0 * static_cast<double>(edge_count) / vertex_count;
   }
-  return {vertex_count, edge_count, average_degree, utils::GetMemoryUsage(),
-          utils::GetDirDiskUsage(config_.durability.storage_directory)};
+  return {vertex_count,
+          edge_count,
+          average_degree,
+          utils::GetMemoryUsage(),
+          utils::GetDirDiskUsage(config_.durability.storage_directory),
+          gc_stats_.runs.load(std::memory_order_acquire),
+          gc_stats_.unlink_deltas_us.load(std::memory_order_acquire),
+          gc_stats_.index_cleanup_us.load(std::memory_order_acquire),
+          gc_stats_.free_objects_us.load(std::memory_order_acquire),
+          wal_group_commit_stats.batches,
+          wal_group_commit_stats.transactions,
+          wal_group_commit_stats.max_batch_size,
+          wal_group_commit_stats.sync_time_us};
+}
+
+StorageMemoryInfo Storage::GetMemoryInfo() const {
+  std::shared_lock<utils::RWLock> storage_guard_(main_lock_);
+  return CollectMemoryInfo();
+}
+
+StorageMemoryInfo Storage::CollectMemoryInfo() const {
+  StorageMemoryInfo info;
+
+  const auto vertex_count = vertices_.size();
+  const auto edge_count = edge_count_.load(std::memory_order_acquire);
+  const auto vertex_size = utils::AverageSkipListNodeSize<Vertex>();
+  const auto edge_size = config_.items.properties_on_edges ? utils::AverageSkipListNodeSize<Edge>() : 0;
+  const auto adjacency_entry_size = sizeof(AdjacencyList::value_type);
+
+  info.vertices = vertex_count * vertex_size;
+  info.edges = edge_count * edge_size;
+  info.deltas = DeltaContainer::AllocatedBytes();
+  info.name_id_mapper = name_id_mapper_.ApproximateMemoryUsage();
+  info.indices = indices_.label_index.ApproximateMemoryUsage() +
+                 indices_.label_property_index.ApproximateMemoryUsage() +
+                 indices_.label_property_composite_index.ApproximateMemoryUsage() +
+                 indices_.edge_type_index.ApproximateMemoryUsage() +
+                 indices_.edge_type_property_index.ApproximateMemoryUsage();
+  if (vertex_lookup_table_) {
+    info.indices += vertex_lookup_table_->MemoryUsage();
+  }
+  info.memory_tracked = static_cast<uint64_t>(std::max<int64_t>(utils::total_memory_tracker.Amount(), 0));
+
+  // The external buffers are sampled. Each edge is counted through the out
+  // edges of its source vertex. The edges are read after the vertex lock is
+  // released because the edge lock is always taken before the vertex locks.
+  uint64_t sampled_vertices = 0;
+  uint64_t labels_bytes = 0;
+  uint64_t properties_bytes = 0;
+  uint64_t adjacency_bytes = 0;
+  std::map<LabelId, uint64_t> per_label;
+  std::map<EdgeTypeId, uint64_t> per_edge_type;
+  std::vector<LabelId> labels;
+  std::vector<std::pair<EdgeTypeId, EdgeRef>> out_edges;
+  auto edges_acc = edges_.access();
+  auto vertices_acc = vertices_.access();
+  for (const auto &[begin, end] : vertices_acc.partition(kMemoryInfoSampleChunks)) {
+    auto it = begin;
+    for (uint64_t i = 0; i < kMemoryInfoSampleChunkSize && it != end; ++i, ++it) {
+      const auto &vertex = *it;
+      uint64_t vertex_bytes = vertex_size;
+      labels.clear();
+      out_edges.clear();
+      {
+        std::lock_guard<utils::SeqLock> guard(vertex.lock);
+        labels_bytes += vertex.labels.ExternalBufferSize();
+        properties_bytes += vertex.properties.ExternalBufferSize();
+        adjacency_bytes += vertex.in_edges.ExternalBufferSize() + vertex.out_edges.ExternalBufferSize();
+        vertex_bytes += vertex.labels.ExternalBufferSize() + vertex.properties.ExternalBufferSize() +
+                        vertex.in_edges.ExternalBufferSize() + vertex.out_edges.ExternalBufferSize();
+        labels.assign(vertex.labels.begin(), vertex.labels.end());
+        for (const auto &[edge_type, to_vertex, edge] : vertex.out_edges) {
+          out_edges.emplace_back(edge_type, edge);
+        }
+      }
+      for (const auto label : labels) {
+        per_label[label] += vertex_bytes;
+      }
+      for (const auto &[edge_type, edge] : out_edges) {
+        uint64_t edge_bytes = 2 * adjacency_entry_size;
+        if (config_.items.properties_on_edges) {
+          std::lock_guard<utils::SeqLock> guard(edge.ptr->lock);
+          const auto edge_properties_bytes = edge.ptr->properties.ExternalBufferSize();
+          properties_bytes += edge_properties_bytes;
+          edge_bytes += edge_size + edge_properties_bytes;
+        }
+        per_edge_type[edge_type] += edge_bytes;
+      }
+      ++sampled_vertices;
+    }
+  }
+
+  if (sampled_vertices == 0) return info;
+  const auto scale = static_cast<double>(vertex_count) / static_cast<double>(sampled_vertices);
+  const auto extrapolate = [scale](uint64_t bytes) {
+    return static_cast<uint64_t>(static_cast<double>(bytes) * scale);
+  };
+  info.labels = extrapolate(labels_bytes);
+  info.properties = extrapolate(properties_bytes);
+  info.adjacency_lists = extrapolate(adjacency_bytes);
+  for (const auto &[label, bytes] : per_label) {
+    info.per_label.emplace(label, extrapolate(bytes));
+  }
+  for (const auto &[edge_type, bytes] : per_edge_type) {
+    info.per_edge_type.emplace(edge_type, extrapolate(bytes));
+  }
+  return info;
 }
 
 VerticesIterable Storage::Accessor::Vertices(LabelId label, View view) {
@@ -1253,6 +1818,37 @@ VerticesIterable Storage::Accessor::Vertices(LabelId label, PropertyId property,
       storage_->indices_.label_property_index.Vertices(label, property, lower_bound, upper_bound, view, &transaction_));
 }
 
+VerticesIterable Storage::Accessor::Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                                             const std::vector<PropertyValue> &prefix,
+                                             const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  return VerticesIterable(storage_->indices_.label_property_composite_index.Vertices(
+      label, properties, prefix, lower_bound, upper_bound, view, &transaction_));
+}
+
+IndexedEdgesIterable Storage::Accessor::Edges(EdgeTypeId edge_type, View view) {
+  return IndexedEdgesIterable(storage_->indices_.edge_type_index.Edges(edge_type, view, &transaction_));
+}
+
+IndexedEdgesIterable Storage::Accessor::Edges(EdgeTypeId edge_type, PropertyId property, View view) {
+  return IndexedEdgesIterable(storage_->indices_.edge_type_property_index.Edges(edge_type, property, std::nullopt,
+                                                                         std::nullopt, view, &transaction_));
+}
+
+IndexedEdgesIterable Storage::Accessor::Edges(EdgeTypeId edge_type, PropertyId property,
+                                              const PropertyValue &value, View view) {
+  return IndexedEdgesIterable(storage_->indices_.edge_type_property_index.Edges(
+      edge_type, property, utils::MakeBoundInclusive(value), utils::MakeBoundInclusive(value), view, &transaction_));
+}
+
+IndexedEdgesIterable Storage::Accessor::Edges(EdgeTypeId edge_type, PropertyId property,
+                                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                              const std::optional<utils::Bound<PropertyValue>> &upper_bound,
+                                              View view) {
+  return IndexedEdgesIterable(storage_->indices_.edge_type_property_index.Edges(edge_type, property, lower_bound,
+                                                                         upper_bound, view, &transaction_));
+}
+
 Transaction Storage::CreateTransaction(IsolationLevel isolation_level) {
   // We acquire the transaction engine lock here because we access (and
   // modify) the transaction engine variables (`transaction_id` and
@@ -1260,7 +1856,7 @@ Transaction Storage::CreateTransaction(IsolationLevel isolation_level) {
   uint64_t transaction_id;
   uint64_t start_timestamp;
   {
-    std::lock_guard<utils::SpinLock> guard(engine_lock_);
+    std::unique_lock<utils::SpinLock> guard(engine_lock_);
     transaction_id = transaction_id_++;
     // Replica should have only read queries and the write queries
     // can come from main instance with any past timestamp.
@@ -1271,12 +1867,191 @@ Transaction Storage::CreateTransaction(IsolationLevel isolation_level) {
     if (replication_role_ == ReplicationRole::REPLICA) {
       start_timestamp = timestamp_;
     } else {
+      // With the group commit, a transaction doesn't start before the commits
+      // it would see are synced, so it can't read or build on a commit that
+      // would be lost in a crash.
+      while (unsynced_commit_timestamp_ &&
+             *unsynced_commit_timestamp_ >= visible_timestamp_.load(std::memory_order_acquire)) {
+        const auto commit_timestamp = *unsynced_commit_timestamp_;
+        const auto wal_position = unsynced_wal_position_;
+        guard.unlock();
+        WaitForWalSync(wal_position);
+        AdvanceVisibleTimestamp(commit_timestamp + 1);
+        guard.lock();
+      }
       start_timestamp = timestamp_++;
     }
   }
-  return {transaction_id, start_timestamp, isolation_level};
+  return {transaction_id, start_timestamp, isolation_level, storage_mode_};
+}
+
+Transaction Storage::CreateReadOnlyTransaction(IsolationLevel isolation_level, uint64_t *slot) {
+  // Read-only transactions don't allocate a timestamp. They start at the
+  // current value of `visible_timestamp_`, which sees all published commits,
+  // and register it in `read_only_transactions_` so that the GC keeps the
+  // deltas they need. `timestamp_` can't be used because a commit takes its
+  // timestamp before the commit is published, so the transaction would see the
+  // commit only after it is published. A transaction could commit before the
+  // timestamp is registered and the GC could then free deltas that are still
+  // needed, so the timestamp is checked again after it is registered. The
+  // fence orders the registration before the check, the GC has the matching
+  // fence.
+  uint64_t start_timestamp = visible_timestamp_.load(std::memory_order_acquire);
+  while (true) {
+    *slot = RegisterReadOnlyTransaction(start_timestamp);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const uint64_t current_timestamp = visible_timestamp_.load(std::memory_order_acquire);
+    if (current_timestamp == start_timestamp) break;
+    FinishReadOnlyTransaction(*slot, start_timestamp);
+    start_timestamp = current_timestamp;
+  }
+  return {kReadOnlyTransactionId, start_timestamp, isolation_level};
+}
+
+uint64_t Storage::RegisterReadOnlyTransaction(uint64_t start_timestamp) {
+  static std::atomic<uint64_t> next_first_slot{0};
+  static thread_local const uint64_t first_slot = next_first_slot.fetch_add(1, std::memory_order_relaxed);
+  for (uint64_t i = 0; i < kReadOnlyTransactionSlots; ++i) {
+    const uint64_t slot = (first_slot + i) % kReadOnlyTransactionSlots;
+    auto &slot_start_timestamp = read_only_transactions_[slot].start_timestamp;
+    // The slot is checked first so that the used slots aren't written to.
+    uint64_t expected = slot_start_timestamp.load(std::memory_order_relaxed);
+    if (expected != kFreeReadOnlyTransactionSlot) continue;
+    if (slot_start_timestamp.compare_exchange_strong(expected, start_timestamp)) return slot;
+  }
+  read_only_transactions_overflow_.WithLock(
+      [&](auto &read_only_transactions) { ++read_only_transactions[start_timestamp]; });
+  return kReadOnlyTransactionSlots;
+}
+
+void Storage::FinishReadOnlyTransaction(uint64_t slot, uint64_t start_timestamp) {
+  if (slot < kReadOnlyTransactionSlots) {
+    MG_ASSERT(read_only_transactions_[slot].start_timestamp.load(std::memory_order_relaxed) == start_timestamp,
+              "Invalid database state!");
+    read_only_transactions_[slot].start_timestamp.store(kFreeReadOnlyTransactionSlot, std::memory_order_release);
+    return;
+  }
+  read_only_transactions_overflow_.WithLock([&](auto &read_only_transactions) {
+    auto it = read_only_transactions.find(start_timestamp);
+    MG_ASSERT(it != read_only_transactions.end(), "Invalid database state!");
+    if (--it->second == 0) {
+      read_only_transactions.erase(it);
+    }
+  });
 }
 
+namespace {
+// Number of vertices or edges that are removed from the main storage by a
+// single GC task.
+constexpr uint64_t kGcObjectsChunkSize = 4096;
+
+// When unlinking a delta which is the first delta in its version chain,
+// special care has to be taken to avoid the following race condition:
+//
+// [Vertex] --> [Delta A]
+//
+//    GC thread: Delta A is the first in its chain, it must be unlinked from
+//               vertex and marked for deletion
+//    TX thread: Update vertex and add Delta B with Delta A as next
+//
+// [Vertex] --> [Delta B] <--> [Delta A]
+//
+//    GC thread: Unlink delta from Vertex
+//
+// [Vertex] --> (nullptr)
+//
+// When processing a delta that is the first one in its chain, we
+// obtain the corresponding vertex or edge lock, and then verify that this
+// delta still is the first in its chain.
+// When processing a delta that is in the middle of the chain we only
+// process the final delta of the given transaction in that chain. We
+// determine the owner of the chain (either a vertex or an edge), obtain the
+// corresponding lock, and then verify that this delta is still in the same
+// position as it was before taking the lock.
+//
+// Even though the delta chain is lock-free (both `next` and `prev`) the
+// chain should not be modified without taking the lock from the object that
+// owns the chain (either a vertex or an edge). Modifying the chain without
+// taking the lock will cause subtle race conditions that will leave the
+// chain in a broken state.
+// The chain can be only read without taking any locks.
+//
+// Deleted vertices and edges whose version chains became empty are appended
+// to `deleted_vertices` and `deleted_edges`.
+void UnlinkDelta(Delta *delta, uint64_t commit_timestamp, std::list<Gid> *deleted_vertices,
+                 std::list<Gid> *deleted_edges) {
+  while (true) {
+    auto prev = delta->prev.Get();
+    switch (prev.type) {
+      case PreviousPtr::Type::VERTEX: {
+        Vertex *vertex = prev.vertex;
+        std::lock_guard<utils::SeqLock> vertex_guard(vertex->lock);
+        if (vertex->delta != delta) {
+          // Something changed, we're not the first delta in the chain
+          // anymore.
+          continue;
+        }
+        vertex->delta = nullptr;
+        if (vertex->deleted) {
+          deleted_vertices->push_back(vertex->gid);
+        }
+        break;
+      }
+      case PreviousPtr::Type::EDGE: {
+        Edge *edge = prev.edge;
+        std::lock_guard<utils::SeqLock> edge_guard(edge->lock);
+        if (edge->delta != delta) {
+          // Something changed, we're not the first delta in the chain
+          // anymore.
+          continue;
+        }
+        edge->delta = nullptr;
+        if (edge->deleted) {
+          deleted_edges->push_back(edge->gid);
+        }
+        break;
+      }
+      case PreviousPtr::Type::DELTA: {
+        if (prev.delta->timestamp->load(std::memory_order_acquire) == commit_timestamp) {
+          // The delta that is newer than this one is also a delta from this
+          // transaction. We skip the current delta and will remove it as a
+          // part of the suffix later.
+          break;
+        }
+        std::unique_lock<utils::SeqLock> guard;
+        {
+          // We need to find the parent object in order to be able to use
+          // its lock.
+          auto parent = prev;
+          while (parent.type == PreviousPtr::Type::DELTA) {
+            parent = parent.delta->prev.Get();
+          }
+          switch (parent.type) {
+            case PreviousPtr::Type::VERTEX:
+              guard = std::unique_lock<utils::SeqLock>(parent.vertex->lock);
+              break;
+            case PreviousPtr::Type::EDGE:
+              guard = std::unique_lock<utils::SeqLock>(parent.edge->lock);
+              break;
+            case PreviousPtr::Type::DELTA:
+              LOG_FATAL("Invalid database state!");
+          }
+        }
+        if (delta->prev.Get() != prev) {
+          // Something changed, we could now be the first delta in the
+          // chain.
+          continue;
+        }
+        Delta *prev_delta = prev.delta;
+        prev_delta->next.store(nullptr, std::memory_order_release);
+        break;
+      }
+    }
+    break;
+  }
+}
+}  // namespace
+
 template <bool force>
 void Storage::CollectGarbage() {
   if constexpr (force) {
@@ -1313,11 +2088,33 @@ void Storage::CollectGarbage() {
     return;
   }
 
+  gc_stats_.runs.fetch_add(1, std::memory_order_acq_rel);
+
   uint64_t oldest_active_start_timestamp = commit_log_->OldestActive();
+  // The commit log must be checked before the read-only transactions, see
+  // `CreateReadOnlyTransaction`.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  uint64_t read_only_start_timestamp = kFreeReadOnlyTransactionSlot;
+  for (const auto &slot : read_only_transactions_) {
+    read_only_start_timestamp =
+        std::min(read_only_start_timestamp, slot.start_timestamp.load(std::memory_order_acquire));
+  }
+  read_only_transactions_overflow_.WithLock([&](auto &read_only_transactions) {
+    if (read_only_transactions.empty()) return;
+    read_only_start_timestamp = std::min(read_only_start_timestamp, read_only_transactions.begin()->first);
+  });
+  if (read_only_start_timestamp != kFreeReadOnlyTransactionSlot) {
+    // A read-only transaction could have started before the objects that were
+    // marked with its start timestamp were unlinked, because it didn't
+    // allocate the timestamp. That's why it is treated as if it started one
+    // timestamp earlier.
+    oldest_active_start_timestamp =
+        std::min(oldest_active_start_timestamp, read_only_start_timestamp > 0 ? read_only_start_timestamp - 1 : 0);
+  }
   // We don't move undo buffers of unlinked transactions to garbage_undo_buffers
   // list immediately, because we would have to repeatedly take
   // garbage_undo_buffers lock.
-  std::list<std::pair<uint64_t, std::list<Delta>>> unlinked_undo_buffers;
+  std::list<std::pair<uint64_t, DeltaContainer>> unlinked_undo_buffers;
 
   // We will only free vertices deleted up until now in this GC cycle, and we
   // will do it after cleaning-up the indices. That way we are sure that all
@@ -1333,141 +2130,83 @@ void Storage::CollectGarbage() {
   // eliminates high CPU usage when the GC doesn't have to clean up anything.
   bool run_index_cleanup = !committed_transactions_->empty() || !garbage_undo_buffers_->empty();
 
-  while (true) {
+  {
+    utils::Timer timer;
     // We don't want to hold the lock on commited transactions for too long,
-    // because that prevents other transactions from committing.
-    Transaction *transaction;
-    {
-      auto committed_transactions_ptr = committed_transactions_.Lock();
-      if (committed_transactions_ptr->empty()) {
-        break;
+    // because that prevents other transactions from committing. We only
+    // collect the transactions whose deltas can be unlinked while holding the
+    // lock. Only the GC removes transactions from the list, so the collected
+    // transactions stay valid after the lock is released.
+    std::vector<Transaction *> transactions;
+    committed_transactions_.WithLock([&](auto &committed_transactions) {
+      for (auto &transaction : committed_transactions) {
+        if (transaction.commit_timestamp->load(std::memory_order_acquire) >= oldest_active_start_timestamp) {
+          break;
+        }
+        transactions.push_back(&transaction);
       }
-      transaction = &committed_transactions_ptr->front();
-    }
+    });
 
-    auto commit_timestamp = transaction->commit_timestamp->load(std::memory_order_acquire);
-    if (commit_timestamp >= oldest_active_start_timestamp) {
-      break;
+    // Each memory block of an undo buffer is unlinked as a separate unit of
+    // work so that even a single large transaction is unlinked in parallel.
+    struct DeltaBlock {
+      Delta *deltas;
+      uint64_t count;
+      uint64_t commit_timestamp;
+    };
+    std::vector<DeltaBlock> delta_blocks;
+    for (auto *transaction : transactions) {
+      auto commit_timestamp = transaction->commit_timestamp->load(std::memory_order_acquire);
+      transaction->deltas.ForEachBlock([&](Delta *deltas, uint64_t count) {
+        delta_blocks.push_back({deltas, count, commit_timestamp});
+      });
     }
 
-    // When unlinking a delta which is the first delta in its version chain,
-    // special care has to be taken to avoid the following race condition:
-    //
-    // [Vertex] --> [Delta A]
-    //
-    //    GC thread: Delta A is the first in its chain, it must be unlinked from
-    //               vertex and marked for deletion
-    //    TX thread: Update vertex and add Delta B with Delta A as next
-    //
-    // [Vertex] --> [Delta B] <--> [Delta A]
-    //
-    //    GC thread: Unlink delta from Vertex
-    //
-    // [Vertex] --> (nullptr)
-    //
-    // When processing a delta that is the first one in its chain, we
-    // obtain the corresponding vertex or edge lock, and then verify that this
-    // delta still is the first in its chain.
-    // When processing a delta that is in the middle of the chain we only
-    // process the final delta of the given transaction in that chain. We
-    // determine the owner of the chain (either a vertex or an edge), obtain the
-    // corresponding lock, and then verify that this delta is still in the same
-    // position as it was before taking the lock.
-    //
-    // Even though the delta chain is lock-free (both `next` and `prev`) the
-    // chain should not be modified without taking the lock from the object that
-    // owns the chain (either a vertex or an edge). Modifying the chain without
-    // taking the lock will cause subtle race conditions that will leave the
-    // chain in a broken state.
-    // The chain can be only read without taking any locks.
-
-    for (Delta &delta : transaction->deltas) {
-      while (true) {
-        auto prev = delta.prev.Get();
-        switch (prev.type) {
-          case PreviousPtr::Type::VERTEX: {
-            Vertex *vertex = prev.vertex;
-            std::lock_guard<utils::SpinLock> vertex_guard(vertex->lock);
-            if (vertex->delta != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            vertex->delta = nullptr;
-            if (vertex->deleted) {
-              current_deleted_vertices.push_back(vertex->gid);
-            }
-            break;
-          }
-          case PreviousPtr::Type::EDGE: {
-            Edge *edge = prev.edge;
-            std::lock_guard<utils::SpinLock> edge_guard(edge->lock);
-            if (edge->delta != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            edge->delta = nullptr;
-            if (edge->deleted) {
-              current_deleted_edges.push_back(edge->gid);
-            }
-            break;
-          }
-          case PreviousPtr::Type::DELTA: {
-            if (prev.delta->timestamp->load(std::memory_order_acquire) == commit_timestamp) {
-              // The delta that is newer than this one is also a delta from this
-              // transaction. We skip the current delta and will remove it as a
-              // part of the suffix later.
-              break;
-            }
-            std::unique_lock<utils::SpinLock> guard;
-            {
-              // We need to find the parent object in order to be able to use
-              // its lock.
-              auto parent = prev;
-              while (parent.type == PreviousPtr::Type::DELTA) {
-                parent = parent.delta->prev.Get();
-              }
-              switch (parent.type) {
-                case PreviousPtr::Type::VERTEX:
-                  guard = std::unique_lock<utils::SpinLock>(parent.vertex->lock);
-                  break;
-                case PreviousPtr::Type::EDGE:
-                  guard = std::unique_lock<utils::SpinLock>(parent.edge->lock);
-                  break;
-                case PreviousPtr::Type::DELTA:
-                  LOG_FATAL("Invalid database state!");
-              }
-            }
-            if (delta.prev.Get() != prev) {
-              // Something changed, we could now be the first delta in the
-              // chain.
-              continue;
-            }
-            Delta *prev_delta = prev.delta;
-            prev_delta->next.store(nullptr, std::memory_order_release);
-            break;
-          }
+    utils::SpinLock deleted_lock;
+    RunGcInParallel(delta_blocks.size(), 1, [&](uint64_t begin, uint64_t end) {
+      std::list<Gid> deleted_vertices;
+      std::list<Gid> deleted_edges;
+      for (uint64_t i = begin; i < end; ++i) {
+        const auto &block = delta_blocks[i];
+        for (uint64_t j = 0; j < block.count; ++j) {
+          UnlinkDelta(&block.deltas[j], block.commit_timestamp, &deleted_vertices, &deleted_edges);
         }
-        break;
       }
-    }
+      std::lock_guard<utils::SpinLock> guard(deleted_lock);
+      current_deleted_vertices.splice(current_deleted_vertices.end(), deleted_vertices);
+      current_deleted_edges.splice(current_deleted_edges.end(), deleted_edges);
+    });
 
     committed_transactions_.WithLock([&](auto &committed_transactions) {
-      unlinked_undo_buffers.emplace_back(0, std::move(transaction->deltas));
-      committed_transactions.pop_front();
+      for (uint64_t i = 0; i < transactions.size(); ++i) {
+        unlinked_undo_buffers.emplace_back(0, std::move(committed_transactions.front().deltas));
+        committed_transactions.pop_front();
+      }
     });
+    gc_stats_.unlink_deltas_us.fetch_add(timer.Elapsed<std::chrono::microseconds>().count(),
+                                         std::memory_order_acq_rel);
   }
 
   // After unlinking deltas from vertices, we refresh the indices. That way
   // we're sure that none of the vertices from `current_deleted_vertices`
   // appears in an index, and we can safely remove the from the main storage
-  // after the last currently active transaction is finished.
-  if (run_index_cleanup) {
+  // after the last currently active transaction is finished. The same holds
+  // for the edges from `current_deleted_edges` and the edge type index.
+  if (run_index_cleanup || !current_deleted_vertices.empty() || !current_deleted_edges.empty()) {
+    utils::Timer timer;
     // This operation is very expensive as it traverses through all of the items
-    // in every index every time.
-    RemoveObsoleteEntries(&indices_, oldest_active_start_timestamp);
-    constraints_.unique_constraints.RemoveObsoleteEntries(oldest_active_start_timestamp);
+    // in every index every time. The indices and the unique constraints are
+    // independent of each other, so they are cleaned up in parallel.
+    auto cleanups = ObsoleteEntriesCleanups(&indices_, oldest_active_start_timestamp);
+    cleanups.emplace_back(
+        [&] { constraints_.unique_constraints.RemoveObsoleteEntries(oldest_active_start_timestamp); });
+    RunGcInParallel(cleanups.size(), 1, [&](uint64_t begin, uint64_t end) {
+      for (uint64_t i = begin; i < end; ++i) {
+        cleanups[i]();
+      }
+    });
+    gc_stats_.index_cleanup_us.fetch_add(timer.Elapsed<std::chrono::microseconds>().count(),
+                                         std::memory_order_acq_rel);
   }
 
   {
@@ -1490,42 +2229,104 @@ void Storage::CollectGarbage() {
     for (auto vertex : current_deleted_vertices) {
       garbage_vertices_.emplace_back(mark_timestamp, vertex);
     }
+    for (auto edge : current_deleted_edges) {
+      garbage_edges_.emplace_back(mark_timestamp, edge);
+    }
   }
 
+  utils::Timer free_timer;
+
+  // The undo buffers are taken out of the list while holding the lock and are
+  // freed after the lock is released.
+  std::list<std::pair<uint64_t, DeltaContainer>> freeable_undo_buffers;
   garbage_undo_buffers_.WithLock([&](auto &undo_buffers) {
     // if force is set to true we can simply delete all the leftover undos because
     // no transaction is active
-    if constexpr (force) {
-      undo_buffers.clear();
-    } else {
-      while (!undo_buffers.empty() && undo_buffers.front().first <= oldest_active_start_timestamp) {
-        undo_buffers.pop_front();
-      }
+    auto it = undo_buffers.begin();
+    while (it != undo_buffers.end() && (force || it->first <= oldest_active_start_timestamp)) {
+      ++it;
+    }
+    freeable_undo_buffers.splice(freeable_undo_buffers.end(), undo_buffers, undo_buffers.begin(), it);
+  });
+  std::vector<DeltaContainer *> undo_buffers_to_free;
+  undo_buffers_to_free.reserve(freeable_undo_buffers.size());
+  for (auto &[timestamp, undo_buffer] : freeable_undo_buffers) {
+    undo_buffers_to_free.push_back(&undo_buffer);
+  }
+  RunGcInParallel(undo_buffers_to_free.size(), 1, [&](uint64_t begin, uint64_t end) {
+    for (uint64_t i = begin; i < end; ++i) {
+      undo_buffers_to_free[i]->clear();
     }
   });
+  freeable_undo_buffers.clear();
 
-  {
+  // if force is set to true, then we have unique_lock and no transactions are
+  // active so we can clean all of the deleted vertices and edges
+  std::vector<Gid> vertices_to_remove;
+  while (!garbage_vertices_.empty() && (force || garbage_vertices_.front().first < oldest_active_start_timestamp)) {
+    vertices_to_remove.push_back(garbage_vertices_.front().second);
+    garbage_vertices_.pop_front();
+  }
+  RunGcInParallel(vertices_to_remove.size(), kGcObjectsChunkSize, [&](uint64_t begin, uint64_t end) {
     auto vertex_acc = vertices_.access();
-    if constexpr (force) {
-      // if force is set to true, then we have unique_lock and no transactions are active
-      // so we can clean all of the deleted vertices
-      while (!garbage_vertices_.empty()) {
-        MG_ASSERT(vertex_acc.remove(garbage_vertices_.front().second), "Invalid database state!");
-        garbage_vertices_.pop_front();
-      }
-    } else {
-      while (!garbage_vertices_.empty() && garbage_vertices_.front().first < oldest_active_start_timestamp) {
-        MG_ASSERT(vertex_acc.remove(garbage_vertices_.front().second), "Invalid database state!");
-        garbage_vertices_.pop_front();
-      }
+    for (uint64_t i = begin; i < end; ++i) {
+      if (vertex_lookup_table_) vertex_lookup_table_->Remove(vertices_to_remove[i]);
+      MG_ASSERT(vertex_acc.remove(vertices_to_remove[i]), "Invalid database state!");
     }
+  });
+
+  std::vector<Gid> edges_to_remove;
+  while (!garbage_edges_.empty() && (force || garbage_edges_.front().first < oldest_active_start_timestamp)) {
+    edges_to_remove.push_back(garbage_edges_.front().second);
+    garbage_edges_.pop_front();
   }
-  {
+  RunGcInParallel(edges_to_remove.size(), kGcObjectsChunkSize, [&](uint64_t begin, uint64_t end) {
     auto edge_acc = edges_.access();
-    for (auto edge : current_deleted_edges) {
-      MG_ASSERT(edge_acc.remove(edge), "Invalid database state!");
+    for (uint64_t i = begin; i < end; ++i) {
+      MG_ASSERT(edge_acc.remove(edges_to_remove[i]), "Invalid database state!");
     }
+  });
+
+  gc_stats_.free_objects_us.fetch_add(free_timer.Elapsed<std::chrono::microseconds>().count(),
+                                      std::memory_order_acq_rel);
+}
+
+void Storage::RunGcInParallel(uint64_t size, uint64_t chunk_size,
+                              const std::function<void(uint64_t, uint64_t)> &func) {
+  const uint64_t chunks = (size + chunk_size - 1) / chunk_size;
+  if (!gc_thread_pool_ || chunks <= 1) {
+    if (size > 0) func(0, size);
+    return;
   }
+
+  // The chunks are taken one by one by all threads, so that the threads that
+  // get cheaper chunks don't end up waiting for the others.
+  std::atomic<uint64_t> next_chunk{0};
+  auto process_chunks = [&] {
+    while (true) {
+      const auto chunk = next_chunk.fetch_add(1, std::memory_order_acq_rel);
+      if (chunk >= chunks) break;
+      func(chunk * chunk_size, std::min(size, (chunk + 1) * chunk_size));
+    }
+  };
+
+  const uint64_t workers = std::min(config_.gc.num_threads - 1, chunks - 1);
+  std::mutex finished_lock;
+  std::condition_variable finished_cv;
+  uint64_t finished = 0;
+  for (uint64_t i = 0; i < workers; ++i) {
+    gc_thread_pool_->AddTask([&] {
+      process_chunks();
+      // Notify while holding the lock because the condition variable is
+      // destroyed as soon as the waiting thread sees that all workers finished.
+      std::lock_guard<std::mutex> guard(finished_lock);
+      ++finished;
+      finished_cv.notify_one();
+    });
+  }
+  process_chunks();
+  std::unique_lock<std::mutex> guard(finished_lock);
+  finished_cv.wait(guard, [&] { return finished == workers; });
 }
 
 // tell the linker he can find the CollectGarbage definitions here
@@ -1536,15 +2337,18 @@ bool Storage::InitializeWalFile() {
   if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL)
     return false;
   if (!wal_file_) {
-    wal_file_.emplace(wal_directory_, uuid_, epoch_id_, config_.items, &name_id_mapper_, wal_seq_num_++,
-                      &file_retainer_);
+    wal_file_.emplace(wal_directory_, uuid_, epoch_id_, config_.items, config_.durability.compression,
+                      &name_id_mapper_, wal_seq_num_++, &file_retainer_);
   }
   return true;
 }
 
 void Storage::FinalizeWalFile() {
+  ++wal_written_transactions_;
   ++wal_unsynced_transactions_;
-  if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
+  // With the group commit the WAL is synced by its own thread.
+  if ((!wal_group_commit_ || replication_role_.load() != ReplicationRole::MAIN) &&
+      wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
     wal_file_->Sync();
     wal_unsynced_transactions_ = 0;
   }
@@ -1561,6 +2365,25 @@ void Storage::FinalizeWalFile() {
   }
 }
 
+bool Storage::IsWalGroupCommitUsed() const {
+  // Replicas write the WAL in the replication handlers which don't
+  // synchronize with the group commit thread.
+  return wal_group_commit_ && replication_role_.load() == ReplicationRole::MAIN;
+}
+
+void Storage::WaitForWalSync(uint64_t wal_position) {
+  if (!IsWalGroupCommitUsed()) return;
+  wal_group_commit_->WaitForSync(wal_position);
+}
+
+void Storage::AdvanceVisibleTimestamp(uint64_t timestamp) {
+  auto visible_timestamp = visible_timestamp_.load(std::memory_order_relaxed);
+  while (visible_timestamp < timestamp &&
+         !visible_timestamp_.compare_exchange_weak(visible_timestamp, timestamp, std::memory_order_release,
+                                                   std::memory_order_relaxed)) {
+  }
+}
+
 void Storage::AppendToWal(const Transaction &transaction, uint64_t final_commit_timestamp) {
   if (!InitializeWalFile()) return;
   // Traverse deltas and append them to the WAL file.
@@ -1734,7 +2557,11 @@ void Storage::AppendToWal(const Transaction &transaction, uint64_t final_commit_
 }
 
 void Storage::AppendToWal(durability::StorageGlobalOperation operation, LabelId label,
-                          const std::set<PropertyId> &properties, uint64_t final_commit_timestamp) {
+                          const std::vector<PropertyId> &properties, uint64_t final_commit_timestamp) {
+  // The operations are written while holding the unique storage lock, but the
+  // engine lock is needed as well because the group commit syncs the WAL
+  // file while holding only the engine lock.
+  std::unique_lock<utils::SpinLock> engine_guard(engine_lock_);
   if (!InitializeWalFile()) return;
   wal_file_->AppendOperation(operation, label, properties, final_commit_timestamp);
   {
@@ -1750,6 +2577,32 @@ void Storage::AppendToWal(durability::StorageGlobalOperation operation, LabelId
     }
   }
   FinalizeWalFile();
+  const uint64_t wal_position = wal_written_transactions_;
+  engine_guard.unlock();
+  WaitForWalSync(wal_position);
+}
+
+void Storage::AppendToWal(durability::StorageGlobalOperation operation, EdgeTypeId edge_type,
+                          const std::set<PropertyId> &properties, uint64_t final_commit_timestamp) {
+  std::unique_lock<utils::SpinLock> engine_guard(engine_lock_);
+  if (!InitializeWalFile()) return;
+  wal_file_->AppendOperation(operation, edge_type, properties, final_commit_timestamp);
+  {
+    if (replication_role_.load() == ReplicationRole::MAIN) {
+      replication_clients_.WithLock([&](auto &clients) {
+        for (auto &client : clients) {
+          client->StartTransactionReplication(wal_file_->SequenceNumber());
+          client->IfStreamingTransaction(
+              [&](auto &stream) { stream.AppendOperation(operation, edge_type, properties, final_commit_timestamp); });
+          client->FinalizeTransactionReplication();
+        }
+      });
+    }
+  }
+  FinalizeWalFile();
+  const uint64_t wal_position = wal_written_transactions_;
+  engine_guard.unlock();
+  WaitForWalSync(wal_position);
 }
 
 utils::BasicResult<Storage::CreateSnapshotError> Storage::CreateSnapshot() {
@@ -1762,18 +2615,93 @@ utils::BasicResult<Storage::CreateSnapshotError> Storage::CreateSnapshot() {
   // Take master RW lock (for reading).
   std::shared_lock<utils::RWLock> storage_guard(main_lock_);
 
-  // Create the transaction used to create the snapshot.
-  auto transaction = CreateTransaction(IsolationLevel::SNAPSHOT_ISOLATION);
+  CreateSnapshotLocked();
+  return {};
+}
+
+void Storage::CreateSnapshotLocked() {
+  // Create the transaction used to create the snapshot. The modified objects
+  // are taken at the same time so that the snapshot sees all of them and none
+  // of the later ones.
+  std::optional<Transaction> transaction;
+  std::optional<durability::SnapshotChanges> changes;
+  std::vector<ModifiedObjects> modified_objects;
+  {
+    std::lock_guard<utils::SpinLock> guard(engine_lock_);
+    transaction.emplace(transaction_id_++, timestamp_++, IsolationLevel::SNAPSHOT_ISOLATION, storage_mode_);
+    modified_objects.swap(modified_objects_);
+    if (snapshot_chain_ && snapshot_chain_->incremental_count < config_.durability.snapshot_incremental_count) {
+      changes.emplace(durability::SnapshotChanges{.base_start_timestamp = snapshot_chain_->base_start_timestamp,
+                                                  .previous_start_timestamp = snapshot_chain_->previous_start_timestamp,
+                                                  .vertices = {},
+                                                  .edges = {}});
+      snapshot_chain_->previous_start_timestamp = transaction->start_timestamp;
+      ++snapshot_chain_->incremental_count;
+    } else if (config_.durability.snapshot_incremental_count > 0 &&
+               storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL) {
+      // The changes done in the analytical mode aren't tracked, so the chain
+      // can be started only in the transactional mode.
+      snapshot_chain_ = SnapshotChain{.base_start_timestamp = transaction->start_timestamp,
+                                      .previous_start_timestamp = transaction->start_timestamp,
+                                      .incremental_count = 0};
+    }
+  }
+  if (changes) {
+    for (const auto &objects : modified_objects) {
+      changes->vertices.insert(changes->vertices.end(), objects.vertices.begin(), objects.vertices.end());
+      changes->edges.insert(changes->edges.end(), objects.edges.begin(), objects.edges.end());
+    }
+    for (auto *gids : {&changes->vertices, &changes->edges}) {
+      std::sort(gids->begin(), gids->end());
+      gids->erase(std::unique(gids->begin(), gids->end()), gids->end());
+    }
+  }
 
   // Create snapshot.
-  durability::CreateSnapshot(&transaction, snapshot_directory_, wal_directory_,
-                             config_.durability.snapshot_retention_count, &vertices_, &edges_, &name_id_mapper_,
-                             &indices_, &constraints_, config_.items, uuid_, epoch_id_, epoch_history_,
-                             &file_retainer_);
+  durability::CreateSnapshot(&*transaction, snapshot_directory_, wal_directory_,
+                             config_.durability.snapshot_retention_count, config_.durability.snapshot_thread_count,
+                             config_.durability.compression, changes ? &*changes : nullptr, &vertices_, &edges_,
+                             &name_id_mapper_, &indices_, &constraints_, config_.items, uuid_, epoch_id_,
+                             epoch_history_, &file_retainer_);
 
   // Finalize snapshot transaction.
-  commit_log_->MarkFinished(transaction.start_timestamp);
-  return {};
+  commit_log_->MarkFinished(transaction->start_timestamp);
+}
+
+std::optional<Storage::ModifiedObjects> Storage::CollectModifiedObjects(const Transaction &transaction) const {
+  // The snapshot chain is started only if incremental snapshots are enabled.
+  if (config_.durability.snapshot_incremental_count == 0) return std::nullopt;
+  ModifiedObjects objects;
+  for (const auto &delta : transaction.deltas) {
+    auto prev = delta.prev.Get();
+    switch (prev.type) {
+      case PreviousPtr::Type::VERTEX:
+        objects.vertices.push_back(prev.vertex->gid);
+        break;
+      case PreviousPtr::Type::EDGE:
+        objects.edges.push_back(prev.edge->gid);
+        break;
+      case PreviousPtr::Type::DELTA:
+        break;
+    }
+  }
+  // An object usually has several deltas, they are removed here so that the
+  // snapshot has fewer duplicates to remove.
+  for (auto *gids : {&objects.vertices, &objects.edges}) {
+    std::sort(gids->begin(), gids->end());
+    gids->erase(std::unique(gids->begin(), gids->end()), gids->end());
+  }
+  return objects;
+}
+
+void Storage::TrackModifiedObjects(ModifiedObjects &&objects) {
+  if (!snapshot_chain_) return;
+  modified_objects_.push_back(std::move(objects));
+}
+
+void Storage::ResetSnapshotChain() {
+  snapshot_chain_.reset();
+  modified_objects_.clear();
 }
 
 bool Storage::LockPath() {
@@ -1803,13 +2731,16 @@ void Storage::FreeMemory() {
   edges_.run_gc();
   indices_.label_index.RunGC();
   indices_.label_property_index.RunGC();
+  indices_.label_property_composite_index.RunGC();
+  indices_.edge_type_index.RunGC();
+  indices_.edge_type_property_index.RunGC();
 }
 
 uint64_t Storage::CommitTimestamp(const std::optional<uint64_t> desired_commit_timestamp) {
   if (!desired_commit_timestamp) {
     return timestamp_++;
   } else {
-    timestamp_ = std::max(timestamp_, *desired_commit_timestamp + 1);
+    timestamp_ = std::max(timestamp_.load(), *desired_commit_timestamp + 1);
     return *desired_commit_timestamp;
   }
 }
@@ -1822,6 +2753,12 @@ bool Storage::SetReplicaRole(io::network::Endpoint endpoint, const replication::
 
   replication_server_ = std::make_unique<ReplicationServer>(this, std::move(endpoint), config);
 
+  {
+    // The replica doesn't create snapshots, and the first snapshot after it
+    // becomes the main instance again has to be a full one.
+    std::lock_guard<utils::SpinLock> guard(engine_lock_);
+    ResetSnapshotChain();
+  }
   replication_role_.store(ReplicationRole::REPLICA);
   return true;
 }
@@ -1927,4 +2864,53 @@ void Storage::SetIsolationLevel(IsolationLevel isolation_level) {
   isolation_level_ = isolation_level;
 }
 
+utils::BasicResult<Storage::SetStorageModeError> Storage::SetStorageMode(StorageMode storage_mode) {
+  // The snapshot lock must be taken before the main lock, see
+  // `CreateSnapshot`, so it is taken whenever a snapshot could be needed.
+  std::unique_lock<utils::SpinLock> snapshot_guard(snapshot_lock_, std::defer_lock);
+  if (storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL &&
+      config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED) {
+    snapshot_guard.lock();
+  }
+  std::unique_lock main_guard{main_lock_};
+  if (storage_mode == StorageMode::IN_MEMORY_ANALYTICAL && storage_mode_ != storage_mode) {
+    const bool replication_enabled =
+        replication_role_.load() == ReplicationRole::REPLICA ||
+        replication_clients_.WithLock([](const auto &clients) { return !clients.empty(); });
+    if (replication_enabled) {
+      return SetStorageModeError::ReplicationEnabled;
+    }
+    if (!ListExistenceConstraints(constraints_).empty() ||
+        !constraints_.unique_constraints.ListConstraints().empty()) {
+      return SetStorageModeError::ConstraintsExist;
+    }
+  }
+  if (storage_mode == StorageMode::IN_MEMORY_ANALYTICAL && storage_mode_ != storage_mode) {
+    // The analytical mode doesn't create deltas, so the modified objects
+    // can't be tracked for the incremental snapshots.
+    std::lock_guard<utils::SpinLock> guard(engine_lock_);
+    ResetSnapshotChain();
+  }
+  const bool create_snapshot = storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL &&
+                               storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL &&
+                               config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED;
+  storage_mode_ = storage_mode;
+  // The changes made in the analytical mode aren't written to the WAL so we
+  // have to persist them with a snapshot. It is created while the main lock
+  // is still held, so no transaction can commit to the WAL before it.
+  if (create_snapshot) {
+    if (replication_role_.load() != ReplicationRole::MAIN) {
+      spdlog::warn("Snapshots are disabled for replicas!");
+    } else {
+      CreateSnapshotLocked();
+    }
+  }
+  return {};
+}
+
+StorageMode Storage::GetStorageMode() const {
+  std::shared_lock main_guard{main_lock_};
+  return storage_mode_;
+}
+
 }  // namespace storage
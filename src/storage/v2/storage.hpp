@@ -11,16 +11,23 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <filesystem>
+#include <functional>
+#include <limits>
+#include <list>
+#include <map>
 #include <optional>
 #include <shared_mutex>
 #include <variant>
+#include <vector>
 
 #include "io/network/endpoint.hpp"
 #include "storage/v2/commit_log.hpp"
 #include "storage/v2/config.hpp"
 #include "storage/v2/constraints.hpp"
+#include "storage/v2/durability/group_commit.hpp"
 #include "storage/v2/durability/metadata.hpp"
 #include "storage/v2/durability/wal.hpp"
 #include "storage/v2/edge.hpp"
@@ -30,15 +37,18 @@
 #include "storage/v2/mvcc.hpp"
 #include "storage/v2/name_id_mapper.hpp"
 #include "storage/v2/result.hpp"
+#include "storage/v2/storage_mode.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/vertex_accessor.hpp"
+#include "storage/v2/vertex_lookup_table.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/on_scope_exit.hpp"
 #include "utils/rw_lock.hpp"
 #include "utils/scheduler.hpp"
 #include "utils/skip_list.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/uuid.hpp"
 
 /// REPLICATION ///
@@ -103,19 +113,21 @@ class AllVerticesIterable final {
 /// This class should be the primary type used by the client code to iterate
 /// over vertices inside a Storage instance.
 class VerticesIterable final {
-  enum class Type { ALL, BY_LABEL, BY_LABEL_PROPERTY };
+  enum class Type { ALL, BY_LABEL, BY_LABEL_PROPERTY, BY_LABEL_PROPERTY_COMPOSITE };
 
   Type type_;
   union {
     AllVerticesIterable all_vertices_;
     LabelIndex::Iterable vertices_by_label_;
     LabelPropertyIndex::Iterable vertices_by_label_property_;
+    LabelPropertyCompositeIndex::Iterable vertices_by_label_property_composite_;
   };
 
  public:
   explicit VerticesIterable(AllVerticesIterable);
   explicit VerticesIterable(LabelIndex::Iterable);
   explicit VerticesIterable(LabelPropertyIndex::Iterable);
+  explicit VerticesIterable(LabelPropertyCompositeIndex::Iterable);
 
   VerticesIterable(const VerticesIterable &) = delete;
   VerticesIterable &operator=(const VerticesIterable &) = delete;
@@ -131,6 +143,7 @@ class VerticesIterable final {
       AllVerticesIterable::Iterator all_it_;
       LabelIndex::Iterable::Iterator by_label_it_;
       LabelPropertyIndex::Iterable::Iterator by_label_property_it_;
+      LabelPropertyCompositeIndex::Iterable::Iterator by_label_property_composite_it_;
     };
 
     void Destroy() noexcept;
@@ -139,6 +152,7 @@ class VerticesIterable final {
     explicit Iterator(AllVerticesIterable::Iterator);
     explicit Iterator(LabelIndex::Iterable::Iterator);
     explicit Iterator(LabelPropertyIndex::Iterable::Iterator);
+    explicit Iterator(LabelPropertyCompositeIndex::Iterable::Iterator);
 
     Iterator(const Iterator &);
     Iterator &operator=(const Iterator &);
@@ -160,10 +174,76 @@ class VerticesIterable final {
   Iterator end();
 };
 
+/// Generic access to different kinds of edge index iterations.
+///
+/// This class should be the primary type used by the client code to iterate
+/// over indexed edges inside a Storage instance. Edges of a single vertex are
+/// iterated with `EdgesIterable` instead.
+class IndexedEdgesIterable final {
+  enum class Type { BY_EDGE_TYPE, BY_EDGE_TYPE_PROPERTY };
+
+  Type type_;
+  union {
+    EdgeTypeIndex::Iterable edges_by_edge_type_;
+    EdgeTypePropertyIndex::Iterable edges_by_edge_type_property_;
+  };
+
+ public:
+  explicit IndexedEdgesIterable(EdgeTypeIndex::Iterable);
+  explicit IndexedEdgesIterable(EdgeTypePropertyIndex::Iterable);
+
+  IndexedEdgesIterable(const IndexedEdgesIterable &) = delete;
+  IndexedEdgesIterable &operator=(const IndexedEdgesIterable &) = delete;
+
+  IndexedEdgesIterable(IndexedEdgesIterable &&) noexcept;
+  IndexedEdgesIterable &operator=(IndexedEdgesIterable &&) noexcept;
+
+  ~IndexedEdgesIterable();
+
+  class Iterator final {
+    Type type_;
+    union {
+      EdgeTypeIndex::Iterable::Iterator by_edge_type_it_;
+      EdgeTypePropertyIndex::Iterable::Iterator by_edge_type_property_it_;
+    };
+
+    void Destroy() noexcept;
+
+   public:
+    explicit Iterator(EdgeTypeIndex::Iterable::Iterator);
+    explicit Iterator(EdgeTypePropertyIndex::Iterable::Iterator);
+
+    Iterator(const Iterator &);
+    Iterator &operator=(const Iterator &);
+
+    Iterator(Iterator &&) noexcept;
+    Iterator &operator=(Iterator &&) noexcept;
+
+    ~Iterator();
+
+    EdgeAccessor operator*() const;
+
+    Iterator &operator++();
+
+    bool operator==(const Iterator &other) const;
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+  };
+
+  Iterator begin();
+  Iterator end();
+};
+
 /// Structure used to return information about existing indices in the storage.
 struct IndicesInfo {
   std::vector<LabelId> label;
   std::vector<std::pair<LabelId, PropertyId>> label_property;
+  std::vector<EdgeTypeId> edge_type;
+  std::vector<std::pair<EdgeTypeId, PropertyId>> edge_type_property;
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_property_composite;
+  // Indices that are still being built online. They aren't used by the queries
+  // until they are ready.
+  std::vector<LabelId> label_building;
+  std::vector<std::pair<LabelId, PropertyId>> label_property_building;
 };
 
 /// Structure used to return information about existing constraints in the
@@ -180,6 +260,41 @@ struct StorageInfo {
   double average_degree;
   uint64_t memory_usage;
   uint64_t disk_usage;
+  // Number of garbage collector runs and the total time (in microseconds) the
+  // runs spent in each of the garbage collection phases.
+  uint64_t gc_runs{0};
+  uint64_t gc_unlink_deltas_time_us{0};
+  uint64_t gc_index_cleanup_time_us{0};
+  uint64_t gc_free_objects_time_us{0};
+  // Number of batches synced by the WAL group commit, the total number and the
+  // largest number of transactions in them, and the total time (in
+  // microseconds) spent syncing.
+  uint64_t wal_sync_batches{0};
+  uint64_t wal_synced_transactions{0};
+  uint64_t wal_max_sync_batch_size{0};
+  uint64_t wal_sync_time_us{0};
+};
+
+/// Estimated number of bytes used by the storage, broken down by category.
+/// Objects kept in skip lists are counted with the average node size of their
+/// skip list while the external buffers (label sets, property stores and
+/// adjacency lists) are sampled on a subset of vertices and extrapolated, so
+/// the values are estimates and are cheap to collect on large graphs.
+struct StorageMemoryInfo {
+  uint64_t vertices{0};
+  uint64_t edges{0};
+  uint64_t labels{0};
+  uint64_t properties{0};
+  uint64_t adjacency_lists{0};
+  uint64_t deltas{0};
+  uint64_t indices{0};
+  uint64_t name_id_mapper{0};
+  // Amount of memory tracked by the global memory tracker.
+  uint64_t memory_tracked{0};
+  // Estimated bytes of the vertices with the given label (including their
+  // external buffers) and of the edges with the given edge type.
+  std::map<LabelId, uint64_t> per_label;
+  std::map<EdgeTypeId, uint64_t> per_edge_type;
 };
 
 enum class ReplicationRole : uint8_t { MAIN, REPLICA };
@@ -196,7 +311,7 @@ class Storage final {
    private:
     friend class Storage;
 
-    explicit Accessor(Storage *storage, IsolationLevel isolation_level);
+    explicit Accessor(Storage *storage, IsolationLevel isolation_level, bool read_only);
 
    public:
     Accessor(const Accessor &) = delete;
@@ -230,6 +345,15 @@ class Storage final {
                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view);
 
+    /// Return the vertices whose first `prefix.size()` values of the given
+    /// properties are equal to `prefix`, optionally bounding the value of the
+    /// property that follows the prefix. The composite index on the label and
+    /// the properties must exist.
+    VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                              const std::vector<PropertyValue> &prefix,
+                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view);
+
     /// Return approximate number of all vertices in the database.
     /// Note that this is always an over-estimate and never an under-estimate.
     int64_t ApproximateVertexCount() const { return storage_->vertices_.size(); }
@@ -262,6 +386,71 @@ class Storage final {
       return storage_->indices_.label_property_index.ApproximateVertexCount(label, property, lower, upper);
     }
 
+    /// Return approximate number of vertices in the composite index on the
+    /// given label and properties.
+    int64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const {
+      return storage_->indices_.label_property_composite_index.ApproximateVertexCount(label, properties);
+    }
+
+    /// Return approximate number of vertices with the given label whose first
+    /// `prefix.size()` values of the given properties are equal to `prefix`.
+    int64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                   const std::vector<PropertyValue> &prefix) const {
+      return storage_->indices_.label_property_composite_index.ApproximateVertexCount(label, properties, prefix);
+    }
+
+    /// Return approximate number of vertices with the given label and prefix
+    /// of property values whose value of the property that follows the prefix
+    /// is in the range defined by provided upper and lower bounds.
+    int64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                   const std::vector<PropertyValue> &prefix,
+                                   const std::optional<utils::Bound<PropertyValue>> &lower,
+                                   const std::optional<utils::Bound<PropertyValue>> &upper) const {
+      return storage_->indices_.label_property_composite_index.ApproximateVertexCount(label, properties, prefix,
+                                                                                       lower, upper);
+    }
+
+    /// Return the edges that have the given edge type. The edge type index
+    /// for the edge type must exist.
+    IndexedEdgesIterable Edges(EdgeTypeId edge_type, View view);
+
+    IndexedEdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, View view);
+
+    IndexedEdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, View view);
+
+    IndexedEdgesIterable Edges(EdgeTypeId edge_type, PropertyId property,
+                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view);
+
+    /// Return approximate number of edges with the given edge type.
+    /// Note that this is always an over-estimate and never an under-estimate.
+    int64_t ApproximateEdgeCount(EdgeTypeId edge_type) const {
+      return storage_->indices_.edge_type_index.ApproximateEdgeCount(edge_type);
+    }
+
+    /// Return approximate number of edges with the given edge type and
+    /// property. Note that this is always an over-estimate and never an
+    /// under-estimate.
+    int64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const {
+      return storage_->indices_.edge_type_property_index.ApproximateEdgeCount(edge_type, property);
+    }
+
+    /// Return approximate number of edges with the given edge type and the
+    /// given value for the given property. Note that this is always an
+    /// over-estimate and never an under-estimate.
+    int64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value) const {
+      return storage_->indices_.edge_type_property_index.ApproximateEdgeCount(edge_type, property, value);
+    }
+
+    /// Return approximate number of edges with the given edge type and value
+    /// for the given property in the range defined by provided upper and lower
+    /// bounds.
+    int64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                 const std::optional<utils::Bound<PropertyValue>> &lower,
+                                 const std::optional<utils::Bound<PropertyValue>> &upper) const {
+      return storage_->indices_.edge_type_property_index.ApproximateEdgeCount(edge_type, property, lower, upper);
+    }
+
     /// @return Accessor to the deleted vertex if a deletion took place, std::nullopt otherwise
     /// @throw std::bad_alloc
     Result<std::optional<VertexAccessor>> DeleteVertex(VertexAccessor *vertex);
@@ -297,8 +486,26 @@ class Storage final {
       return storage_->indices_.label_property_index.IndexExists(label, property);
     }
 
+    bool LabelPropertyCompositeIndexExists(LabelId label, const std::vector<PropertyId> &properties) const {
+      return storage_->indices_.label_property_composite_index.IndexExists(label, properties);
+    }
+
+    bool EdgeTypeIndexExists(EdgeTypeId edge_type) const {
+      return storage_->indices_.edge_type_index.IndexExists(edge_type);
+    }
+
+    bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId property) const {
+      return storage_->indices_.edge_type_property_index.IndexExists(edge_type, property);
+    }
+
     IndicesInfo ListAllIndices() const {
-      return {storage_->indices_.label_index.ListIndices(), storage_->indices_.label_property_index.ListIndices()};
+      return {storage_->indices_.label_index.ListIndices(),
+              storage_->indices_.label_property_index.ListIndices(),
+              storage_->indices_.edge_type_index.ListIndices(),
+              storage_->indices_.edge_type_property_index.ListIndices(),
+              storage_->indices_.label_property_composite_index.ListIndices(),
+              storage_->indices_.label_index.ListBuildingIndices(),
+              storage_->indices_.label_property_index.ListBuildingIndices()};
     }
 
     ConstraintsInfo ListAllConstraints() const {
@@ -306,6 +513,8 @@ class Storage final {
               storage_->constraints_.unique_constraints.ListConstraints()};
     }
 
+    StorageMemoryInfo GetMemoryInfo() const { return storage_->CollectMemoryInfo(); }
+
     void AdvanceCommand();
 
     /// Commit returns `ConstraintViolation` if the changes made by this
@@ -319,6 +528,8 @@ class Storage final {
 
     void FinalizeTransaction();
 
+    bool IsReadOnly() const { return read_only_; }
+
    private:
     /// @throw std::bad_alloc
     VertexAccessor CreateVertex(storage::Gid gid);
@@ -328,14 +539,25 @@ class Storage final {
 
     Storage *storage_;
     std::shared_lock<utils::RWLock> storage_guard_;
+    // Set when the read-only transaction is created, so it must be declared
+    // before `transaction_`.
+    uint64_t read_only_slot_;
     Transaction transaction_;
     std::optional<uint64_t> commit_timestamp_;
     bool is_transaction_active_;
+    bool read_only_;
     Config::Items config_;
   };
 
   Accessor Access(std::optional<IsolationLevel> override_isolation_level = {}) {
-    return Accessor{this, override_isolation_level.value_or(isolation_level_)};
+    return Accessor{this, override_isolation_level.value_or(isolation_level_), false};
+  }
+
+  /// Read-only accessors don't allocate a timestamp and don't take the engine
+  /// lock, neither when they are created nor when they are committed. They
+  /// must not be used to modify the storage.
+  Accessor ReadOnlyAccess(std::optional<IsolationLevel> override_isolation_level = {}) {
+    return Accessor{this, override_isolation_level.value_or(isolation_level_), true};
   }
 
   const std::string &LabelToName(LabelId label) const;
@@ -361,6 +583,31 @@ class Storage final {
 
   bool DropIndex(LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp = {});
 
+  /// Creates a composite index on the given label and the ordered list of
+  /// properties. Returns true if the index was successfully created, false if
+  /// it already exists.
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, const std::vector<PropertyId> &properties,
+                   std::optional<uint64_t> desired_commit_timestamp = {});
+
+  bool DropIndex(LabelId label, const std::vector<PropertyId> &properties,
+                 std::optional<uint64_t> desired_commit_timestamp = {});
+
+  /// @throw std::bad_alloc
+  bool CreateIndex(EdgeTypeId edge_type, std::optional<uint64_t> desired_commit_timestamp = {});
+
+  bool DropIndex(EdgeTypeId edge_type, std::optional<uint64_t> desired_commit_timestamp = {});
+
+  /// Creates an edge type+property index. Returns true if the index was
+  /// successfully created, false if it already exists. Since edge properties
+  /// are stored only when properties on edges are enabled,
+  /// `Error::PROPERTIES_DISABLED` is returned otherwise.
+  /// @throw std::bad_alloc
+  Result<bool> CreateIndex(EdgeTypeId edge_type, PropertyId property,
+                           std::optional<uint64_t> desired_commit_timestamp = {});
+
+  bool DropIndex(EdgeTypeId edge_type, PropertyId property, std::optional<uint64_t> desired_commit_timestamp = {});
+
   IndicesInfo ListAllIndices() const;
 
   /// Creates an existence constraint. Returns true if the constraint was
@@ -404,6 +651,11 @@ class Storage final {
 
   StorageInfo GetInfo() const;
 
+  /// Returns an estimate of the memory used by the storage. The estimate
+  /// samples at most a few thousand vertices so it doesn't need to scan the
+  /// whole graph.
+  StorageMemoryInfo GetMemoryInfo() const;
+
   bool LockPath();
   bool UnlockPath();
 
@@ -439,6 +691,20 @@ class Storage final {
 
   void SetIsolationLevel(IsolationLevel isolation_level);
 
+  enum class SetStorageModeError : uint8_t { ReplicationEnabled, ConstraintsExist };
+
+  /// Waits until all active transactions finish and changes the storage mode
+  /// of the following transactions. Constraints aren't validated and the
+  /// changes aren't replicated in the analytical mode, so switching to it fails
+  /// if there are any constraints or if replication is used. When switching
+  /// back to the transactional mode, a snapshot is created (if durability is
+  /// enabled) because the WAL doesn't contain the analytical changes. The
+  /// following transactions start only after the snapshot is created, so none
+  /// of their changes are written only to the WAL before it.
+  utils::BasicResult<SetStorageModeError> SetStorageMode(StorageMode storage_mode);
+
+  StorageMode GetStorageMode() const;
+
   enum class CreateSnapshotError : uint8_t { DisabledForReplica };
 
   utils::BasicResult<CreateSnapshotError> CreateSnapshot();
@@ -446,6 +712,24 @@ class Storage final {
  private:
   Transaction CreateTransaction(IsolationLevel isolation_level);
 
+  /// Stores the registration slot of the transaction in `slot`, it must be
+  /// passed to `FinishReadOnlyTransaction`.
+  /// @throw std::bad_alloc
+  Transaction CreateReadOnlyTransaction(IsolationLevel isolation_level, uint64_t *slot);
+
+  /// Returns the registration slot of the start timestamp.
+  /// @throw std::bad_alloc
+  uint64_t RegisterReadOnlyTransaction(uint64_t start_timestamp);
+
+  void FinishReadOnlyTransaction(uint64_t slot, uint64_t start_timestamp);
+
+  /// Same as `CreateSnapshot`, but the caller must hold `snapshot_lock_` and
+  /// `main_lock_`.
+  void CreateSnapshotLocked();
+
+  /// Same as `GetMemoryInfo`, but the caller must hold `main_lock_`.
+  StorageMemoryInfo CollectMemoryInfo() const;
+
   /// The force parameter determines the behaviour of the garbage collector.
   /// If it's set to true, it will behave as a global operation, i.e. it can't
   /// be part of a transaction, and no other transaction can be active at the same time.
@@ -460,15 +744,53 @@ class Storage final {
   template <bool force>
   void CollectGarbage();
 
+  /// Splits the range [0, size) into chunks of at most `chunk_size` elements
+  /// and calls `func(begin, end)` for each of them. The chunks are processed
+  /// by the GC thread pool and the calling thread. The function returns after
+  /// all chunks are processed.
+  void RunGcInParallel(uint64_t size, uint64_t chunk_size, const std::function<void(uint64_t, uint64_t)> &func);
+
   bool InitializeWalFile();
   void FinalizeWalFile();
+  bool IsWalGroupCommitUsed() const;
+  /// Blocks until the first `wal_position` WAL transactions are synced if the
+  /// group commit is used. Must be called without holding the engine lock.
+  void WaitForWalSync(uint64_t wal_position);
+  /// Advances `visible_timestamp_` to `timestamp` unless it is already past it.
+  void AdvanceVisibleTimestamp(uint64_t timestamp);
 
   void AppendToWal(const Transaction &transaction, uint64_t final_commit_timestamp);
-  void AppendToWal(durability::StorageGlobalOperation operation, LabelId label, const std::set<PropertyId> &properties,
-                   uint64_t final_commit_timestamp);
+  void AppendToWal(durability::StorageGlobalOperation operation, LabelId label,
+                   const std::vector<PropertyId> &properties, uint64_t final_commit_timestamp);
+  void AppendToWal(durability::StorageGlobalOperation operation, EdgeTypeId edge_type,
+                   const std::set<PropertyId> &properties, uint64_t final_commit_timestamp);
 
   uint64_t CommitTimestamp(std::optional<uint64_t> desired_commit_timestamp = {});
 
+  /// Gids of the objects modified by a transaction.
+  struct ModifiedObjects {
+    std::vector<Gid> vertices;
+    std::vector<Gid> edges;
+  };
+
+  /// Collects the objects modified by the transaction if they can be needed by
+  /// an incremental snapshot. Doesn't need the engine lock, so the commit
+  /// calls it before it takes the lock.
+  std::optional<ModifiedObjects> CollectModifiedObjects(const Transaction &transaction) const;
+  /// Remembers the collected objects for the next incremental snapshot. Must
+  /// be called while holding the engine lock.
+  void TrackModifiedObjects(ModifiedObjects &&objects);
+  /// Drops the tracked modifications so that the next snapshot is a full one.
+  /// Must be called while holding the engine lock.
+  void ResetSnapshotChain();
+
+  // Indices are built online only when requested in the config. Replicated
+  // index creations (with a desired commit timestamp) are always blocking so
+  // that the replica applies them at the same point as the main instance.
+  bool UseOnlineIndexBuild(std::optional<uint64_t> desired_commit_timestamp) const {
+    return config_.schema_creation.online_index_build && !desired_commit_timestamp;
+  }
+
   // Main storage lock.
   //
   // Accessors take a shared lock when starting, so it is possible to block
@@ -480,6 +802,10 @@ class Storage final {
   // Main object storage
   utils::SkipList<storage::Vertex> vertices_;
   utils::SkipList<storage::Edge> edges_;
+  // Direct gid-to-vertex lookup for `FindVertex`, created only when enabled in
+  // the config. The vertices are inserted when they are created or recovered
+  // and removed by the GC before they are removed from `vertices_`.
+  std::optional<VertexLookupTable> vertex_lookup_table_;
   std::atomic<uint64_t> vertex_id_{0};
   std::atomic<uint64_t> edge_id_{0};
   // Even though the edge count is already kept in the `edges_` SkipList, the
@@ -494,13 +820,44 @@ class Storage final {
 
   // Transaction engine
   utils::SpinLock engine_lock_;
-  uint64_t timestamp_{kTimestampInitialId};
+  // The timestamp is modified only while holding the engine lock, but it is
+  // atomic so that it can be read without the lock.
+  std::atomic<uint64_t> timestamp_{kTimestampInitialId};
+  // All transactions with a commit timestamp lower than this one have
+  // published their commit timestamp. Unlike `timestamp_`, it isn't advanced
+  // before the commit is published, so read-only transactions start at it.
+  // With the group commit, it is advanced only after the commit is synced.
+  std::atomic<uint64_t> visible_timestamp_{kTimestampInitialId};
+  // With the group commit, the commit timestamp and the WAL position of the
+  // last commit that may still wait for its WAL records to be synced. New
+  // transactions don't start before it is synced.
+  std::optional<uint64_t> unsynced_commit_timestamp_;
+  uint64_t unsynced_wal_position_{0};
   uint64_t transaction_id_{kTransactionInitialId};
   // TODO: This isn't really a commit log, it doesn't even care if a
   // transaction commited or aborted. We could probably combine this with
   // `timestamp_` in a sensible unit, something like TransactionClock or
   // whatever.
   std::optional<CommitLog> commit_log_;
+  StorageMode storage_mode_{StorageMode::IN_MEMORY_TRANSACTIONAL};
+  // Number of slots for the start timestamps of active read-only
+  // transactions.
+  static constexpr uint64_t kReadOnlyTransactionSlots = 256;
+  // Value of a slot that isn't used by any read-only transaction.
+  static constexpr uint64_t kFreeReadOnlyTransactionSlot = std::numeric_limits<uint64_t>::max();
+
+  struct alignas(64) ReadOnlyTransactionSlot {
+    std::atomic<uint64_t> start_timestamp{kFreeReadOnlyTransactionSlot};
+  };
+
+  // Start timestamps of active read-only transactions. Read-only transactions
+  // don't allocate a timestamp, so they aren't tracked by the `commit_log_`.
+  // Each transaction takes a free slot, starting from a slot chosen by its
+  // thread so that concurrent transactions don't share a cache line.
+  std::array<ReadOnlyTransactionSlot, kReadOnlyTransactionSlots> read_only_transactions_;
+  // Start timestamps of the read-only transactions that didn't find a free
+  // slot, with the number of transactions that use each of them.
+  utils::Synchronized<std::map<uint64_t, uint64_t>, utils::SpinLock> read_only_transactions_overflow_;
 
   utils::Synchronized<std::list<Transaction>, utils::SpinLock> committed_transactions_;
   IsolationLevel isolation_level_;
@@ -508,9 +865,20 @@ class Storage final {
   Config config_;
   utils::Scheduler gc_runner_;
   std::mutex gc_lock_;
+  // Workers that help the GC thread, created only if `config_.gc.num_threads`
+  // is larger than 1.
+  std::optional<utils::ThreadPool> gc_thread_pool_;
+
+  // Statistics of the garbage collector runs.
+  struct GcStats {
+    std::atomic<uint64_t> runs{0};
+    std::atomic<uint64_t> unlink_deltas_us{0};
+    std::atomic<uint64_t> index_cleanup_us{0};
+    std::atomic<uint64_t> free_objects_us{0};
+  } gc_stats_;
 
   // Undo buffers that were unlinked and now are waiting to be freed.
-  utils::Synchronized<std::list<std::pair<uint64_t, std::list<Delta>>>, utils::SpinLock> garbage_undo_buffers_;
+  utils::Synchronized<std::list<std::pair<uint64_t, DeltaContainer>>, utils::SpinLock> garbage_undo_buffers_;
 
   // Vertices that are logically deleted but still have to be removed from
   // indices before removing them from the main storage.
@@ -524,6 +892,10 @@ class Storage final {
   // storage.
   utils::Synchronized<std::list<Gid>, utils::SpinLock> deleted_edges_;
 
+  // Edges that are logically deleted and removed from the edge type index and
+  // now wait to be removed from the main storage.
+  std::list<std::pair<uint64_t, Gid>> garbage_edges_;
+
   // Durability
   std::filesystem::path snapshot_directory_;
   std::filesystem::path wal_directory_;
@@ -533,6 +905,20 @@ class Storage final {
   utils::Scheduler snapshot_runner_;
   utils::SpinLock snapshot_lock_;
 
+  // Chain of incremental snapshots that the next snapshot can be added to. The
+  // chain and the objects modified since its last snapshot are guarded by the
+  // engine lock, so the modifications are split between two snapshots exactly
+  // at the start timestamp of the newer one.
+  struct SnapshotChain {
+    uint64_t base_start_timestamp;
+    uint64_t previous_start_timestamp;
+    uint64_t incremental_count;
+  };
+  std::optional<SnapshotChain> snapshot_chain_;
+  // The objects of each committed transaction are kept as they were
+  // collected, the duplicates are removed by the snapshot.
+  std::vector<ModifiedObjects> modified_objects_;
+
   // UUID used to distinguish snapshots and to link snapshots to WALs
   std::string uuid_;
   // Sequence number used to keep track of the chain of WALs.
@@ -560,6 +946,14 @@ class Storage final {
 
   std::optional<durability::WalFile> wal_file_;
   uint64_t wal_unsynced_transactions_{0};
+  // Total number of transactions (and global operations) written to the WAL
+  // files. Committers use it as the position they wait for to be synced. It
+  // is modified only while holding the engine lock, but it is atomic so that
+  // the group commit can read it without the lock.
+  std::atomic<uint64_t> wal_written_transactions_{0};
+  // Created only if the WAL and `config_.durability.wal_group_commit` are
+  // enabled.
+  std::optional<durability::GroupCommit> wal_group_commit_;
 
   utils::FileRetainer file_retainer_;
 
@@ -0,0 +1,24 @@
+// Copyright 2021 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+
+namespace storage {
+
+/// In the analytical mode transactions write directly to the objects without
+/// creating deltas. There is no isolation between the transactions, aborted
+/// transactions aren't rolled back and the changes aren't written to the WAL
+/// nor replicated. The mode is meant for bulk loading with a single writer.
+enum class StorageMode : std::uint8_t { IN_MEMORY_TRANSACTIONAL, IN_MEMORY_ANALYTICAL };
+
+}  // namespace storage
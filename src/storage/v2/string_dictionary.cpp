@@ -0,0 +1,142 @@
+// Copyright 2021 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/string_dictionary.hpp"
+
+#include <functional>
+#include <mutex>
+#include <utility>
+
+#include "utils/logging.hpp"
+
+namespace storage {
+
+StringDictionary::Reference::Reference(StringDictionary *dictionary, std::string_view value)
+    : dictionary_(dictionary), id_(dictionary->AcquireIfInterned(value)) {}
+
+StringDictionary::Reference::~Reference() {
+  if (id_) dictionary_->Release(*id_);
+}
+
+StringDictionary::Reference::Reference(Reference &&other) noexcept
+    : dictionary_(other.dictionary_), id_(std::exchange(other.id_, std::nullopt)) {}
+
+StringDictionary::Reference &StringDictionary::Reference::operator=(Reference &&other) noexcept {
+  if (this == &other) return *this;
+  if (id_) dictionary_->Release(*id_);
+  dictionary_ = other.dictionary_;
+  id_ = std::exchange(other.id_, std::nullopt);
+  return *this;
+}
+
+StringDictionary &StringDictionary::Global() {
+  // The dictionary is intentionally leaked so that property stores which are
+  // destroyed during static destruction can still release their strings.
+  static auto *dictionary = new StringDictionary();
+  return *dictionary;
+}
+
+StringDictionary::~StringDictionary() {
+  for (auto &shard : shards_) {
+    for (auto &chunk : shard.chunks) {
+      delete[] chunk.load(std::memory_order_acquire);
+    }
+  }
+}
+
+std::optional<uint64_t> StringDictionary::Acquire(std::string_view value) {
+  if (value.size() < kMinStringSize || value.size() > kMaxStringSize) return std::nullopt;
+
+  const size_t hash = std::hash<std::string_view>{}(value);
+  const uint64_t shard_index = hash % kShards;
+  auto &shard = shards_[shard_index];
+  std::lock_guard<utils::SpinLock> guard(shard.lock);
+  if (auto found = shard.ids.find(value); found != shard.ids.end()) {
+    ++GetEntry(found->second).refcount;
+    return found->second;
+  }
+
+  // Remember the first sighting and store the string inline.
+  auto &seen = shard.seen[(hash / kShards) % kFilterSize];
+  if (seen != hash) {
+    seen = hash;
+    return std::nullopt;
+  }
+
+  uint64_t index = 0;
+  if (!shard.free_ids.empty()) {
+    index = shard.free_ids.back();
+  } else if (shard.next_id < kShardCapacity) {
+    index = shard.next_id;
+    auto &chunk = shard.chunks[index / kChunkSize];
+    if (!chunk.load(std::memory_order_acquire)) {
+      chunk.store(new Entry[kChunkSize], std::memory_order_release);
+    }
+  } else {
+    return std::nullopt;
+  }
+
+  const uint64_t id = shard_index * kShardCapacity + index;
+  auto &entry = GetEntry(id);
+  entry.value = value;
+  entry.refcount = 1;
+  shard.ids.emplace(entry.value, id);
+  if (!shard.free_ids.empty()) {
+    shard.free_ids.pop_back();
+  } else {
+    ++shard.next_id;
+  }
+  size_.fetch_add(1, std::memory_order_acq_rel);
+  return id;
+}
+
+std::optional<uint64_t> StringDictionary::AcquireIfInterned(std::string_view value) {
+  if (value.size() < kMinStringSize || value.size() > kMaxStringSize) return std::nullopt;
+
+  auto &shard = shards_[std::hash<std::string_view>{}(value) % kShards];
+  std::lock_guard<utils::SpinLock> guard(shard.lock);
+  auto found = shard.ids.find(value);
+  if (found == shard.ids.end()) return std::nullopt;
+  ++GetEntry(found->second).refcount;
+  return found->second;
+}
+
+bool StringDictionary::Contains(std::string_view value) const {
+  if (value.size() < kMinStringSize || value.size() > kMaxStringSize) return false;
+
+  const auto &shard = shards_[std::hash<std::string_view>{}(value) % kShards];
+  std::lock_guard<utils::SpinLock> guard(shard.lock);
+  return shard.ids.find(value) != shard.ids.end();
+}
+
+void StringDictionary::Release(uint64_t id) {
+  auto &shard = shards_[id / kShardCapacity];
+  std::lock_guard<utils::SpinLock> guard(shard.lock);
+  auto &entry = GetEntry(id);
+  MG_ASSERT(entry.refcount > 0, "Releasing an unused interned string!");
+  if (--entry.refcount > 0) return;
+  shard.ids.erase(entry.value);
+  entry.value.clear();
+  shard.free_ids.push_back(id % kShardCapacity);
+  size_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+std::string_view StringDictionary::Get(uint64_t id) const { return GetEntry(id).value; }
+
+StringDictionary::Entry &StringDictionary::GetEntry(uint64_t id) const {
+  MG_ASSERT(id < kCapacity, "Invalid interned string ID!");
+  const uint64_t index = id % kShardCapacity;
+  auto *chunk = shards_[id / kShardCapacity].chunks[index / kChunkSize].load(std::memory_order_acquire);
+  MG_ASSERT(chunk, "Invalid interned string ID!");
+  return chunk[index % kChunkSize];
+}
+
+}  // namespace storage
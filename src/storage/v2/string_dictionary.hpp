@@ -0,0 +1,162 @@
+// Copyright 2021 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/spin_lock.hpp"
+
+namespace storage {
+
+/// Dictionary of interned strings used by the `PropertyStore`. Low-cardinality
+/// string properties (statuses, country codes, enum-like values) are repeated
+/// in a huge number of vertices and edges. Instead of storing the whole string
+/// in each property buffer, the buffer stores only the (small) ID of the string
+/// in the dictionary.
+///
+/// A string is interned only when it is seen for the second time while it
+/// isn't interned. The first sighting is remembered in a small filter and the
+/// string is stored inline, so unique values (names, e-mails, UUIDs) don't
+/// take up the dictionary.
+///
+/// Each string is reference counted. A string is removed from the dictionary
+/// once no property buffer references it anymore and its ID is then reused.
+/// The dictionary has a limited capacity so that high-cardinality strings
+/// can't make it grow without bounds; once it is full, new strings aren't
+/// interned and are stored inline in the property buffers.
+///
+/// The strings are split into shards by their hash, and each shard has its
+/// own lock.
+///
+/// A string has a single ID while it is interned, so a property value that
+/// holds an interned string is equal to another interned string only if their
+/// IDs are equal. Scans that compare a lot of property values with the same
+/// string hold a `Reference` to it and compare the IDs instead of the strings.
+///
+/// Snapshots and WALs write each interned string in full only once and refer
+/// to it by a file-local ID afterwards (see `durability::Encoder`). The IDs in
+/// the dictionary aren't persisted; the strings are interned again when they
+/// are recovered.
+class StringDictionary final {
+ public:
+  /// Only strings whose size is in the range [kMinStringSize, kMaxStringSize]
+  /// are interned. An interned string is stored as a (mostly 2 byte) ID instead
+  /// of its size and contents, so only single characters are smaller when
+  /// stored inline. Longer strings are unlikely to be low-cardinality values.
+  static constexpr uint64_t kMinStringSize = 2;
+  static constexpr uint64_t kMaxStringSize = 64;
+  static constexpr uint64_t kCapacity = 65536;
+  static constexpr uint64_t kShards = 16;
+  /// Number of strings that each shard can hold.
+  static constexpr uint64_t kShardCapacity = kCapacity / kShards;
+
+  /// Holds a reference to an interned string for as long as it exists, so the
+  /// string keeps its ID. If the string isn't interned when the reference is
+  /// created, the reference is empty.
+  class Reference final {
+   public:
+    Reference() = default;
+    Reference(StringDictionary *dictionary, std::string_view value);
+    ~Reference();
+
+    Reference(const Reference &) = delete;
+    Reference &operator=(const Reference &) = delete;
+    Reference(Reference &&other) noexcept;
+    Reference &operator=(Reference &&other) noexcept;
+
+    /// Returns the ID of the referenced string or `std::nullopt` if the
+    /// reference is empty.
+    std::optional<uint64_t> Id() const { return id_; }
+
+   private:
+    StringDictionary *dictionary_{nullptr};
+    std::optional<uint64_t> id_;
+  };
+
+  /// Returns the dictionary that is shared by all property stores.
+  static StringDictionary &Global();
+
+  StringDictionary() = default;
+
+  StringDictionary(const StringDictionary &) = delete;
+  StringDictionary(StringDictionary &&) = delete;
+  StringDictionary &operator=(const StringDictionary &) = delete;
+  StringDictionary &operator=(StringDictionary &&) = delete;
+
+  ~StringDictionary();
+
+  /// Returns the ID of the string `value` and increments its reference count.
+  /// If the string isn't eligible for interning, it is seen for the first
+  /// time or its shard is full, `std::nullopt` is returned and the string
+  /// should be stored inline.
+  /// @throw std::bad_alloc
+  std::optional<uint64_t> Acquire(std::string_view value);
+
+  /// Returns the ID of the string `value` and increments its reference count
+  /// if the string is interned. Unlike `Acquire`, the string is never interned
+  /// by this function, so `std::nullopt` is returned if it isn't interned.
+  std::optional<uint64_t> AcquireIfInterned(std::string_view value);
+
+  /// Returns whether the string `value` is currently interned.
+  bool Contains(std::string_view value) const;
+
+  /// Decrements the reference count of the string with ID `id`. The string is
+  /// removed from the dictionary when its reference count drops to zero.
+  void Release(uint64_t id);
+
+  /// Returns the string with ID `id`. The caller must hold a reference to the
+  /// string. This function doesn't take any locks.
+  std::string_view Get(uint64_t id) const;
+
+  /// Returns the number of strings that are currently interned.
+  uint64_t Size() const { return size_.load(std::memory_order_acquire); }
+
+ private:
+  struct Entry {
+    std::string value;
+    uint64_t refcount{0};
+  };
+
+  // Entries are allocated in chunks that are never moved or freed (until the
+  // dictionary is destroyed) so that `Get` can access them without locking.
+  static constexpr uint64_t kChunkSize = 1024;
+  // Number of the remembered first sightings in each shard.
+  static constexpr uint64_t kFilterSize = 1024;
+
+  // The shards are aligned to separate cache lines so that their locks don't
+  // share them.
+  struct alignas(64) Shard {
+    mutable utils::SpinLock lock;
+    // The keys point to the strings stored in the entries.
+    std::unordered_map<std::string_view, uint64_t> ids;
+    std::vector<uint64_t> free_ids;
+    uint64_t next_id{0};
+    // Hashes of the strings that were seen once. A slot is overwritten by the
+    // next string that maps to it.
+    std::array<size_t, kFilterSize> seen{};
+    std::array<std::atomic<Entry *>, kShardCapacity / kChunkSize> chunks{};
+  };
+
+  // The shard is encoded in the ID as `shard * kShardCapacity + index`.
+  Entry &GetEntry(uint64_t id) const;
+
+  std::array<Shard, kShards> shards_;
+  std::atomic<uint64_t> size_{0};
+};
+
+}  // namespace storage
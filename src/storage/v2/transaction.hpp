@@ -13,15 +13,16 @@
 
 #include <atomic>
 #include <limits>
-#include <list>
 #include <memory>
 
 #include "utils/skip_list.hpp"
 
 #include "storage/v2/delta.hpp"
+#include "storage/v2/delta_container.hpp"
 #include "storage/v2/edge.hpp"
 #include "storage/v2/isolation_level.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/storage_mode.hpp"
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/view.hpp"
 
@@ -29,14 +30,19 @@ namespace storage {
 
 const uint64_t kTimestampInitialId = 0;
 const uint64_t kTransactionInitialId = 1ULL << 63U;
+// All read-only transactions share this id. Write transactions get their ids
+// sequentially from `kTransactionInitialId`, so they never reach it.
+const uint64_t kReadOnlyTransactionId = std::numeric_limits<uint64_t>::max();
 
 struct Transaction {
-  Transaction(uint64_t transaction_id, uint64_t start_timestamp, IsolationLevel isolation_level)
+  Transaction(uint64_t transaction_id, uint64_t start_timestamp, IsolationLevel isolation_level,
+              StorageMode storage_mode = StorageMode::IN_MEMORY_TRANSACTIONAL)
       : transaction_id(transaction_id),
         start_timestamp(start_timestamp),
         command_id(0),
         must_abort(false),
-        isolation_level(isolation_level) {}
+        isolation_level(isolation_level),
+        storage_mode(storage_mode) {}
 
   Transaction(Transaction &&other) noexcept
       : transaction_id(other.transaction_id),
@@ -45,7 +51,8 @@ struct Transaction {
         command_id(other.command_id),
         deltas(std::move(other.deltas)),
         must_abort(other.must_abort),
-        isolation_level(other.isolation_level) {}
+        isolation_level(other.isolation_level),
+        storage_mode(other.storage_mode) {}
 
   Transaction(const Transaction &) = delete;
   Transaction &operator=(const Transaction &) = delete;
@@ -67,9 +74,10 @@ struct Transaction {
   // `commited_transactions_` list for GC.
   std::unique_ptr<std::atomic<uint64_t>> commit_timestamp;
   uint64_t command_id;
-  std::list<Delta> deltas;
+  DeltaContainer deltas;
   bool must_abort;
   IsolationLevel isolation_level;
+  StorageMode storage_mode;
 };
 
 inline bool operator==(const Transaction &first, const Transaction &second) {
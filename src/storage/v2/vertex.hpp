@@ -12,14 +12,14 @@
 #pragma once
 
 #include <limits>
-#include <tuple>
 #include <vector>
 
+#include "storage/v2/adjacency_list.hpp"
 #include "storage/v2/delta.hpp"
-#include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
+#include "storage/v2/label_set.hpp"
 #include "storage/v2/property_store.hpp"
-#include "utils/spin_lock.hpp"
+#include "utils/seq_lock.hpp"
 
 namespace storage {
 
@@ -31,21 +31,29 @@ struct Vertex {
 
   Gid gid;
 
-  std::vector<LabelId> labels;
+  LabelSet labels;
   PropertyStore properties;
 
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> in_edges;
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
-
-  mutable utils::SpinLock lock;
-  bool deleted;
-  // uint8_t PAD;
-  // uint16_t PAD;
+  AdjacencyList in_edges;
+  AdjacencyList out_edges;
+
+  // Guards all of the fields below and the labels and properties. Readers
+  // that only copy the state of the vertex can do so optimistically, without
+  // taking the lock.
+  mutable utils::SeqLock lock;
+  bool deleted : 1;
+  // Incremented on every modification of `in_edges` or `out_edges`. It is
+  // used by the lazy edge iterators to detect that their position in the
+  // adjacency lists is no longer valid, so it must be wide enough not to wrap
+  // around during an iteration. Together with `deleted` it takes up the 32
+  // bits next to the lock.
+  uint32_t edges_version : 31 {0};
 
   Delta *delta;
 };
 
 static_assert(alignof(Vertex) >= 8, "The Vertex should be aligned to at least 8!");
+static_assert(sizeof(Vertex) == 104, "The Vertex should be 104 bytes large!");
 
 inline bool operator==(const Vertex &first, const Vertex &second) { return first.gid == second.gid; }
 inline bool operator<(const Vertex &first, const Vertex &second) { return first.gid < second.gid; }
@@ -11,6 +11,8 @@
 
 #include "storage/v2/vertex_accessor.hpp"
 
+#include <algorithm>
+#include <array>
 #include <memory>
 
 #include "storage/v2/edge_accessor.hpp"
@@ -29,10 +31,14 @@ std::pair<bool, bool> IsVisible(Vertex *vertex, Transaction *transaction, View v
   bool exists = true;
   bool deleted = false;
   Delta *delta = nullptr;
-  {
-    std::lock_guard<utils::SpinLock> guard(vertex->lock);
+  auto read = [&] {
     deleted = vertex->deleted;
     delta = vertex->delta;
+    return true;
+  };
+  if (!vertex->lock.TryOptimisticRead(read)) {
+    std::lock_guard<utils::SeqLock> guard(vertex->lock);
+    read();
   }
   ApplyDeltasForRead(transaction, delta, view, [&](const Delta &delta) {
     switch (delta.action) {
@@ -57,6 +63,47 @@ std::pair<bool, bool> IsVisible(Vertex *vertex, Transaction *transaction, View v
 
   return {exists, deleted};
 }
+
+// Copies all links from `edges` that satisfy the edge type and destination
+// filters into `result`. Only the edge type groups that are requested are
+// visited, the rest of the adjacency list is skipped.
+void CollectEdges(const AdjacencyList &edges, const std::vector<EdgeTypeId> &edge_types, const Vertex *destination,
+                  std::vector<AdjacencyList::value_type> *result) {
+  auto collect_range = [destination, result](auto first, auto last) {
+    for (auto it = first; it != last; ++it) {
+      if (destination && std::get<1>(*it) != destination) continue;
+      result->push_back(*it);
+    }
+  };
+  if (edge_types.empty()) {
+    if (!destination) {
+      result->assign(edges.begin(), edges.end());
+    } else {
+      collect_range(edges.begin(), edges.end());
+    }
+    return;
+  }
+  for (auto type_it = edge_types.begin(); type_it != edge_types.end(); ++type_it) {
+    // Skip duplicated edge types so that each edge is collected only once.
+    if (std::find(edge_types.begin(), type_it, *type_it) != type_it) continue;
+    auto [first, last] = edges.EdgeTypeRange(*type_it);
+    collect_range(first, last);
+  }
+}
+
+// Returns the number of links in `edges` that have one of the given edge
+// types. Only the sizes of the requested edge type groups are computed, the
+// links themselves aren't visited.
+size_t CountEdges(const AdjacencyList &edges, const std::vector<EdgeTypeId> &edge_types) {
+  if (edge_types.empty()) return edges.size();
+  size_t count = 0;
+  for (auto type_it = edge_types.begin(); type_it != edge_types.end(); ++type_it) {
+    // Skip duplicated edge types so that each edge is counted only once.
+    if (std::find(edge_types.begin(), type_it, *type_it) != type_it) continue;
+    count += edges.EdgeTypeCount(*type_it);
+  }
+  return count;
+}
 }  // namespace
 }  // namespace detail
 
@@ -76,17 +123,17 @@ bool VertexAccessor::IsVisible(View view) const {
 
 Result<bool> VertexAccessor::AddLabel(LabelId label) {
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-  std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+  std::lock_guard<utils::SeqLock> guard(vertex_->lock);
 
   if (!PrepareForWrite(transaction_, vertex_)) return Error::SERIALIZATION_ERROR;
 
   if (vertex_->deleted) return Error::DELETED_OBJECT;
 
-  if (std::find(vertex_->labels.begin(), vertex_->labels.end(), label) != vertex_->labels.end()) return false;
+  if (vertex_->labels.Contains(label)) return false;
 
   CreateAndLinkDelta(transaction_, vertex_, Delta::RemoveLabelTag(), label);
 
-  vertex_->labels.push_back(label);
+  vertex_->labels.Insert(label);
 
   UpdateOnAddLabel(indices_, label, vertex_, *transaction_);
 
@@ -94,19 +141,17 @@ Result<bool> VertexAccessor::AddLabel(LabelId label) {
 }
 
 Result<bool> VertexAccessor::RemoveLabel(LabelId label) {
-  std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+  std::lock_guard<utils::SeqLock> guard(vertex_->lock);
 
   if (!PrepareForWrite(transaction_, vertex_)) return Error::SERIALIZATION_ERROR;
 
   if (vertex_->deleted) return Error::DELETED_OBJECT;
 
-  auto it = std::find(vertex_->labels.begin(), vertex_->labels.end(), label);
-  if (it == vertex_->labels.end()) return false;
+  if (!vertex_->labels.Contains(label)) return false;
 
   CreateAndLinkDelta(transaction_, vertex_, Delta::AddLabelTag(), label);
 
-  std::swap(*it, *vertex_->labels.rbegin());
-  vertex_->labels.pop_back();
+  vertex_->labels.Erase(label);
   return true;
 }
 
@@ -115,10 +160,18 @@ Result<bool> VertexAccessor::HasLabel(LabelId label, View view) const {
   bool deleted = false;
   bool has_label = false;
   Delta *delta = nullptr;
-  {
-    std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+  LabelSet::RawCopy labels;
+  if (vertex_->lock.TryOptimisticRead([&] {
+        deleted = vertex_->deleted;
+        labels = LabelSet::RawCopy(vertex_->labels);
+        delta = vertex_->delta;
+        return labels.IsInline();
+      })) {
+    has_label = labels.Contains(label);
+  } else {
+    std::lock_guard<utils::SeqLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
-    has_label = std::find(vertex_->labels.begin(), vertex_->labels.end(), label) != vertex_->labels.end();
+    has_label = vertex_->labels.Contains(label);
     delta = vertex_->delta;
   }
   ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &has_label, label](const Delta &delta) {
@@ -163,10 +216,18 @@ Result<std::vector<LabelId>> VertexAccessor::Labels(View view) const {
   bool deleted = false;
   std::vector<LabelId> labels;
   Delta *delta = nullptr;
-  {
-    std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+  LabelSet::RawCopy labels_copy;
+  if (vertex_->lock.TryOptimisticRead([&] {
+        deleted = vertex_->deleted;
+        labels_copy = LabelSet::RawCopy(vertex_->labels);
+        delta = vertex_->delta;
+        return labels_copy.IsInline();
+      })) {
+    labels.assign(labels_copy.begin(), labels_copy.end());
+  } else {
+    std::lock_guard<utils::SeqLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
-    labels = vertex_->labels;
+    labels.assign(vertex_->labels.begin(), vertex_->labels.end());
     delta = vertex_->delta;
   }
   ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &labels](const Delta &delta) {
@@ -209,7 +270,7 @@ Result<std::vector<LabelId>> VertexAccessor::Labels(View view) const {
 
 Result<PropertyValue> VertexAccessor::SetProperty(PropertyId property, const PropertyValue &value) {
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-  std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+  std::lock_guard<utils::SeqLock> guard(vertex_->lock);
 
   if (!PrepareForWrite(transaction_, vertex_)) return Error::SERIALIZATION_ERROR;
 
@@ -231,7 +292,7 @@ Result<PropertyValue> VertexAccessor::SetProperty(PropertyId property, const Pro
 }
 
 Result<std::map<PropertyId, PropertyValue>> VertexAccessor::ClearProperties() {
-  std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+  std::lock_guard<utils::SeqLock> guard(vertex_->lock);
 
   if (!PrepareForWrite(transaction_, vertex_)) return Error::SERIALIZATION_ERROR;
 
@@ -253,8 +314,20 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
   bool deleted = false;
   PropertyValue value;
   Delta *delta = nullptr;
-  {
-    std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+  std::optional<PropertyValue> copied_value;
+  PropertyStore::RawCopy properties;
+  if (vertex_->lock.TryOptimisticRead([&] {
+        deleted = vertex_->deleted;
+        properties = PropertyStore::RawCopy(vertex_->properties);
+        delta = vertex_->delta;
+        return properties.IsInline();
+      })) {
+    copied_value = properties.GetProperty(property);
+  }
+  if (copied_value) {
+    value = std::move(*copied_value);
+  } else {
+    std::lock_guard<utils::SeqLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
     value = vertex_->properties.GetProperty(property);
     delta = vertex_->delta;
@@ -294,8 +367,20 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
   bool deleted = false;
   std::map<PropertyId, PropertyValue> properties;
   Delta *delta = nullptr;
-  {
-    std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+  std::optional<std::map<PropertyId, PropertyValue>> copied_properties;
+  PropertyStore::RawCopy properties_copy;
+  if (vertex_->lock.TryOptimisticRead([&] {
+        deleted = vertex_->deleted;
+        properties_copy = PropertyStore::RawCopy(vertex_->properties);
+        delta = vertex_->delta;
+        return properties_copy.IsInline();
+      })) {
+    copied_properties = properties_copy.Properties();
+  }
+  if (copied_properties) {
+    properties = std::move(*copied_properties);
+  } else {
+    std::lock_guard<utils::SeqLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
     properties = vertex_->properties.Properties();
     delta = vertex_->delta;
@@ -347,19 +432,9 @@ Result<std::vector<EdgeAccessor>> VertexAccessor::InEdges(View view, const std::
   std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> in_edges;
   Delta *delta = nullptr;
   {
-    std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+    std::lock_guard<utils::SeqLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
-    if (edge_types.empty() && !destination) {
-      in_edges = vertex_->in_edges;
-    } else {
-      for (const auto &item : vertex_->in_edges) {
-        const auto &[edge_type, from_vertex, edge] = item;
-        if (destination && from_vertex != destination->vertex_) continue;
-        if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end())
-          continue;
-        in_edges.push_back(item);
-      }
-    }
+    detail::CollectEdges(vertex_->in_edges, edge_types, destination ? destination->vertex_ : nullptr, &in_edges);
     delta = vertex_->delta;
   }
   ApplyDeltasForRead(
@@ -427,19 +502,9 @@ Result<std::vector<EdgeAccessor>> VertexAccessor::OutEdges(View view, const std:
   std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
   Delta *delta = nullptr;
   {
-    std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+    std::lock_guard<utils::SeqLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
-    if (edge_types.empty() && !destination) {
-      out_edges = vertex_->out_edges;
-    } else {
-      for (const auto &item : vertex_->out_edges) {
-        const auto &[edge_type, to_vertex, edge] = item;
-        if (destination && to_vertex != destination->vertex_) continue;
-        if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end())
-          continue;
-        out_edges.push_back(item);
-      }
-    }
+    detail::CollectEdges(vertex_->out_edges, edge_types, destination ? destination->vertex_ : nullptr, &out_edges);
     delta = vertex_->delta;
   }
   ApplyDeltasForRead(
@@ -499,24 +564,391 @@ Result<std::vector<EdgeAccessor>> VertexAccessor::OutEdges(View view, const std:
   return std::move(ret);
 }
 
-Result<size_t> VertexAccessor::InDegree(View view) const {
+struct EdgesIterable::State {
+  using Link = AdjacencyList::value_type;
+
+  // Number of edges that are copied from the vertex while holding its lock.
+  static constexpr size_t kBatchSize = 64;
+
+  enum class Phase {
+    // Edges are copied in batches from the adjacency list.
+    LIST,
+    // Edges that were removed from the adjacency list by changes that aren't
+    // visible to the transaction are returned.
+    EXTRA,
+    // The adjacency list was modified during the iteration, the remaining
+    // edges were materialized in `remaining`.
+    REMAINING,
+    DONE,
+  };
+
+  Vertex *vertex;
+  Direction direction;
+  std::vector<EdgeTypeId> edge_types;
+  Vertex *destination;
+  Transaction *transaction;
+  Indices *indices;
+  Constraints *constraints;
+  Config::Items config;
+  View view;
+
+  Phase phase{Phase::LIST};
+  bool started{false};
+  uint32_t edges_version{0};
+  // Newest delta of the transaction on the vertex when the iteration started,
+  // `nullptr` if there was none. The changes that the transaction makes after
+  // it aren't visible to the iteration.
+  const Delta *own_delta{nullptr};
+
+  // Position in the adjacency list. The list is visited in ranges, one range
+  // for each requested edge type or a single range if all edge types are
+  // requested.
+  size_t range_index{0};
+  size_t list_pos{0};
+  size_t list_end{0};
+  bool list_exhausted{false};
+
+  // Links that are in the adjacency list, but aren't visible to the
+  // transaction. Sorted by the edge.
+  std::vector<Link> hidden;
+  // Links that aren't in the adjacency list, but are visible to the
+  // transaction.
+  std::vector<Link> extra;
+  size_t extra_pos{0};
+
+  // `EdgeRef` isn't default constructible, so the batch slots are optional.
+  std::array<std::optional<Link>, kBatchSize> batch;
+  size_t batch_size{0};
+  size_t batch_pos{0};
+
+  // Edges that were already returned from previous batches. They are tracked
+  // only when more than one batch is needed and they are needed only if the
+  // adjacency list is modified, but that can't be known in advance because the
+  // modification may reorder the list.
+  std::vector<EdgeRef> returned;
+
+  std::vector<Link> remaining;
+  size_t remaining_pos{0};
+
+  std::optional<Link> current;
+
+  State(Vertex *vertex, Direction direction, const std::vector<EdgeTypeId> &edge_types, Vertex *destination,
+        Transaction *transaction, Indices *indices, Constraints *constraints, Config::Items config, View view)
+      : vertex(vertex),
+        direction(direction),
+        edge_types(edge_types),
+        destination(destination),
+        transaction(transaction),
+        indices(indices),
+        constraints(constraints),
+        config(config),
+        view(view) {}
+
+  const AdjacencyList &Edges() const { return direction == Direction::IN ? vertex->in_edges : vertex->out_edges; }
+
+  bool Matches(EdgeTypeId edge_type, const Vertex *other_vertex) const {
+    if (destination && other_vertex != destination) return false;
+    if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end())
+      return false;
+    return true;
+  }
+
+  bool IsHidden(const Link &link) const {
+    return !hidden.empty() && std::binary_search(hidden.begin(), hidden.end(), link, CompareByEdge);
+  }
+
+  // Moves the list position to the next range of the adjacency list and
+  // returns `false` if there are no more ranges.
+  bool NextRange(const AdjacencyList &edges) {
+    if (edge_types.empty()) {
+      if (range_index > 0) return false;
+      ++range_index;
+      list_pos = 0;
+      list_end = edges.size();
+      return true;
+    }
+    while (range_index < edge_types.size()) {
+      auto type_it = edge_types.begin() + range_index++;
+      // Skip duplicated edge types so that each edge is returned only once.
+      if (std::find(edge_types.begin(), type_it, *type_it) != type_it) continue;
+      auto [first, last] = edges.EdgeTypeRange(*type_it);
+      list_pos = first - edges.begin();
+      list_end = last - edges.begin();
+      return true;
+    }
+    return false;
+  }
+
+  void FetchBatch() {
+    // The edges of the previous batch are remembered only now, when it is
+    // known that there is more than one batch.
+    for (size_t i = 0; i < batch_size; ++i) {
+      returned.push_back(std::get<2>(*batch[i]));
+    }
+    batch_size = 0;
+    batch_pos = 0;
+
+    std::unique_lock<utils::SeqLock> guard(vertex->lock);
+    if (vertex->edges_version != edges_version) {
+      MaterializeRemaining(&guard);
+      return;
+    }
+    const auto &edges = Edges();
+    while (batch_size < kBatchSize) {
+      if (list_pos == list_end) {
+        if (!NextRange(edges)) {
+          list_exhausted = true;
+          break;
+        }
+        continue;
+      }
+      const auto &link = *(edges.begin() + list_pos++);
+      if (destination && std::get<1>(link) != destination) continue;
+      if (IsHidden(link)) continue;
+      batch[batch_size++] = link;
+    }
+  }
+
+  // Collects all edges that were visible to the transaction when the
+  // iteration started, except for those that were already returned. Used when
+  // the adjacency list was modified during the iteration.
+  void MaterializeRemaining(std::unique_lock<utils::SeqLock> *guard) {
+    remaining.clear();
+    detail::CollectEdges(Edges(), edge_types, destination, &remaining);
+    Delta *delta = vertex->delta;
+    guard->unlock();
+
+    const auto add_action = direction == Direction::IN ? Delta::Action::ADD_IN_EDGE : Delta::Action::ADD_OUT_EDGE;
+    const auto remove_action =
+        direction == Direction::IN ? Delta::Action::REMOVE_IN_EDGE : Delta::Action::REMOVE_OUT_EDGE;
+    auto apply = [&, this](const Delta &delta) {
+      if (delta.action != add_action && delta.action != remove_action) return;
+      if (!Matches(delta.vertex_edge.edge_type, delta.vertex_edge.vertex)) return;
+      Link link{delta.vertex_edge.edge_type, delta.vertex_edge.vertex, delta.vertex_edge.edge};
+      auto it = std::find(remaining.begin(), remaining.end(), link);
+      if (delta.action == add_action) {
+        // Add the edge because we don't see the removal.
+        MG_ASSERT(it == remaining.end(), "Invalid database state!");
+        remaining.push_back(link);
+      } else {
+        // Remove the edge because we don't see the addition.
+        MG_ASSERT(it != remaining.end(), "Invalid database state!");
+        std::swap(*it, *remaining.rbegin());
+        remaining.pop_back();
+      }
+    };
+    // The changes of the transaction are at the start of the delta chain. The
+    // ones made after the iteration started are undone regardless of the view,
+    // the rest of the chain is applied as usual.
+    while (delta != nullptr && delta != own_delta && delta->timestamp == transaction->commit_timestamp.get()) {
+      apply(*delta);
+      delta = delta->next.load(std::memory_order_acquire);
+    }
+    ApplyDeltasForRead(transaction, delta, view, apply);
+
+    std::sort(returned.begin(), returned.end(), [](const EdgeRef &a, const EdgeRef &b) {
+      return a.gid.AsUint() < b.gid.AsUint();
+    });
+    auto is_returned = [this](const Link &link) {
+      return std::binary_search(returned.begin(), returned.end(), std::get<2>(link),
+                                [](const EdgeRef &a, const EdgeRef &b) { return a.gid.AsUint() < b.gid.AsUint(); });
+    };
+    remaining.erase(std::remove_if(remaining.begin(), remaining.end(), is_returned), remaining.end());
+    remaining_pos = 0;
+    phase = Phase::REMAINING;
+  }
+
+  void Advance() {
+    started = true;
+    while (true) {
+      switch (phase) {
+        case Phase::LIST: {
+          if (batch_pos < batch_size) {
+            current = *batch[batch_pos++];
+            return;
+          }
+          if (list_exhausted) {
+            phase = Phase::EXTRA;
+          } else {
+            FetchBatch();
+          }
+          break;
+        }
+        case Phase::EXTRA: {
+          if (extra_pos < extra.size()) {
+            current = extra[extra_pos++];
+            return;
+          }
+          phase = Phase::DONE;
+          break;
+        }
+        case Phase::REMAINING: {
+          if (remaining_pos < remaining.size()) {
+            current = remaining[remaining_pos++];
+            return;
+          }
+          phase = Phase::DONE;
+          break;
+        }
+        case Phase::DONE: {
+          current = std::nullopt;
+          return;
+        }
+      }
+    }
+  }
+
+  static bool CompareByEdge(const Link &a, const Link &b) {
+    return std::get<2>(a).gid.AsUint() < std::get<2>(b).gid.AsUint();
+  }
+};
+
+EdgesIterable::EdgesIterable(std::unique_ptr<State> state) : state_(std::move(state)) {}
+
+EdgesIterable::EdgesIterable(EdgesIterable &&) noexcept = default;
+
+EdgesIterable &EdgesIterable::operator=(EdgesIterable &&) noexcept = default;
+
+EdgesIterable::~EdgesIterable() = default;
+
+EdgesIterable::Iterator EdgesIterable::begin() const {
+  if (!state_->started) state_->Advance();
+  return Iterator(state_.get());
+}
+
+EdgeAccessor EdgesIterable::Iterator::operator*() const {
+  const auto &[edge_type, other_vertex, edge] = *state_->current;
+  if (state_->direction == Direction::IN) {
+    return EdgeAccessor(edge, edge_type, other_vertex, state_->vertex, state_->transaction, state_->indices,
+                        state_->constraints, state_->config);
+  }
+  return EdgeAccessor(edge, edge_type, state_->vertex, other_vertex, state_->transaction, state_->indices,
+                      state_->constraints, state_->config);
+}
+
+EdgesIterable::Iterator &EdgesIterable::Iterator::operator++() {
+  state_->Advance();
+  return *this;
+}
+
+bool EdgesIterable::Iterator::AtEnd() const { return state_ == nullptr || !state_->current; }
+
+bool EdgesIterable::Iterator::operator==(const Iterator &other) const {
+  if (AtEnd() || other.AtEnd()) return AtEnd() == other.AtEnd();
+  return state_ == other.state_;
+}
+
+Result<EdgesIterable> VertexAccessor::IterateEdges(EdgesIterable::Direction direction, View view,
+                                                   const std::vector<EdgeTypeId> &edge_types,
+                                                   const VertexAccessor *destination) const {
+  MG_ASSERT(!destination || destination->transaction_ == transaction_, "Invalid accessor!");
+  auto state = std::make_unique<EdgesIterable::State>(vertex_, direction, edge_types,
+                                                      destination ? destination->vertex_ : nullptr, transaction_,
+                                                      indices_, constraints_, config_, view);
+  bool exists = true;
+  bool deleted = false;
+  Delta *delta = nullptr;
+  auto read = [&] {
+    deleted = vertex_->deleted;
+    state->edges_version = vertex_->edges_version;
+    delta = vertex_->delta;
+    return true;
+  };
+  if (!vertex_->lock.TryOptimisticRead(read)) {
+    std::lock_guard<utils::SeqLock> guard(vertex_->lock);
+    read();
+  }
+  if (delta != nullptr && delta->timestamp == transaction_->commit_timestamp.get()) {
+    state->own_delta = delta;
+  }
+  // Only the changes to the adjacency list are recorded here, the list itself
+  // is read lazily during the iteration.
+  const auto add_action =
+      direction == EdgesIterable::Direction::IN ? Delta::Action::ADD_IN_EDGE : Delta::Action::ADD_OUT_EDGE;
+  const auto remove_action =
+      direction == EdgesIterable::Direction::IN ? Delta::Action::REMOVE_IN_EDGE : Delta::Action::REMOVE_OUT_EDGE;
+  ApplyDeltasForRead(transaction_, delta, view, [&](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE: {
+        if (delta.action != add_action && delta.action != remove_action) break;
+        if (!state->Matches(delta.vertex_edge.edge_type, delta.vertex_edge.vertex)) break;
+        EdgesIterable::State::Link link{delta.vertex_edge.edge_type, delta.vertex_edge.vertex, delta.vertex_edge.edge};
+        // An edge that is both added and removed by invisible changes cancels
+        // out, otherwise it is either hidden or an extra edge.
+        auto &same = delta.action == add_action ? state->extra : state->hidden;
+        auto &opposite = delta.action == add_action ? state->hidden : state->extra;
+        auto it = std::find(opposite.begin(), opposite.end(), link);
+        if (it != opposite.end()) {
+          opposite.erase(it);
+        } else {
+          MG_ASSERT(std::find(same.begin(), same.end(), link) == same.end(), "Invalid database state!");
+          same.push_back(link);
+        }
+        break;
+      }
+      case Delta::Action::DELETE_OBJECT: {
+        exists = false;
+        break;
+      }
+      case Delta::Action::RECREATE_OBJECT: {
+        deleted = false;
+        break;
+      }
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+        break;
+    }
+  });
+  if (!exists) return Error::NONEXISTENT_OBJECT;
+  if (deleted) return Error::DELETED_OBJECT;
+  std::sort(state->hidden.begin(), state->hidden.end(), EdgesIterable::State::CompareByEdge);
+  return EdgesIterable(std::move(state));
+}
+
+Result<EdgesIterable> VertexAccessor::IterateInEdges(View view, const std::vector<EdgeTypeId> &edge_types,
+                                                     const VertexAccessor *destination) const {
+  return IterateEdges(EdgesIterable::Direction::IN, view, edge_types, destination);
+}
+
+Result<EdgesIterable> VertexAccessor::IterateOutEdges(View view, const std::vector<EdgeTypeId> &edge_types,
+                                                      const VertexAccessor *destination) const {
+  return IterateEdges(EdgesIterable::Direction::OUT, view, edge_types, destination);
+}
+
+Result<size_t> VertexAccessor::InDegree(View view, const std::vector<EdgeTypeId> &edge_types) const {
   bool exists = true;
   bool deleted = false;
   size_t degree = 0;
   Delta *delta = nullptr;
-  {
-    std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+  // Without an edge type filter the degree is the size of the adjacency list,
+  // which can be read without accessing the list's buffer.
+  auto read = [&] {
     deleted = vertex_->deleted;
     degree = vertex_->in_edges.size();
     delta = vertex_->delta;
+    return true;
+  };
+  if (!edge_types.empty() || !vertex_->lock.TryOptimisticRead(read)) {
+    std::lock_guard<utils::SeqLock> guard(vertex_->lock);
+    deleted = vertex_->deleted;
+    degree = detail::CountEdges(vertex_->in_edges, edge_types);
+    delta = vertex_->delta;
   }
-  ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &degree](const Delta &delta) {
+  auto has_edge_type = [&edge_types](const Delta &delta) {
+    return edge_types.empty() ||
+           std::find(edge_types.begin(), edge_types.end(), delta.vertex_edge.edge_type) != edge_types.end();
+  };
+  ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &degree, &has_edge_type](const Delta &delta) {
     switch (delta.action) {
       case Delta::Action::ADD_IN_EDGE:
-        ++degree;
+        if (has_edge_type(delta)) ++degree;
         break;
       case Delta::Action::REMOVE_IN_EDGE:
-        --degree;
+        if (has_edge_type(delta)) --degree;
         break;
       case Delta::Action::DELETE_OBJECT:
         exists = false;
@@ -537,24 +969,36 @@ Result<size_t> VertexAccessor::InDegree(View view) const {
   return degree;
 }
 
-Result<size_t> VertexAccessor::OutDegree(View view) const {
+Result<size_t> VertexAccessor::OutDegree(View view, const std::vector<EdgeTypeId> &edge_types) const {
   bool exists = true;
   bool deleted = false;
   size_t degree = 0;
   Delta *delta = nullptr;
-  {
-    std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+  // Without an edge type filter the degree is the size of the adjacency list,
+  // which can be read without accessing the list's buffer.
+  auto read = [&] {
     deleted = vertex_->deleted;
     degree = vertex_->out_edges.size();
     delta = vertex_->delta;
+    return true;
+  };
+  if (!edge_types.empty() || !vertex_->lock.TryOptimisticRead(read)) {
+    std::lock_guard<utils::SeqLock> guard(vertex_->lock);
+    deleted = vertex_->deleted;
+    degree = detail::CountEdges(vertex_->out_edges, edge_types);
+    delta = vertex_->delta;
   }
-  ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &degree](const Delta &delta) {
+  auto has_edge_type = [&edge_types](const Delta &delta) {
+    return edge_types.empty() ||
+           std::find(edge_types.begin(), edge_types.end(), delta.vertex_edge.edge_type) != edge_types.end();
+  };
+  ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &degree, &has_edge_type](const Delta &delta) {
     switch (delta.action) {
       case Delta::Action::ADD_OUT_EDGE:
-        ++degree;
+        if (has_edge_type(delta)) ++degree;
         break;
       case Delta::Action::REMOVE_OUT_EDGE:
-        --degree;
+        if (has_edge_type(delta)) --degree;
         break;
       case Delta::Action::DELETE_OBJECT:
         exists = false;
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <iterator>
+#include <memory>
 #include <optional>
 
 #include "storage/v2/vertex.hpp"
@@ -27,6 +29,73 @@ class Storage;
 struct Indices;
 struct Constraints;
 
+/// Lazy, single-pass iterable over the in or out edges of a vertex.
+///
+/// Instead of copying the whole adjacency list up front, the edges are copied
+/// from the vertex in fixed-size batches while the vertex lock is held and the
+/// `EdgeAccessor` objects are created one by one as the iteration progresses.
+/// This makes expansions that stop early (e.g. due to `LIMIT`) independent of
+/// the vertex degree. The deltas of the vertex are inspected only once, when
+/// the iterable is created.
+///
+/// If the adjacency list is modified while the iteration is in progress, the
+/// remaining edges are materialized from the current state of the vertex and
+/// the edges that were already returned are skipped, so every visible edge is
+/// returned exactly once. Because a modification can move the edges around in
+/// the list, the position alone can't tell which edges were returned. Once the
+/// iteration goes past the first batch, the returned edges are therefore
+/// remembered (an `EdgeRef` each), so a complete iteration over a vertex still
+/// takes memory proportional to its degree, though a lot less than the
+/// `EdgeAccessor` objects created by `InEdges` and `OutEdges`.
+///
+/// All iterators obtained from the same iterable share the iteration position,
+/// so an iterator must not be used after any of its copies was incremented.
+class EdgesIterable final {
+ public:
+  enum class Direction { IN, OUT };
+
+  struct State;
+
+  explicit EdgesIterable(std::unique_ptr<State> state);
+
+  EdgesIterable(const EdgesIterable &) = delete;
+  EdgesIterable &operator=(const EdgesIterable &) = delete;
+
+  EdgesIterable(EdgesIterable &&) noexcept;
+  EdgesIterable &operator=(EdgesIterable &&) noexcept;
+
+  ~EdgesIterable();
+
+  class Iterator final {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = EdgeAccessor;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = EdgeAccessor;
+
+    explicit Iterator(State *state) : state_(state) {}
+
+    EdgeAccessor operator*() const;
+
+    Iterator &operator++();
+
+    bool operator==(const Iterator &other) const;
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+   private:
+    bool AtEnd() const;
+
+    State *state_;
+  };
+
+  Iterator begin() const;
+  Iterator end() const { return Iterator(nullptr); }
+
+ private:
+  std::unique_ptr<State> state_;
+};
+
 class VertexAccessor final {
  private:
   friend class Storage;
@@ -90,9 +159,29 @@ class VertexAccessor final {
   Result<std::vector<EdgeAccessor>> OutEdges(View view, const std::vector<EdgeTypeId> &edge_types = {},
                                              const VertexAccessor *destination = nullptr) const;
 
-  Result<size_t> InDegree(View view) const;
+  /// Returns a lazy iterable over the in edges of the vertex. The same edges
+  /// as with `InEdges` are returned, but they are produced on demand. Changes
+  /// that the transaction makes during the iteration aren't visible to it.
+  /// @throw std::bad_alloc
+  Result<EdgesIterable> IterateInEdges(View view, const std::vector<EdgeTypeId> &edge_types = {},
+                                       const VertexAccessor *destination = nullptr) const;
+
+  /// Returns a lazy iterable over the out edges of the vertex. The same edges
+  /// as with `OutEdges` are returned, but they are produced on demand. Changes
+  /// that the transaction makes during the iteration aren't visible to it.
+  /// @throw std::bad_alloc
+  Result<EdgesIterable> IterateOutEdges(View view, const std::vector<EdgeTypeId> &edge_types = {},
+                                        const VertexAccessor *destination = nullptr) const;
 
-  Result<size_t> OutDegree(View view) const;
+  /// Returns the number of in edges of the vertex that have one of the given
+  /// edge types, or all in edges if `edge_types` is empty. The edges aren't
+  /// materialized, only the sizes of the edge type groups are read.
+  Result<size_t> InDegree(View view, const std::vector<EdgeTypeId> &edge_types = {}) const;
+
+  /// Returns the number of out edges of the vertex that have one of the given
+  /// edge types, or all out edges if `edge_types` is empty. The edges aren't
+  /// materialized, only the sizes of the edge type groups are read.
+  Result<size_t> OutDegree(View view, const std::vector<EdgeTypeId> &edge_types = {}) const;
 
   Gid Gid() const noexcept { return vertex_->gid; }
 
@@ -102,6 +191,10 @@ class VertexAccessor final {
   bool operator!=(const VertexAccessor &other) const noexcept { return !(*this == other); }
 
  private:
+  Result<EdgesIterable> IterateEdges(EdgesIterable::Direction direction, View view,
+                                     const std::vector<EdgeTypeId> &edge_types,
+                                     const VertexAccessor *destination) const;
+
   Vertex *vertex_;
   Transaction *transaction_;
   Indices *indices_;
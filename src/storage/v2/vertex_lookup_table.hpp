@@ -0,0 +1,114 @@
+// Copyright 2021 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/skip_list.hpp"
+
+namespace storage {
+
+/// Table that maps the `Gid` of a vertex directly to the vertex in the vertex
+/// skip list. Vertex gids are allocated sequentially, so the table is a dense
+/// array split into chunks of `kChunkSize` entries that are allocated the first
+/// time a gid from the chunk is inserted. Gids that don't fit into the table
+/// (larger than `kMaxChunks * kChunkSize`) are ignored and should be looked up
+/// in the skip list.
+///
+/// `Insert`, `Remove` and `Find` are thread-safe and lock-free. The table
+/// doesn't own the vertices, so the caller must hold an accessor to the vertex
+/// skip list while using the vertex returned by `Find`, and must remove the
+/// vertex from the table before removing it from the skip list.
+class VertexLookupTable final {
+ public:
+  static constexpr uint64_t kChunkSize = 1 << 16;
+  static constexpr uint64_t kMaxChunks = 1 << 16;
+
+  VertexLookupTable() : chunks_(std::make_unique<std::atomic<Chunk *>[]>(kMaxChunks)) {}
+
+  VertexLookupTable(const VertexLookupTable &) = delete;
+  VertexLookupTable &operator=(const VertexLookupTable &) = delete;
+  VertexLookupTable(VertexLookupTable &&) = delete;
+  VertexLookupTable &operator=(VertexLookupTable &&) = delete;
+
+  ~VertexLookupTable() { Clear(); }
+
+  static bool Covers(Gid gid) { return gid.AsUint() < kMaxChunks * kChunkSize; }
+
+  /// @throw std::bad_alloc
+  void Insert(Gid gid, Vertex *vertex) {
+    if (!Covers(gid)) return;
+    auto &chunk_ptr = chunks_[gid.AsUint() / kChunkSize];
+    auto *chunk = chunk_ptr.load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+      auto new_chunk = std::make_unique<Chunk>();
+      if (chunk_ptr.compare_exchange_strong(chunk, new_chunk.get(), std::memory_order_acq_rel)) {
+        chunk = new_chunk.release();
+        allocated_chunks_.fetch_add(1, std::memory_order_acq_rel);
+      }
+    }
+    chunk->vertices[gid.AsUint() % kChunkSize].store(vertex, std::memory_order_release);
+  }
+
+  void Remove(Gid gid) {
+    if (!Covers(gid)) return;
+    auto *chunk = chunks_[gid.AsUint() / kChunkSize].load(std::memory_order_acquire);
+    if (chunk == nullptr) return;
+    chunk->vertices[gid.AsUint() % kChunkSize].store(nullptr, std::memory_order_release);
+  }
+
+  /// @return the vertex or `nullptr` if the vertex isn't in the table
+  Vertex *Find(Gid gid) const {
+    if (!Covers(gid)) return nullptr;
+    const auto *chunk = chunks_[gid.AsUint() / kChunkSize].load(std::memory_order_acquire);
+    if (chunk == nullptr) return nullptr;
+    return chunk->vertices[gid.AsUint() % kChunkSize].load(std::memory_order_acquire);
+  }
+
+  /// Removes all vertices from the table and inserts all vertices from
+  /// `vertices`. This function isn't thread-safe.
+  /// @throw std::bad_alloc
+  void Rebuild(utils::SkipList<Vertex>::Accessor *vertices) {
+    Clear();
+    for (auto &vertex : *vertices) {
+      Insert(vertex.gid, &vertex);
+    }
+  }
+
+  /// This function isn't thread-safe.
+  void Clear() {
+    for (uint64_t i = 0; i < kMaxChunks; ++i) {
+      delete chunks_[i].exchange(nullptr, std::memory_order_acq_rel);
+    }
+    allocated_chunks_.store(0, std::memory_order_release);
+  }
+
+  /// @return the number of bytes used by the table
+  uint64_t MemoryUsage() const {
+    return kMaxChunks * sizeof(std::atomic<Chunk *>) +
+           allocated_chunks_.load(std::memory_order_acquire) * sizeof(Chunk);
+  }
+
+ private:
+  struct Chunk {
+    std::atomic<Vertex *> vertices[kChunkSize]{};
+  };
+
+  std::unique_ptr<std::atomic<Chunk *>[]> chunks_;
+  std::atomic<uint64_t> allocated_chunks_{0};
+};
+
+}  // namespace storage
@@ -473,6 +473,15 @@ void OutputFile::Sync() {
   written_since_last_sync_ = 0;
 }
 
+OutputFileSyncHandle OutputFile::FlushForSync() {
+  FlushBuffer(true);
+
+  int fd = dup(fd_);
+  MG_ASSERT(fd != -1, "While trying to duplicate the descriptor of {}, an error occurred: {} ({}).", path_,
+            strerror(errno), errno);
+  return {fd, path_};
+}
+
 void OutputFile::Close() noexcept {
   FlushBuffer(true);
 
@@ -499,6 +508,35 @@ void OutputFile::Close() noexcept {
   path_ = "";
 }
 
+OutputFileSyncHandle::OutputFileSyncHandle(int fd, std::filesystem::path path) : fd_(fd), path_(std::move(path)) {}
+
+OutputFileSyncHandle::~OutputFileSyncHandle() {
+  if (fd_ != -1) close(fd_);
+}
+
+OutputFileSyncHandle::OutputFileSyncHandle(OutputFileSyncHandle &&other) noexcept
+    : fd_(other.fd_), path_(std::move(other.path_)) {
+  other.fd_ = -1;
+}
+
+void OutputFileSyncHandle::Sync() {
+  MG_ASSERT(fd_ != -1, "Syncing through an invalid handle.");
+
+  int ret = 0;
+  while (true) {
+    ret = fdatasync(fd_);
+    if (ret == -1 && errno == EINTR) {
+      // The call was interrupted, try again...
+      continue;
+    } else {
+      break;
+    }
+  }
+
+  // Errors are fatal for the same reasons as in `OutputFile::Sync`.
+  MG_ASSERT(ret == 0, "While trying to sync {}, an error occurred: {} ({}).", path_, strerror(errno), errno);
+}
+
 void OutputFile::FlushBuffer(bool force_flush) {
   MG_ASSERT(IsOpen(), "Flushing an unopend file.");
 
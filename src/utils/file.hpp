@@ -143,6 +143,29 @@ class InputFile {
   size_t buffer_position_{0};
 };
 
+/// Handle used to sync the data written to an `OutputFile` from a different
+/// thread, without blocking the thread that keeps writing to the file. It owns
+/// a duplicate of the file descriptor so it stays valid even after the file is
+/// closed.
+class OutputFileSyncHandle {
+ public:
+  OutputFileSyncHandle(int fd, std::filesystem::path path);
+  ~OutputFileSyncHandle();
+
+  OutputFileSyncHandle(const OutputFileSyncHandle &) = delete;
+  OutputFileSyncHandle &operator=(const OutputFileSyncHandle &) = delete;
+  OutputFileSyncHandle(OutputFileSyncHandle &&other) noexcept;
+  OutputFileSyncHandle &operator=(OutputFileSyncHandle &&other) = delete;
+
+  /// Syncs the data that was written to the file before the handle was
+  /// created using `fdatasync`. On failure it crashes the program.
+  void Sync();
+
+ private:
+  int fd_;
+  std::filesystem::path path_;
+};
+
 /// This class implements a file handler that is used for mission critical files
 /// that need to be written and synced to permanent storage. Typical usage for
 /// this class is in implementation of write-ahead logging or anything similar
@@ -232,6 +255,11 @@ class OutputFile {
   /// and misuse it crashes the program.
   void Sync();
 
+  /// Writes the internal buffer to the currently opened file and returns a
+  /// handle that can sync the written data from another thread. On failure
+  /// and misuse it crashes the program.
+  OutputFileSyncHandle FlushForSync();
+
   /// Closes the currently opened file. It doesn't perform a `Sync` on the
   /// file. On failure and misuse it crashes the program.
   void Close() noexcept;
@@ -0,0 +1,105 @@
+// Copyright 2021 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <emmintrin.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace utils {
+
+/// This class is a spin lock that additionally allows the data it guards to
+/// be read optimistically, without taking the lock (a sequence lock). Every
+/// lock and unlock increments the sequence number of the lock, so the sequence
+/// number is odd while a writer holds the lock and it changes whenever the
+/// guarded data could have been modified.
+///
+/// Writers use the lock just like any other lock (e.g. with `std::lock_guard`).
+/// Readers copy the data in `TryOptimisticRead` and the copy is used only if
+/// the sequence number didn't change while it was being made. Because the copy
+/// races with the writers, the optimistic read must only copy data that is
+/// stored in the guarded object itself (it must never follow pointers) and
+/// nothing may be derived from the copy until it's validated.
+class SeqLock {
+ public:
+  /// Number of optimistic read attempts before `TryOptimisticRead` gives up
+  /// and lets the caller take the lock.
+  static constexpr int kMaxOptimisticReadAttempts = 8;
+
+  SeqLock() = default;
+
+  SeqLock(SeqLock &&other) noexcept : sequence_(other.sequence_.load(std::memory_order_relaxed)) {
+    other.sequence_.store(0, std::memory_order_relaxed);
+  }
+
+  SeqLock &operator=(SeqLock &&other) noexcept {
+    sequence_.store(other.sequence_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    other.sequence_.store(0, std::memory_order_relaxed);
+    return *this;
+  }
+
+  SeqLock(const SeqLock &) = delete;
+  SeqLock &operator=(const SeqLock &) = delete;
+
+  ~SeqLock() = default;
+
+  void lock() {
+    while (!try_lock()) {
+      while (sequence_.load(std::memory_order_relaxed) & 1) _mm_pause();
+    }
+  }
+
+  bool try_lock() {
+    auto sequence = sequence_.load(std::memory_order_relaxed);
+    if (sequence & 1) return false;
+    if (!sequence_.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {
+      return false;
+    }
+    // The odd sequence number must be visible before any of the writes to the
+    // guarded data.
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+  }
+
+  void unlock() { sequence_.store(sequence_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  /// Calls `read` to copy the guarded data without taking the lock. The call is
+  /// repeated while a writer modifies the data concurrently, at most
+  /// `kMaxOptimisticReadAttempts` times. `read` returns `false` when the data
+  /// can't be copied optimistically (e.g. part of it is stored outside of the
+  /// guarded object). Returns `true` if the last copy made by `read` is
+  /// consistent, otherwise the caller should take the lock and read the data
+  /// again.
+  template <typename TFunc>
+  bool TryOptimisticRead(TFunc &&read) const {
+    for (int attempt = 0; attempt < kMaxOptimisticReadAttempts; ++attempt) {
+      const auto sequence = sequence_.load(std::memory_order_acquire);
+      if (sequence & 1) {
+        _mm_pause();
+        continue;
+      }
+      if (!read()) return false;
+      // The reads of the guarded data must be done before the sequence number
+      // is read again.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence_.load(std::memory_order_relaxed) == sequence) return true;
+    }
+    return false;
+  }
+
+ private:
+  std::atomic<uint32_t> sequence_{0};
+};
+
+}  // namespace utils
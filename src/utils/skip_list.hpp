@@ -20,6 +20,7 @@
 #include <optional>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "utils/bound.hpp"
 #include "utils/linux.hpp"
@@ -113,6 +114,16 @@ size_t SkipListNodeSize(const SkipListNode<TObj> &node) {
   return sizeof(node) + node.height * sizeof(std::atomic<SkipListNode<TObj> *>);
 }
 
+/// Get the average size in bytes of a SkipListNode instance. The node heights
+/// are geometrically distributed (see the `gen_height` function), so the
+/// average height of a node is 2.
+///
+/// This can be used to estimate the memory used by a SkipList from its size.
+template <typename TObj>
+constexpr size_t AverageSkipListNodeSize() {
+  return sizeof(SkipListNode<TObj>) + 2 * sizeof(std::atomic<SkipListNode<TObj> *>);
+}
+
 /// A helper function for determining the skip list layer used for estimating
 /// the number of elements in, e.g. a database index. The lower layer we use,
 /// the better approximation we get (if we use the lowest layer, we get the
@@ -736,6 +747,18 @@ class SkipList final {
       return skiplist_->template estimate_average_number_of_equals(equal_cmp, max_layer_for_estimation);
     }
 
+    /// Splits the list into at most `max_chunks` consecutive ranges of
+    /// approximately equal size. The ranges are determined by walking one of
+    /// the upper layers of the list, so not all items are visited. When items
+    /// are removed from the list while the ranges are iterated, a removed
+    /// range boundary is skipped, so the iteration of a range should also stop
+    /// at the first item that isn't less than the boundary.
+    ///
+    /// @return pairs of iterators to the beginning and the end of each range
+    std::vector<std::pair<Iterator, Iterator>> partition(uint64_t max_chunks) const {
+      return skiplist_->partition(max_chunks);
+    }
+
     /// Removes the key from the list.
     ///
     /// @return bool indicating whether the removal was successful
@@ -816,6 +839,12 @@ class SkipList final {
       return skiplist_->template estimate_average_number_of_equals(equal_cmp, max_layer_for_estimation);
     }
 
+    /// @sa Accessor::partition
+    std::vector<std::pair<ConstIterator, ConstIterator>> partition(uint64_t max_chunks) const {
+      auto chunks = skiplist_->partition(max_chunks);
+      return {chunks.begin(), chunks.end()};
+    }
+
     uint64_t size() const { return skiplist_->size(); }
 
    private:
@@ -1020,6 +1049,40 @@ class SkipList final {
     return Iterator{nullptr};
   }
 
+  std::vector<std::pair<Iterator, Iterator>> partition(uint64_t max_chunks) const {
+    TNode *first = head_->nexts[0].load(std::memory_order_acquire);
+    if (max_chunks <= 1) {
+      return {{Iterator{first}, Iterator{nullptr}}};
+    }
+
+    // The layer with index `layer` contains about `size / 2^layer` nodes. We
+    // use the highest layer that still contains enough nodes for the chunks
+    // to be balanced.
+    const uint64_t kNodesPerChunk = 32;
+    const uint64_t size = size_.load(std::memory_order_acquire);
+    uint64_t layer = 0;
+    while (layer + 1 < kSkipListMaxHeight && (size >> (layer + 1)) >= max_chunks * kNodesPerChunk) {
+      ++layer;
+    }
+    std::vector<TNode *> nodes;
+    for (TNode *curr = head_->nexts[layer].load(std::memory_order_acquire); curr != nullptr;
+         curr = curr->nexts[layer].load(std::memory_order_acquire)) {
+      if (!curr->marked.load(std::memory_order_acquire)) nodes.push_back(curr);
+    }
+
+    const uint64_t chunks = std::min(max_chunks, static_cast<uint64_t>(nodes.size()));
+    std::vector<std::pair<Iterator, Iterator>> ret;
+    ret.reserve(std::max(chunks, uint64_t{1}));
+    TNode *chunk_begin = first;
+    for (uint64_t i = 1; i < chunks; ++i) {
+      TNode *chunk_end = nodes[i * nodes.size() / chunks];
+      ret.emplace_back(Iterator{chunk_begin}, Iterator{chunk_end});
+      chunk_begin = chunk_end;
+    }
+    ret.emplace_back(Iterator{chunk_begin}, Iterator{nullptr});
+    return ret;
+  }
+
   template <typename TKey>
   uint64_t estimate_count(const TKey &key, int max_layer_for_estimation) const {
     MG_ASSERT(max_layer_for_estimation >= 1 && max_layer_for_estimation <= kSkipListMaxHeight,
@@ -0,0 +1,48 @@
+#include <atomic>
+#include <optional>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/commit_log.hpp"
+
+// The benchmark measures the contention on the commit log. Each iteration
+// finishes one transaction, like the transaction engine does when committing,
+// and the first thread also asks for the oldest active transaction from time
+// to time, like the GC does.
+
+namespace {
+class CommitLogContention : public benchmark::Fixture {
+ protected:
+  void SetUp(const benchmark::State &state) override {
+    if (state.thread_index == 0) {
+      log.emplace();
+      next_id.store(0);
+    }
+  }
+
+  void TearDown(const benchmark::State &state) override {
+    if (state.thread_index == 0) {
+      log.reset();
+    }
+  }
+
+  std::optional<storage::CommitLog> log;
+  std::atomic<uint64_t> next_id{0};
+};
+}  // namespace
+
+// NOLINTNEXTLINE(google-runtime-references)
+BENCHMARK_DEFINE_F(CommitLogContention, MarkFinished)(benchmark::State &state) {
+  uint64_t iteration = 0;
+  while (state.KeepRunning()) {
+    log->MarkFinished(next_id.fetch_add(1, std::memory_order_relaxed));
+    if (state.thread_index == 0 && ++iteration % 64 == 0) {
+      benchmark::DoNotOptimize(log->OldestActive());
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_REGISTER_F(CommitLogContention, MarkFinished)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+#include <atomic>
+#include <list>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/delta_container.hpp"
+#include "storage/v2/storage.hpp"
+#include "utils/stat.hpp"
+
+// The benchmarks fill a delta container the same way a write-heavy transaction
+// does and then release it the way the GC does. Besides the throughput, the
+// increase of the resident memory while the container is full is reported in
+// the `rss_per_delta` label.
+
+namespace {
+std::atomic<uint64_t> kTimestamp{0};
+
+template <typename TContainer>
+void FillAndRelease(benchmark::State &state) {
+  uint64_t counter = 0;
+  int64_t rss_increase = 0;
+  while (state.KeepRunning()) {
+    const auto rss_before = utils::GetMemoryUsage();
+    {
+      TContainer deltas;
+      for (int64_t i = 0; i < state.range(0); ++i) {
+        deltas.emplace_back(storage::Delta::AddLabelTag(), storage::LabelId::FromUint(i), &kTimestamp, 0);
+      }
+      state.PauseTiming();
+      rss_increase = static_cast<int64_t>(utils::GetMemoryUsage()) - static_cast<int64_t>(rss_before);
+      state.ResumeTiming();
+    }
+    counter += state.range(0);
+  }
+  state.SetItemsProcessed(counter);
+  state.SetLabel("rss_per_delta=" +
+                 std::to_string(static_cast<double>(rss_increase) / static_cast<double>(state.range(0))));
+}
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// DeltaContainer
+///////////////////////////////////////////////////////////////////////////////
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void DeltaContainerFill(benchmark::State &state) { FillAndRelease<storage::DeltaContainer>(state); }
+
+BENCHMARK(DeltaContainerFill)->RangeMultiplier(16)->Range(1, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// std::list<Delta>
+///////////////////////////////////////////////////////////////////////////////
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void StdListFill(benchmark::State &state) { FillAndRelease<std::list<storage::Delta>>(state); }
+
+BENCHMARK(StdListFill)->RangeMultiplier(16)->Range(1, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Storage commit
+///////////////////////////////////////////////////////////////////////////////
+
+// Commits a transaction that creates `state.range(0)` vertices with a label and
+// a property each, so that three deltas are created per vertex.
+// NOLINTNEXTLINE(google-runtime-references)
+static void StorageCommit(benchmark::State &state) {
+  storage::Storage storage(storage::Config{.gc = {.type = storage::Config::Gc::Type::NONE}});
+  auto label = storage::LabelId::FromUint(0);
+  auto property = storage::PropertyId::FromUint(0);
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    auto acc = storage.Access();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      auto vertex = acc.CreateVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      MG_ASSERT(vertex.SetProperty(property, storage::PropertyValue(i)).HasValue());
+    }
+    MG_ASSERT(!acc.Commit().HasError());
+    counter += state.range(0) * 3;
+    state.PauseTiming();
+    storage.FreeMemory();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(counter);
+}
+
+BENCHMARK(StorageCommit)->RangeMultiplier(16)->Range(1, 1 << 16)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
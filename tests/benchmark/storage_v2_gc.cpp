@@ -1,4 +1,5 @@
 #include <iostream>
+#include <optional>
 
 #include <gflags/gflags.h>
 
@@ -6,7 +7,9 @@
 #include "utils/timer.hpp"
 
 // This benchmark should be run for a fixed amount of time that is
-// large compared to GC interval to make the output relevant.
+// large compared to GC interval to make the output relevant. After that, the
+// benchmark measures how the garbage collection of a large number of deleted
+// objects scales with the number of GC threads.
 
 const int kNumIterations = 5000000;
 const int kNumVertices = 1000000;
@@ -42,6 +45,53 @@ void UpdateLabelFunc(int thread_id, storage::Storage *storage, const std::vector
   }
 }
 
+// Creates a chain of vertices with a label and edges between them, deletes
+// all of them in a single transaction and measures how long it takes to free
+// them when the garbage collector uses `gc_threads` threads.
+void DeleteAllAndCollectGarbage(uint64_t gc_threads) {
+  storage::Storage storage(
+      storage::Config{.gc = {.type = storage::Config::Gc::Type::NONE, .num_threads = gc_threads}});
+  auto label = storage.NameToLabel("label");
+  auto edge_type = storage.NameToEdgeType("type");
+  MG_ASSERT(storage.CreateIndex(label));
+  MG_ASSERT(storage.CreateIndex(edge_type));
+  {
+    auto acc = storage.Access();
+    std::optional<storage::VertexAccessor> prev;
+    for (int i = 0; i < FLAGS_num_vertices; ++i) {
+      auto vertex = acc.CreateVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      if (prev) {
+        MG_ASSERT(acc.CreateEdge(&*prev, &vertex, edge_type).HasValue());
+      }
+      prev = vertex;
+    }
+    MG_ASSERT(!acc.Commit().HasError());
+  }
+  // Free the deltas of the creation so that only the deletion is measured.
+  storage.FreeMemory();
+  {
+    auto acc = storage.Access();
+    for (auto vertex : acc.Vertices(storage::View::OLD)) {
+      MG_ASSERT(acc.DetachDeleteVertex(&vertex).HasValue());
+    }
+    MG_ASSERT(!acc.Commit().HasError());
+  }
+
+  const auto info_before = storage.GetInfo();
+  utils::Timer timer;
+  storage.FreeMemory();
+  const auto elapsed = timer.Elapsed().count();
+  const auto info = storage.GetInfo();
+  MG_ASSERT(info.vertex_count == 0 && info.edge_count == 0);
+
+  std::cout << "GC threads: " << gc_threads << ", Time: " << elapsed
+            << ", Unlink deltas (us): " << info.gc_unlink_deltas_time_us - info_before.gc_unlink_deltas_time_us
+            << ", Index cleanup (us): " << info.gc_index_cleanup_time_us - info_before.gc_index_cleanup_time_us
+            << ", Free objects (us): " << info.gc_free_objects_time_us - info_before.gc_free_objects_time_us
+            << std::endl;
+}
+
 int main(int argc, char *argv[]) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
 
@@ -70,5 +120,9 @@ int main(int argc, char *argv[]) {
     std::cout << "Config: " << config.first << ", Time: " << timer.Elapsed().count() << std::endl;
   }
 
+  for (uint64_t gc_threads : {1, 2, 4, 8}) {
+    DeleteAllAndCollectGarbage(gc_threads);
+  }
+
   return 0;
 }
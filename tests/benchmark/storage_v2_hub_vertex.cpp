@@ -0,0 +1,90 @@
+#include <optional>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/storage.hpp"
+
+// The benchmarks measure the throughput of concurrent reads of a single hub
+// vertex. All benchmark threads read the same vertex, so before the readers
+// copied the vertex state optimistically they all competed for its lock.
+
+namespace {
+const int64_t kNumEdges = 1 << 10;
+
+class HubVertexReads : public benchmark::Fixture {
+ protected:
+  void SetUp(const benchmark::State &state) override {
+    if (state.thread_index == 0) {
+      storage.emplace();
+      property = storage->NameToProperty("id");
+      auto acc = storage->Access();
+      auto hub = acc.CreateVertex();
+      MG_ASSERT(hub.AddLabel(storage->NameToLabel("Hub")).HasValue());
+      MG_ASSERT(hub.SetProperty(property, storage::PropertyValue(42)).HasValue());
+      const auto edge_type = storage->NameToEdgeType("Edge");
+      for (int64_t i = 0; i < kNumEdges; ++i) {
+        auto vertex = acc.CreateVertex();
+        MG_ASSERT(acc.CreateEdge(&hub, &vertex, edge_type).HasValue());
+      }
+      hub_gid = hub.Gid();
+      MG_ASSERT(!acc.Commit().HasError());
+    }
+  }
+
+  void TearDown(const benchmark::State &state) override {
+    if (state.thread_index == 0) {
+      storage.reset();
+    }
+  }
+
+  template <typename TFunc>
+  void ReadHub(benchmark::State &state, TFunc &&read) {
+    auto acc = storage->Access();
+    auto hub = acc.FindVertex(hub_gid, storage::View::OLD);
+    MG_ASSERT(hub);
+    while (state.KeepRunning()) {
+      read(*hub);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  std::optional<storage::Storage> storage;
+  storage::PropertyId property;
+  storage::Gid hub_gid;
+};
+}  // namespace
+
+// NOLINTNEXTLINE(google-runtime-references)
+BENCHMARK_DEFINE_F(HubVertexReads, GetProperty)(benchmark::State &state) {
+  ReadHub(state, [this](const storage::VertexAccessor &hub) {
+    benchmark::DoNotOptimize(hub.GetProperty(property, storage::View::OLD));
+  });
+}
+
+BENCHMARK_REGISTER_F(HubVertexReads, GetProperty)->ThreadRange(1, 16)->UseRealTime();
+
+// NOLINTNEXTLINE(google-runtime-references)
+BENCHMARK_DEFINE_F(HubVertexReads, Labels)(benchmark::State &state) {
+  ReadHub(state,
+          [](const storage::VertexAccessor &hub) { benchmark::DoNotOptimize(hub.Labels(storage::View::OLD)); });
+}
+
+BENCHMARK_REGISTER_F(HubVertexReads, Labels)->ThreadRange(1, 16)->UseRealTime();
+
+// NOLINTNEXTLINE(google-runtime-references)
+BENCHMARK_DEFINE_F(HubVertexReads, OutDegree)(benchmark::State &state) {
+  ReadHub(state,
+          [](const storage::VertexAccessor &hub) { benchmark::DoNotOptimize(hub.OutDegree(storage::View::OLD)); });
+}
+
+BENCHMARK_REGISTER_F(HubVertexReads, OutDegree)->ThreadRange(1, 16)->UseRealTime();
+
+// NOLINTNEXTLINE(google-runtime-references)
+BENCHMARK_DEFINE_F(HubVertexReads, IsVisible)(benchmark::State &state) {
+  ReadHub(state,
+          [](const storage::VertexAccessor &hub) { benchmark::DoNotOptimize(hub.IsVisible(storage::View::OLD)); });
+}
+
+BENCHMARK_REGISTER_F(HubVertexReads, IsVisible)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
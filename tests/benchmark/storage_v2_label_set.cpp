@@ -0,0 +1,128 @@
+#include <malloc.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/label_set.hpp"
+#include "storage/v2/storage.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/stat.hpp"
+
+// The benchmarks compare the `LabelSet` that is used to store the labels of a
+// vertex to the `std::vector<LabelId>` that was used before it. The first
+// argument is the number of labels of each vertex. Besides the throughput, the
+// memory used by the labels of each vertex (the size of the object itself plus
+// the increase of the resident memory) is reported in the `bytes_per_vertex`
+// label.
+
+namespace {
+const int64_t kVertices = 1 << 20;
+
+void Insert(storage::LabelSet *labels, storage::LabelId label) { labels->Insert(label); }
+void Insert(std::vector<storage::LabelId> *labels, storage::LabelId label) { labels->push_back(label); }
+
+bool Contains(const storage::LabelSet &labels, storage::LabelId label) { return labels.Contains(label); }
+bool Contains(const std::vector<storage::LabelId> &labels, storage::LabelId label) {
+  return std::find(labels.begin(), labels.end(), label) != labels.end();
+}
+
+template <typename TLabels>
+void FillAndCheck(benchmark::State &state) {
+  uint64_t counter = 0;
+  int64_t rss_increase = 0;
+  while (state.KeepRunning()) {
+    // Return the memory freed by the previous iterations to the OS so that
+    // the increase of the resident memory can be measured.
+    state.PauseTiming();
+    malloc_trim(0);
+    const auto rss_before = utils::GetMemoryUsage();
+    state.ResumeTiming();
+    {
+      std::vector<TLabels> vertices(kVertices);
+      for (auto &labels : vertices) {
+        for (int64_t i = 0; i < state.range(0); ++i) {
+          Insert(&labels, storage::LabelId::FromUint(i));
+        }
+      }
+      state.PauseTiming();
+      rss_increase = static_cast<int64_t>(utils::GetMemoryUsage()) - static_cast<int64_t>(rss_before);
+      state.ResumeTiming();
+      // This is the check that is done for each vertex in `ScanAllByLabel`.
+      for (const auto &labels : vertices) {
+        benchmark::DoNotOptimize(Contains(labels, storage::LabelId::FromUint(state.range(0) - 1)));
+        benchmark::DoNotOptimize(Contains(labels, storage::LabelId::FromUint(state.range(0))));
+      }
+    }
+    counter += kVertices;
+  }
+  state.SetItemsProcessed(counter);
+  state.SetLabel("bytes_per_vertex=" +
+                 std::to_string(static_cast<double>(rss_increase) / static_cast<double>(kVertices)));
+}
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// LabelSet
+///////////////////////////////////////////////////////////////////////////////
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void LabelSetFill(benchmark::State &state) { FillAndCheck<storage::LabelSet>(state); }
+
+BENCHMARK(LabelSetFill)->DenseRange(0, 4)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// std::vector<LabelId>
+///////////////////////////////////////////////////////////////////////////////
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void StdVectorFill(benchmark::State &state) { FillAndCheck<std::vector<storage::LabelId>>(state); }
+
+BENCHMARK(StdVectorFill)->DenseRange(0, 4)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Storage vertices
+///////////////////////////////////////////////////////////////////////////////
+
+// Creates vertices with labels in the storage and reports the resident memory
+// used by each vertex (including its skip list node) in the `bytes_per_vertex`
+// label and the size of the `Vertex` object in the `sizeof_vertex` label.
+// NOLINTNEXTLINE(google-runtime-references)
+static void StorageCreateVertices(benchmark::State &state) {
+  const int64_t kStorageVertices = 1 << 18;
+  uint64_t counter = 0;
+  int64_t rss_increase = 0;
+  while (state.KeepRunning()) {
+    // Return the memory freed by the previous iterations to the OS so that
+    // the increase of the resident memory can be measured.
+    state.PauseTiming();
+    malloc_trim(0);
+    const auto rss_before = utils::GetMemoryUsage();
+    state.ResumeTiming();
+    {
+      storage::Storage storage;
+      auto acc = storage.Access();
+      for (int64_t i = 0; i < kStorageVertices; ++i) {
+        auto vertex = acc.CreateVertex();
+        for (int64_t j = 0; j < state.range(0); ++j) {
+          benchmark::DoNotOptimize(vertex.AddLabel(storage::LabelId::FromUint(j)));
+        }
+      }
+      benchmark::DoNotOptimize(acc.Commit());
+      state.PauseTiming();
+      rss_increase = static_cast<int64_t>(utils::GetMemoryUsage()) - static_cast<int64_t>(rss_before);
+      state.ResumeTiming();
+    }
+    counter += kStorageVertices;
+  }
+  state.SetItemsProcessed(counter);
+  state.SetLabel("bytes_per_vertex=" +
+                 std::to_string(static_cast<double>(rss_increase) / static_cast<double>(kStorageVertices)) +
+                 " sizeof_vertex=" + std::to_string(sizeof(storage::Vertex)));
+}
+
+BENCHMARK(StorageCreateVertices)->DenseRange(0, 4)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -95,4 +95,66 @@ static void StdMapGet(benchmark::State &state) {
 
 BENCHMARK(StdMapGet)->RangeMultiplier(2)->Range(1, 1024)->Unit(benchmark::kNanosecond)->UseRealTime();
 
+///////////////////////////////////////////////////////////////////////////////
+// PropertyStore Get by position
+///////////////////////////////////////////////////////////////////////////////
+
+// The first argument is the number of properties in the store and the second
+// argument is the position (in percent) of the looked up property.
+static void PositionArguments(benchmark::internal::Benchmark *benchmark) {
+  for (int64_t count : {1, 8, 16, 64, 256, 1024}) {
+    for (int64_t position : {0, 50, 100}) {
+      benchmark->Args({count, position});
+    }
+  }
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void PropertyStoreGetByPosition(benchmark::State &state) {
+  storage::PropertyStore store;
+  for (uint64_t i = 0; i < state.range(0); ++i) {
+    auto prop = storage::PropertyId::FromUint(i);
+    store.SetProperty(prop, storage::PropertyValue(0));
+  }
+  auto prop = storage::PropertyId::FromUint((state.range(0) - 1) * state.range(1) / 100);
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(store.GetProperty(prop));
+    ++counter;
+  }
+  state.SetItemsProcessed(counter);
+}
+
+BENCHMARK(PropertyStoreGetByPosition)
+    ->Apply(PositionArguments)
+    ->Unit(benchmark::kNanosecond)
+    ->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// PropertyStore IsPropertyEqual by position
+///////////////////////////////////////////////////////////////////////////////
+
+// The arguments are the same as for `PropertyStoreGetByPosition`.
+// NOLINTNEXTLINE(google-runtime-references)
+static void PropertyStoreIsPropertyEqualByPosition(benchmark::State &state) {
+  storage::PropertyStore store;
+  for (uint64_t i = 0; i < state.range(0); ++i) {
+    auto prop = storage::PropertyId::FromUint(i);
+    store.SetProperty(prop, storage::PropertyValue(0));
+  }
+  auto prop = storage::PropertyId::FromUint((state.range(0) - 1) * state.range(1) / 100);
+  storage::PropertyValue value(0);
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(store.IsPropertyEqual(prop, value));
+    ++counter;
+  }
+  state.SetItemsProcessed(counter);
+}
+
+BENCHMARK(PropertyStoreIsPropertyEqualByPosition)
+    ->Apply(PositionArguments)
+    ->Unit(benchmark::kNanosecond)
+    ->UseRealTime();
+
 BENCHMARK_MAIN();
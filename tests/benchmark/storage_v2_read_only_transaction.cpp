@@ -0,0 +1,90 @@
+#include <atomic>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/storage.hpp"
+
+// The benchmarks measure the throughput of single vertex read transactions
+// (the `single_vertex_read` workload of mgbench) done through regular and
+// read-only accessors. The benchmark threads only read, while a background
+// thread keeps committing small write transactions so that the readers compete
+// with the writer for the transaction engine.
+
+namespace {
+const int64_t kNumVertices = 1 << 16;
+
+class ReadTransactions : public benchmark::Fixture {
+ protected:
+  void SetUp(const benchmark::State &state) override {
+    if (state.thread_index == 0) {
+      storage.emplace(storage::Config{.gc = {.type = storage::Config::Gc::Type::PERIODIC,
+                                             .interval = std::chrono::milliseconds(100)}});
+      property = storage->NameToProperty("id");
+      gids.clear();
+      auto acc = storage->Access();
+      for (int64_t i = 0; i < kNumVertices; ++i) {
+        auto vertex = acc.CreateVertex();
+        MG_ASSERT(vertex.SetProperty(property, storage::PropertyValue(i)).HasValue());
+        gids.push_back(vertex.Gid());
+      }
+      MG_ASSERT(!acc.Commit().HasError());
+
+      writer_running.store(true);
+      writer = std::thread([this] {
+        std::mt19937 gen(0);
+        std::uniform_int_distribution<uint64_t> dist(0, gids.size() - 1);
+        while (writer_running.load(std::memory_order_acquire)) {
+          auto acc = storage->Access();
+          auto vertex = acc.FindVertex(gids[dist(gen)], storage::View::OLD);
+          MG_ASSERT(vertex);
+          if (vertex->SetProperty(property, storage::PropertyValue(0)).HasValue()) {
+            MG_ASSERT(!acc.Commit().HasError());
+          }
+        }
+      });
+    }
+  }
+
+  void TearDown(const benchmark::State &state) override {
+    if (state.thread_index == 0) {
+      writer_running.store(false);
+      writer.join();
+      storage.reset();
+    }
+  }
+
+  void FindVertices(benchmark::State &state, bool read_only) {
+    std::mt19937 gen(state.thread_index);
+    std::uniform_int_distribution<uint64_t> dist(0, kNumVertices - 1);
+    while (state.KeepRunning()) {
+      auto acc = read_only ? storage->ReadOnlyAccess() : storage->Access();
+      auto vertex = acc.FindVertex(gids[dist(gen)], storage::View::OLD);
+      benchmark::DoNotOptimize(vertex->GetProperty(property, storage::View::OLD));
+      MG_ASSERT(!acc.Commit().HasError());
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  std::optional<storage::Storage> storage;
+  storage::PropertyId property;
+  std::vector<storage::Gid> gids;
+  std::atomic<bool> writer_running{false};
+  std::thread writer;
+};
+}  // namespace
+
+// NOLINTNEXTLINE(google-runtime-references)
+BENCHMARK_DEFINE_F(ReadTransactions, Access)(benchmark::State &state) { FindVertices(state, false); }
+
+BENCHMARK_REGISTER_F(ReadTransactions, Access)->ThreadRange(1, 8)->UseRealTime();
+
+// NOLINTNEXTLINE(google-runtime-references)
+BENCHMARK_DEFINE_F(ReadTransactions, ReadOnlyAccess)(benchmark::State &state) { FindVertices(state, true); }
+
+BENCHMARK_REGISTER_F(ReadTransactions, ReadOnlyAccess)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
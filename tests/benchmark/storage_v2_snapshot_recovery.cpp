@@ -0,0 +1,81 @@
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/storage.hpp"
+
+// The benchmarks measure the time needed to recover a storage from a snapshot
+// with different numbers of recovery threads. The snapshot is written once
+// with multiple threads so that it has enough segments to load in parallel.
+
+namespace {
+const int64_t kNumVertices = 1 << 18;
+const int64_t kNumEdges = 1 << 19;
+const uint64_t kSnapshotThreads = 8;
+
+const std::filesystem::path kStorageDirectory{std::filesystem::temp_directory_path() /
+                                              "MG_benchmark_storage_v2_snapshot_recovery"};
+
+void CreateSnapshot() {
+  std::filesystem::remove_all(kStorageDirectory);
+  storage::Storage store({.items = {.properties_on_edges = true},
+                          .durability = {.storage_directory = kStorageDirectory,
+                                         .snapshot_thread_count = kSnapshotThreads,
+                                         .snapshot_on_exit = true}});
+  const auto label = store.NameToLabel("Label");
+  const auto property = store.NameToProperty("id");
+  const auto edge_type = store.NameToEdgeType("Edge");
+  MG_ASSERT(store.CreateIndex(label));
+  MG_ASSERT(store.CreateIndex(label, property));
+  std::vector<storage::Gid> gids;
+  gids.reserve(kNumVertices);
+  {
+    auto acc = store.Access();
+    for (int64_t i = 0; i < kNumVertices; ++i) {
+      auto vertex = acc.CreateVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      MG_ASSERT(vertex.SetProperty(property, storage::PropertyValue(i)).HasValue());
+      gids.push_back(vertex.Gid());
+    }
+    MG_ASSERT(!acc.Commit().HasError());
+  }
+  {
+    auto acc = store.Access();
+    for (int64_t i = 0; i < kNumEdges; ++i) {
+      auto from = acc.FindVertex(gids[i % kNumVertices], storage::View::OLD);
+      auto to = acc.FindVertex(gids[(i * 7919) % kNumVertices], storage::View::OLD);
+      MG_ASSERT(from && to);
+      auto edge = acc.CreateEdge(&*from, &*to, edge_type);
+      MG_ASSERT(edge.HasValue());
+      MG_ASSERT(edge->SetProperty(property, storage::PropertyValue(i)).HasValue());
+    }
+    MG_ASSERT(!acc.Commit().HasError());
+  }
+}
+}  // namespace
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void RecoverSnapshot(benchmark::State &state) {
+  static const bool created = (CreateSnapshot(), true);
+  benchmark::DoNotOptimize(created);
+  std::optional<storage::Storage> store;
+  while (state.KeepRunning()) {
+    store.emplace(storage::Config{
+        .items = {.properties_on_edges = true},
+        .durability = {.storage_directory = kStorageDirectory,
+                       .recover_on_startup = true,
+                       .recovery_thread_count = static_cast<uint64_t>(state.range(0))}});
+    state.PauseTiming();
+    MG_ASSERT(store->GetInfo().vertex_count == kNumVertices);
+    MG_ASSERT(store->GetInfo().edge_count == kNumEdges);
+    store.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * (kNumVertices + kNumEdges));
+}
+
+BENCHMARK(RecoverSnapshot)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,60 @@
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/storage.hpp"
+
+// The benchmarks compare the lookup of vertices by their gid (as done for
+// `WHERE id(n) = $id` and for point reads over Bolt) through the vertex skip
+// list to the lookup through the `VertexLookupTable`. The first argument is
+// the number of vertices in the storage. Each iteration looks up `kLookups`
+// random vertices in a single transaction.
+
+namespace {
+const int64_t kLookups = 1 << 16;
+
+void FindVertices(benchmark::State &state, bool vertex_lookup_table) {
+  storage::Storage storage(storage::Config{.gc = {.type = storage::Config::Gc::Type::NONE},
+                                           .items = {.vertex_lookup_table = vertex_lookup_table}});
+  std::vector<storage::Gid> gids;
+  gids.reserve(state.range(0));
+  {
+    auto acc = storage.Access();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      gids.push_back(acc.CreateVertex().Gid());
+    }
+    MG_ASSERT(!acc.Commit().HasError());
+  }
+
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<uint64_t> dist(0, gids.size() - 1);
+  std::vector<storage::Gid> lookups;
+  lookups.reserve(kLookups);
+  for (int64_t i = 0; i < kLookups; ++i) {
+    lookups.push_back(gids[dist(gen)]);
+  }
+
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    auto acc = storage.Access();
+    for (auto gid : lookups) {
+      benchmark::DoNotOptimize(acc.FindVertex(gid, storage::View::OLD));
+    }
+    counter += kLookups;
+  }
+  state.SetItemsProcessed(counter);
+}
+}  // namespace
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void SkipListFindVertex(benchmark::State &state) { FindVertices(state, false); }
+
+BENCHMARK(SkipListFindVertex)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMillisecond);
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void LookupTableFindVertex(benchmark::State &state) { FindVertices(state, true); }
+
+BENCHMARK(LookupTableFindVertex)->RangeMultiplier(16)->Range(1 << 12, 1 << 20)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
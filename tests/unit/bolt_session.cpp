@@ -25,8 +25,9 @@ class TestSession : public Session<TestInputStream, TestOutputStream> {
   TestSession(TestSessionData *data, TestInputStream *input_stream, TestOutputStream *output_stream)
       : Session<TestInputStream, TestOutputStream>(input_stream, output_stream) {}
 
-  std::pair<std::vector<std::string>, std::optional<int>> Interpret(
-      const std::string &query, const std::map<std::string, Value> &params) override {
+  std::pair<std::vector<std::string>, std::optional<int>> Interpret(const std::string &query,
+                                                                   const std::map<std::string, Value> &params,
+                                                                   const std::map<std::string, Value> &extra) override {
     if (query == kQueryReturn42 || query == kQueryEmpty || query == kQueryReturnMultiple) {
       query_ = query;
       return {{"result_name"}, {}};
@@ -65,7 +66,7 @@ class TestSession : public Session<TestInputStream, TestOutputStream> {
 
   std::map<std::string, Value> Discard(std::optional<int>, std::optional<int>) override { return {}; }
 
-  void BeginTransaction() override {}
+  void BeginTransaction(const std::map<std::string, Value> &extra) override {}
   void CommitTransaction() override {}
   void RollbackTransaction() override {}
 
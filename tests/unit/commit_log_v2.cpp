@@ -1,5 +1,9 @@
 #include "storage/v2/commit_log.hpp"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace {
@@ -68,3 +72,37 @@ TEST(CommitLog, TrackAfterInitialId) {
     check_marking_ids(&log, i);
   }
 }
+
+TEST(CommitLog, Concurrent) {
+  constexpr uint64_t kNumThreads = 8;
+  constexpr uint64_t kIdsPerThread = ids_per_block;
+  storage::CommitLog log;
+
+  std::atomic<bool> done{false};
+  std::thread reader([&] {
+    uint64_t last = 0;
+    while (!done.load()) {
+      const auto oldest_active = log.OldestActive();
+      ASSERT_GE(oldest_active, last);
+      ASSERT_LE(oldest_active, kNumThreads * kIdsPerThread);
+      last = oldest_active;
+    }
+  });
+
+  std::atomic<uint64_t> next_id{0};
+  std::vector<std::thread> threads;
+  for (uint64_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&] {
+      for (uint64_t j = 0; j < kIdsPerThread; ++j) {
+        log.MarkFinished(next_id.fetch_add(1));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  done.store(true);
+  reader.join();
+
+  EXPECT_EQ(log.OldestActive(), kNumThreads * kIdsPerThread);
+}
@@ -842,6 +842,52 @@ TEST_P(CypherMainVisitorTest, Function) {
   ASSERT_TRUE(function->function_);
 }
 
+TEST_P(CypherMainVisitorTest, PatternSizeToDegree) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<CypherQuery *>(
+      ast_generator.ParseQuery("MATCH (n) RETURN size((n)-->()), size((n)<-[:A|B]-()), size((n)-[:A]->())"));
+  ASSERT_TRUE(query);
+  ASSERT_TRUE(query->single_query_);
+  auto *single_query = query->single_query_;
+  auto *return_clause = dynamic_cast<Return *>(single_query->clauses_[1]);
+  ASSERT_EQ(return_clause->body_.named_expressions.size(), 3);
+  auto check_degree = [&](size_t index, const std::string &function_name,
+                          const std::vector<std::string> &edge_types) {
+    auto *function = dynamic_cast<Function *>(return_clause->body_.named_expressions[index]->expression_);
+    ASSERT_TRUE(function);
+    ASSERT_EQ(function->function_name_, function_name);
+    ASSERT_TRUE(function->function_);
+    auto *identifier = dynamic_cast<Identifier *>(function->arguments_[0]);
+    ASSERT_TRUE(identifier);
+    ASSERT_EQ(identifier->name_, "n");
+    if (edge_types.empty()) {
+      ASSERT_EQ(function->arguments_.size(), 1);
+      return;
+    }
+    ASSERT_EQ(function->arguments_.size(), 2);
+    auto *list = dynamic_cast<ListLiteral *>(function->arguments_[1]);
+    ASSERT_TRUE(list);
+    ASSERT_EQ(list->elements_.size(), edge_types.size());
+    for (size_t i = 0; i < edge_types.size(); ++i) {
+      auto *literal = dynamic_cast<PrimitiveLiteral *>(list->elements_[i]);
+      ASSERT_TRUE(literal);
+      ASSERT_EQ(literal->value_.ValueString(), edge_types[i]);
+    }
+  };
+  check_degree(0, "OUTDEGREE", {});
+  check_degree(1, "INDEGREE", {"A", "B"});
+  check_degree(2, "OUTDEGREE", {"A"});
+}
+
+TEST_P(CypherMainVisitorTest, PatternSizeNotRewritten) {
+  auto &ast_generator = *GetParam();
+  // Undirected patterns and patterns that constrain the other node can't be
+  // answered by the degree functions.
+  ASSERT_THROW(ast_generator.ParseQuery("MATCH (n) RETURN size((n)--())"), utils::NotYetImplemented);
+  ASSERT_THROW(ast_generator.ParseQuery("MATCH (n) RETURN size((n)-->(:Label))"), utils::NotYetImplemented);
+  ASSERT_THROW(ast_generator.ParseQuery("MATCH (n) RETURN size((n)-[*]->())"), utils::NotYetImplemented);
+}
+
 TEST_P(CypherMainVisitorTest, StringLiteralDoubleQuotes) {
   auto &ast_generator = *GetParam();
   auto *query = dynamic_cast<CypherQuery *>(ast_generator.ParseQuery("RETURN \"mi'rko\""));
@@ -1684,9 +1730,67 @@ TEST_P(CypherMainVisitorTest, DropIndexWithoutProperties) {
   EXPECT_THROW(ast_generator.ParseQuery("dRoP InDeX oN :mirko()"), SyntaxException);
 }
 
+TEST_P(CypherMainVisitorTest, CreateIndexWithMultipleProperties) {
+  auto &ast_generator = *GetParam();
+  auto *index_query = dynamic_cast<IndexQuery *>(ast_generator.ParseQuery("Create InDeX oN :mirko(slavko, pero)"));
+  ASSERT_TRUE(index_query);
+  EXPECT_EQ(index_query->action_, IndexQuery::Action::CREATE);
+  EXPECT_EQ(index_query->label_, ast_generator.Label("mirko"));
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko"), ast_generator.Prop("pero")};
+  EXPECT_EQ(index_query->properties_, expected_properties);
+}
+
 TEST_P(CypherMainVisitorTest, DropIndexWithMultipleProperties) {
   auto &ast_generator = *GetParam();
-  EXPECT_THROW(ast_generator.ParseQuery("dRoP InDeX oN :mirko(slavko, pero)"), SyntaxException);
+  auto *index_query = dynamic_cast<IndexQuery *>(ast_generator.ParseQuery("dRoP InDeX oN :mirko(slavko, pero)"));
+  ASSERT_TRUE(index_query);
+  EXPECT_EQ(index_query->action_, IndexQuery::Action::DROP);
+  EXPECT_EQ(index_query->label_, ast_generator.Label("mirko"));
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko"), ast_generator.Prop("pero")};
+  EXPECT_EQ(index_query->properties_, expected_properties);
+}
+
+TEST_P(CypherMainVisitorTest, CreateEdgeIndex) {
+  auto &ast_generator = *GetParam();
+  auto *edge_index_query = dynamic_cast<EdgeIndexQuery *>(ast_generator.ParseQuery("Create EdGe InDeX oN :mirko"));
+  ASSERT_TRUE(edge_index_query);
+  EXPECT_EQ(edge_index_query->action_, EdgeIndexQuery::Action::CREATE);
+  EXPECT_EQ(edge_index_query->edge_type_, ast_generator.EdgeType("mirko"));
+}
+
+TEST_P(CypherMainVisitorTest, DropEdgeIndex) {
+  auto &ast_generator = *GetParam();
+  auto *edge_index_query = dynamic_cast<EdgeIndexQuery *>(ast_generator.ParseQuery("dRoP EdGe InDeX oN :mirko"));
+  ASSERT_TRUE(edge_index_query);
+  EXPECT_EQ(edge_index_query->action_, EdgeIndexQuery::Action::DROP);
+  EXPECT_EQ(edge_index_query->edge_type_, ast_generator.EdgeType("mirko"));
+}
+
+TEST_P(CypherMainVisitorTest, CreateEdgePropertyIndex) {
+  auto &ast_generator = *GetParam();
+  auto *edge_index_query =
+      dynamic_cast<EdgeIndexQuery *>(ast_generator.ParseQuery("Create EdGe InDeX oN :mirko(slavko)"));
+  ASSERT_TRUE(edge_index_query);
+  EXPECT_EQ(edge_index_query->action_, EdgeIndexQuery::Action::CREATE);
+  EXPECT_EQ(edge_index_query->edge_type_, ast_generator.EdgeType("mirko"));
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko")};
+  EXPECT_EQ(edge_index_query->properties_, expected_properties);
+}
+
+TEST_P(CypherMainVisitorTest, DropEdgePropertyIndex) {
+  auto &ast_generator = *GetParam();
+  auto *edge_index_query =
+      dynamic_cast<EdgeIndexQuery *>(ast_generator.ParseQuery("dRoP EdGe InDeX oN :mirko(slavko)"));
+  ASSERT_TRUE(edge_index_query);
+  EXPECT_EQ(edge_index_query->action_, EdgeIndexQuery::Action::DROP);
+  EXPECT_EQ(edge_index_query->edge_type_, ast_generator.EdgeType("mirko"));
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko")};
+  EXPECT_EQ(edge_index_query->properties_, expected_properties);
+}
+
+TEST_P(CypherMainVisitorTest, EdgeIndexWithMultipleProperties) {
+  auto &ast_generator = *GetParam();
+  EXPECT_THROW(ast_generator.ParseQuery("CREATE EDGE INDEX ON :mirko(slavko, pero)"), SyntaxException);
 }
 
 TEST_P(CypherMainVisitorTest, ReturnAll) {
@@ -2399,6 +2503,13 @@ TEST_P(CypherMainVisitorTest, TestShowConstraintInfo) {
   EXPECT_EQ(query->info_type_, InfoQuery::InfoType::CONSTRAINT);
 }
 
+TEST_P(CypherMainVisitorTest, TestShowMemoryInfo) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<InfoQuery *>(ast_generator.ParseQuery("SHOW MEMORY INFO"));
+  ASSERT_TRUE(query);
+  EXPECT_EQ(query->info_type_, InfoQuery::InfoType::MEMORY);
+}
+
 TEST_P(CypherMainVisitorTest, CreateConstraintSyntaxError) {
   auto &ast_generator = *GetParam();
   EXPECT_THROW(ast_generator.ParseQuery("CREATE CONSTRAINT ON (:label) ASSERT EXISTS"), SyntaxException);
@@ -3522,6 +3633,24 @@ TEST_P(CypherMainVisitorTest, SetIsolationLevelQuery) {
   }
 }
 
+TEST_P(CypherMainVisitorTest, StorageModeQuery) {
+  auto &ast_generator = *GetParam();
+  TestInvalidQuery("STORAGE MODE", ast_generator);
+  TestInvalidQuery("STORAGE ANALYTICAL", ast_generator);
+  TestInvalidQuery("STORAGE MODE IN_MEMORY_ANALYTICAL", ast_generator);
+
+  constexpr std::array storage_modes{
+      std::pair{"ANALYTICAL", query::StorageModeQuery::StorageMode::IN_MEMORY_ANALYTICAL},
+      std::pair{"TRANSACTIONAL", query::StorageModeQuery::StorageMode::IN_MEMORY_TRANSACTIONAL}};
+
+  for (const auto &[storage_mode_string, storage_mode] : storage_modes) {
+    auto *parsed_query =
+        dynamic_cast<StorageModeQuery *>(ast_generator.ParseQuery(fmt::format("STORAGE MODE {}", storage_mode_string)));
+    ASSERT_TRUE(parsed_query);
+    EXPECT_EQ(parsed_query->storage_mode_, storage_mode);
+  }
+}
+
 TEST_P(CypherMainVisitorTest, CreateSnapshotQuery) {
   auto &ast_generator = *GetParam();
   ASSERT_TRUE(dynamic_cast<CreateSnapshotQuery *>(ast_generator.ParseQuery("CREATE SNAPSHOT")));
@@ -828,6 +828,44 @@ TEST_F(InterpreterTest, Transactions) {
   }
 }
 
+TEST_F(InterpreterTest, ReadOnlyTransactions) {
+  auto &interpreter = default_interpreter.interpreter;
+  {
+    interpreter.SetNextTransactionReadOnly();
+    ASSERT_THROW(Interpret("CREATE ()"), query::QueryException);
+    interpreter.SetNextTransactionReadOnly();
+    auto stream = Interpret("MATCH (n) RETURN count(n)");
+    ASSERT_EQ(stream.GetResults().size(), 1U);
+    ASSERT_EQ(stream.GetResults()[0][0].ValueInt(), 0);
+  }
+  {
+    // The request applies only to the next transaction.
+    interpreter.SetNextTransactionReadOnly();
+    Interpret("RETURN 1");
+    Interpret("CREATE ()");
+  }
+  {
+    interpreter.SetNextTransactionReadOnly();
+    interpreter.BeginTransaction();
+    auto [stream, qid] = Prepare("MATCH (n) RETURN count(n)");
+    Pull(&stream);
+    ASSERT_EQ(stream.GetResults()[0][0].ValueInt(), 1);
+    ASSERT_THROW(Prepare("CREATE ()"), query::QueryException);
+    interpreter.RollbackTransaction();
+  }
+  {
+    // Read queries with a cached plan run in read-only transactions even
+    // without the request.
+    Interpret("MATCH (n) RETURN count(n)");
+    auto stream = Interpret("MATCH (n) RETURN count(n)");
+    ASSERT_EQ(stream.GetResults()[0][0].ValueInt(), 1);
+    Interpret("CREATE ()");
+    Interpret("CREATE ()");
+    stream = Interpret("MATCH (n) RETURN count(n)");
+    ASSERT_EQ(stream.GetResults()[0][0].ValueInt(), 3);
+  }
+}
+
 TEST_F(InterpreterTest, Qid) {
   auto &interpreter = default_interpreter.interpreter;
   {
@@ -533,6 +533,63 @@ TEST(DumpTest, IndicesKeys) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(DumpTest, CompositeIndices) {
+  storage::Storage db;
+  ASSERT_TRUE(db.CreateIndex(db.NameToLabel("Label1"), std::vector{db.NameToProperty("b"), db.NameToProperty("a")}));
+
+  {
+    ResultStreamFaker stream(&db);
+    query::AnyStream query_stream(&stream, utils::NewDeleteResource());
+    {
+      auto acc = db.Access();
+      query::DbAccessor dba(&acc);
+      query::DumpDatabaseToCypherQueries(&dba, &query_stream);
+    }
+    VerifyQueries(stream.GetResults(), "CREATE INDEX ON :`Label1`(`b`, `a`);", kCreateInternalIndex,
+                  kDropInternalIndex, kRemoveInternalLabelProperty);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(DumpTest, EdgeTypeIndices) {
+  storage::Storage db;
+  ASSERT_TRUE(db.CreateIndex(db.NameToEdgeType("EdgeType")));
+  ASSERT_TRUE(db.CreateIndex(db.NameToEdgeType("Edge `Type")));
+
+  {
+    ResultStreamFaker stream(&db);
+    query::AnyStream query_stream(&stream, utils::NewDeleteResource());
+    {
+      auto acc = db.Access();
+      query::DbAccessor dba(&acc);
+      query::DumpDatabaseToCypherQueries(&dba, &query_stream);
+    }
+    VerifyQueries(stream.GetResults(), "CREATE EDGE INDEX ON :`EdgeType`;", "CREATE EDGE INDEX ON :`Edge ``Type`;",
+                  kCreateInternalIndex, kDropInternalIndex, kRemoveInternalLabelProperty);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(DumpTest, EdgeTypePropertyIndices) {
+  storage::Storage db;
+  ASSERT_FALSE(db.CreateIndex(db.NameToEdgeType("EdgeType"), db.NameToProperty("prop")).HasError());
+  ASSERT_FALSE(db.CreateIndex(db.NameToEdgeType("Edge `Type"), db.NameToProperty("prop `")).HasError());
+
+  {
+    ResultStreamFaker stream(&db);
+    query::AnyStream query_stream(&stream, utils::NewDeleteResource());
+    {
+      auto acc = db.Access();
+      query::DbAccessor dba(&acc);
+      query::DumpDatabaseToCypherQueries(&dba, &query_stream);
+    }
+    VerifyQueries(stream.GetResults(), "CREATE EDGE INDEX ON :`EdgeType`(`prop`);",
+                  "CREATE EDGE INDEX ON :`Edge ``Type`(`prop ```);", kCreateInternalIndex, kDropInternalIndex,
+                  kRemoveInternalLabelProperty);
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST(DumpTest, ExistenceConstraints) {
   storage::Storage db;
@@ -1335,6 +1335,25 @@ TEST_F(FunctionTest, OutDegree) {
   ASSERT_THROW(EvaluateFunction("OUTDEGREE", *e12), QueryRuntimeException);
 }
 
+TEST_F(FunctionTest, DegreeWithEdgeTypes) {
+  auto v1 = dba.InsertVertex();
+  auto v2 = dba.InsertVertex();
+  ASSERT_TRUE(dba.InsertEdge(&v1, &v2, dba.NameToEdgeType("a")).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v1, &v2, dba.NameToEdgeType("b")).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v2, &v1, dba.NameToEdgeType("a")).HasValue());
+  dba.AdvanceCommand();
+  ASSERT_EQ(EvaluateFunction("OUTDEGREE", v1, "a").ValueInt(), 1);
+  ASSERT_EQ(EvaluateFunction("OUTDEGREE", v1, MakeTypedValueList("a", "b")).ValueInt(), 2);
+  ASSERT_EQ(EvaluateFunction("OUTDEGREE", v1, MakeTypedValueList()).ValueInt(), 0);
+  ASSERT_EQ(EvaluateFunction("OUTDEGREE", v1, "c").ValueInt(), 0);
+  ASSERT_EQ(EvaluateFunction("INDEGREE", v2, "b").ValueInt(), 1);
+  ASSERT_EQ(EvaluateFunction("INDEGREE", v1, MakeTypedValueList("b")).ValueInt(), 0);
+  ASSERT_EQ(EvaluateFunction("DEGREE", v1, "a").ValueInt(), 2);
+  ASSERT_EQ(EvaluateFunction("DEGREE", v2, MakeTypedValueList("a", "b")).ValueInt(), 3);
+  ASSERT_THROW(EvaluateFunction("OUTDEGREE", v1, 1), QueryRuntimeException);
+  ASSERT_THROW(EvaluateFunction("OUTDEGREE", v1, MakeTypedValueList(1)), QueryRuntimeException);
+}
+
 TEST_F(FunctionTest, ToBoolean) {
   ASSERT_THROW(EvaluateFunction("TOBOOLEAN"), QueryRuntimeException);
   ASSERT_TRUE(EvaluateFunction("TOBOOLEAN", TypedValue()).IsNull());
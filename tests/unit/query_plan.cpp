@@ -986,6 +986,96 @@ TYPED_TEST(TestPlanner, BestPropertyIndexed) {
             ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, AtomIndexedLabelPropertiesComposite) {
+  // Test MATCH (n :label {a: 1, b: 2}) RETURN n
+  AstStorage storage;
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = PROPERTY_PAIR("a");
+  auto b = PROPERTY_PAIR("b");
+  // The single property index is smaller, but the composite one can look up
+  // both properties.
+  dba.SetIndexCount(label, a.second, 0);
+  dba.SetIndexCount(label, {a.second, b.second}, 10);
+  auto node = NODE("n", "label");
+  std::get<0>(node->properties_)[storage.GetPropertyIx(a.first)] = LITERAL(1);
+  std::get<0>(node->properties_)[storage.GetPropertyIx(b.first)] = LITERAL(2);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(node)), RETURN("n")));
+  auto symbol_table = query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabelProperties(label, {a.second, b.second}, 2),
+            ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, WhereIndexedLabelPropertiesLongestPrefix) {
+  // Test MATCH (n :label) WHERE n.a = 1 AND n.b = 2 AND n.c > 3 RETURN n
+  AstStorage storage;
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = PROPERTY_PAIR("a");
+  auto b = PROPERTY_PAIR("b");
+  auto c = PROPERTY_PAIR("c");
+  dba.SetIndexCount(label, {a.second, b.second}, 0);
+  dba.SetIndexCount(label, {a.second, b.second, c.second}, 10);
+  dba.SetIndexCount(label, {b.second, c.second, a.second}, 0);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(AND(AND(EQ(PROPERTY_LOOKUP("n", a), LITERAL(1)),
+                                                 EQ(PROPERTY_LOOKUP("n", b), LITERAL(2))),
+                                             GREATER(PROPERTY_LOOKUP("n", c), LITERAL(3)))),
+                                   RETURN("n")));
+  auto symbol_table = query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  // The equality prefix on `a` and `b` followed by the range on `c` uses all
+  // three properties of the index, so all filters are replaced.
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByLabelProperties(label, {a.second, b.second, c.second}, 2, true), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, WhereIndexedLabelPropertiesSingleProperty) {
+  // Test MATCH (n :label) WHERE n.a = 42 RETURN n
+  AstStorage storage;
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = PROPERTY_PAIR("a");
+  auto b = PROPERTY_PAIR("b");
+  dba.SetIndexCount(label, {a.second, b.second}, 0);
+  auto lit_42 = LITERAL(42);
+  auto *query = QUERY(
+      SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))), WHERE(EQ(PROPERTY_LOOKUP("n", a), lit_42)), RETURN("n")));
+  {
+    auto symbol_table = query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+    // Only the composite index can be used.
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabelProperties(label, {a.second, b.second}, 1),
+              ExpectProduce());
+  }
+  dba.SetIndexCount(label, a.second, 10);
+  {
+    auto symbol_table = query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+    // Both indices can look up a single property, so the label+property index
+    // is preferred.
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabelPropertyValue(label, a, lit_42), ExpectProduce());
+  }
+}
+
+TYPED_TEST(TestPlanner, WhereIndexedLabelPropertiesNoPrefix) {
+  // Test MATCH (n :label) WHERE n.b = 42 RETURN n
+  AstStorage storage;
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = PROPERTY_PAIR("a");
+  auto b = PROPERTY_PAIR("b");
+  dba.SetIndexCount(label, {a.second, b.second}, 0);
+  auto *query = QUERY(
+      SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))), WHERE(EQ(PROPERTY_LOOKUP("n", b), LITERAL(42))), RETURN("n")));
+  auto symbol_table = query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  // The first property of the index isn't filtered, so the index can't be
+  // used.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectFilter(), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, MultiPropertyIndexScan) {
   // Test MATCH (n :label1), (m :label2) WHERE n.prop1 = 1 AND m.prop2 = 2
   //      RETURN n, m
@@ -1251,6 +1341,90 @@ TYPED_TEST(TestPlanner, MatchScanToExpand) {
   CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectExpand(), ExpectFilter(), ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, MatchEdgeTypeIndex) {
+  // Test MATCH (n) -[r :relationship]-> (m) RETURN r
+  FakeDbAccessor dba;
+  auto relationship = "relationship";
+  dba.SetIndexCount(dba.NameToEdgeType(relationship), 1);
+  AstStorage storage;
+  auto *query = QUERY(
+      SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT, {relationship}), NODE("m"))), RETURN("r")));
+  auto symbol_table = query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  // We expect ScanAll and Expand to be replaced with ScanAllByEdgeType.
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByEdgeType(dba.NameToEdgeType(relationship), Direction::OUT), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, MatchEdgeTypeIndexFilteredNode) {
+  // Test MATCH (n :label) -[r :relationship]- (m) RETURN r
+  FakeDbAccessor dba;
+  auto relationship = "relationship";
+  dba.SetIndexCount(dba.NameToEdgeType(relationship), 1);
+  AstStorage storage;
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n", "label"), EDGE("r", Direction::BOTH, {relationship}), NODE("m"))), RETURN("r")));
+  auto symbol_table = query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  // The label filter must be applied on `n` before the expansion, so the edge
+  // type index isn't used.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectFilter(), ExpectExpand(), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, MatchEdgeTypePropertyIndexValue) {
+  // Test MATCH (n) -[r :relationship]-> (m) WHERE r.property = 42 RETURN r
+  FakeDbAccessor dba;
+  auto relationship = "relationship";
+  auto property = dba.Property("property");
+  dba.SetIndexCount(dba.NameToEdgeType(relationship), property, 1);
+  AstStorage storage;
+  auto lit_42 = LITERAL(42);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT, {relationship}), NODE("m"))),
+                                   WHERE(EQ(PROPERTY_LOOKUP("r", property), lit_42)), RETURN("r")));
+  auto symbol_table = query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  // ScanAll, Expand and Filter are all replaced with a single indexed scan.
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByEdgeTypePropertyValue(dba.NameToEdgeType(relationship), property, lit_42),
+            ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, MatchEdgeTypePropertyIndexRange) {
+  // Test MATCH (n) -[r :relationship]-> (m) WHERE r.property > 42 RETURN r
+  FakeDbAccessor dba;
+  auto relationship = "relationship";
+  auto property = dba.Property("property");
+  // The edge type+property index is preferred over the edge type index.
+  dba.SetIndexCount(dba.NameToEdgeType(relationship), 1);
+  dba.SetIndexCount(dba.NameToEdgeType(relationship), property, 1);
+  AstStorage storage;
+  auto lit_42 = LITERAL(42);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT, {relationship}), NODE("m"))),
+                                   WHERE(GREATER(PROPERTY_LOOKUP("r", property), lit_42)), RETURN("r")));
+  auto symbol_table = query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByEdgeTypePropertyRange(dba.NameToEdgeType(relationship), property,
+                                                 Bound(lit_42, Bound::Type::EXCLUSIVE), std::nullopt),
+            ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, MatchEdgeTypePropertyIndexUnboundValue) {
+  // Test MATCH (n) -[r :relationship]-> (m) WHERE r.property = m.property RETURN r
+  FakeDbAccessor dba;
+  auto relationship = "relationship";
+  auto property = dba.Property("property");
+  dba.SetIndexCount(dba.NameToEdgeType(relationship), property, 1);
+  AstStorage storage;
+  auto *query = QUERY(
+      SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT, {relationship}), NODE("m"))),
+                   WHERE(EQ(PROPERTY_LOOKUP("r", property), PROPERTY_LOOKUP("m", property))), RETURN("r")));
+  auto symbol_table = query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, storage, symbol_table, query);
+  // The value depends on the scanned edge, so the index can't be used.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectExpand(), ExpectFilter(), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, MatchWhereAndSplit) {
   // Test MATCH (n) -[r]- (m) WHERE n.prop AND r.prop RETURN m
   FakeDbAccessor dba;
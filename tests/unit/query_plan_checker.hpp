@@ -50,7 +50,11 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
   PRE_VISIT(ScanAllByLabelPropertyValue);
   PRE_VISIT(ScanAllByLabelPropertyRange);
   PRE_VISIT(ScanAllByLabelProperty);
+  PRE_VISIT(ScanAllByLabelProperties);
   PRE_VISIT(ScanAllById);
+  PRE_VISIT(ScanAllByEdgeType);
+  PRE_VISIT(ScanAllByEdgeTypePropertyValue);
+  PRE_VISIT(ScanAllByEdgeTypePropertyRange);
   PRE_VISIT(Expand);
   PRE_VISIT(ExpandVariable);
   PRE_VISIT(Filter);
@@ -234,6 +238,67 @@ class ExpectOptional : public OpChecker<Optional> {
   const std::list<BaseOpChecker *> &optional_;
 };
 
+class ExpectScanAllByEdgeType : public OpChecker<ScanAllByEdgeType> {
+ public:
+  ExpectScanAllByEdgeType(storage::EdgeTypeId edge_type, query::EdgeAtom::Direction direction)
+      : edge_type_(edge_type), direction_(direction) {}
+
+  void ExpectOp(ScanAllByEdgeType &scan_all, const SymbolTable &) override {
+    EXPECT_THAT(scan_all.common_.edge_types, testing::ElementsAre(edge_type_));
+    EXPECT_EQ(scan_all.common_.direction, direction_);
+  }
+
+ private:
+  storage::EdgeTypeId edge_type_;
+  query::EdgeAtom::Direction direction_;
+};
+
+class ExpectScanAllByEdgeTypePropertyValue : public OpChecker<ScanAllByEdgeTypePropertyValue> {
+ public:
+  ExpectScanAllByEdgeTypePropertyValue(storage::EdgeTypeId edge_type, storage::PropertyId property,
+                                       query::Expression *expression)
+      : edge_type_(edge_type), property_(property), expression_(expression) {}
+
+  void ExpectOp(ScanAllByEdgeTypePropertyValue &scan_all, const SymbolTable &) override {
+    EXPECT_THAT(scan_all.common_.edge_types, testing::ElementsAre(edge_type_));
+    EXPECT_EQ(scan_all.property_, property_);
+    // TODO: Proper expression equality
+    EXPECT_EQ(typeid(scan_all.expression_).hash_code(), typeid(expression_).hash_code());
+  }
+
+ private:
+  storage::EdgeTypeId edge_type_;
+  storage::PropertyId property_;
+  query::Expression *expression_;
+};
+
+class ExpectScanAllByEdgeTypePropertyRange : public OpChecker<ScanAllByEdgeTypePropertyRange> {
+ public:
+  ExpectScanAllByEdgeTypePropertyRange(storage::EdgeTypeId edge_type, storage::PropertyId property,
+                                       std::optional<ScanAllByEdgeTypePropertyRange::Bound> lower_bound,
+                                       std::optional<ScanAllByEdgeTypePropertyRange::Bound> upper_bound)
+      : edge_type_(edge_type), property_(property), lower_bound_(lower_bound), upper_bound_(upper_bound) {}
+
+  void ExpectOp(ScanAllByEdgeTypePropertyRange &scan_all, const SymbolTable &) override {
+    EXPECT_THAT(scan_all.common_.edge_types, testing::ElementsAre(edge_type_));
+    EXPECT_EQ(scan_all.property_, property_);
+    EXPECT_EQ(static_cast<bool>(scan_all.lower_bound_), static_cast<bool>(lower_bound_));
+    if (lower_bound_ && scan_all.lower_bound_) {
+      EXPECT_EQ(scan_all.lower_bound_->type(), lower_bound_->type());
+    }
+    EXPECT_EQ(static_cast<bool>(scan_all.upper_bound_), static_cast<bool>(upper_bound_));
+    if (upper_bound_ && scan_all.upper_bound_) {
+      EXPECT_EQ(scan_all.upper_bound_->type(), upper_bound_->type());
+    }
+  }
+
+ private:
+  storage::EdgeTypeId edge_type_;
+  storage::PropertyId property_;
+  std::optional<ScanAllByEdgeTypePropertyRange::Bound> lower_bound_;
+  std::optional<ScanAllByEdgeTypePropertyRange::Bound> upper_bound_;
+};
+
 class ExpectScanAllByLabelPropertyValue : public OpChecker<ScanAllByLabelPropertyValue> {
  public:
   ExpectScanAllByLabelPropertyValue(storage::LabelId label,
@@ -285,6 +350,26 @@ class ExpectScanAllByLabelPropertyRange : public OpChecker<ScanAllByLabelPropert
   std::optional<ScanAllByLabelPropertyRange::Bound> upper_bound_;
 };
 
+class ExpectScanAllByLabelProperties : public OpChecker<ScanAllByLabelProperties> {
+ public:
+  ExpectScanAllByLabelProperties(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                                 size_t prefix_size, bool has_range = false)
+      : label_(label), properties_(properties), prefix_size_(prefix_size), has_range_(has_range) {}
+
+  void ExpectOp(ScanAllByLabelProperties &scan_all, const SymbolTable &) override {
+    EXPECT_EQ(scan_all.label_, label_);
+    EXPECT_EQ(scan_all.properties_, properties_);
+    EXPECT_EQ(scan_all.prefix_expressions_.size(), prefix_size_);
+    EXPECT_EQ(scan_all.lower_bound_ || scan_all.upper_bound_, has_range_);
+  }
+
+ private:
+  storage::LabelId label_;
+  std::vector<storage::PropertyId> properties_;
+  size_t prefix_size_;
+  bool has_range_;
+};
+
 class ExpectScanAllByLabelProperty : public OpChecker<ScanAllByLabelProperty> {
  public:
   ExpectScanAllByLabelProperty(storage::LabelId label, const std::pair<std::string, storage::PropertyId> &prop_pair)
@@ -385,8 +470,34 @@ class FakeDbAccessor {
     return 0;
   }
 
+  int64_t EdgesCount(storage::EdgeTypeId edge_type) const {
+    auto found = edge_type_index_.find(edge_type);
+    if (found != edge_type_index_.end()) return found->second;
+    return 0;
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
+    auto found = edge_type_property_index_.find(std::make_pair(edge_type, property));
+    if (found != edge_type_property_index_.end()) return found->second;
+    return 0;
+  }
+
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties) const {
+    auto found = label_property_composite_index_.find(std::make_pair(label, properties));
+    if (found != label_property_composite_index_.end()) return found->second;
+    return 0;
+  }
+
   bool LabelIndexExists(storage::LabelId label) const { return label_index_.find(label) != label_index_.end(); }
 
+  bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) const {
+    return edge_type_index_.find(edge_type) != edge_type_index_.end();
+  }
+
+  bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
+    return edge_type_property_index_.find(std::make_pair(edge_type, property)) != edge_type_property_index_.end();
+  }
+
   bool LabelPropertyIndexExists(storage::LabelId label, storage::PropertyId property) const {
     for (auto &index : label_property_index_) {
       if (std::get<0>(index) == label && std::get<1>(index) == property) {
@@ -396,8 +507,20 @@ class FakeDbAccessor {
     return false;
   }
 
+  std::vector<std::vector<storage::PropertyId>> LabelPropertyCompositeIndices(storage::LabelId label) const {
+    std::vector<std::vector<storage::PropertyId>> ret;
+    for (const auto &[key, count] : label_property_composite_index_) {
+      if (key.first == label) ret.push_back(key.second);
+    }
+    return ret;
+  }
+
   void SetIndexCount(storage::LabelId label, int64_t count) { label_index_[label] = count; }
 
+  void SetIndexCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties, int64_t count) {
+    label_property_composite_index_[std::make_pair(label, properties)] = count;
+  }
+
   void SetIndexCount(storage::LabelId label, storage::PropertyId property, int64_t count) {
     for (auto &index : label_property_index_) {
       if (std::get<0>(index) == label && std::get<1>(index) == property) {
@@ -408,6 +531,12 @@ class FakeDbAccessor {
     label_property_index_.emplace_back(label, property, count);
   }
 
+  void SetIndexCount(storage::EdgeTypeId edge_type, int64_t count) { edge_type_index_[edge_type] = count; }
+
+  void SetIndexCount(storage::EdgeTypeId edge_type, storage::PropertyId property, int64_t count) {
+    edge_type_property_index_[std::make_pair(edge_type, property)] = count;
+  }
+
   storage::LabelId NameToLabel(const std::string &name) {
     auto found = labels_.find(name);
     if (found != labels_.end()) return found->second;
@@ -446,6 +575,9 @@ class FakeDbAccessor {
 
   std::unordered_map<storage::LabelId, int64_t> label_index_;
   std::vector<std::tuple<storage::LabelId, storage::PropertyId, int64_t>> label_property_index_;
+  std::map<std::pair<storage::LabelId, std::vector<storage::PropertyId>>, int64_t> label_property_composite_index_;
+  std::unordered_map<storage::EdgeTypeId, int64_t> edge_type_index_;
+  std::map<std::pair<storage::EdgeTypeId, storage::PropertyId>, int64_t> edge_type_property_index_;
 };
 
 }  // namespace query::plan
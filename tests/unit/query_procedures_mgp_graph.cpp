@@ -527,6 +527,30 @@ TEST_F(MgpGraphTest, EdgesIterator) {
   }
 }
 
+TEST_F(MgpGraphTest, VertexDegree) {
+  const auto vertex_ids = CreateEdge();
+  auto graph = CreateGraph();
+  MgpVertexPtr from{EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_graph_get_vertex_by_id, &graph,
+                                        mgp_vertex_id{vertex_ids[0].AsInt()}, &memory)};
+  MgpVertexPtr to{EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_graph_get_vertex_by_id, &graph,
+                                      mgp_vertex_id{vertex_ids[1].AsInt()}, &memory)};
+  ASSERT_NE(from, nullptr);
+  ASSERT_NE(to, nullptr);
+  MgpEdgePtr edge{EXPECT_MGP_NO_ERROR(mgp_edge *, mgp_graph_create_edge, &graph, from.get(), to.get(),
+                                      mgp_edge_type{"OTHER"}, &memory)};
+  ASSERT_NE(edge, nullptr);
+  mgp_edge_type edge_type{"EDGE"};
+  mgp_edge_type other_type{"OTHER"};
+  mgp_edge_type missing_type{"MISSING"};
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_vertex_out_degree, from.get(), nullptr), 2);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_vertex_out_degree, from.get(), &edge_type), 1);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_vertex_out_degree, from.get(), &other_type), 1);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_vertex_out_degree, from.get(), &missing_type), 0);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_vertex_in_degree, from.get(), nullptr), 0);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_vertex_in_degree, to.get(), nullptr), 2);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_vertex_in_degree, to.get(), &other_type), 1);
+}
+
 TEST_F(MgpGraphTest, EdgeSetProperty) {
   constexpr std::string_view property_to_update{"to_update"};
   constexpr std::string_view property_to_set{"to_set"};
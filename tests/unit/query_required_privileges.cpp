@@ -110,6 +110,12 @@ TEST_F(TestPrivilegeExtractor, ShowConstraintInfo) {
   EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::CONSTRAINT));
 }
 
+TEST_F(TestPrivilegeExtractor, ShowMemoryInfo) {
+  auto *query = storage.Create<InfoQuery>();
+  query->info_type_ = InfoQuery::InfoType::MEMORY;
+  EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::STATS));
+}
+
 TEST_F(TestPrivilegeExtractor, CreateConstraint) {
   auto *query = storage.Create<ConstraintQuery>();
   query->action_type_ = ConstraintQuery::ActionType::CREATE;
@@ -161,6 +167,11 @@ TEST_F(TestPrivilegeExtractor, SetIsolationLevelQuery) {
   EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::CONFIG));
 }
 
+TEST_F(TestPrivilegeExtractor, StorageModeQuery) {
+  auto *query = storage.Create<StorageModeQuery>();
+  EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::CONFIG));
+}
+
 TEST_F(TestPrivilegeExtractor, CreateSnapshotQuery) {
   auto *query = storage.Create<CreateSnapshotQuery>();
   EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::DURABILITY));
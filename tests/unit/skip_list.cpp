@@ -842,3 +842,49 @@ TEST(SkipList, EstimateAverageNumberOfEquals5) {
     ASSERT_EQ(count, kMaxElements);
   }
 }
+
+TEST(SkipList, Partition) {
+  utils::SkipList<int64_t> list;
+  auto acc = list.access();
+
+  // An empty list is a single empty range.
+  {
+    auto chunks = acc.partition(4);
+    ASSERT_EQ(chunks.size(), 1);
+    ASSERT_EQ(chunks[0].first, chunks[0].second);
+  }
+
+  const int64_t kSize = 100000;
+  for (int64_t i = 0; i < kSize; ++i) {
+    ASSERT_TRUE(acc.insert(i).second);
+  }
+
+  for (uint64_t max_chunks : {1, 2, 7, 16, 1000}) {
+    auto chunks = acc.partition(max_chunks);
+    ASSERT_GE(chunks.size(), 1);
+    ASSERT_LE(chunks.size(), max_chunks);
+    ASSERT_EQ(chunks.front().first, acc.begin());
+    ASSERT_EQ(chunks.back().second, acc.end());
+    // The ranges cover all items exactly once and in order.
+    int64_t expected = 0;
+    for (const auto &[begin, end] : chunks) {
+      ASSERT_NE(begin, end);
+      for (auto it = begin; it != end; ++it) {
+        ASSERT_EQ(*it, expected);
+        ++expected;
+      }
+    }
+    ASSERT_EQ(expected, kSize);
+  }
+
+  // The chunks should be roughly balanced for a large list.
+  auto chunks = acc.partition(4);
+  ASSERT_EQ(chunks.size(), 4);
+  for (const auto &[begin, end] : chunks) {
+    uint64_t count = 0;
+    for (auto it = begin; it != end; ++it) {
+      ++count;
+    }
+    ASSERT_GT(count, kSize / 16);
+  }
+}
@@ -960,3 +960,60 @@ TEST_F(ConstraintsTest, UniqueConstraintsComparePropertyValues) {
     ASSERT_NO_ERROR(acc.Commit());
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(ConstraintsParallelCreationTest, Validation) {
+  const int64_t kNumVertices = 50000;
+  Storage storage(Config{.schema_creation = {.num_threads = 4}});
+  auto label = storage.NameToLabel("label");
+  auto prop1 = storage.NameToProperty("prop1");
+  auto prop2 = storage.NameToProperty("prop2");
+  std::optional<Gid> last_gid;
+  {
+    auto acc = storage.Access();
+    for (int64_t i = 0; i < kNumVertices; ++i) {
+      auto vertex = acc.CreateVertex();
+      ASSERT_NO_ERROR(vertex.AddLabel(label));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop1, PropertyValue(i)));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop2, PropertyValue(i % 1000)));
+      last_gid = vertex.Gid();
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  {
+    auto res = storage.CreateExistenceConstraint(label, prop1);
+    ASSERT_TRUE(res.HasValue() && res.GetValue());
+  }
+  {
+    auto res = storage.CreateUniqueConstraint(label, {prop1});
+    ASSERT_TRUE(res.HasValue());
+    ASSERT_EQ(res.GetValue(), UniqueConstraints::CreationStatus::SUCCESS);
+  }
+  {
+    auto res = storage.CreateUniqueConstraint(label, {prop2});
+    ASSERT_TRUE(res.HasError());
+    EXPECT_EQ(res.GetError(), (ConstraintViolation{ConstraintViolation::Type::UNIQUE, label, std::set{prop2}}));
+  }
+  ASSERT_TRUE(storage.DropUniqueConstraint(label, {prop1}) == UniqueConstraints::DeletionStatus::SUCCESS);
+
+  // Only the last vertex violates the constraints.
+  {
+    auto acc = storage.Access();
+    auto vertex = acc.FindVertex(*last_gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_NO_ERROR(vertex->SetProperty(prop1, PropertyValue(0)));
+    ASSERT_NO_ERROR(vertex->SetProperty(prop2, PropertyValue()));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  {
+    auto res = storage.CreateUniqueConstraint(label, {prop1});
+    ASSERT_TRUE(res.HasError());
+    EXPECT_EQ(res.GetError(), (ConstraintViolation{ConstraintViolation::Type::UNIQUE, label, std::set{prop1}}));
+  }
+  {
+    auto res = storage.CreateExistenceConstraint(label, prop2);
+    ASSERT_TRUE(res.HasError());
+    EXPECT_EQ(res.GetError(), (ConstraintViolation{ConstraintViolation::Type::EXISTENCE, label, std::set{prop2}}));
+  }
+}
@@ -2,9 +2,12 @@
 
 #include <filesystem>
 #include <limits>
+#include <random>
 
 #include "storage/v2/durability/serialization.hpp"
+#include "storage/v2/durability/version.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/temporal.hpp"
 
 static const std::string kTestMagic{"MGtest"};
@@ -307,6 +310,8 @@ TEST_F(DecoderEncoderTest, PropertyValueInvalidMarker) {
         case storage::durability::Marker::TYPE_MAP:
         case storage::durability::Marker::TYPE_TEMPORAL_DATA:
         case storage::durability::Marker::TYPE_PROPERTY_VALUE:
+        case storage::durability::Marker::TYPE_INTERNED_STRING:
+        case storage::durability::Marker::TYPE_INTERNED_STRING_DEFINITION:
           valid_marker = true;
           break;
 
@@ -318,6 +323,8 @@ TEST_F(DecoderEncoderTest, PropertyValueInvalidMarker) {
         case storage::durability::Marker::SECTION_CONSTRAINTS:
         case storage::durability::Marker::SECTION_DELTA:
         case storage::durability::Marker::SECTION_EPOCH_HISTORY:
+        case storage::durability::Marker::SECTION_SEGMENTS:
+        case storage::durability::Marker::SECTION_DELETED_OBJECTS:
         case storage::durability::Marker::SECTION_OFFSETS:
         case storage::durability::Marker::DELTA_VERTEX_CREATE:
         case storage::durability::Marker::DELTA_VERTEX_DELETE:
@@ -336,6 +343,12 @@ TEST_F(DecoderEncoderTest, PropertyValueInvalidMarker) {
         case storage::durability::Marker::DELTA_EXISTENCE_CONSTRAINT_DROP:
         case storage::durability::Marker::DELTA_UNIQUE_CONSTRAINT_CREATE:
         case storage::durability::Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
+        case storage::durability::Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
+        case storage::durability::Marker::DELTA_EDGE_TYPE_INDEX_DROP:
+        case storage::durability::Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+        case storage::durability::Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
+        case storage::durability::Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case storage::durability::Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
         case storage::durability::Marker::VALUE_FALSE:
         case storage::durability::Marker::VALUE_TRUE:
           valid_marker = false;
@@ -440,3 +453,141 @@ TEST_F(DecoderEncoderTest, EncoderPosition) {
     ASSERT_EQ(pos, decoder.GetSize());
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DecoderEncoderTest, CompressedBlocks) {
+  // The file is read both with the block index written by `Finalize` and by
+  // scanning the blocks of an unfinalized file (e.g. the current WAL).
+  for (const bool finalize : {true, false}) {
+    std::vector<std::pair<uint64_t, uint64_t>> positions;
+    uint64_t offset = 0;
+    std::filesystem::remove(storage_file);
+    {
+      storage::durability::Encoder encoder;
+      encoder.Initialize(storage_file, kTestMagic, storage::durability::kVersion);
+      offset = encoder.GetPosition();
+      encoder.WriteUint(0);
+      encoder.StartCompression(storage::Config::Durability::Compression::LZ4);
+      for (uint64_t i = 0; i < 100000; ++i) {
+        positions.emplace_back(encoder.GetPosition(), i);
+        encoder.WriteUint(i);
+        encoder.WriteString(std::string(i % 50, 'a' + i % 26));
+        if (i % 1000 == 0) encoder.TryFlushing();
+      }
+      // Data before the compressed blocks can still be overwritten.
+      const auto end = encoder.GetPosition();
+      encoder.SetPosition(offset);
+      encoder.WriteUint(end);
+      encoder.SetPosition(end);
+      if (finalize) {
+        encoder.Finalize();
+      } else {
+        encoder.Sync();
+        encoder.Close();
+      }
+      const auto &stats = encoder.GetCompressionStats();
+      ASSERT_EQ(stats.uncompressed_bytes, end - positions.front().first);
+      ASSERT_LT(stats.compressed_bytes, stats.uncompressed_bytes);
+      ASSERT_LT(std::filesystem::file_size(storage_file), end);
+    }
+    {
+      storage::durability::Decoder decoder;
+      auto version = decoder.Initialize(storage_file, kTestMagic);
+      ASSERT_TRUE(version);
+      ASSERT_EQ(*version, storage::durability::kVersion);
+      auto end = decoder.ReadUint();
+      ASSERT_TRUE(end);
+      ASSERT_EQ(*end, decoder.GetSize());
+      for (const auto &[position, value] : positions) {
+        ASSERT_EQ(decoder.GetPosition(), position);
+        auto decoded = decoder.ReadUint();
+        ASSERT_TRUE(decoded);
+        ASSERT_EQ(*decoded, value);
+        auto decoded_string = decoder.ReadString();
+        ASSERT_TRUE(decoded_string);
+        ASSERT_EQ(*decoded_string, std::string(value % 50, 'a' + value % 26));
+      }
+      ASSERT_EQ(decoder.GetPosition(), decoder.GetSize());
+      ASSERT_FALSE(decoder.ReadMarker());
+
+      std::mt19937 gen(0);
+      for (int i = 0; i < 10000; ++i) {
+        const auto &[position, value] = positions[gen() % positions.size()];
+        ASSERT_TRUE(decoder.SetPosition(position));
+        ASSERT_TRUE(decoder.PeekMarker());
+        auto decoded = decoder.ReadUint();
+        ASSERT_TRUE(decoded);
+        ASSERT_EQ(*decoded, value);
+        ASSERT_TRUE(decoder.SkipString());
+      }
+      ASSERT_TRUE(decoder.SetPosition(offset));
+      auto decoded = decoder.ReadUint();
+      ASSERT_TRUE(decoded);
+      ASSERT_EQ(*decoded, *end);
+      ASSERT_GT(decoder.GetCompressionStats().compressed_bytes, 0);
+    }
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DecoderEncoderTest, InternedStrings) {
+  auto &dictionary = storage::StringDictionary::Global();
+  const std::string interned("interned value");
+  dictionary.Acquire(interned);
+  auto id = dictionary.Acquire(interned);
+  ASSERT_TRUE(id);
+  const storage::PropertyValue value(interned);
+  const storage::PropertyValue list(std::vector<storage::PropertyValue>{value, storage::PropertyValue("other")});
+
+  // The interned string is written in full only once per reset, and only in
+  // files of a version that supports interned strings.
+  uint64_t reset_position = 0;
+  for (const auto version : {kTestVersion, storage::durability::kVersion}) {
+    storage::durability::Encoder encoder;
+    encoder.Initialize(storage_file, kTestMagic, version);
+    const auto begin = encoder.GetPosition();
+    encoder.WritePropertyValue(value);
+    const auto first_size = encoder.GetPosition() - begin;
+    encoder.WritePropertyValue(value);
+    const auto second_size = encoder.GetPosition() - begin - first_size;
+    if (version == kTestVersion) {
+      ASSERT_EQ(second_size, first_size);
+    } else {
+      ASSERT_LT(second_size, first_size);
+    }
+    encoder.WritePropertyValue(list);
+    encoder.ResetInternedStrings();
+    reset_position = encoder.GetPosition();
+    encoder.WritePropertyValue(value);
+    encoder.WritePropertyValue(value);
+    encoder.Finalize();
+  }
+  dictionary.Release(*id);
+
+  {
+    storage::durability::Decoder decoder;
+    auto version = decoder.Initialize(storage_file, kTestMagic);
+    ASSERT_TRUE(version);
+    ASSERT_EQ(*version, storage::durability::kVersion);
+    // The skipped definitions are still known.
+    ASSERT_TRUE(decoder.SkipPropertyValue());
+    ASSERT_EQ(decoder.ReadPropertyValue(), value);
+    ASSERT_EQ(decoder.ReadPropertyValue(), list);
+    ASSERT_EQ(decoder.ReadPropertyValue(), value);
+    ASSERT_EQ(decoder.ReadPropertyValue(), value);
+  }
+  {
+    // The data after the reset can be read on its own.
+    storage::durability::Decoder decoder;
+    ASSERT_TRUE(decoder.Initialize(storage_file, kTestMagic));
+    ASSERT_TRUE(decoder.SetPosition(reset_position));
+    ASSERT_EQ(decoder.ReadPropertyValue(), value);
+    ASSERT_EQ(decoder.ReadPropertyValue(), value);
+
+    // References to strings that weren't defined are invalid.
+    ASSERT_TRUE(decoder.SetPosition(reset_position));
+    ASSERT_TRUE(decoder.SkipPropertyValue());
+    decoder.ResetInternedStrings();
+    ASSERT_FALSE(decoder.ReadPropertyValue());
+  }
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "storage/v2/delta_container.hpp"
+
+namespace {
+std::atomic<uint64_t> kTimestamp{0};
+}  // namespace
+
+TEST(DeltaContainer, Empty) {
+  storage::DeltaContainer deltas;
+  ASSERT_TRUE(deltas.empty());
+  ASSERT_EQ(deltas.size(), 0);
+  ASSERT_EQ(deltas.begin(), deltas.end());
+  deltas.clear();
+  ASSERT_TRUE(deltas.empty());
+}
+
+TEST(DeltaContainer, StableAddressesAndOrder) {
+  storage::DeltaContainer deltas;
+  std::vector<storage::Delta *> pointers;
+  const uint64_t kCount = 10000;
+  for (uint64_t i = 0; i < kCount; ++i) {
+    auto &delta = deltas.emplace_back(storage::Delta::AddLabelTag(), storage::LabelId::FromUint(i), &kTimestamp, i);
+    pointers.push_back(&delta);
+  }
+  ASSERT_FALSE(deltas.empty());
+  ASSERT_EQ(deltas.size(), kCount);
+
+  uint64_t index = 0;
+  for (const auto &delta : deltas) {
+    ASSERT_EQ(&delta, pointers[index]);
+    ASSERT_EQ(delta.action, storage::Delta::Action::ADD_LABEL);
+    ASSERT_EQ(delta.label, storage::LabelId::FromUint(index));
+    ASSERT_EQ(delta.command_id, index);
+    ++index;
+  }
+  ASSERT_EQ(index, kCount);
+}
+
+TEST(DeltaContainer, MoveAndDestroy) {
+  storage::DeltaContainer deltas;
+  const std::string long_string(1000, 'x');
+  for (uint64_t i = 0; i < 100; ++i) {
+    // The property values are heap allocated, so a missing destructor call
+    // would be reported by the sanitizers.
+    deltas.emplace_back(storage::Delta::SetPropertyTag(), storage::PropertyId::FromUint(i),
+                        storage::PropertyValue(long_string), &kTimestamp, 0);
+  }
+  auto *first = &*deltas.begin();
+
+  storage::DeltaContainer moved(std::move(deltas));
+  ASSERT_TRUE(deltas.empty());
+  ASSERT_EQ(deltas.begin(), deltas.end());
+  ASSERT_EQ(moved.size(), 100);
+  ASSERT_EQ(&*moved.begin(), first);
+
+  storage::DeltaContainer assigned;
+  assigned.emplace_back(storage::Delta::DeleteObjectTag(), &kTimestamp, 0);
+  assigned = std::move(moved);
+  ASSERT_EQ(assigned.size(), 100);
+  for (const auto &delta : assigned) {
+    ASSERT_EQ(delta.action, storage::Delta::Action::SET_PROPERTY);
+    ASSERT_EQ(delta.property.value.ValueString(), long_string);
+  }
+
+  assigned.clear();
+  ASSERT_TRUE(assigned.empty());
+  assigned.emplace_back(storage::Delta::DeleteObjectTag(), &kTimestamp, 0);
+  ASSERT_EQ(assigned.size(), 1);
+}
@@ -9,7 +9,12 @@
 #include <csignal>
 #include <filesystem>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <random>
 #include <thread>
+#include <tuple>
+#include <vector>
 
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/snapshot.hpp"
@@ -20,6 +25,7 @@
 #include "utils/timer.hpp"
 
 using testing::Contains;
+using testing::ElementsAre;
 using testing::UnorderedElementsAre;
 
 class DurabilityTest : public ::testing::TestWithParam<bool> {
@@ -668,6 +674,351 @@ TEST_P(DurabilityTest, SnapshotOnExit) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotMultipleThreads) {
+  // Create snapshot.
+  {
+    storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                            .durability = {.storage_directory = storage_directory,
+                                           .snapshot_thread_count = 4,
+                                           .snapshot_on_exit = true}});
+    CreateBaseDataset(&store, GetParam());
+    CreateExtendedDataset(&store);
+    VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  // The snapshot is written without temporary files.
+  auto snapshots = GetSnapshotsList();
+  ASSERT_EQ(snapshots.size(), 1);
+  ASSERT_EQ(GetWalsList().size(), 0);
+  ASSERT_EQ(std::distance(std::filesystem::directory_iterator(snapshots[0].parent_path()),
+                          std::filesystem::directory_iterator()),
+            1);
+
+  // The segments cover all objects. They are written in any order, but the
+  // first one starts at the start of the objects.
+  auto info = storage::durability::ReadSnapshotInfo(snapshots[0]);
+  ASSERT_GT(info.vertex_segments.size(), 1);
+  uint64_t vertices_count = 0;
+  uint64_t first_vertex_offset = std::numeric_limits<uint64_t>::max();
+  for (const auto &segment : info.vertex_segments) {
+    vertices_count += segment.count;
+    first_vertex_offset = std::min(first_vertex_offset, segment.offset);
+  }
+  ASSERT_EQ(first_vertex_offset, info.offset_vertices);
+  ASSERT_EQ(vertices_count, kNumBaseVertices + kNumExtendedVertices);
+  ASSERT_EQ(vertices_count, info.vertices_count);
+  if (GetParam()) {
+    ASSERT_GT(info.edge_segments.size(), 1);
+    uint64_t edges_count = 0;
+    uint64_t first_edge_offset = std::numeric_limits<uint64_t>::max();
+    for (const auto &segment : info.edge_segments) {
+      edges_count += segment.count;
+      first_edge_offset = std::min(first_edge_offset, segment.offset);
+    }
+    ASSERT_EQ(first_edge_offset, info.offset_edges);
+    ASSERT_EQ(edges_count, kNumBaseEdges + kNumExtendedEdges);
+  } else {
+    ASSERT_TRUE(info.edge_segments.empty());
+  }
+
+  // Recover snapshot.
+  storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                          .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotParallelRecovery) {
+  // Create snapshot.
+  {
+    storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                            .durability = {.storage_directory = storage_directory,
+                                           .snapshot_thread_count = 4,
+                                           .snapshot_on_exit = true}});
+    CreateBaseDataset(&store, GetParam());
+    CreateExtendedDataset(&store);
+    VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetWalsList().size(), 0);
+
+  // Recover snapshot with more threads than there are segments.
+  for (uint64_t threads : {2, 4, 64}) {
+    storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                            .durability = {.storage_directory = storage_directory,
+                                           .recover_on_startup = true,
+                                           .recovery_thread_count = threads}});
+    VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotCompressed) {
+  // Create compressed snapshot.
+  {
+    storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                            .durability = {.storage_directory = storage_directory,
+                                           .snapshot_thread_count = 4,
+                                           .snapshot_on_exit = true,
+                                           .compression = storage::Config::Durability::Compression::LZ4}});
+    CreateBaseDataset(&store, GetParam());
+    CreateExtendedDataset(&store);
+    VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetWalsList().size(), 0);
+  const auto compressed_snapshot = GetSnapshotsList().front();
+
+  // Recover compressed snapshot and create an uncompressed one.
+  for (uint64_t threads : {1, 4}) {
+    storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                            .durability = {.storage_directory = storage_directory,
+                                           .recover_on_startup = true,
+                                           .recovery_thread_count = threads,
+                                           .snapshot_on_exit = threads == 4}});
+    VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  auto snapshots = GetSnapshotsList();
+  ASSERT_EQ(snapshots.size(), 2);
+  const auto &uncompressed_snapshot = snapshots[0] == compressed_snapshot ? snapshots[1] : snapshots[0];
+  ASSERT_LT(std::filesystem::file_size(compressed_snapshot), std::filesystem::file_size(uncompressed_snapshot));
+
+  // Recover uncompressed snapshot.
+  storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                          .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotIncremental) {
+  const storage::Config config{
+      .items = {.properties_on_edges = GetParam()},
+      .durability = {.storage_directory = storage_directory,
+                     .recover_on_startup = true,
+                     .snapshot_retention_count = 2,
+                     .snapshot_incremental_count = 2}};
+
+  // Labels, properties and edge types are dumped by name because the
+  // recovered storage doesn't necessarily assign them the same ids.
+  using Properties = std::map<std::string, storage::PropertyValue>;
+  using Edges = std::vector<std::tuple<storage::Gid, std::string, storage::Gid, Properties>>;
+  using Graph = std::map<storage::Gid, std::tuple<std::vector<std::string>, Properties, Edges>>;
+  auto dump = [](storage::Storage *store, Graph *graph) {
+    auto acc = store->Access();
+    auto to_names = [&](const std::map<storage::PropertyId, storage::PropertyValue> &properties) {
+      Properties named;
+      for (const auto &[property, value] : properties) named.emplace(acc.PropertyToName(property), value);
+      return named;
+    };
+    for (auto vertex : acc.Vertices(storage::View::OLD)) {
+      auto labels = vertex.Labels(storage::View::OLD);
+      ASSERT_TRUE(labels.HasValue());
+      auto properties = vertex.Properties(storage::View::OLD);
+      ASSERT_TRUE(properties.HasValue());
+      auto out_edges = vertex.OutEdges(storage::View::OLD);
+      ASSERT_TRUE(out_edges.HasValue());
+      std::vector<std::string> label_names;
+      for (const auto &label : *labels) label_names.push_back(acc.LabelToName(label));
+      Edges edges;
+      for (const auto &edge : *out_edges) {
+        auto edge_properties = edge.Properties(storage::View::OLD);
+        ASSERT_TRUE(edge_properties.HasValue());
+        edges.emplace_back(edge.Gid(), acc.EdgeTypeToName(edge.EdgeType()), edge.ToVertex().Gid(),
+                           to_names(*edge_properties));
+      }
+      std::sort(label_names.begin(), label_names.end());
+      std::sort(edges.begin(), edges.end(),
+                [](const auto &a, const auto &b) { return std::get<0>(a) < std::get<0>(b); });
+      graph->emplace(vertex.Gid(), std::make_tuple(label_names, to_names(*properties), edges));
+    }
+  };
+
+  // Modifies, creates and deletes random vertices and edges.
+  auto modify = [&](storage::Storage *store, uint64_t seed) {
+    const auto label = store->NameToLabel("incremental");
+    const auto property = store->NameToProperty("incremental");
+    const auto edge_type = store->NameToEdgeType("incremental");
+    auto acc = store->Access();
+    std::vector<storage::Gid> gids;
+    for (auto vertex : acc.Vertices(storage::View::OLD)) {
+      gids.push_back(vertex.Gid());
+    }
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint64_t> vertex_dist(0, gids.size() - 1);
+    std::uniform_int_distribution<int> op_dist(0, 5);
+    for (uint64_t i = 0; i < 200; ++i) {
+      auto vertex = acc.FindVertex(gids[vertex_dist(gen)], storage::View::NEW);
+      if (!vertex) continue;
+      switch (op_dist(gen)) {
+        case 0:
+          ASSERT_TRUE(vertex->SetProperty(property, storage::PropertyValue(static_cast<int64_t>(i))).HasValue());
+          break;
+        case 1:
+          ASSERT_TRUE(vertex->AddLabel(label).HasValue());
+          break;
+        case 2: {
+          auto other = acc.CreateVertex();
+          auto edge = acc.CreateEdge(&*vertex, &other, edge_type);
+          ASSERT_TRUE(edge.HasValue());
+          if (GetParam()) {
+            ASSERT_TRUE(edge->SetProperty(property, storage::PropertyValue(static_cast<int64_t>(i))).HasValue());
+          }
+          break;
+        }
+        case 3: {
+          auto out_edges = vertex->OutEdges(storage::View::NEW);
+          ASSERT_TRUE(out_edges.HasValue());
+          if (!out_edges->empty() && GetParam()) {
+            auto edge = out_edges->front();
+            ASSERT_TRUE(edge.SetProperty(property, storage::PropertyValue(static_cast<int64_t>(i))).HasValue());
+          }
+          break;
+        }
+        case 4: {
+          auto out_edges = vertex->OutEdges(storage::View::NEW);
+          ASSERT_TRUE(out_edges.HasValue());
+          if (!out_edges->empty()) {
+            ASSERT_TRUE(acc.DeleteEdge(&out_edges->front()).HasValue());
+          }
+          break;
+        }
+        case 5:
+          ASSERT_TRUE(acc.DetachDeleteVertex(&*vertex).HasValue());
+          break;
+      }
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  };
+
+  // Create a full snapshot followed by two incremental ones.
+  Graph expected;
+  {
+    storage::Storage store(config);
+    CreateBaseDataset(&store, GetParam());
+    ASSERT_FALSE(store.CreateSnapshot().HasError());
+    CreateExtendedDataset(&store);
+    ASSERT_FALSE(store.CreateSnapshot().HasError());
+    modify(&store, 1);
+    ASSERT_FALSE(store.CreateSnapshot().HasError());
+    dump(&store, &expected);
+  }
+
+  auto snapshots = GetSnapshotsList();
+  ASSERT_EQ(snapshots.size(), 3);
+  std::vector<storage::durability::SnapshotInfo> infos;
+  for (const auto &path : snapshots) {
+    infos.push_back(storage::durability::ReadSnapshotInfo(path));
+  }
+  std::sort(infos.begin(), infos.end(),
+            [](const auto &a, const auto &b) { return a.start_timestamp < b.start_timestamp; });
+  ASSERT_FALSE(infos[0].IsIncremental());
+  for (uint64_t i = 1; i < infos.size(); ++i) {
+    ASSERT_TRUE(infos[i].IsIncremental());
+    ASSERT_EQ(infos[i].base_start_timestamp, infos[0].start_timestamp);
+    ASSERT_EQ(infos[i].previous_start_timestamp, infos[i - 1].start_timestamp);
+    ASSERT_LT(infos[i].vertices_count, infos[0].vertices_count);
+  }
+
+  // Recover the chain. The first snapshot after the recovery is a full one,
+  // and so is every third snapshot after it.
+  {
+    storage::Storage store(config);
+    Graph graph;
+    dump(&store, &graph);
+    ASSERT_EQ(graph, expected);
+    ASSERT_EQ(store.GetInfo().edge_count, [&] {
+      uint64_t count = 0;
+      for (const auto &[gid, vertex] : expected) count += std::get<2>(vertex).size();
+      return count;
+    }());
+
+    for (uint64_t i = 0; i < 4; ++i) {
+      modify(&store, 2 + i);
+      ASSERT_FALSE(store.CreateSnapshot().HasError());
+    }
+    expected.clear();
+    dump(&store, &expected);
+  }
+
+  // The chain of the recovered snapshots is removed, and the last chain is
+  // kept because of its retained incremental snapshots.
+  snapshots = GetSnapshotsList();
+  ASSERT_EQ(snapshots.size(), 4);
+  uint64_t full_snapshots = 0;
+  for (const auto &path : snapshots) {
+    auto info = storage::durability::ReadSnapshotInfo(path);
+    ASSERT_GT(info.base_start_timestamp, infos.back().start_timestamp);
+    if (!info.IsIncremental()) ++full_snapshots;
+  }
+  ASSERT_EQ(full_snapshots, 2);
+
+  // Recover the consolidated snapshot.
+  {
+    storage::Storage store(config);
+    Graph graph;
+    dump(&store, &graph);
+    ASSERT_EQ(graph, expected);
+  }
+
+  // An incremental snapshot is skipped when the snapshots it is based on are
+  // missing, so there is nothing left to recover from.
+  {
+    storage::Storage store(config);
+    modify(&store, 10);
+    ASSERT_FALSE(store.CreateSnapshot().HasError());
+    modify(&store, 11);
+    ASSERT_FALSE(store.CreateSnapshot().HasError());
+  }
+  uint64_t incremental_snapshots = 0;
+  for (const auto &path : GetSnapshotsList()) {
+    if (storage::durability::ReadSnapshotInfo(path).IsIncremental()) {
+      ++incremental_snapshots;
+    } else {
+      ASSERT_TRUE(std::filesystem::remove(path));
+    }
+  }
+  ASSERT_GT(incremental_snapshots, 0);
+  ASSERT_DEATH({ storage::Storage store(config); }, "");
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotAfterAnalyticalMode) {
+  // The changes made in the analytical mode aren't written to the WAL, they
+  // are persisted by the snapshot created when switching back, before any
+  // transaction commits to the WAL again.
+  {
+    storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .snapshot_wal_mode = storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                        .snapshot_interval = std::chrono::minutes(20)}});
+    ASSERT_FALSE(store.SetStorageMode(storage::StorageMode::IN_MEMORY_ANALYTICAL).HasError());
+    {
+      auto acc = store.Access();
+      for (uint64_t i = 0; i < kNumBaseVertices; ++i) {
+        acc.CreateVertex();
+      }
+      ASSERT_FALSE(acc.Commit().HasError());
+    }
+    ASSERT_EQ(GetSnapshotsList().size(), 0);
+    ASSERT_FALSE(store.SetStorageMode(storage::StorageMode::IN_MEMORY_TRANSACTIONAL).HasError());
+    ASSERT_EQ(GetSnapshotsList().size(), 1);
+    {
+      auto acc = store.Access();
+      acc.CreateVertex();
+      ASSERT_FALSE(acc.Commit().HasError());
+    }
+  }
+
+  storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                          .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  ASSERT_EQ(store.GetInfo().vertex_count, kNumBaseVertices + 1);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, SnapshotPeriodic) {
   // Create snapshot.
@@ -1135,6 +1486,114 @@ TEST_P(DurabilityTest, WalBasic) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalCompressed) {
+  // Create compressed WALs.
+  {
+    storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .snapshot_wal_mode = storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                        .snapshot_interval = std::chrono::minutes(20),
+                        .wal_file_flush_every_n_tx = kFlushWalEvery,
+                        .compression = storage::Config::Durability::Compression::LZ4}});
+    CreateBaseDataset(&store, GetParam());
+    CreateExtendedDataset(&store);
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover WALs.
+  for (uint64_t threads : {1, 4}) {
+    storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                            .durability = {.storage_directory = storage_directory,
+                                           .recover_on_startup = true,
+                                           .recovery_thread_count = threads}});
+    VerifyDataset(&store, DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalGroupCommit) {
+  const uint64_t kNumThreads = 4;
+  const uint64_t kNumCommits = 100;
+
+  // Create WALs.
+  {
+    storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .snapshot_wal_mode = storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                        .snapshot_interval = std::chrono::minutes(20),
+                        .wal_group_commit = true,
+                        .wal_group_commit_max_latency = std::chrono::microseconds(100)}});
+    std::vector<std::thread> threads;
+    threads.reserve(kNumThreads);
+    for (uint64_t i = 0; i < kNumThreads; ++i) {
+      threads.emplace_back([&store] {
+        for (uint64_t j = 0; j < kNumCommits; ++j) {
+          auto acc = store.Access();
+          acc.CreateVertex();
+          MG_ASSERT(!acc.Commit().HasError(), "Couldn't commit transaction!");
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    // Each commit waited for its WAL transaction to be synced.
+    auto info = store.GetInfo();
+    ASSERT_EQ(info.wal_synced_transactions, kNumThreads * kNumCommits);
+    ASSERT_GE(info.wal_sync_batches, 1);
+    ASSERT_LE(info.wal_sync_batches, kNumThreads * kNumCommits);
+    ASSERT_GE(info.wal_max_sync_batch_size, 1);
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover WALs.
+  storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                          .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  auto acc = store.Access();
+  uint64_t count = 0;
+  for ([[maybe_unused]] const auto &vertex : acc.Vertices(storage::View::OLD)) {
+    ++count;
+  }
+  ASSERT_EQ(count, kNumThreads * kNumCommits);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalGroupCommitSingleCommitter) {
+  // The batch is synced as soon as every transaction written to the WAL waits
+  // for it, so a lone committer doesn't wait for the maximum latency.
+  storage::Storage store(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory,
+                      .snapshot_wal_mode = storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                      .snapshot_interval = std::chrono::minutes(20),
+                      .wal_group_commit = true,
+                      .wal_group_commit_max_latency = std::chrono::seconds(10)}});
+  utils::Timer timer;
+  for (uint64_t i = 0; i < 10; ++i) {
+    auto acc = store.Access();
+    acc.CreateVertex();
+    ASSERT_FALSE(acc.Commit().HasError());
+
+    // The commit is visible to the transactions started after it.
+    auto read_only_acc = store.ReadOnlyAccess();
+    uint64_t count = 0;
+    for ([[maybe_unused]] const auto &vertex : read_only_acc.Vertices(storage::View::OLD)) {
+      ++count;
+    }
+    ASSERT_EQ(count, i + 1);
+  }
+  ASSERT_LT(timer.Elapsed().count(), 10.0);
+  ASSERT_EQ(store.GetInfo().wal_synced_transactions, 10);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalBackup) {
   // Create WALs.
@@ -1983,6 +2442,135 @@ TEST_P(DurabilityTest, WalAllOperationsInSingleTransaction) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalParallelReplay) {
+  const uint64_t kNumVertices = 100;
+  const uint64_t kNumTransactions = 2000;
+
+  // Create WALs. Most of the transactions modify disjoint objects, but there are
+  // enough of them that touch the same vertices and edges.
+  {
+    storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .snapshot_wal_mode = storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                        .snapshot_interval = std::chrono::minutes(20),
+                        .wal_file_size_kibibytes = 16,
+                        .wal_file_flush_every_n_tx = kFlushWalEvery}});
+    const auto label = store.NameToLabel("label");
+    const auto property = store.NameToProperty("property");
+    const auto edge_type = store.NameToEdgeType("edge_type");
+    std::vector<storage::Gid> gids;
+    for (uint64_t i = 0; i < kNumVertices; ++i) {
+      auto acc = store.Access();
+      gids.push_back(acc.CreateVertex().Gid());
+      ASSERT_FALSE(acc.Commit().HasError());
+    }
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint64_t> vertex_dist(0, kNumVertices - 1);
+    std::uniform_int_distribution<int> op_dist(0, 4);
+    for (uint64_t i = 0; i < kNumTransactions; ++i) {
+      if (i == kNumTransactions / 2) {
+        ASSERT_TRUE(store.CreateIndex(label, property));
+      }
+      auto acc = store.Access();
+      auto vertex = acc.FindVertex(gids[vertex_dist(gen)], storage::View::OLD);
+      ASSERT_TRUE(vertex);
+      switch (op_dist(gen)) {
+        case 0:
+          ASSERT_TRUE(vertex->SetProperty(property, storage::PropertyValue(static_cast<int64_t>(i))).HasValue());
+          break;
+        case 1:
+          ASSERT_TRUE(vertex->AddLabel(label).HasValue());
+          break;
+        case 2:
+          ASSERT_TRUE(vertex->RemoveLabel(label).HasValue());
+          break;
+        case 3: {
+          auto other = acc.FindVertex(gids[vertex_dist(gen)], storage::View::OLD);
+          ASSERT_TRUE(other);
+          auto edge = acc.CreateEdge(&*vertex, &*other, edge_type);
+          ASSERT_TRUE(edge.HasValue());
+          if (GetParam()) {
+            ASSERT_TRUE(edge->SetProperty(property, storage::PropertyValue(static_cast<int64_t>(i))).HasValue());
+          }
+          break;
+        }
+        case 4: {
+          auto out_edges = vertex->OutEdges(storage::View::OLD);
+          ASSERT_TRUE(out_edges.HasValue());
+          if (!out_edges->empty()) {
+            ASSERT_TRUE(acc.DeleteEdge(&out_edges->front()).HasValue());
+          }
+          break;
+        }
+      }
+      ASSERT_FALSE(acc.Commit().HasError());
+    }
+    for (uint64_t i = 0; i < kNumVertices; i += 10) {
+      auto acc = store.Access();
+      auto vertex = acc.FindVertex(gids[i], storage::View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_TRUE(acc.DetachDeleteVertex(&*vertex).HasValue());
+      ASSERT_FALSE(acc.Commit().HasError());
+    }
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 2);
+
+  // Recover WALs and dump the whole graph.
+  using Properties = std::map<storage::PropertyId, storage::PropertyValue>;
+  using Edges = std::vector<std::tuple<storage::Gid, storage::EdgeTypeId, storage::Gid, Properties>>;
+  using Graph = std::map<storage::Gid, std::tuple<std::vector<storage::LabelId>, Properties, Edges>>;
+  auto recover = [&](uint64_t threads, Graph *graph, storage::StorageInfo *storage_info,
+                     std::vector<std::pair<storage::LabelId, storage::PropertyId>> *indices) {
+    storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                            .durability = {.storage_directory = storage_directory,
+                                           .recover_on_startup = true,
+                                           .recovery_thread_count = threads}});
+    auto acc = store.Access();
+    for (auto vertex : acc.Vertices(storage::View::OLD)) {
+      auto labels = vertex.Labels(storage::View::OLD);
+      ASSERT_TRUE(labels.HasValue());
+      auto properties = vertex.Properties(storage::View::OLD);
+      ASSERT_TRUE(properties.HasValue());
+      auto out_edges = vertex.OutEdges(storage::View::OLD);
+      ASSERT_TRUE(out_edges.HasValue());
+      Edges edges;
+      for (const auto &edge : *out_edges) {
+        auto edge_properties = edge.Properties(storage::View::OLD);
+        ASSERT_TRUE(edge_properties.HasValue());
+        edges.emplace_back(edge.Gid(), edge.EdgeType(), edge.ToVertex().Gid(), *edge_properties);
+      }
+      std::sort(labels->begin(), labels->end());
+      std::sort(edges.begin(), edges.end(),
+                [](const auto &a, const auto &b) { return std::get<0>(a) < std::get<0>(b); });
+      graph->emplace(vertex.Gid(), std::make_tuple(*labels, *properties, edges));
+    }
+    *storage_info = store.GetInfo();
+    *indices = store.ListAllIndices().label_property;
+  };
+
+  Graph serial_graph;
+  storage::StorageInfo serial_info;
+  std::vector<std::pair<storage::LabelId, storage::PropertyId>> serial_indices;
+  recover(1, &serial_graph, &serial_info, &serial_indices);
+  ASSERT_EQ(serial_graph.size(), kNumVertices - kNumVertices / 10);
+  ASSERT_EQ(serial_indices.size(), 1);
+
+  for (uint64_t threads : {2, 8}) {
+    Graph graph;
+    storage::StorageInfo info;
+    std::vector<std::pair<storage::LabelId, storage::PropertyId>> indices;
+    recover(threads, &graph, &info, &indices);
+    ASSERT_EQ(graph, serial_graph);
+    ASSERT_EQ(info.vertex_count, serial_info.vertex_count);
+    ASSERT_EQ(info.edge_count, serial_info.edge_count);
+    ASSERT_EQ(indices, serial_indices);
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalAndSnapshot) {
   // Create snapshot and WALs.
@@ -2312,3 +2900,209 @@ TEST_P(DurabilityTest, SnapshotAndWalMixedUUID) {
     ASSERT_FALSE(acc.Commit().HasError());
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, EdgeTypeIndexSnapshotAndWal) {
+  auto count_edges = [](storage::Storage *store, storage::EdgeTypeId edge_type) {
+    auto acc = store->Access();
+    uint64_t count = 0;
+    for (auto edge : acc.Edges(edge_type, storage::View::OLD)) {
+      EXPECT_EQ(edge.EdgeType(), edge_type);
+      ++count;
+    }
+    return count;
+  };
+
+  // Create snapshot.
+  {
+    storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                            .durability = {.storage_directory = storage_directory, .snapshot_on_exit = true}});
+    auto et1 = store.NameToEdgeType("et1");
+    ASSERT_TRUE(store.CreateIndex(et1));
+    auto acc = store.Access();
+    auto vertex1 = acc.CreateVertex();
+    auto vertex2 = acc.CreateVertex();
+    ASSERT_TRUE(acc.CreateEdge(&vertex1, &vertex2, et1).HasValue());
+    ASSERT_TRUE(acc.CreateEdge(&vertex2, &vertex1, et1).HasValue());
+    ASSERT_TRUE(acc.CreateEdge(&vertex1, &vertex2, store.NameToEdgeType("et2")).HasValue());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetBackupSnapshotsList().size(), 0);
+  ASSERT_EQ(GetWalsList().size(), 0);
+  ASSERT_EQ(GetBackupWalsList().size(), 0);
+
+  // Recover snapshot and create WALs.
+  {
+    storage::Storage store(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .recover_on_startup = true,
+                        .snapshot_wal_mode = storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                        .snapshot_interval = std::chrono::minutes(20),
+                        .wal_file_flush_every_n_tx = kFlushWalEvery}});
+    auto et1 = store.NameToEdgeType("et1");
+    auto et2 = store.NameToEdgeType("et2");
+    ASSERT_THAT(store.ListAllIndices().edge_type, UnorderedElementsAre(et1));
+    ASSERT_EQ(count_edges(&store, et1), 2);
+
+    ASSERT_TRUE(store.CreateIndex(et2));
+    ASSERT_TRUE(store.DropIndex(et1));
+    auto acc = store.Access();
+    auto vertex = acc.CreateVertex();
+    ASSERT_TRUE(acc.CreateEdge(&vertex, &vertex, et2).HasValue());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover snapshot and WALs.
+  storage::Storage store({.items = {.properties_on_edges = GetParam()},
+                          .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  auto et2 = store.NameToEdgeType("et2");
+  ASSERT_THAT(store.ListAllIndices().edge_type, UnorderedElementsAre(et2));
+  ASSERT_EQ(count_edges(&store, et2), 2);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DurabilityTest, EdgeTypePropertyIndexSnapshotAndWal) {
+  auto edge_values = [](storage::Storage *store, storage::EdgeTypeId edge_type, storage::PropertyId property) {
+    auto acc = store->Access();
+    std::vector<int64_t> values;
+    for (auto edge : acc.Edges(edge_type, property, storage::View::OLD)) {
+      values.push_back(edge.GetProperty(property, storage::View::OLD)->ValueInt());
+    }
+    return values;
+  };
+
+  // Create snapshot.
+  {
+    storage::Storage store({.items = {.properties_on_edges = true},
+                            .durability = {.storage_directory = storage_directory, .snapshot_on_exit = true}});
+    auto et = store.NameToEdgeType("et");
+    auto p1 = store.NameToProperty("p1");
+    ASSERT_FALSE(store.CreateIndex(et, p1).HasError());
+    auto acc = store.Access();
+    auto vertex1 = acc.CreateVertex();
+    auto vertex2 = acc.CreateVertex();
+    for (int64_t i = 0; i < 3; ++i) {
+      auto edge = acc.CreateEdge(&vertex1, &vertex2, et);
+      ASSERT_TRUE(edge.HasValue());
+      ASSERT_FALSE(edge->SetProperty(p1, storage::PropertyValue(i)).HasError());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetWalsList().size(), 0);
+
+  // Recover snapshot and create WALs.
+  {
+    storage::Storage store(
+        {.items = {.properties_on_edges = true},
+         .durability = {.storage_directory = storage_directory,
+                        .recover_on_startup = true,
+                        .snapshot_wal_mode = storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                        .snapshot_interval = std::chrono::minutes(20),
+                        .wal_file_flush_every_n_tx = kFlushWalEvery}});
+    auto et = store.NameToEdgeType("et");
+    auto p1 = store.NameToProperty("p1");
+    auto p2 = store.NameToProperty("p2");
+    ASSERT_THAT(store.ListAllIndices().edge_type_property, UnorderedElementsAre(std::make_pair(et, p1)));
+    ASSERT_THAT(edge_values(&store, et, p1), ElementsAre(0, 1, 2));
+
+    ASSERT_FALSE(store.CreateIndex(et, p2).HasError());
+    ASSERT_TRUE(store.DropIndex(et, p1));
+    auto acc = store.Access();
+    auto vertex = acc.CreateVertex();
+    auto edge = acc.CreateEdge(&vertex, &vertex, et);
+    ASSERT_TRUE(edge.HasValue());
+    ASSERT_FALSE(edge->SetProperty(p2, storage::PropertyValue(42)).HasError());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover snapshot and WALs.
+  storage::Storage store({.items = {.properties_on_edges = true},
+                          .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  auto et = store.NameToEdgeType("et");
+  auto p2 = store.NameToProperty("p2");
+  ASSERT_THAT(store.ListAllIndices().edge_type_property, UnorderedElementsAre(std::make_pair(et, p2)));
+  ASSERT_THAT(edge_values(&store, et, p2), ElementsAre(42));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DurabilityTest, LabelPropertyCompositeIndexSnapshotAndWal) {
+  auto vertex_values = [](storage::Storage *store, storage::LabelId label,
+                          const std::vector<storage::PropertyId> &properties) {
+    auto acc = store->Access();
+    std::vector<int64_t> values;
+    for (auto vertex : acc.Vertices(label, properties, {storage::PropertyValue(1)}, std::nullopt, std::nullopt,
+                                    storage::View::OLD)) {
+      values.push_back(vertex.GetProperty(properties[1], storage::View::OLD)->ValueInt());
+    }
+    return values;
+  };
+
+  // Create snapshot.
+  {
+    storage::Storage store({.durability = {.storage_directory = storage_directory, .snapshot_on_exit = true}});
+    auto label = store.NameToLabel("l");
+    auto p1 = store.NameToProperty("p1");
+    auto p2 = store.NameToProperty("p2");
+    ASSERT_TRUE(store.CreateIndex(label, std::vector{p1, p2}));
+    auto acc = store.Access();
+    for (int64_t i = 0; i < 4; ++i) {
+      auto vertex = acc.CreateVertex();
+      ASSERT_FALSE(vertex.AddLabel(label).HasError());
+      ASSERT_FALSE(vertex.SetProperty(p1, storage::PropertyValue(i % 2)).HasError());
+      ASSERT_FALSE(vertex.SetProperty(p2, storage::PropertyValue(i)).HasError());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetWalsList().size(), 0);
+
+  // Recover snapshot and create WALs.
+  {
+    storage::Storage store(
+        {.durability = {.storage_directory = storage_directory,
+                        .recover_on_startup = true,
+                        .snapshot_wal_mode = storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                        .snapshot_interval = std::chrono::minutes(20),
+                        .wal_file_flush_every_n_tx = kFlushWalEvery}});
+    auto label = store.NameToLabel("l");
+    auto p1 = store.NameToProperty("p1");
+    auto p2 = store.NameToProperty("p2");
+    ASSERT_THAT(store.ListAllIndices().label_property_composite,
+                UnorderedElementsAre(std::make_pair(label, std::vector{p1, p2})));
+    ASSERT_THAT(vertex_values(&store, label, {p1, p2}), ElementsAre(1, 3));
+
+    // The order of the properties has to survive the WAL.
+    ASSERT_TRUE(store.CreateIndex(label, std::vector{p2, p1}));
+    ASSERT_TRUE(store.DropIndex(label, std::vector{p1, p2}));
+    auto acc = store.Access();
+    auto vertex = acc.CreateVertex();
+    ASSERT_FALSE(vertex.AddLabel(label).HasError());
+    ASSERT_FALSE(vertex.SetProperty(p2, storage::PropertyValue(1)).HasError());
+    ASSERT_FALSE(vertex.SetProperty(p1, storage::PropertyValue(42)).HasError());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover snapshot and WALs.
+  storage::Storage store({.durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+  auto label = store.NameToLabel("l");
+  auto p1 = store.NameToProperty("p1");
+  auto p2 = store.NameToProperty("p2");
+  ASSERT_THAT(store.ListAllIndices().label_property_composite,
+              UnorderedElementsAre(std::make_pair(label, std::vector{p2, p1})));
+  ASSERT_THAT(vertex_values(&store, label, {p2, p1}), ElementsAre(1, 42));
+}
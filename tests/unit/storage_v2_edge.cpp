@@ -1,6 +1,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <limits>
 
 #include "storage/v2/storage.hpp"
@@ -4602,6 +4603,250 @@ TEST_P(StorageEdgeTest, VertexDetachDeleteMultipleAbort) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(StorageEdgeTest, EdgeTypeFilterManyTypes) {
+  storage::Storage store({.items = {.properties_on_edges = GetParam()}});
+  storage::Gid gid_hub = storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  std::vector<storage::EdgeTypeId> edge_types;
+
+  auto count_edges = [](const std::vector<storage::EdgeAccessor> &edges, storage::EdgeTypeId edge_type) {
+    return std::count_if(edges.begin(), edges.end(), [edge_type](const auto &edge) {
+      return edge.EdgeType() == edge_type;
+    });
+  };
+
+  // Create a hub with edges of interleaved edge types.
+  {
+    auto acc = store.Access();
+    auto hub = acc.CreateVertex();
+    gid_hub = hub.Gid();
+    for (int i = 0; i < 5; ++i) {
+      edge_types.push_back(acc.NameToEdgeType("et" + std::to_string(i)));
+    }
+    for (int i = 0; i < 100; ++i) {
+      auto other = acc.CreateVertex();
+      // Insert the edge types in descending order so that every insertion has
+      // to be moved in front of the existing groups.
+      auto et = edge_types[4 - i % 5];
+      ASSERT_TRUE(acc.CreateEdge(&hub, &other, et).HasValue());
+      ASSERT_TRUE(acc.CreateEdge(&other, &hub, et).HasValue());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  // Check the filters and delete all edges of one edge type.
+  {
+    auto acc = store.Access();
+    auto hub = acc.FindVertex(gid_hub, storage::View::OLD);
+    ASSERT_TRUE(hub);
+    for (const auto et : edge_types) {
+      auto out_edges = hub->OutEdges(storage::View::OLD, {et});
+      ASSERT_TRUE(out_edges.HasValue());
+      ASSERT_EQ(out_edges->size(), 20);
+      ASSERT_EQ(count_edges(*out_edges, et), 20);
+      auto in_edges = hub->InEdges(storage::View::OLD, {et});
+      ASSERT_TRUE(in_edges.HasValue());
+      ASSERT_EQ(in_edges->size(), 20);
+      ASSERT_EQ(count_edges(*in_edges, et), 20);
+    }
+    {
+      auto out_edges = hub->OutEdges(storage::View::OLD, {edge_types[1], edge_types[3], edge_types[1]});
+      ASSERT_TRUE(out_edges.HasValue());
+      ASSERT_EQ(out_edges->size(), 40);
+    }
+
+    auto out_edges = hub->OutEdges(storage::View::OLD, {edge_types[2]});
+    ASSERT_TRUE(out_edges.HasValue());
+    for (auto &edge : *out_edges) {
+      auto ret = acc.DeleteEdge(&edge);
+      ASSERT_TRUE(ret.HasValue());
+      ASSERT_TRUE(*ret);
+    }
+
+    ASSERT_EQ(hub->OutEdges(storage::View::OLD, {edge_types[2]})->size(), 20);
+    ASSERT_EQ(hub->OutEdges(storage::View::NEW, {edge_types[2]})->size(), 0);
+    ASSERT_EQ(hub->OutEdges(storage::View::NEW)->size(), 80);
+    for (const auto et : {edge_types[0], edge_types[1], edge_types[3], edge_types[4]}) {
+      ASSERT_EQ(hub->OutEdges(storage::View::NEW, {et})->size(), 20);
+    }
+
+    // The degrees must agree with the number of edges.
+    ASSERT_EQ(*hub->OutDegree(storage::View::OLD, {edge_types[2]}), 20);
+    ASSERT_EQ(*hub->OutDegree(storage::View::NEW, {edge_types[2]}), 0);
+    ASSERT_EQ(*hub->OutDegree(storage::View::NEW, {edge_types[1], edge_types[2], edge_types[1]}), 20);
+    ASSERT_EQ(*hub->OutDegree(storage::View::NEW), 80);
+    ASSERT_EQ(*hub->InDegree(storage::View::NEW, {edge_types[2]}), 20);
+    ASSERT_EQ(*hub->InDegree(storage::View::NEW, {edge_types[0], edge_types[4]}), 40);
+
+    acc.Abort();
+  }
+
+  // The aborted deletion must restore the edges into their groups.
+  {
+    auto acc = store.Access();
+    auto hub = acc.FindVertex(gid_hub, storage::View::OLD);
+    ASSERT_TRUE(hub);
+    for (const auto et : edge_types) {
+      auto out_edges = hub->OutEdges(storage::View::NEW, {et});
+      ASSERT_TRUE(out_edges.HasValue());
+      ASSERT_EQ(count_edges(*out_edges, et), 20);
+      ASSERT_EQ(out_edges->size(), 20);
+      auto in_edges = hub->InEdges(storage::View::NEW, {et});
+      ASSERT_TRUE(in_edges.HasValue());
+      ASSERT_EQ(count_edges(*in_edges, et), 20);
+      ASSERT_EQ(in_edges->size(), 20);
+    }
+    ASSERT_EQ(*hub->OutDegree(storage::View::NEW), 100);
+    ASSERT_EQ(*hub->InDegree(storage::View::NEW), 100);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(StorageEdgeTest, LazyEdgeIteration) {
+  storage::Storage store({.items = {.properties_on_edges = GetParam()}});
+  storage::Gid gid_hub = storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  std::vector<storage::EdgeTypeId> edge_types;
+
+  auto gids = [](const auto &edges) {
+    std::vector<storage::Gid> ret;
+    for (const auto &edge : edges) ret.push_back(edge.Gid());
+    std::sort(ret.begin(), ret.end());
+    return ret;
+  };
+
+  // Create a hub with more edges than fit into a single batch.
+  {
+    auto acc = store.Access();
+    auto hub = acc.CreateVertex();
+    gid_hub = hub.Gid();
+    for (int i = 0; i < 3; ++i) {
+      edge_types.push_back(acc.NameToEdgeType("et" + std::to_string(i)));
+    }
+    for (int i = 0; i < 300; ++i) {
+      auto other = acc.CreateVertex();
+      ASSERT_TRUE(acc.CreateEdge(&hub, &other, edge_types[i % 3]).HasValue());
+      ASSERT_TRUE(acc.CreateEdge(&other, &hub, edge_types[i % 3]).HasValue());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  auto acc_before = store.Access();
+  auto hub_before = acc_before.FindVertex(gid_hub, storage::View::OLD);
+  ASSERT_TRUE(hub_before);
+
+  // Modify the edges and compare the lazy iteration with the eager one.
+  {
+    auto acc = store.Access();
+    auto hub = acc.FindVertex(gid_hub, storage::View::OLD);
+    ASSERT_TRUE(hub);
+    auto out_edges = hub->OutEdges(storage::View::OLD, {edge_types[1]});
+    ASSERT_TRUE(out_edges.HasValue());
+    for (size_t i = 0; i < out_edges->size(); i += 7) {
+      auto ret = acc.DeleteEdge(&(*out_edges)[i]);
+      ASSERT_TRUE(ret.HasValue());
+      ASSERT_TRUE(*ret);
+    }
+    for (int i = 0; i < 10; ++i) {
+      auto other = acc.CreateVertex();
+      ASSERT_TRUE(acc.CreateEdge(&*hub, &other, edge_types[i % 2]).HasValue());
+    }
+
+    for (auto view : {storage::View::OLD, storage::View::NEW}) {
+      for (const auto &types : std::vector<std::vector<storage::EdgeTypeId>>{
+               {}, {edge_types[1]}, {edge_types[2], edge_types[0]}, {edge_types[1], edge_types[1]}}) {
+        auto lazy_out = hub->IterateOutEdges(view, types);
+        ASSERT_TRUE(lazy_out.HasValue());
+        ASSERT_EQ(gids(*lazy_out), gids(*hub->OutEdges(view, types)));
+        auto lazy_in = hub->IterateInEdges(view, types);
+        ASSERT_TRUE(lazy_in.HasValue());
+        ASSERT_EQ(gids(*lazy_in), gids(*hub->InEdges(view, types)));
+      }
+    }
+
+    // Uncommitted changes aren't visible to the other transaction.
+    auto lazy_before = hub_before->IterateOutEdges(storage::View::OLD);
+    ASSERT_TRUE(lazy_before.HasValue());
+    auto gids_before = gids(*lazy_before);
+    ASSERT_EQ(gids_before, gids(*hub_before->OutEdges(storage::View::OLD)));
+    ASSERT_EQ(gids_before.size(), 300);
+
+    // Only the edges to the destination are returned.
+    auto edge = (*hub->OutEdges(storage::View::NEW, {edge_types[2]}))[0];
+    auto to = edge.ToVertex();
+    auto lazy_dest = hub->IterateOutEdges(storage::View::NEW, {}, &to);
+    ASSERT_TRUE(lazy_dest.HasValue());
+    ASSERT_EQ(gids(*lazy_dest), std::vector<storage::Gid>{edge.Gid()});
+
+    // The iteration can be stopped early.
+    auto lazy_partial = hub->IterateOutEdges(storage::View::NEW);
+    ASSERT_TRUE(lazy_partial.HasValue());
+    size_t count = 0;
+    for (const auto &edge : *lazy_partial) {
+      ASSERT_EQ(edge.FromVertex(), *hub);
+      if (++count == 3) break;
+    }
+    ASSERT_EQ(count, 3);
+
+    acc.Abort();
+  }
+
+  // Modify the edges while the iteration is in progress.
+  {
+    auto acc = store.Access();
+    auto hub = acc.FindVertex(gid_hub, storage::View::OLD);
+    ASSERT_TRUE(hub);
+    const auto before = gids(*hub->OutEdges(storage::View::NEW));
+    auto lazy = hub->IterateOutEdges(storage::View::NEW);
+    ASSERT_TRUE(lazy.HasValue());
+    std::vector<storage::Gid> returned;
+    std::vector<storage::Gid> created;
+    for (const auto &edge : *lazy) {
+      returned.push_back(edge.Gid());
+      if (returned.size() == 100) {
+        // Delete a few edges that weren't returned yet and a few that were,
+        // and create new ones.
+        auto current = *hub->OutEdges(storage::View::NEW);
+        size_t deleted = 0;
+        for (auto &other : current) {
+          if (deleted == 10) break;
+          auto ret = acc.DeleteEdge(&other);
+          ASSERT_TRUE(ret.HasValue());
+          ++deleted;
+        }
+        for (int i = 0; i < 5; ++i) {
+          auto other = acc.CreateVertex();
+          auto ret = acc.CreateEdge(&*hub, &other, edge_types[0]);
+          ASSERT_TRUE(ret.HasValue());
+          created.push_back(ret->Gid());
+        }
+      }
+    }
+    // The edges are returned as they were when the iteration started, even
+    // under the NEW view. The deleted edges are still returned and the created
+    // ones aren't.
+    auto sorted = returned;
+    std::sort(sorted.begin(), sorted.end());
+    ASSERT_EQ(sorted, before);
+    for (const auto &gid : created) {
+      ASSERT_FALSE(std::binary_search(sorted.begin(), sorted.end(), gid));
+    }
+    ASSERT_EQ(gids(*hub->OutEdges(storage::View::NEW)).size(), 295);
+    acc.Abort();
+  }
+
+  // The edges of a deleted vertex can't be iterated.
+  {
+    auto acc = store.Access();
+    auto hub = acc.FindVertex(gid_hub, storage::View::OLD);
+    ASSERT_TRUE(hub);
+    ASSERT_TRUE(acc.DetachDeleteVertex(&*hub).HasValue());
+    ASSERT_TRUE(hub->IterateOutEdges(storage::View::OLD).HasValue());
+    ASSERT_EQ(hub->IterateOutEdges(storage::View::NEW).GetError(), storage::Error::DELETED_OBJECT);
+    ASSERT_EQ(hub->IterateInEdges(storage::View::NEW).GetError(), storage::Error::DELETED_OBJECT);
+    acc.Abort();
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST(StorageWithProperties, EdgePropertyCommit) {
   storage::Storage store({.items = {.properties_on_edges = true}});
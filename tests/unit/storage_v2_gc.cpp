@@ -186,3 +186,71 @@ TEST(StorageV2Gc, Indices) {
     EXPECT_EQ(gids.size(), 1000);
   }
 }
+
+// A simple test checking that the garbage collector that uses multiple threads
+// frees all deleted objects and cleans up the indices.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, MultipleThreads) {
+  storage::Storage storage(storage::Config{.gc = {.type = storage::Config::Gc::Type::NONE, .num_threads = 4}});
+
+  ASSERT_TRUE(storage.CreateIndex(storage.NameToLabel("label")));
+  ASSERT_TRUE(storage.CreateIndex(storage.NameToEdgeType("type")));
+
+  const uint64_t kNumVertices = 20000;
+  {
+    auto acc = storage.Access();
+    std::optional<storage::VertexAccessor> prev;
+    for (uint64_t i = 0; i < kNumVertices; ++i) {
+      auto vertex = acc.CreateVertex();
+      ASSERT_TRUE(*vertex.AddLabel(acc.NameToLabel("label")));
+      if (prev) {
+        ASSERT_TRUE(acc.CreateEdge(&*prev, &vertex, acc.NameToEdgeType("type")).HasValue());
+      }
+      prev = vertex;
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    // Delete every other vertex (with its edges) in one transaction.
+    auto acc = storage.Access();
+    uint64_t i = 0;
+    for (auto vertex : acc.Vertices(storage::View::OLD)) {
+      if (i++ % 2 == 0) {
+        ASSERT_TRUE(acc.DetachDeleteVertex(&vertex).HasValue());
+      }
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    // Remove the label from every other remaining vertex in many small
+    // transactions.
+    auto acc = storage.Access();
+    std::vector<storage::Gid> gids;
+    for (auto vertex : acc.Vertices(storage::View::OLD)) {
+      gids.push_back(vertex.Gid());
+    }
+    for (uint64_t i = 0; i < gids.size(); i += 2) {
+      auto acc_update = storage.Access();
+      auto vertex = acc_update.FindVertex(gids[i], storage::View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_TRUE(*vertex->RemoveLabel(acc_update.NameToLabel("label")));
+      ASSERT_FALSE(acc_update.Commit().HasError());
+    }
+  }
+
+  storage.FreeMemory();
+
+  auto info = storage.GetInfo();
+  EXPECT_EQ(info.vertex_count, kNumVertices / 2);
+  EXPECT_EQ(info.edge_count, 0);
+  EXPECT_GT(info.gc_runs, 0);
+
+  auto acc = storage.Access();
+  uint64_t count = 0;
+  for (auto vertex : acc.Vertices(acc.NameToLabel("label"), storage::View::OLD)) {
+    ASSERT_TRUE(*vertex.HasLabel(acc.NameToLabel("label"), storage::View::OLD));
+    ++count;
+  }
+  EXPECT_EQ(count, kNumVertices / 4);
+  EXPECT_EQ(acc.ApproximateVertexCount(acc.NameToLabel("label")), kNumVertices / 4);
+}
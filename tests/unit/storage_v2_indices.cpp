@@ -1,6 +1,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/storage.hpp"
 #include "storage/v2/temporal.hpp"
@@ -8,6 +11,7 @@
 // NOLINTNEXTLINE(google-build-using-namespace)
 using namespace storage;
 
+using testing::ElementsAre;
 using testing::IsEmpty;
 using testing::UnorderedElementsAre;
 
@@ -590,6 +594,45 @@ TEST_F(IndexTest, LabelPropertyIndexFiltering) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyIndexInternedStrings) {
+  // Equality lookups compare interned strings by their dictionary IDs, so
+  // check them for both interned and inline strings.
+  storage.CreateIndex(label1, prop_val);
+
+  {
+    auto acc = storage.Access();
+    for (int i = 0; i < 6; ++i) {
+      auto vertex = CreateVertex(&acc);
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i % 2 ? "DE" : "HR")));
+    }
+    auto vertex = CreateVertex(&acc);
+    ASSERT_NO_ERROR(vertex.AddLabel(label1));
+    ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue("inline index value")));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  {
+    auto acc = storage.Access();
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue("HR"), View::OLD)),
+                UnorderedElementsAre(0, 2, 4));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue("DE"), View::OLD)),
+                UnorderedElementsAre(1, 3, 5));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue("inline index value"), View::OLD)),
+                UnorderedElementsAre(6));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue("US"), View::OLD)), IsEmpty());
+
+    auto vertex = acc.FindVertex(Gid::FromUint(2), View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_NO_ERROR(vertex->SetProperty(prop_val, PropertyValue("DE")));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue("HR"), View::OLD)),
+                UnorderedElementsAre(0, 2, 4));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue("HR"), View::NEW)), UnorderedElementsAre(0, 4));
+    EXPECT_THAT(GetIds(acc.Vertices(label1, prop_val, PropertyValue("DE"), View::NEW)),
+                UnorderedElementsAre(1, 2, 3, 5));
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_F(IndexTest, LabelPropertyIndexCountEstimate) {
   storage.CreateIndex(label1, prop_val);
@@ -800,3 +843,789 @@ TEST_F(IndexTest, LabelPropertyIndexMixedIteration) {
   // Iteration without any bounds should return all items of the index.
   verify(std::nullopt, std::nullopt, values);
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyCompositeIndexCreateAndDrop) {
+  const std::vector<PropertyId> val_id{prop_val, prop_id};
+  const std::vector<PropertyId> id_val{prop_id, prop_val};
+  EXPECT_EQ(storage.ListAllIndices().label_property_composite.size(), 0);
+  EXPECT_TRUE(storage.CreateIndex(label1, val_id));
+  {
+    auto acc = storage.Access();
+    EXPECT_TRUE(acc.LabelPropertyCompositeIndexExists(label1, val_id));
+    // The order of the properties is a part of the index definition.
+    EXPECT_FALSE(acc.LabelPropertyCompositeIndexExists(label1, id_val));
+    EXPECT_FALSE(acc.LabelPropertyCompositeIndexExists(label2, val_id));
+    EXPECT_FALSE(acc.LabelPropertyIndexExists(label1, prop_val));
+  }
+  EXPECT_FALSE(storage.CreateIndex(label1, val_id));
+  EXPECT_TRUE(storage.CreateIndex(label1, id_val));
+  EXPECT_THAT(storage.ListAllIndices().label_property_composite,
+              UnorderedElementsAre(std::make_pair(label1, val_id), std::make_pair(label1, id_val)));
+
+  EXPECT_TRUE(storage.DropIndex(label1, val_id));
+  EXPECT_FALSE(storage.DropIndex(label1, val_id));
+  {
+    auto acc = storage.Access();
+    EXPECT_FALSE(acc.LabelPropertyCompositeIndexExists(label1, val_id));
+    EXPECT_TRUE(acc.LabelPropertyCompositeIndexExists(label1, id_val));
+  }
+  EXPECT_THAT(storage.ListAllIndices().label_property_composite, UnorderedElementsAre(std::make_pair(label1, id_val)));
+  EXPECT_TRUE(storage.DropIndex(label1, id_val));
+  EXPECT_EQ(storage.ListAllIndices().label_property_composite.size(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyCompositeIndexFiltering) {
+  // We insert vertices with ids 0..19 and values 0 0 0 0 0 1.0 1 1.0 1 1.0 ...
+  // so that the vertices with the same value are ordered by their ids in the
+  // index on (val, id). Integers and doubles are mixed to verify that they are
+  // treated as equal in the prefix.
+  const std::vector<PropertyId> properties{prop_val, prop_id};
+  EXPECT_TRUE(storage.CreateIndex(label1, properties));
+  {
+    auto acc = storage.Access();
+    for (int i = 0; i < 20; ++i) {
+      auto vertex = CreateVertex(&acc);
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, i % 2 ? PropertyValue(i / 5) : PropertyValue(i / 5 * 1.0)));
+    }
+    // Vertices without the label or with none of the properties set aren't
+    // indexed.
+    ASSERT_NO_ERROR(CreateVertex(&acc).SetProperty(prop_val, PropertyValue(1)));
+    ASSERT_NO_ERROR(acc.CreateVertex().AddLabel(label1));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  auto acc = storage.Access();
+  auto lookup = [&](const std::vector<PropertyValue> &prefix,
+                    const std::optional<utils::Bound<PropertyValue>> &lower = std::nullopt,
+                    const std::optional<utils::Bound<PropertyValue>> &upper = std::nullopt) {
+    return GetIds(acc.Vertices(label1, properties, prefix, lower, upper, View::OLD));
+  };
+
+  EXPECT_THAT(lookup({}), ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19));
+  EXPECT_THAT(lookup({PropertyValue(1)}), ElementsAre(5, 6, 7, 8, 9));
+  EXPECT_THAT(lookup({PropertyValue(1.0)}), ElementsAre(5, 6, 7, 8, 9));
+  EXPECT_THAT(lookup({PropertyValue(4)}), IsEmpty());
+  EXPECT_THAT(lookup({PropertyValue(1), PropertyValue(7)}), ElementsAre(7));
+  EXPECT_THAT(lookup({PropertyValue(1), PropertyValue(12)}), IsEmpty());
+
+  // Range on the property that follows the prefix.
+  EXPECT_THAT(lookup({PropertyValue(1)}, utils::MakeBoundInclusive(PropertyValue(6)),
+                     utils::MakeBoundExclusive(PropertyValue(8))),
+              ElementsAre(6, 7));
+  EXPECT_THAT(lookup({PropertyValue(1)}, utils::MakeBoundExclusive(PropertyValue(6))), ElementsAre(7, 8, 9));
+  EXPECT_THAT(lookup({PropertyValue(1)}, std::nullopt, utils::MakeBoundInclusive(PropertyValue(6))),
+              ElementsAre(5, 6));
+  EXPECT_THAT(lookup({PropertyValue(2)}, utils::MakeBoundInclusive(PropertyValue("a"))), IsEmpty());
+
+  // Range on the first property.
+  EXPECT_THAT(lookup({}, utils::MakeBoundExclusive(PropertyValue(1)), utils::MakeBoundInclusive(PropertyValue(2))),
+              ElementsAre(10, 11, 12, 13, 14));
+  EXPECT_THAT(lookup({}, std::nullopt, utils::MakeBoundExclusive(PropertyValue(1))), ElementsAre(0, 1, 2, 3, 4));
+
+  // `Null` never matches a value.
+  EXPECT_THAT(lookup({PropertyValue()}), IsEmpty());
+  EXPECT_THAT(lookup({PropertyValue(), PropertyValue(20)}), IsEmpty());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyCompositeIndexUpdates) {
+  const std::vector<PropertyId> properties{prop_val, prop_id};
+  EXPECT_TRUE(storage.CreateIndex(label1, properties));
+
+  auto acc = storage.Access();
+  for (int i = 0; i < 6; ++i) {
+    auto vertex = CreateVertex(&acc);
+    ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i % 2)));
+    if (i < 4) {
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+    }
+  }
+  acc.AdvanceCommand();
+
+  auto lookup = [&](int64_t val, View view) {
+    return GetIds(acc.Vertices(label1, properties, {PropertyValue(val)}, std::nullopt, std::nullopt, view), view);
+  };
+  EXPECT_THAT(lookup(0, View::OLD), ElementsAre(0, 2));
+  EXPECT_THAT(lookup(1, View::OLD), ElementsAre(1, 3));
+
+  for (auto vertex : acc.Vertices(View::OLD)) {
+    auto id = vertex.GetProperty(prop_id, View::OLD)->ValueInt();
+    switch (id) {
+      case 0:
+        ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(1)));
+        break;
+      case 1:
+        ASSERT_NO_ERROR(vertex.RemoveLabel(label1));
+        break;
+      case 2:
+        ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue()));
+        break;
+      case 4:
+        ASSERT_NO_ERROR(vertex.AddLabel(label1));
+        break;
+      case 5:
+        ASSERT_NO_ERROR(vertex.AddLabel(label2));
+        break;
+      default:
+        break;
+    }
+  }
+
+  EXPECT_THAT(lookup(0, View::OLD), ElementsAre(0, 2));
+  EXPECT_THAT(lookup(1, View::OLD), ElementsAre(1, 3));
+  EXPECT_THAT(lookup(0, View::NEW), ElementsAre(4));
+  EXPECT_THAT(lookup(1, View::NEW), ElementsAre(0, 3));
+
+  {
+    auto other_acc = storage.Access();
+    EXPECT_THAT(GetIds(other_acc.Vertices(label1, properties, {PropertyValue(1)}, std::nullopt, std::nullopt,
+                                          View::NEW),
+                       View::NEW),
+                IsEmpty());
+  }
+  ASSERT_NO_ERROR(acc.Commit());
+  {
+    auto other_acc = storage.Access();
+    EXPECT_THAT(GetIds(other_acc.Vertices(label1, properties, {PropertyValue(1)}, std::nullopt, std::nullopt,
+                                          View::OLD)),
+                ElementsAre(0, 3));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyCompositeIndexCountEstimate) {
+  const std::vector<PropertyId> properties{prop_val, prop_id};
+  EXPECT_TRUE(storage.CreateIndex(label1, properties));
+
+  auto acc = storage.Access();
+  for (int i = 1; i <= 10; ++i) {
+    for (int j = 0; j < i; ++j) {
+      auto vertex = CreateVertex(&acc);
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i)));
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+    }
+  }
+
+  EXPECT_EQ(acc.ApproximateVertexCount(label1, properties), 55);
+  for (int i = 1; i <= 10; ++i) {
+    EXPECT_EQ(acc.ApproximateVertexCount(label1, properties, {PropertyValue(i)}), i);
+  }
+  EXPECT_EQ(acc.ApproximateVertexCount(label1, properties, {PropertyValue(3), PropertyValue(3)}), 1);
+  EXPECT_EQ(acc.ApproximateVertexCount(label1, properties, {}, utils::MakeBoundInclusive(PropertyValue(2)),
+                                       utils::MakeBoundInclusive(PropertyValue(6))),
+            2 + 3 + 4 + 5 + 6);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, LabelPropertyCompositeIndexGarbageCollection) {
+  const std::vector<PropertyId> properties{prop_val, prop_id};
+  EXPECT_TRUE(storage.CreateIndex(label1, properties));
+  {
+    auto acc = storage.Access();
+    for (int i = 0; i < 10; ++i) {
+      auto vertex = CreateVertex(&acc);
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i)));
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  {
+    auto acc = storage.Access();
+    for (auto vertex : acc.Vertices(View::OLD)) {
+      auto id = vertex.GetProperty(prop_id, View::OLD)->ValueInt();
+      if (id % 2 == 0) {
+        ASSERT_NO_ERROR(acc.DeleteVertex(&vertex));
+      } else {
+        ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(id + 100)));
+      }
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  EXPECT_EQ(storage.Access().ApproximateVertexCount(label1, properties), 15);
+  storage.FreeMemory();
+  auto acc = storage.Access();
+  EXPECT_EQ(acc.ApproximateVertexCount(label1, properties), 5);
+  EXPECT_THAT(GetIds(acc.Vertices(label1, properties, {}, utils::MakeBoundInclusive(PropertyValue(105)), std::nullopt,
+                                  View::OLD)),
+              ElementsAre(5, 7, 9));
+}
+
+class EdgeTypeIndexTest : public testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    auto acc = storage.Access();
+    edge_type1 = acc.NameToEdgeType("edge_type1");
+    edge_type2 = acc.NameToEdgeType("edge_type2");
+  }
+
+  Storage storage{Config{.gc = {.type = Config::Gc::Type::NONE}, .items = {.properties_on_edges = GetParam()}}};
+  EdgeTypeId edge_type1;
+  EdgeTypeId edge_type2;
+
+  template <class TIterable>
+  std::vector<Gid> GetGids(TIterable iterable) {
+    std::vector<Gid> ret;
+    for (auto edge : iterable) {
+      ret.push_back(edge.Gid());
+    }
+    return ret;
+  }
+};
+
+INSTANTIATE_TEST_CASE_P(EdgesWithProperties, EdgeTypeIndexTest, ::testing::Values(true));
+INSTANTIATE_TEST_CASE_P(EdgesWithoutProperties, EdgeTypeIndexTest, ::testing::Values(false));
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(EdgeTypeIndexTest, CreateAndDrop) {
+  EXPECT_EQ(storage.ListAllIndices().edge_type.size(), 0);
+
+  std::vector<Gid> type1_gids;
+  {
+    auto acc = storage.Access();
+    auto from = acc.CreateVertex();
+    auto to = acc.CreateVertex();
+    for (int i = 0; i < 10; ++i) {
+      auto edge = acc.CreateEdge(&from, &to, i % 2 ? edge_type1 : edge_type2);
+      ASSERT_NO_ERROR(edge);
+      if (i % 2) type1_gids.push_back(edge->Gid());
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  EXPECT_TRUE(storage.CreateIndex(edge_type1));
+  EXPECT_FALSE(storage.CreateIndex(edge_type1));
+  EXPECT_THAT(storage.ListAllIndices().edge_type, UnorderedElementsAre(edge_type1));
+
+  {
+    auto acc = storage.Access();
+    EXPECT_TRUE(acc.EdgeTypeIndexExists(edge_type1));
+    EXPECT_FALSE(acc.EdgeTypeIndexExists(edge_type2));
+    EXPECT_EQ(acc.ApproximateEdgeCount(edge_type1), 5);
+    EXPECT_EQ(GetGids(acc.Edges(edge_type1, View::OLD)), type1_gids);
+    EXPECT_EQ(GetGids(acc.Edges(edge_type1, View::NEW)), type1_gids);
+  }
+
+  {
+    // Edges created after the index creation are added to the index.
+    auto acc = storage.Access();
+    auto from = acc.CreateVertex();
+    auto to = acc.CreateVertex();
+    auto edge = acc.CreateEdge(&from, &to, edge_type1);
+    ASSERT_NO_ERROR(edge);
+    type1_gids.push_back(edge->Gid());
+    ASSERT_NO_ERROR(acc.CreateEdge(&from, &to, edge_type2));
+    EXPECT_EQ(GetGids(acc.Edges(edge_type1, View::NEW)), type1_gids);
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  {
+    auto acc = storage.Access();
+    EXPECT_EQ(GetGids(acc.Edges(edge_type1, View::OLD)), type1_gids);
+  }
+
+  EXPECT_TRUE(storage.DropIndex(edge_type1));
+  EXPECT_FALSE(storage.DropIndex(edge_type1));
+  EXPECT_EQ(storage.ListAllIndices().edge_type.size(), 0);
+  {
+    auto acc = storage.Access();
+    EXPECT_FALSE(acc.EdgeTypeIndexExists(edge_type1));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(EdgeTypeIndexTest, Endpoints) {
+  EXPECT_TRUE(storage.CreateIndex(edge_type1));
+  Gid from_gid;
+  Gid to_gid;
+  {
+    auto acc = storage.Access();
+    auto from = acc.CreateVertex();
+    auto to = acc.CreateVertex();
+    from_gid = from.Gid();
+    to_gid = to.Gid();
+    ASSERT_NO_ERROR(acc.CreateEdge(&from, &to, edge_type1));
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  {
+    auto acc = storage.Access();
+    uint64_t count = 0;
+    for (auto edge : acc.Edges(edge_type1, View::OLD)) {
+      EXPECT_EQ(edge.EdgeType(), edge_type1);
+      EXPECT_EQ(edge.FromVertex().Gid(), from_gid);
+      EXPECT_EQ(edge.ToVertex().Gid(), to_gid);
+      ++count;
+    }
+    EXPECT_EQ(count, 1);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(EdgeTypeIndexTest, TransactionalIsolation) {
+  EXPECT_TRUE(storage.CreateIndex(edge_type1));
+
+  auto acc_before = storage.Access();
+  auto acc = storage.Access();
+  auto from = acc.CreateVertex();
+  auto to = acc.CreateVertex();
+  std::vector<Gid> gids;
+  for (int i = 0; i < 5; ++i) {
+    auto edge = acc.CreateEdge(&from, &to, edge_type1);
+    ASSERT_NO_ERROR(edge);
+    gids.push_back(edge->Gid());
+  }
+  EXPECT_THAT(GetGids(acc.Edges(edge_type1, View::OLD)), IsEmpty());
+  EXPECT_EQ(GetGids(acc.Edges(edge_type1, View::NEW)), gids);
+  EXPECT_THAT(GetGids(acc_before.Edges(edge_type1, View::NEW)), IsEmpty());
+
+  auto acc_concurrent = storage.Access();
+  ASSERT_NO_ERROR(acc.Commit());
+
+  auto acc_after = storage.Access();
+  EXPECT_THAT(GetGids(acc_before.Edges(edge_type1, View::NEW)), IsEmpty());
+  EXPECT_THAT(GetGids(acc_concurrent.Edges(edge_type1, View::NEW)), IsEmpty());
+  EXPECT_EQ(GetGids(acc_after.Edges(edge_type1, View::NEW)), gids);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(EdgeTypeIndexTest, DeleteAndAbort) {
+  EXPECT_TRUE(storage.CreateIndex(edge_type1));
+  std::vector<Gid> gids;
+  {
+    auto acc = storage.Access();
+    auto from = acc.CreateVertex();
+    auto to = acc.CreateVertex();
+    for (int i = 0; i < 4; ++i) {
+      auto edge = acc.CreateEdge(&from, &to, edge_type1);
+      ASSERT_NO_ERROR(edge);
+      gids.push_back(edge->Gid());
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  {
+    // Deleted edges are visible only in the old view of the deleting
+    // transaction.
+    auto acc = storage.Access();
+    auto edges = acc.Edges(edge_type1, View::OLD);
+    auto edge = *edges.begin();
+    ASSERT_NO_ERROR(acc.DeleteEdge(&edge));
+    EXPECT_EQ(GetGids(acc.Edges(edge_type1, View::OLD)), gids);
+    EXPECT_EQ(GetGids(acc.Edges(edge_type1, View::NEW)), std::vector<Gid>(gids.begin() + 1, gids.end()));
+    acc.Abort();
+  }
+
+  {
+    auto acc = storage.Access();
+    EXPECT_EQ(GetGids(acc.Edges(edge_type1, View::OLD)), gids);
+  }
+
+  {
+    // Deleting a vertex with its edges removes them from the index as well.
+    auto acc = storage.Access();
+    auto edges = acc.Edges(edge_type1, View::OLD);
+    auto from = (*edges.begin()).FromVertex();
+    ASSERT_NO_ERROR(acc.DetachDeleteVertex(&from));
+    EXPECT_THAT(GetGids(acc.Edges(edge_type1, View::NEW)), IsEmpty());
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  {
+    auto acc = storage.Access();
+    EXPECT_THAT(GetGids(acc.Edges(edge_type1, View::OLD)), IsEmpty());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(EdgeTypeIndexTest, GarbageCollection) {
+  EXPECT_TRUE(storage.CreateIndex(edge_type1));
+  std::vector<Gid> gids;
+  {
+    auto acc = storage.Access();
+    auto from = acc.CreateVertex();
+    auto to = acc.CreateVertex();
+    for (int i = 0; i < 10; ++i) {
+      auto edge = acc.CreateEdge(&from, &to, edge_type1);
+      ASSERT_NO_ERROR(edge);
+      gids.push_back(edge->Gid());
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  {
+    auto acc = storage.Access();
+    uint64_t i = 0;
+    for (auto edge : acc.Edges(edge_type1, View::OLD)) {
+      if (i++ % 2 == 0) ASSERT_NO_ERROR(acc.DeleteEdge(&edge));
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  {
+    // A transaction that started before the garbage collection must still
+    // see the remaining edges.
+    auto acc = storage.Access();
+    storage.FreeMemory();
+    EXPECT_EQ(acc.ApproximateEdgeCount(edge_type1), 5);
+    EXPECT_EQ(GetGids(acc.Edges(edge_type1, View::OLD)),
+              std::vector<Gid>({gids[1], gids[3], gids[5], gids[7], gids[9]}));
+  }
+}
+
+class EdgeTypePropertyIndexTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    auto acc = storage.Access();
+    edge_type1 = acc.NameToEdgeType("edge_type1");
+    edge_type2 = acc.NameToEdgeType("edge_type2");
+    prop_val = acc.NameToProperty("val");
+    prop_id = acc.NameToProperty("id");
+  }
+
+  Storage storage{Config{.gc = {.type = Config::Gc::Type::NONE}, .items = {.properties_on_edges = true}}};
+  EdgeTypeId edge_type1;
+  EdgeTypeId edge_type2;
+  PropertyId prop_val;
+  PropertyId prop_id;
+
+  // Creates edges between two new vertices with the `id` property set to
+  // 0, 1, ... `count` - 1, and the `val` property set by the `value` function.
+  template <class TValueFun>
+  void CreateEdges(EdgeTypeId edge_type, int count, TValueFun value) {
+    auto acc = storage.Access();
+    auto from = acc.CreateVertex();
+    auto to = acc.CreateVertex();
+    for (int i = 0; i < count; ++i) {
+      auto edge = acc.CreateEdge(&from, &to, edge_type);
+      ASSERT_NO_ERROR(edge);
+      ASSERT_NO_ERROR(edge->SetProperty(prop_id, PropertyValue(i)));
+      ASSERT_NO_ERROR(edge->SetProperty(prop_val, value(i)));
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  template <class TIterable>
+  std::vector<int64_t> GetIds(TIterable iterable, View view = View::OLD) {
+    std::vector<int64_t> ret;
+    for (auto edge : iterable) {
+      ret.push_back(edge.GetProperty(prop_id, view)->ValueInt());
+    }
+    return ret;
+  }
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeTypePropertyIndexTest, CreateAndDrop) {
+  EXPECT_EQ(storage.ListAllIndices().edge_type_property.size(), 0);
+  CreateEdges(edge_type1, 4, [](int i) { return PropertyValue(i); });
+  CreateEdges(edge_type2, 4, [](int i) { return PropertyValue(i); });
+
+  {
+    auto ret = storage.CreateIndex(edge_type1, prop_val);
+    ASSERT_TRUE(ret.HasValue());
+    EXPECT_TRUE(ret.GetValue());
+  }
+  {
+    auto ret = storage.CreateIndex(edge_type1, prop_val);
+    ASSERT_TRUE(ret.HasValue());
+    EXPECT_FALSE(ret.GetValue());
+  }
+  EXPECT_THAT(storage.ListAllIndices().edge_type_property, UnorderedElementsAre(std::make_pair(edge_type1, prop_val)));
+
+  {
+    auto acc = storage.Access();
+    EXPECT_TRUE(acc.EdgeTypePropertyIndexExists(edge_type1, prop_val));
+    EXPECT_FALSE(acc.EdgeTypePropertyIndexExists(edge_type1, prop_id));
+    EXPECT_FALSE(acc.EdgeTypePropertyIndexExists(edge_type2, prop_val));
+    EXPECT_EQ(acc.ApproximateEdgeCount(edge_type1, prop_val), 4);
+    EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, View::OLD)), ElementsAre(0, 1, 2, 3));
+  }
+
+  // Edges created after the index creation are added to the index.
+  CreateEdges(edge_type1, 2, [](int i) { return PropertyValue(10 + i); });
+  {
+    auto acc = storage.Access();
+    EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, View::OLD)), ElementsAre(0, 1, 2, 3, 0, 1));
+  }
+
+  EXPECT_TRUE(storage.DropIndex(edge_type1, prop_val));
+  EXPECT_FALSE(storage.DropIndex(edge_type1, prop_val));
+  EXPECT_EQ(storage.ListAllIndices().edge_type_property.size(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeTypePropertyIndexTest, PropertiesOnEdgesDisabled) {
+  Storage storage_without_properties{Config{.items = {.properties_on_edges = false}}};
+  auto ret = storage_without_properties.CreateIndex(edge_type1, prop_val);
+  ASSERT_TRUE(ret.HasError());
+  EXPECT_EQ(ret.GetError(), Error::PROPERTIES_DISABLED);
+  EXPECT_EQ(storage_without_properties.ListAllIndices().edge_type_property.size(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeTypePropertyIndexTest, Filtering) {
+  // The edges have values 0 0.0 1 1.0 2 2.0 3 3.0 4 4.0, the same as in the
+  // label+property index filtering test.
+  ASSERT_FALSE(storage.CreateIndex(edge_type1, prop_val).HasError());
+  CreateEdges(edge_type1, 10, [](int i) { return i % 2 ? PropertyValue(i / 2) : PropertyValue(i / 2.0); });
+  CreateEdges(edge_type2, 10, [](int i) { return PropertyValue(i); });
+
+  auto acc = storage.Access();
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, PropertyValue(i), View::OLD)),
+                UnorderedElementsAre(2 * i, 2 * i + 1));
+  }
+
+  // [1, +inf>
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, utils::MakeBoundInclusive(PropertyValue(1)), std::nullopt,
+                               View::OLD)),
+              UnorderedElementsAre(2, 3, 4, 5, 6, 7, 8, 9));
+  // <-inf, 3>
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, std::nullopt, utils::MakeBoundExclusive(PropertyValue(3)),
+                               View::OLD)),
+              UnorderedElementsAre(0, 1, 2, 3, 4, 5));
+  // <1, 3]
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, utils::MakeBoundExclusive(PropertyValue(1)),
+                               utils::MakeBoundInclusive(PropertyValue(3)), View::OLD)),
+              UnorderedElementsAre(4, 5, 6, 7));
+  // Bounds of incomparable types don't return any edges.
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, utils::MakeBoundInclusive(PropertyValue(1)),
+                               utils::MakeBoundInclusive(PropertyValue("3")), View::OLD)),
+              IsEmpty());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeTypePropertyIndexTest, TransactionalIsolation) {
+  ASSERT_FALSE(storage.CreateIndex(edge_type1, prop_val).HasError());
+  CreateEdges(edge_type1, 3, [](int i) { return PropertyValue(i); });
+
+  auto acc_before = storage.Access();
+  auto acc = storage.Access();
+  for (auto edge : acc.Edges(edge_type1, prop_val, PropertyValue(1), View::OLD)) {
+    ASSERT_NO_ERROR(edge.SetProperty(prop_val, PropertyValue(5)));
+  }
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, PropertyValue(1), View::OLD)), ElementsAre(1));
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, PropertyValue(1), View::NEW)), IsEmpty());
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, PropertyValue(5), View::NEW), View::NEW), ElementsAre(1));
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, PropertyValue(5), View::OLD)), IsEmpty());
+
+  // Setting the property to the old value doesn't return the edge twice.
+  for (auto edge : acc.Edges(edge_type1, prop_val, PropertyValue(5), View::NEW)) {
+    ASSERT_NO_ERROR(edge.SetProperty(prop_val, PropertyValue(1)));
+  }
+  for (auto edge : acc.Edges(edge_type1, prop_val, PropertyValue(1), View::NEW)) {
+    ASSERT_NO_ERROR(edge.SetProperty(prop_val, PropertyValue(7)));
+  }
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, View::NEW), View::NEW), ElementsAre(0, 2, 1));
+  ASSERT_NO_ERROR(acc.Commit());
+
+  EXPECT_THAT(GetIds(acc_before.Edges(edge_type1, prop_val, View::NEW)), ElementsAre(0, 1, 2));
+  auto acc_after = storage.Access();
+  EXPECT_THAT(GetIds(acc_after.Edges(edge_type1, prop_val, View::NEW)), ElementsAre(0, 2, 1));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeTypePropertyIndexTest, DeleteAndRemoveProperty) {
+  ASSERT_FALSE(storage.CreateIndex(edge_type1, prop_val).HasError());
+  CreateEdges(edge_type1, 4, [](int i) { return PropertyValue(i); });
+
+  auto acc = storage.Access();
+  for (auto edge : acc.Edges(edge_type1, prop_val, View::OLD)) {
+    auto id = edge.GetProperty(prop_id, View::OLD)->ValueInt();
+    if (id == 1) ASSERT_NO_ERROR(acc.DeleteEdge(&edge));
+    if (id == 2) ASSERT_NO_ERROR(edge.SetProperty(prop_val, PropertyValue()));
+  }
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, View::OLD)), ElementsAre(0, 1, 2, 3));
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, View::NEW), View::NEW), ElementsAre(0, 3));
+  acc.Abort();
+
+  auto acc_after = storage.Access();
+  EXPECT_THAT(GetIds(acc_after.Edges(edge_type1, prop_val, View::NEW)), ElementsAre(0, 1, 2, 3));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeTypePropertyIndexTest, CountEstimate) {
+  ASSERT_FALSE(storage.CreateIndex(edge_type1, prop_val).HasError());
+  for (int i = 1; i <= 10; ++i) {
+    CreateEdges(edge_type1, i, [i](int) { return PropertyValue(i); });
+  }
+
+  auto acc = storage.Access();
+  EXPECT_EQ(acc.ApproximateEdgeCount(edge_type1, prop_val), 55);
+  for (int i = 1; i <= 10; ++i) {
+    EXPECT_EQ(acc.ApproximateEdgeCount(edge_type1, prop_val, PropertyValue(i)), i);
+  }
+  EXPECT_EQ(acc.ApproximateEdgeCount(edge_type1, prop_val, utils::MakeBoundInclusive(PropertyValue(2)),
+                                     utils::MakeBoundInclusive(PropertyValue(6))),
+            2 + 3 + 4 + 5 + 6);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeTypePropertyIndexTest, GarbageCollection) {
+  ASSERT_FALSE(storage.CreateIndex(edge_type1, prop_val).HasError());
+  CreateEdges(edge_type1, 10, [](int i) { return PropertyValue(i); });
+
+  {
+    auto acc = storage.Access();
+    for (auto edge : acc.Edges(edge_type1, prop_val, View::OLD)) {
+      auto id = edge.GetProperty(prop_id, View::OLD)->ValueInt();
+      if (id % 2 == 0) {
+        ASSERT_NO_ERROR(acc.DeleteEdge(&edge));
+      } else {
+        ASSERT_NO_ERROR(edge.SetProperty(prop_val, PropertyValue(id + 100)));
+      }
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  // Both the entries of the deleted edges and the entries with the old
+  // property values are removed from the index.
+  EXPECT_EQ(storage.Access().ApproximateEdgeCount(edge_type1, prop_val), 15);
+  storage.FreeMemory();
+  auto acc = storage.Access();
+  EXPECT_EQ(acc.ApproximateEdgeCount(edge_type1, prop_val), 5);
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, View::OLD)), ElementsAre(1, 3, 5, 7, 9));
+  EXPECT_THAT(GetIds(acc.Edges(edge_type1, prop_val, utils::MakeBoundInclusive(PropertyValue(105)), std::nullopt,
+                               View::OLD)),
+              ElementsAre(5, 7, 9));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(IndexParallelCreationTest, MatchesSequentialCreation) {
+  const int64_t kNumVertices = 50000;
+  std::vector<std::vector<int64_t>> results;
+  for (uint64_t num_threads : {1, 4}) {
+    Storage storage(Config{.schema_creation = {.num_threads = num_threads}});
+    auto label = storage.NameToLabel("label");
+    auto id = storage.NameToProperty("id");
+    auto val = storage.NameToProperty("val");
+    {
+      auto acc = storage.Access();
+      for (int64_t i = 0; i < kNumVertices; ++i) {
+        auto vertex = acc.CreateVertex();
+        ASSERT_NO_ERROR(vertex.SetProperty(id, PropertyValue(i)));
+        if (i % 3 == 0) ASSERT_NO_ERROR(vertex.AddLabel(label));
+        if (i % 5 == 0) ASSERT_NO_ERROR(vertex.SetProperty(val, PropertyValue(i % 7)));
+      }
+      ASSERT_NO_ERROR(acc.Commit());
+    }
+    ASSERT_TRUE(storage.CreateIndex(label));
+    ASSERT_TRUE(storage.CreateIndex(label, val));
+    ASSERT_TRUE(storage.CreateIndex(label, std::vector<PropertyId>{val, id}));
+
+    auto acc = storage.Access();
+    auto get_ids = [&](auto iterable) {
+      std::vector<int64_t> ids;
+      for (auto vertex : iterable) {
+        ids.push_back(vertex.GetProperty(id, View::OLD)->ValueInt());
+      }
+      std::sort(ids.begin(), ids.end());
+      return ids;
+    };
+    results.push_back(get_ids(acc.Vertices(label, View::OLD)));
+    results.push_back(get_ids(acc.Vertices(label, val, View::OLD)));
+    results.push_back(get_ids(acc.Vertices(label, val, PropertyValue(3), View::OLD)));
+    EXPECT_EQ(results[results.size() - 3].size(), (kNumVertices + 2) / 3);
+    EXPECT_EQ(acc.ApproximateVertexCount(label, std::vector<PropertyId>{val, id}), (kNumVertices + 2) / 3);
+  }
+  ASSERT_EQ(results.size(), 6);
+  for (uint64_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(results[i], results[i + 3]);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(IndexOnlineCreationTest, ConcurrentWrites) {
+  const int64_t kNumVertices = 50000;
+  const int64_t kMinWriterTransactions = 1000;
+  Storage storage(Config{.schema_creation = {.num_threads = 2, .online_index_build = true}});
+  auto label = storage.NameToLabel("label");
+  auto id = storage.NameToProperty("id");
+  auto val = storage.NameToProperty("val");
+  {
+    auto acc = storage.Access();
+    for (int64_t i = 0; i < kNumVertices; ++i) {
+      auto vertex = acc.CreateVertex();
+      ASSERT_NO_ERROR(vertex.SetProperty(id, PropertyValue(i)));
+      if (i % 3 == 0) ASSERT_NO_ERROR(vertex.AddLabel(label));
+      if (i % 5 == 0) ASSERT_NO_ERROR(vertex.SetProperty(val, PropertyValue(i % 7)));
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  // The writer changes the labels and the properties of the vertices, creates
+  // new vertices and deletes old ones while the indices are being built.
+  std::atomic<bool> indices_created{false};
+  std::thread writer([&] {
+    int64_t next_id = kNumVertices;
+    for (int64_t i = 0; !indices_created.load() || i < kMinWriterTransactions; ++i) {
+      auto acc = storage.Access();
+      auto vertex = acc.FindVertex(Gid::FromUint((i * 7919) % kNumVertices), View::OLD);
+      if (vertex) {
+        if (i % 11 == 0) {
+          EXPECT_FALSE(acc.DeleteVertex(&*vertex).HasError());
+        } else if (i % 2 == 0) {
+          EXPECT_FALSE(vertex->AddLabel(label).HasError());
+          EXPECT_FALSE(vertex->SetProperty(val, PropertyValue(i % 13)).HasError());
+        } else {
+          EXPECT_FALSE(vertex->RemoveLabel(label).HasError());
+        }
+      }
+      auto new_vertex = acc.CreateVertex();
+      EXPECT_FALSE(new_vertex.SetProperty(id, PropertyValue(next_id++)).HasError());
+      EXPECT_FALSE(new_vertex.AddLabel(label).HasError());
+      EXPECT_FALSE(new_vertex.SetProperty(val, PropertyValue(i % 7)).HasError());
+      // Aborted transactions leave entries in the indices that must be skipped.
+      if (i % 17 == 0) {
+        acc.Abort();
+      } else {
+        EXPECT_FALSE(acc.Commit().HasError());
+      }
+    }
+  });
+  EXPECT_TRUE(storage.CreateIndex(label));
+  EXPECT_TRUE(storage.CreateIndex(label, val));
+  EXPECT_FALSE(storage.CreateIndex(label));
+  indices_created.store(true);
+  writer.join();
+
+  auto info = storage.ListAllIndices();
+  EXPECT_THAT(info.label, UnorderedElementsAre(label));
+  EXPECT_THAT(info.label_property, UnorderedElementsAre(std::make_pair(label, val)));
+  EXPECT_THAT(info.label_building, IsEmpty());
+  EXPECT_THAT(info.label_property_building, IsEmpty());
+
+  auto check = [&] {
+    auto acc = storage.Access();
+    ASSERT_TRUE(acc.LabelIndexExists(label));
+    ASSERT_TRUE(acc.LabelPropertyIndexExists(label, val));
+    std::vector<int64_t> expected_label;
+    std::vector<int64_t> expected_label_val;
+    for (auto vertex : acc.Vertices(View::OLD)) {
+      if (!*vertex.HasLabel(label, View::OLD)) continue;
+      expected_label.push_back(vertex.GetProperty(id, View::OLD)->ValueInt());
+      if (*vertex.GetProperty(val, View::OLD) == PropertyValue(3)) {
+        expected_label_val.push_back(vertex.GetProperty(id, View::OLD)->ValueInt());
+      }
+    }
+    auto get_ids = [&](auto iterable) {
+      std::vector<int64_t> ids;
+      for (auto vertex : iterable) {
+        ids.push_back(vertex.GetProperty(id, View::OLD)->ValueInt());
+      }
+      std::sort(ids.begin(), ids.end());
+      return ids;
+    };
+    std::sort(expected_label.begin(), expected_label.end());
+    std::sort(expected_label_val.begin(), expected_label_val.end());
+    EXPECT_EQ(get_ids(acc.Vertices(label, View::OLD)), expected_label);
+    EXPECT_EQ(get_ids(acc.Vertices(label, val, PropertyValue(3), View::OLD)), expected_label_val);
+  };
+  check();
+  // The GC removes the unneeded entries that were added by the build.
+  storage.FreeMemory();
+  check();
+}
@@ -0,0 +1,113 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "storage/v2/label_set.hpp"
+
+using testing::ElementsAre;
+using testing::UnorderedElementsAreArray;
+
+namespace {
+std::vector<storage::LabelId> ToVector(const storage::LabelSet &labels) {
+  return std::vector<storage::LabelId>(labels.begin(), labels.end());
+}
+}  // namespace
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(LabelSet, Inline) {
+  auto l1 = storage::LabelId::FromUint(1);
+  auto l2 = storage::LabelId::FromUint(2);
+  auto l3 = storage::LabelId::FromUint(3);
+
+  storage::LabelSet labels;
+  ASSERT_TRUE(labels.empty());
+  ASSERT_FALSE(labels.Contains(l1));
+  ASSERT_FALSE(labels.Erase(l1));
+
+  ASSERT_TRUE(labels.Insert(l1));
+  ASSERT_FALSE(labels.Insert(l1));
+  ASSERT_TRUE(labels.Insert(l2));
+  ASSERT_EQ(labels.size(), 2);
+  ASSERT_TRUE(labels.Contains(l1));
+  ASSERT_TRUE(labels.Contains(l2));
+  ASSERT_FALSE(labels.Contains(l3));
+  ASSERT_THAT(ToVector(labels), ElementsAre(l1, l2));
+
+  ASSERT_TRUE(labels.Erase(l1));
+  ASSERT_FALSE(labels.Contains(l1));
+  ASSERT_TRUE(labels.Contains(l2));
+  ASSERT_THAT(ToVector(labels), ElementsAre(l2));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(LabelSet, External) {
+  std::vector<storage::LabelId> expected;
+  storage::LabelSet labels;
+  for (uint64_t i = 0; i < 100; ++i) {
+    auto label = storage::LabelId::FromUint(i * 3);
+    ASSERT_TRUE(labels.Insert(label));
+    expected.push_back(label);
+    ASSERT_EQ(labels.size(), expected.size());
+    ASSERT_THAT(ToVector(labels), UnorderedElementsAreArray(expected));
+  }
+  for (uint64_t i = 0; i < 300; ++i) {
+    ASSERT_EQ(labels.Contains(storage::LabelId::FromUint(i)), i % 3 == 0);
+  }
+
+  // Removing the labels moves the remaining labels back inline.
+  while (!expected.empty()) {
+    auto label = expected[expected.size() / 2];
+    expected.erase(expected.begin() + expected.size() / 2);
+    ASSERT_TRUE(labels.Erase(label));
+    ASSERT_FALSE(labels.Erase(label));
+    ASSERT_FALSE(labels.Contains(label));
+    ASSERT_EQ(labels.size(), expected.size());
+    ASSERT_THAT(ToVector(labels), UnorderedElementsAreArray(expected));
+  }
+  ASSERT_TRUE(labels.empty());
+  ASSERT_TRUE(labels.Insert(storage::LabelId::FromUint(42)));
+  ASSERT_THAT(ToVector(labels), ElementsAre(storage::LabelId::FromUint(42)));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(LabelSet, Move) {
+  for (uint64_t count : {1, 2, 10}) {
+    storage::LabelSet labels;
+    for (uint64_t i = 0; i < count; ++i) {
+      ASSERT_TRUE(labels.Insert(storage::LabelId::FromUint(i)));
+    }
+    storage::LabelSet moved(std::move(labels));
+    ASSERT_EQ(moved.size(), count);
+    ASSERT_TRUE(moved.Contains(storage::LabelId::FromUint(count - 1)));
+
+    storage::LabelSet assigned;
+    ASSERT_TRUE(assigned.Insert(storage::LabelId::FromUint(1000)));
+    assigned = std::move(moved);
+    ASSERT_EQ(assigned.size(), count);
+    ASSERT_FALSE(assigned.Contains(storage::LabelId::FromUint(1000)));
+    ASSERT_TRUE(assigned.Contains(storage::LabelId::FromUint(0)));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(LabelSet, RawCopy) {
+  storage::LabelSet labels;
+  ASSERT_TRUE(storage::LabelSet::RawCopy(labels).IsInline());
+  ASSERT_TRUE(labels.Insert(storage::LabelId::FromUint(1)));
+  ASSERT_TRUE(labels.Insert(storage::LabelId::FromUint(2)));
+  {
+    storage::LabelSet::RawCopy copy(labels);
+    ASSERT_TRUE(copy.IsInline());
+    ASSERT_TRUE(copy.Contains(storage::LabelId::FromUint(2)));
+    ASSERT_FALSE(copy.Contains(storage::LabelId::FromUint(3)));
+    ASSERT_THAT(std::vector<storage::LabelId>(copy.begin(), copy.end()),
+                ElementsAre(storage::LabelId::FromUint(1), storage::LabelId::FromUint(2)));
+  }
+
+  // Labels stored in the external buffer can't be read from the copy.
+  ASSERT_TRUE(labels.Insert(storage::LabelId::FromUint(3)));
+  ASSERT_FALSE(storage::LabelSet::RawCopy(labels).IsInline());
+  ASSERT_TRUE(labels.Erase(storage::LabelId::FromUint(1)));
+  ASSERT_TRUE(storage::LabelSet::RawCopy(labels).IsInline());
+}
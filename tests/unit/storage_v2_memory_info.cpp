@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include "storage/v2/storage.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace storage;
+
+class StorageV2MemoryInfo : public ::testing::Test {
+ protected:
+  Storage storage{Config{.gc = {.type = Config::Gc::Type::NONE}}};
+  LabelId label{storage.NameToLabel("label")};
+  LabelId other_label{storage.NameToLabel("other_label")};
+  PropertyId property{storage.NameToProperty("property")};
+  EdgeTypeId edge_type{storage.NameToEdgeType("edge_type")};
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2MemoryInfo, EmptyStorage) {
+  auto info = storage.GetMemoryInfo();
+  EXPECT_EQ(info.vertices, 0);
+  EXPECT_EQ(info.edges, 0);
+  EXPECT_EQ(info.labels, 0);
+  EXPECT_EQ(info.properties, 0);
+  EXPECT_EQ(info.adjacency_lists, 0);
+  EXPECT_EQ(info.indices, 0);
+  EXPECT_GT(info.name_id_mapper, 0);
+  EXPECT_TRUE(info.per_label.empty());
+  EXPECT_TRUE(info.per_edge_type.empty());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2MemoryInfo, Categories) {
+  {
+    auto acc = storage.Access();
+    for (int i = 0; i < 10; ++i) {
+      auto from = acc.CreateVertex();
+      auto to = acc.CreateVertex();
+      ASSERT_FALSE(from.AddLabel(label).HasError());
+      ASSERT_FALSE(to.AddLabel(other_label).HasError());
+      // A long string doesn't fit into the inline buffer of the property store.
+      ASSERT_FALSE(from.SetProperty(property, PropertyValue(std::string(100, 'a'))).HasError());
+      ASSERT_FALSE(acc.CreateEdge(&from, &to, edge_type).HasError());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  ASSERT_TRUE(storage.CreateIndex(label));
+
+  auto info = storage.GetMemoryInfo();
+  EXPECT_GE(info.vertices, 20 * sizeof(Vertex));
+  EXPECT_GE(info.edges, 10 * sizeof(Edge));
+  EXPECT_GE(info.properties, 10 * 100);
+  EXPECT_GE(info.adjacency_lists, 20 * sizeof(AdjacencyList::value_type));
+  EXPECT_GT(info.indices, 0);
+
+  ASSERT_EQ(info.per_label.size(), 2);
+  // The vertices with `label` hold the long strings.
+  EXPECT_GT(info.per_label[label], info.per_label[other_label]);
+  EXPECT_GE(info.per_label[other_label], 10 * sizeof(Vertex));
+  ASSERT_EQ(info.per_edge_type.size(), 1);
+  EXPECT_GE(info.per_edge_type[edge_type], 10 * sizeof(Edge));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2MemoryInfo, LargeGraphIsSampled) {
+  const uint64_t kNumVertices = 100000;
+  {
+    auto acc = storage.Access();
+    for (uint64_t i = 0; i < kNumVertices; ++i) {
+      auto vertex = acc.CreateVertex();
+      ASSERT_FALSE(vertex.AddLabel(label).HasError());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  // All of the vertices have the same size so the extrapolated estimate
+  // matches the exact one.
+  auto info = storage.GetMemoryInfo();
+  EXPECT_EQ(info.vertices, kNumVertices * utils::AverageSkipListNodeSize<Vertex>());
+  EXPECT_NEAR(info.per_label[label], info.vertices, info.vertices / 1000);
+}
@@ -1,10 +1,13 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <limits>
+#include <random>
 
 #include "storage/v2/property_store.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/temporal.hpp"
 
 using testing::UnorderedElementsAre;
@@ -372,6 +375,79 @@ TEST(PropertyStore, FullSet) {
   }
 }
 
+void TestPropertiesEqual(const storage::PropertyStore &store,
+                         const std::map<storage::PropertyId, storage::PropertyValue> &expected,
+                         uint64_t max_property_id) {
+  ASSERT_EQ(store.Properties(), expected);
+  for (uint64_t i = 0; i <= max_property_id + 1; ++i) {
+    auto prop = storage::PropertyId::FromUint(i);
+    auto it = expected.find(prop);
+    if (it == expected.end()) {
+      ASSERT_TRUE(store.GetProperty(prop).IsNull());
+      ASSERT_FALSE(store.HasProperty(prop));
+      ASSERT_TRUE(store.IsPropertyEqual(prop, storage::PropertyValue()));
+    } else {
+      ASSERT_EQ(store.GetProperty(prop), it->second);
+      ASSERT_TRUE(store.HasProperty(prop));
+      TestIsPropertyEqual(store, prop, it->second);
+    }
+  }
+}
+
+TEST(PropertyStore, ManyProperties) {
+  const uint64_t kMaxPropertyId = 200;
+  std::vector<uint64_t> ids;
+  for (uint64_t i = 1; i <= kMaxPropertyId; i += 2) {
+    ids.push_back(i);
+  }
+  std::mt19937 gen(42);
+  std::shuffle(ids.begin(), ids.end(), gen);
+
+  storage::PropertyStore props;
+  std::map<storage::PropertyId, storage::PropertyValue> expected;
+  for (size_t i = 0; i < ids.size(); ++i) {
+    auto prop = storage::PropertyId::FromUint(ids[i]);
+    const auto &value = kSampleValues[1 + i % (std::size(kSampleValues) - 1)];
+    ASSERT_TRUE(props.SetProperty(prop, value));
+    expected[prop] = value;
+    TestPropertiesEqual(props, expected, kMaxPropertyId);
+  }
+
+  // Change the values so that the encoded properties grow and shrink.
+  for (size_t i = 0; i < ids.size(); ++i) {
+    auto prop = storage::PropertyId::FromUint(ids[i]);
+    const auto &value = kSampleValues[1 + (i * 7) % (std::size(kSampleValues) - 1)];
+    ASSERT_FALSE(props.SetProperty(prop, value));
+    expected[prop] = value;
+    TestPropertiesEqual(props, expected, kMaxPropertyId);
+  }
+
+  std::shuffle(ids.begin(), ids.end(), gen);
+  for (auto id : ids) {
+    auto prop = storage::PropertyId::FromUint(id);
+    ASSERT_FALSE(props.SetProperty(prop, storage::PropertyValue()));
+    expected.erase(prop);
+    TestPropertiesEqual(props, expected, kMaxPropertyId);
+  }
+  ASSERT_EQ(props.Properties().size(), 0);
+}
+
+TEST(PropertyStore, ManyPropertiesClear) {
+  storage::PropertyStore props;
+  for (uint64_t i = 0; i < 100; ++i) {
+    ASSERT_TRUE(props.SetProperty(storage::PropertyId::FromUint(i), storage::PropertyValue(std::string(i, 'a'))));
+  }
+  ASSERT_EQ(props.Properties().size(), 100);
+  ASSERT_TRUE(props.ClearProperties());
+  ASSERT_EQ(props.Properties().size(), 0);
+  for (uint64_t i = 0; i < 100; ++i) {
+    ASSERT_FALSE(props.HasProperty(storage::PropertyId::FromUint(i)));
+  }
+  ASSERT_TRUE(props.SetProperty(storage::PropertyId::FromUint(42), storage::PropertyValue(42)));
+  ASSERT_THAT(props.Properties(),
+              UnorderedElementsAre(std::pair(storage::PropertyId::FromUint(42), storage::PropertyValue(42))));
+}
+
 TEST(PropertyStore, IntEncoding) {
   std::map<storage::PropertyId, storage::PropertyValue> data{
       {storage::PropertyId::FromUint(0UL), storage::PropertyValue(std::numeric_limits<int64_t>::min())},
@@ -541,6 +617,148 @@ TEST(PropertyStore, IsPropertyEqualString) {
   ASSERT_FALSE(props.IsPropertyEqual(prop, storage::PropertyValue("testt")));
 }
 
+TEST(PropertyStore, InternedString) {
+  auto &dictionary = storage::StringDictionary::Global();
+  auto prop = storage::PropertyId::FromInt(42);
+  auto other_prop = storage::PropertyId::FromInt(43);
+  const std::string value("interned");
+  const auto initial_size = dictionary.Size();
+  // The string is interned only after it was seen once.
+  {
+    storage::PropertyStore props;
+    ASSERT_TRUE(props.SetProperty(prop, storage::PropertyValue(value)));
+    ASSERT_EQ(props.GetProperty(prop), storage::PropertyValue(value));
+  }
+  ASSERT_EQ(dictionary.Size(), initial_size);
+  {
+    storage::PropertyStore props;
+    ASSERT_TRUE(props.SetProperty(prop, storage::PropertyValue(value)));
+    ASSERT_EQ(dictionary.Size(), initial_size + 1);
+    ASSERT_EQ(props.GetProperty(prop), storage::PropertyValue(value));
+    ASSERT_TRUE(props.HasProperty(prop));
+    TestIsPropertyEqual(props, prop, storage::PropertyValue(value));
+    ASSERT_FALSE(props.IsPropertyEqual(prop, storage::PropertyValue("internet")));
+    ASSERT_FALSE(props.IsPropertyEqual(prop, storage::PropertyValue("interne")));
+
+    // The same string is interned only once.
+    storage::PropertyStore other_props;
+    ASSERT_TRUE(other_props.SetProperty(other_prop, storage::PropertyValue(value)));
+    ASSERT_TRUE(props.SetProperty(other_prop, storage::PropertyValue(value)));
+    ASSERT_EQ(dictionary.Size(), initial_size + 1);
+    ASSERT_THAT(props.Properties(), UnorderedElementsAre(std::pair(prop, storage::PropertyValue(value)),
+                                                         std::pair(other_prop, storage::PropertyValue(value))));
+
+    // Overwriting and removing the properties releases the string.
+    ASSERT_FALSE(props.SetProperty(prop, storage::PropertyValue(42)));
+    ASSERT_FALSE(props.SetProperty(other_prop, storage::PropertyValue()));
+    ASSERT_EQ(dictionary.Size(), initial_size + 1);
+    ASSERT_TRUE(other_props.ClearProperties());
+    ASSERT_EQ(dictionary.Size(), initial_size);
+
+    // Destroying the store releases the string.
+    ASSERT_TRUE(props.SetProperty(other_prop, storage::PropertyValue(value)));
+    ASSERT_EQ(dictionary.Size(), initial_size + 1);
+  }
+  ASSERT_EQ(dictionary.Size(), initial_size);
+
+  // Strings that are too short or too long aren't interned.
+  {
+    storage::PropertyStore props;
+    const std::string short_value(storage::StringDictionary::kMinStringSize - 1, 'a');
+    const std::string long_value(storage::StringDictionary::kMaxStringSize + 1, 'a');
+    ASSERT_TRUE(props.SetProperty(prop, storage::PropertyValue(short_value)));
+    ASSERT_TRUE(props.SetProperty(other_prop, storage::PropertyValue(long_value)));
+    ASSERT_EQ(dictionary.Size(), initial_size);
+    ASSERT_EQ(props.GetProperty(prop), storage::PropertyValue(short_value));
+    ASSERT_EQ(props.GetProperty(other_prop), storage::PropertyValue(long_value));
+  }
+}
+
+TEST(PropertyStore, InternedStringEqualById) {
+  auto &dictionary = storage::StringDictionary::Global();
+  auto prop = storage::PropertyId::FromInt(42);
+  // Two-letter codes are interned too.
+  const std::string value("HR");
+  const std::string other_value("DE");
+  for (const auto &item : {value, other_value}) {
+    storage::PropertyStore props;
+    ASSERT_TRUE(props.SetProperty(prop, storage::PropertyValue(item)));
+  }
+  storage::PropertyStore props;
+  ASSERT_TRUE(props.SetProperty(prop, storage::PropertyValue(value)));
+  storage::PropertyStore other_props;
+  ASSERT_TRUE(other_props.SetProperty(prop, storage::PropertyValue(other_value)));
+
+  storage::StringDictionary::Reference reference(&dictionary, value);
+  ASSERT_TRUE(reference.Id());
+  ASSERT_TRUE(props.IsPropertyEqual(prop, storage::PropertyValue(value), reference.Id()));
+  ASSERT_FALSE(other_props.IsPropertyEqual(prop, storage::PropertyValue(value), reference.Id()));
+  ASSERT_FALSE(props.IsPropertyEqual(storage::PropertyId::FromInt(43), storage::PropertyValue(value), reference.Id()));
+
+  // Strings that are stored inline are still compared by their contents.
+  storage::PropertyStore inline_props;
+  ASSERT_TRUE(inline_props.SetProperty(prop, storage::PropertyValue("US")));
+  storage::StringDictionary::Reference inline_reference(&dictionary, "US");
+  ASSERT_FALSE(inline_reference.Id());
+  ASSERT_TRUE(inline_props.IsPropertyEqual(prop, storage::PropertyValue("US"), inline_reference.Id()));
+  ASSERT_FALSE(inline_props.IsPropertyEqual(prop, storage::PropertyValue(value), reference.Id()));
+}
+
+TEST(PropertyStore, InternedStringMoveAssign) {
+  auto &dictionary = storage::StringDictionary::Global();
+  auto prop = storage::PropertyId::FromInt(42);
+  const auto initial_size = dictionary.Size();
+  // Make both strings seen so that they are interned.
+  for (const auto *value : {"first value", "second value"}) {
+    storage::PropertyStore props;
+    ASSERT_TRUE(props.SetProperty(prop, storage::PropertyValue(value)));
+  }
+  storage::PropertyStore props;
+  ASSERT_TRUE(props.SetProperty(prop, storage::PropertyValue("first value")));
+  storage::PropertyStore other_props;
+  ASSERT_TRUE(other_props.SetProperty(prop, storage::PropertyValue("second value")));
+  ASSERT_EQ(dictionary.Size(), initial_size + 2);
+  props = std::move(other_props);
+  ASSERT_EQ(dictionary.Size(), initial_size + 1);
+  ASSERT_EQ(props.GetProperty(prop), storage::PropertyValue("second value"));
+  ASSERT_TRUE(props.ClearProperties());
+  ASSERT_EQ(dictionary.Size(), initial_size);
+}
+
+TEST(PropertyStore, RawCopy) {
+  auto prop = storage::PropertyId::FromInt(42);
+  auto other_prop = storage::PropertyId::FromInt(43);
+  storage::PropertyStore props;
+  ASSERT_TRUE(props.SetProperty(prop, storage::PropertyValue(42)));
+  ASSERT_TRUE(props.SetProperty(other_prop, storage::PropertyValue(true)));
+  {
+    storage::PropertyStore::RawCopy copy(props);
+    ASSERT_TRUE(copy.IsInline());
+    ASSERT_EQ(copy.GetProperty(prop), storage::PropertyValue(42));
+    ASSERT_EQ(copy.GetProperty(other_prop), storage::PropertyValue(true));
+    ASSERT_EQ(copy.GetProperty(storage::PropertyId::FromInt(44)), storage::PropertyValue());
+    ASSERT_THAT(*copy.Properties(), UnorderedElementsAre(std::pair(prop, storage::PropertyValue(42)),
+                                                         std::pair(other_prop, storage::PropertyValue(true))));
+  }
+
+  // Interned strings have to be read from the store.
+  ASSERT_FALSE(props.SetProperty(other_prop, storage::PropertyValue("interned")));
+  {
+    storage::PropertyStore::RawCopy copy(props);
+    ASSERT_TRUE(copy.IsInline());
+    ASSERT_EQ(copy.GetProperty(prop), storage::PropertyValue(42));
+    ASSERT_FALSE(copy.GetProperty(other_prop));
+    ASSERT_FALSE(copy.Properties());
+  }
+
+  // Properties stored in the external buffer can't be read from the copy.
+  ASSERT_FALSE(props.SetProperty(other_prop, storage::PropertyValue(std::string(100, 'a'))));
+  ASSERT_FALSE(storage::PropertyStore::RawCopy(props).IsInline());
+  ASSERT_TRUE(props.ClearProperties());
+  ASSERT_TRUE(storage::PropertyStore::RawCopy(props).IsInline());
+  ASSERT_TRUE(storage::PropertyStore::RawCopy(props).Properties()->empty());
+}
+
 TEST(PropertyStore, IsPropertyEqualList) {
   storage::PropertyStore props;
   auto prop = storage::PropertyId::FromInt(42);
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "storage/v2/storage.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace storage;
+
+class StorageV2ReadOnlyTransaction : public ::testing::Test {
+ protected:
+  Storage storage{Config{.gc = {.type = Config::Gc::Type::NONE}}};
+  PropertyId property{storage.NameToProperty("property")};
+
+  Gid CreateVertex(int64_t value) {
+    auto acc = storage.Access();
+    auto vertex = acc.CreateVertex();
+    EXPECT_FALSE(vertex.SetProperty(property, PropertyValue(value)).HasError());
+    EXPECT_FALSE(acc.Commit().HasError());
+    return vertex.Gid();
+  }
+
+  void SetValue(Gid gid, int64_t value) {
+    auto acc = storage.Access();
+    auto vertex = acc.FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_FALSE(vertex->SetProperty(property, PropertyValue(value)).HasError());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  int64_t GetValue(Storage::Accessor *acc, Gid gid) {
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    EXPECT_TRUE(vertex);
+    auto value = vertex->GetProperty(property, View::OLD);
+    EXPECT_FALSE(value.HasError());
+    return value->ValueInt();
+  }
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2ReadOnlyTransaction, SnapshotIsolation) {
+  const auto gid = CreateVertex(1);
+
+  auto reader = storage.ReadOnlyAccess();
+  EXPECT_TRUE(reader.IsReadOnly());
+  EXPECT_FALSE(storage.Access().IsReadOnly());
+  EXPECT_EQ(GetValue(&reader, gid), 1);
+
+  // Changes committed after the read-only transaction started aren't visible
+  // to it, even after the GC runs.
+  SetValue(gid, 2);
+  SetValue(gid, 3);
+  const auto new_gid = CreateVertex(4);
+  storage.FreeMemory();
+  EXPECT_EQ(GetValue(&reader, gid), 1);
+  EXPECT_FALSE(reader.FindVertex(new_gid, View::OLD));
+  ASSERT_FALSE(reader.Commit().HasError());
+
+  auto new_reader = storage.ReadOnlyAccess();
+  EXPECT_EQ(GetValue(&new_reader, gid), 3);
+  EXPECT_EQ(GetValue(&new_reader, new_gid), 4);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2ReadOnlyTransaction, UncommittedChangesAreInvisible) {
+  const auto gid = CreateVertex(1);
+
+  auto writer = storage.Access();
+  auto vertex = writer.FindVertex(gid, View::OLD);
+  ASSERT_TRUE(vertex);
+  ASSERT_FALSE(vertex->SetProperty(property, PropertyValue(2)).HasError());
+
+  {
+    auto reader = storage.ReadOnlyAccess();
+    EXPECT_EQ(GetValue(&reader, gid), 1);
+  }
+
+  ASSERT_FALSE(writer.Commit().HasError());
+
+  auto reader = storage.ReadOnlyAccess();
+  EXPECT_EQ(GetValue(&reader, gid), 2);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2ReadOnlyTransaction, GcKeepsDeltasOfOldestReader) {
+  const auto gid = CreateVertex(0);
+
+  // Readers that start at the same timestamp share it, and the GC must keep
+  // the deltas until the last one of them finishes.
+  std::vector<Storage::Accessor> readers;
+  readers.push_back(storage.ReadOnlyAccess());
+  readers.push_back(storage.ReadOnlyAccess());
+  SetValue(gid, 1);
+  readers.push_back(storage.ReadOnlyAccess());
+  SetValue(gid, 2);
+
+  readers[0].Abort();
+  storage.FreeMemory();
+  EXPECT_EQ(GetValue(&readers[1], gid), 0);
+  EXPECT_EQ(GetValue(&readers[2], gid), 1);
+
+  ASSERT_FALSE(readers[1].Commit().HasError());
+  storage.FreeMemory();
+  EXPECT_EQ(GetValue(&readers[2], gid), 1);
+
+  readers.clear();
+  storage.FreeMemory();
+  auto reader = storage.ReadOnlyAccess();
+  EXPECT_EQ(GetValue(&reader, gid), 2);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2ReadOnlyTransaction, GcKeepsDeltasOfOverflowReaders) {
+  const auto gid = CreateVertex(0);
+
+  // There are more readers than registration slots, so the last ones are
+  // registered in the overflow map.
+  std::vector<Storage::Accessor> readers;
+  for (int i = 0; i < 300; ++i) {
+    readers.push_back(storage.ReadOnlyAccess());
+  }
+  SetValue(gid, 1);
+  readers.push_back(storage.ReadOnlyAccess());
+  SetValue(gid, 2);
+
+  // Only the overflow readers of the oldest timestamp are left.
+  for (int i = 0; i < 290; ++i) {
+    ASSERT_FALSE(readers[i].Commit().HasError());
+  }
+  storage.FreeMemory();
+  for (int i = 290; i < 300; ++i) {
+    EXPECT_EQ(GetValue(&readers[i], gid), 0);
+  }
+  EXPECT_EQ(GetValue(&readers[300], gid), 1);
+
+  readers.clear();
+  storage.FreeMemory();
+  auto reader = storage.ReadOnlyAccess();
+  EXPECT_EQ(GetValue(&reader, gid), 2);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2ReadOnlyTransaction, RepeatableReadDuringCommit) {
+  // The unique constraint makes the commit validate every vertex after the
+  // commit timestamp is taken, which widens the window before the commit is
+  // published. A reader that starts in that window must see the same vertices
+  // on every read.
+  const auto label = storage.NameToLabel("label");
+  ASSERT_FALSE(storage.CreateUniqueConstraint(label, {property}).HasError());
+
+  const int64_t kBatches = 200;
+  const int64_t kBatchSize = 100;
+  std::atomic<bool> done{false};
+  std::thread writer([&] {
+    for (int64_t i = 0; i < kBatches; ++i) {
+      auto acc = storage.Access();
+      for (int64_t j = 0; j < kBatchSize; ++j) {
+        auto vertex = acc.CreateVertex();
+        ASSERT_FALSE(vertex.AddLabel(label).HasError());
+        ASSERT_FALSE(vertex.SetProperty(property, PropertyValue(i * kBatchSize + j)).HasError());
+      }
+      ASSERT_FALSE(acc.Commit().HasError());
+    }
+    done = true;
+  });
+
+  auto count = [](Storage::Accessor *acc) {
+    int64_t count = 0;
+    for ([[maybe_unused]] auto vertex : acc->Vertices(View::OLD)) ++count;
+    return count;
+  };
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&] {
+      while (!done) {
+        auto reader = storage.ReadOnlyAccess();
+        const auto first = count(&reader);
+        EXPECT_EQ(first % kBatchSize, 0);
+        EXPECT_EQ(count(&reader), first);
+        ASSERT_FALSE(reader.Commit().HasError());
+      }
+    });
+  }
+
+  writer.join();
+  for (auto &reader : readers) reader.join();
+  auto reader = storage.ReadOnlyAccess();
+  EXPECT_EQ(count(&reader), kBatches * kBatchSize);
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include "storage/v2/storage.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace storage;
+
+class StorageV2StorageMode : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_FALSE(storage.SetStorageMode(StorageMode::IN_MEMORY_ANALYTICAL).HasError());
+    ASSERT_EQ(storage.GetStorageMode(), StorageMode::IN_MEMORY_ANALYTICAL);
+  }
+
+  Storage storage{Config{.gc = {.type = Config::Gc::Type::NONE}}};
+  PropertyId property{storage.NameToProperty("property")};
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2StorageMode, ChangesAreVisibleBeforeCommit) {
+  auto writer = storage.Access();
+  auto vertex = writer.CreateVertex();
+  ASSERT_FALSE(vertex.SetProperty(property, PropertyValue(1)).HasError());
+
+  // The changes are written directly to the objects so other transactions
+  // see them immediately.
+  auto reader = storage.Access();
+  auto found = reader.FindVertex(vertex.Gid(), View::OLD);
+  ASSERT_TRUE(found);
+  EXPECT_EQ(found->GetProperty(property, View::OLD)->ValueInt(), 1);
+  ASSERT_FALSE(reader.Commit().HasError());
+
+  // Without deltas there is nothing to roll back.
+  writer.Abort();
+  auto acc = storage.Access();
+  EXPECT_TRUE(acc.FindVertex(vertex.Gid(), View::OLD));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2StorageMode, DeletedObjectsAreCollected) {
+  Gid gid;
+  {
+    auto acc = storage.Access();
+    auto from = acc.CreateVertex();
+    auto to = acc.CreateVertex();
+    ASSERT_FALSE(acc.CreateEdge(&from, &to, acc.NameToEdgeType("edge")).HasError());
+    gid = from.Gid();
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  EXPECT_EQ(storage.GetInfo().vertex_count, 2);
+  EXPECT_EQ(storage.GetInfo().edge_count, 1);
+
+  {
+    auto acc = storage.Access();
+    auto vertex = acc.FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_FALSE(acc.DetachDeleteVertex(&*vertex).HasError());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  storage.FreeMemory();
+  EXPECT_EQ(storage.GetInfo().vertex_count, 1);
+  EXPECT_EQ(storage.GetInfo().edge_count, 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2StorageMode, DeleteObjectsWithDeltasFromTransactionalMode) {
+  // The deltas of the transactions committed before the switch are still
+  // linked, and the GC finds the deleted objects through them.
+  ASSERT_FALSE(storage.SetStorageMode(StorageMode::IN_MEMORY_TRANSACTIONAL).HasError());
+  Gid gid;
+  {
+    auto acc = storage.Access();
+    auto from = acc.CreateVertex();
+    auto to = acc.CreateVertex();
+    ASSERT_FALSE(acc.CreateEdge(&from, &to, acc.NameToEdgeType("edge")).HasError());
+    acc.CreateVertex();
+    gid = from.Gid();
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  ASSERT_FALSE(storage.SetStorageMode(StorageMode::IN_MEMORY_ANALYTICAL).HasError());
+
+  {
+    auto acc = storage.Access();
+    auto vertex = acc.FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_FALSE(acc.DetachDeleteVertex(&*vertex).HasError());
+    for (auto other : acc.Vertices(View::OLD)) {
+      if (other.Gid() != gid) {
+        ASSERT_FALSE(acc.DeleteVertex(&other).HasError());
+      }
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  storage.FreeMemory();
+  EXPECT_EQ(storage.GetInfo().vertex_count, 0);
+  EXPECT_EQ(storage.GetInfo().edge_count, 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2StorageMode, SwitchBackRestoresIsolation) {
+  Gid gid;
+  {
+    auto acc = storage.Access();
+    gid = acc.CreateVertex().Gid();
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  ASSERT_FALSE(storage.SetStorageMode(StorageMode::IN_MEMORY_TRANSACTIONAL).HasError());
+
+  auto writer = storage.Access();
+  auto vertex = writer.FindVertex(gid, View::OLD);
+  ASSERT_TRUE(vertex);
+  ASSERT_FALSE(vertex->SetProperty(property, PropertyValue(1)).HasError());
+
+  auto reader = storage.Access();
+  auto found = reader.FindVertex(gid, View::OLD);
+  ASSERT_TRUE(found);
+  EXPECT_TRUE(found->GetProperty(property, View::OLD)->IsNull());
+  ASSERT_FALSE(reader.Commit().HasError());
+
+  writer.Abort();
+  auto acc = storage.Access();
+  EXPECT_TRUE(acc.FindVertex(gid, View::OLD)->GetProperty(property, View::OLD)->IsNull());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(StorageV2StorageMode, ConstraintsPreventSwitch) {
+  ASSERT_FALSE(storage.SetStorageMode(StorageMode::IN_MEMORY_TRANSACTIONAL).HasError());
+  ASSERT_FALSE(storage.CreateExistenceConstraint(storage.NameToLabel("label"), property).HasError());
+
+  auto result = storage.SetStorageMode(StorageMode::IN_MEMORY_ANALYTICAL);
+  ASSERT_TRUE(result.HasError());
+  EXPECT_EQ(result.GetError(), Storage::SetStorageModeError::ConstraintsExist);
+  EXPECT_EQ(storage.GetStorageMode(), StorageMode::IN_MEMORY_TRANSACTIONAL);
+
+  ASSERT_TRUE(storage.DropExistenceConstraint(storage.NameToLabel("label"), property));
+  EXPECT_FALSE(storage.SetStorageMode(StorageMode::IN_MEMORY_ANALYTICAL).HasError());
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storage/v2/string_dictionary.hpp"
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StringDictionary, Basic) {
+  storage::StringDictionary dictionary;
+  ASSERT_EQ(dictionary.Size(), 0);
+
+  // The strings are interned when they are seen for the second time.
+  ASSERT_FALSE(dictionary.Acquire("first"));
+  auto first = dictionary.Acquire("first");
+  ASSERT_TRUE(first);
+  ASSERT_FALSE(dictionary.Acquire("second"));
+  auto second = dictionary.Acquire("second");
+  ASSERT_TRUE(second);
+  ASSERT_NE(*first, *second);
+  ASSERT_EQ(dictionary.Acquire("first"), first);
+  ASSERT_EQ(dictionary.Size(), 2);
+
+  ASSERT_EQ(dictionary.Get(*first), "first");
+  ASSERT_EQ(dictionary.Get(*second), "second");
+
+  // The string is removed only after all references are released.
+  dictionary.Release(*first);
+  ASSERT_EQ(dictionary.Size(), 2);
+  ASSERT_EQ(dictionary.Get(*first), "first");
+  dictionary.Release(*first);
+  ASSERT_EQ(dictionary.Size(), 1);
+
+  // A removed string is still remembered as seen, so it is interned again
+  // immediately.
+  auto again = dictionary.Acquire("first");
+  ASSERT_TRUE(again);
+  ASSERT_EQ(dictionary.Get(*again), "first");
+  ASSERT_EQ(dictionary.Get(*second), "second");
+  ASSERT_EQ(dictionary.Size(), 2);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StringDictionary, Reference) {
+  storage::StringDictionary dictionary;
+
+  // Strings that aren't interned aren't interned by the reference either.
+  {
+    storage::StringDictionary::Reference reference(&dictionary, "value");
+    ASSERT_FALSE(reference.Id());
+  }
+  ASSERT_EQ(dictionary.Size(), 0);
+  ASSERT_FALSE(dictionary.AcquireIfInterned("value"));
+  ASSERT_EQ(dictionary.Size(), 0);
+
+  ASSERT_FALSE(dictionary.Acquire("value"));
+  auto id = dictionary.Acquire("value");
+  ASSERT_TRUE(id);
+  {
+    storage::StringDictionary::Reference reference(&dictionary, "value");
+    ASSERT_EQ(reference.Id(), id);
+
+    // The string keeps its ID while it is referenced.
+    dictionary.Release(*id);
+    ASSERT_EQ(dictionary.Size(), 1);
+    ASSERT_EQ(dictionary.Get(*id), "value");
+
+    storage::StringDictionary::Reference moved(std::move(reference));
+    ASSERT_EQ(moved.Id(), id);
+    storage::StringDictionary::Reference assigned;
+    assigned = std::move(moved);
+    ASSERT_EQ(assigned.Id(), id);
+    ASSERT_EQ(dictionary.Size(), 1);
+  }
+  ASSERT_EQ(dictionary.Size(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StringDictionary, StringSize) {
+  storage::StringDictionary dictionary;
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_FALSE(dictionary.Acquire(std::string(storage::StringDictionary::kMinStringSize - 1, 'a')));
+    ASSERT_FALSE(dictionary.Acquire(std::string(storage::StringDictionary::kMaxStringSize + 1, 'a')));
+    dictionary.Acquire(std::string(storage::StringDictionary::kMinStringSize, 'a'));
+    dictionary.Acquire(std::string(storage::StringDictionary::kMaxStringSize, 'a'));
+  }
+  ASSERT_EQ(dictionary.Size(), 2);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StringDictionary, UniqueStringsAreNotInterned) {
+  storage::StringDictionary dictionary;
+  for (uint64_t i = 0; i < 2 * storage::StringDictionary::kCapacity; ++i) {
+    ASSERT_FALSE(dictionary.Acquire("unique" + std::to_string(i)));
+  }
+  ASSERT_EQ(dictionary.Size(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StringDictionary, Capacity) {
+  storage::StringDictionary dictionary;
+  std::vector<std::pair<uint64_t, std::string>> interned;
+  for (uint64_t i = 0; dictionary.Size() < storage::StringDictionary::kCapacity; ++i) {
+    auto value = "value" + std::to_string(i);
+    dictionary.Acquire(value);
+    auto id = dictionary.Acquire(value);
+    if (!id) continue;
+    ASSERT_LT(*id, storage::StringDictionary::kCapacity);
+    interned.emplace_back(*id, std::move(value));
+  }
+  ASSERT_EQ(interned.size(), storage::StringDictionary::kCapacity);
+  ASSERT_FALSE(dictionary.Acquire("overflow"));
+  ASSERT_FALSE(dictionary.Acquire("overflow"));
+
+  // The ID of a removed string is reused in its shard.
+  const auto &[id, value] = interned[42];
+  ASSERT_EQ(dictionary.Acquire(value), id);
+  dictionary.Release(id);
+  dictionary.Release(id);
+  ASSERT_EQ(dictionary.Size(), storage::StringDictionary::kCapacity - 1);
+  dictionary.Acquire(value);
+  ASSERT_EQ(dictionary.Acquire(value), id);
+  ASSERT_EQ(dictionary.Get(id), value);
+  ASSERT_EQ(dictionary.Get(interned[43].first), interned[43].second);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StringDictionary, Concurrent) {
+  const uint64_t kThreads = 4;
+  const uint64_t kIterations = 10000;
+  storage::StringDictionary dictionary;
+  std::vector<std::thread> threads;
+  for (uint64_t i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&dictionary, i] {
+      for (uint64_t j = 0; j < kIterations; ++j) {
+        auto value = "value" + std::to_string((i + j) % 100);
+        auto id = dictionary.Acquire(value);
+        if (!id) continue;
+        ASSERT_EQ(dictionary.Get(*id), value);
+        dictionary.Release(*id);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(dictionary.Size(), 0);
+}
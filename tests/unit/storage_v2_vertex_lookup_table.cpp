@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "storage/v2/storage.hpp"
+#include "storage/v2/vertex_lookup_table.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace storage;
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VertexLookupTable, InsertFindRemove) {
+  utils::SkipList<Vertex> vertices;
+  VertexLookupTable table;
+  EXPECT_EQ(table.Find(Gid::FromUint(0)), nullptr);
+
+  std::vector<Gid> gids{Gid::FromUint(0), Gid::FromUint(1), Gid::FromUint(VertexLookupTable::kChunkSize + 3)};
+  {
+    auto acc = vertices.access();
+    for (auto gid : gids) {
+      auto [it, inserted] = acc.insert(Vertex{gid, nullptr});
+      ASSERT_TRUE(inserted);
+      table.Insert(gid, &*it);
+    }
+  }
+  const auto memory_usage = table.MemoryUsage();
+
+  auto acc = vertices.access();
+  for (auto gid : gids) {
+    auto *vertex = table.Find(gid);
+    ASSERT_NE(vertex, nullptr);
+    EXPECT_EQ(vertex->gid, gid);
+  }
+  EXPECT_EQ(table.Find(Gid::FromUint(2)), nullptr);
+  EXPECT_EQ(table.Find(Gid::FromUint(2 * VertexLookupTable::kChunkSize)), nullptr);
+
+  // Gids that don't fit into the table aren't stored.
+  const auto large_gid = Gid::FromUint(VertexLookupTable::kMaxChunks * VertexLookupTable::kChunkSize);
+  EXPECT_FALSE(VertexLookupTable::Covers(large_gid));
+  table.Insert(large_gid, &*acc.begin());
+  EXPECT_EQ(table.Find(large_gid), nullptr);
+
+  table.Remove(gids[1]);
+  EXPECT_EQ(table.Find(gids[1]), nullptr);
+  EXPECT_NE(table.Find(gids[0]), nullptr);
+  table.Remove(Gid::FromUint(3 * VertexLookupTable::kChunkSize));
+  EXPECT_EQ(table.MemoryUsage(), memory_usage);
+
+  table.Rebuild(&acc);
+  for (auto gid : gids) {
+    EXPECT_EQ(table.Find(gid), &*acc.find(gid));
+  }
+
+  table.Clear();
+  EXPECT_EQ(table.Find(gids[0]), nullptr);
+  EXPECT_LT(table.MemoryUsage(), memory_usage);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VertexLookupTable, StorageFindVertex) {
+  Storage storage(Config{.gc = {.type = Config::Gc::Type::NONE}, .items = {.vertex_lookup_table = true}});
+  std::vector<Gid> gids;
+  {
+    auto acc = storage.Access();
+    for (int i = 0; i < 100; ++i) {
+      gids.push_back(acc.CreateVertex().Gid());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    // Vertices of aborted transactions are removed from the table by the GC.
+    auto acc = storage.Access();
+    gids.push_back(acc.CreateVertex().Gid());
+    ASSERT_TRUE(acc.FindVertex(gids.back(), View::NEW));
+    acc.Abort();
+  }
+  {
+    auto acc = storage.Access();
+    for (size_t i = 0; i < 100; i += 2) {
+      auto vertex = acc.FindVertex(gids[i], View::OLD);
+      ASSERT_TRUE(vertex);
+      EXPECT_EQ(vertex->Gid(), gids[i]);
+      ASSERT_FALSE(acc.DeleteVertex(&*vertex).HasError());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  storage.FreeMemory();
+
+  auto acc = storage.Access();
+  for (size_t i = 0; i < gids.size(); ++i) {
+    auto vertex = acc.FindVertex(gids[i], View::OLD);
+    if (i % 2 == 1 && i < 100) {
+      ASSERT_TRUE(vertex);
+      EXPECT_EQ(vertex->Gid(), gids[i]);
+    } else {
+      EXPECT_FALSE(vertex);
+    }
+  }
+  EXPECT_FALSE(acc.FindVertex(Gid::FromUint(1000), View::OLD));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VertexLookupTable, Recovery) {
+  const std::filesystem::path storage_directory{std::filesystem::temp_directory_path() /
+                                                "MG_test_unit_storage_v2_vertex_lookup_table"};
+  std::filesystem::remove_all(storage_directory);
+  std::vector<Gid> gids;
+  {
+    Storage storage(Config{.items = {.vertex_lookup_table = true},
+                           .durability = {.storage_directory = storage_directory, .snapshot_on_exit = true}});
+    auto acc = storage.Access();
+    for (int i = 0; i < 10; ++i) {
+      gids.push_back(acc.CreateVertex().Gid());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    Storage storage(Config{.items = {.vertex_lookup_table = true},
+                           .durability = {.storage_directory = storage_directory, .recover_on_startup = true}});
+    auto acc = storage.Access();
+    for (auto gid : gids) {
+      auto vertex = acc.FindVertex(gid, View::OLD);
+      ASSERT_TRUE(vertex);
+      EXPECT_EQ(vertex->Gid(), gid);
+    }
+    // New vertices get the following gids and are found as well.
+    auto vertex = acc.CreateVertex();
+    EXPECT_TRUE(acc.FindVertex(vertex.Gid(), View::NEW));
+  }
+  std::filesystem::remove_all(storage_directory);
+}
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <list>
 #include <string_view>
 
 #include "storage/v2/durability/exceptions.hpp"
@@ -35,6 +36,18 @@ storage::durability::WalDeltaData::Type StorageGlobalOperationToWalDeltaDataType
       return storage::durability::WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE;
     case storage::durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
       return storage::durability::WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP;
+    case storage::durability::StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE:
+      return storage::durability::WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE;
+    case storage::durability::StorageGlobalOperation::EDGE_TYPE_INDEX_DROP:
+      return storage::durability::WalDeltaData::Type::EDGE_TYPE_INDEX_DROP;
+    case storage::durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+      return storage::durability::WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE;
+    case storage::durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+      return storage::durability::WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP;
+    case storage::durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      return storage::durability::WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE;
+    case storage::durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return storage::durability::WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP;
   }
 }
 
@@ -76,7 +89,7 @@ class DeltaGenerator final {
 
     void AddLabel(storage::Vertex *vertex, const std::string &label) {
       auto label_id = storage::LabelId::FromUint(gen_->mapper_.NameToId(label));
-      vertex->labels.push_back(label_id);
+      vertex->labels.Insert(label_id);
       storage::CreateAndLinkDelta(&transaction_, &*vertex, storage::Delta::RemoveLabelTag(), label_id);
       {
         storage::durability::WalDeltaData data;
@@ -89,7 +102,7 @@ class DeltaGenerator final {
 
     void RemoveLabel(storage::Vertex *vertex, const std::string &label) {
       auto label_id = storage::LabelId::FromUint(gen_->mapper_.NameToId(label));
-      vertex->labels.erase(std::find(vertex->labels.begin(), vertex->labels.end(), label_id));
+      vertex->labels.Erase(label_id);
       storage::CreateAndLinkDelta(&transaction_, &*vertex, storage::Delta::AddLabelTag(), label_id);
       {
         storage::durability::WalDeltaData data;
@@ -171,8 +184,8 @@ class DeltaGenerator final {
       : uuid_(utils::GenerateUUID()),
         epoch_id_(utils::GenerateUUID()),
         seq_num_(seq_num),
-        wal_file_(data_directory, uuid_, epoch_id_, {.properties_on_edges = properties_on_edges}, &mapper_, seq_num,
-                  &file_retainer_) {}
+        wal_file_(data_directory, uuid_, epoch_id_, {.properties_on_edges = properties_on_edges},
+                  storage::Config::Durability::Compression::NONE, &mapper_, seq_num, &file_retainer_) {}
 
   Transaction CreateTransaction() { return Transaction(this); }
 
@@ -183,11 +196,11 @@ class DeltaGenerator final {
   }
 
   void AppendOperation(storage::durability::StorageGlobalOperation operation, const std::string &label,
-                       const std::set<std::string> properties = {}) {
+                       const std::vector<std::string> properties = {}) {
     auto label_id = storage::LabelId::FromUint(mapper_.NameToId(label));
-    std::set<storage::PropertyId> property_ids;
+    std::vector<storage::PropertyId> property_ids;
     for (const auto &property : properties) {
-      property_ids.insert(storage::PropertyId::FromUint(mapper_.NameToId(property)));
+      property_ids.push_back(storage::PropertyId::FromUint(mapper_.NameToId(property)));
     }
     wal_file_.AppendOperation(operation, label_id, property_ids, timestamp_);
     if (valid_) {
@@ -208,7 +221,47 @@ class DeltaGenerator final {
         case storage::durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE:
         case storage::durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
           data.operation_label_properties.label = label;
-          data.operation_label_properties.properties = properties;
+          data.operation_label_properties.properties = std::set<std::string>(properties.begin(), properties.end());
+          break;
+        case storage::durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case storage::durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+          data.operation_label_ordered_properties.label = label;
+          data.operation_label_ordered_properties.properties = properties;
+          break;
+        case storage::durability::StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE:
+        case storage::durability::StorageGlobalOperation::EDGE_TYPE_INDEX_DROP:
+        case storage::durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+        case storage::durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+          LOG_FATAL("Use AppendEdgeTypeOperation for edge type operations!");
+      }
+      data_.emplace_back(timestamp_, data);
+    }
+  }
+
+  void AppendEdgeTypeOperation(storage::durability::StorageGlobalOperation operation, const std::string &edge_type,
+                               const std::set<std::string> properties = {}) {
+    auto edge_type_id = storage::EdgeTypeId::FromUint(mapper_.NameToId(edge_type));
+    std::set<storage::PropertyId> property_ids;
+    for (const auto &property : properties) {
+      property_ids.insert(storage::PropertyId::FromUint(mapper_.NameToId(property)));
+    }
+    wal_file_.AppendOperation(operation, edge_type_id, property_ids, timestamp_);
+    if (valid_) {
+      UpdateStats(timestamp_, 1);
+      storage::durability::WalDeltaData data;
+      data.type = StorageGlobalOperationToWalDeltaDataType(operation);
+      switch (operation) {
+        case storage::durability::StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE:
+        case storage::durability::StorageGlobalOperation::EDGE_TYPE_INDEX_DROP:
+          data.operation_edge_type.edge_type = edge_type;
+          break;
+        case storage::durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+        case storage::durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+          data.operation_edge_type_property.edge_type = edge_type;
+          data.operation_edge_type_property.property = *properties.begin();
+          break;
+        default:
+          LOG_FATAL("Use AppendOperation for label operations!");
       }
       data_.emplace_back(timestamp_, data);
     }
@@ -270,6 +323,9 @@ class DeltaGenerator final {
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define OPERATION(op, ...) gen.AppendOperation(storage::durability::StorageGlobalOperation::op, __VA_ARGS__)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define EDGE_TYPE_OPERATION(op, ...) \
+  gen.AppendEdgeTypeOperation(storage::durability::StorageGlobalOperation::op, __VA_ARGS__)
 
 void AssertWalInfoEqual(const storage::durability::WalInfo &a, const storage::durability::WalInfo &b) {
   ASSERT_EQ(a.uuid, b.uuid);
@@ -496,6 +552,12 @@ GENERATE_SIMPLE_TEST(AllGlobalOperations, {
   OPERATION(EXISTENCE_CONSTRAINT_DROP, "hello", {"world"});
   OPERATION(UNIQUE_CONSTRAINT_CREATE, "hello", {"world", "and", "universe"});
   OPERATION(UNIQUE_CONSTRAINT_DROP, "hello", {"world", "and", "universe"});
+  EDGE_TYPE_OPERATION(EDGE_TYPE_INDEX_CREATE, "hello");
+  EDGE_TYPE_OPERATION(EDGE_TYPE_INDEX_DROP, "hello");
+  EDGE_TYPE_OPERATION(EDGE_TYPE_PROPERTY_INDEX_CREATE, "hello", {"world"});
+  EDGE_TYPE_OPERATION(EDGE_TYPE_PROPERTY_INDEX_DROP, "hello", {"world"});
+  OPERATION(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE, "hello", {"world", "and", "universe"});
+  OPERATION(LABEL_PROPERTY_COMPOSITE_INDEX_DROP, "hello", {"world", "and", "universe"});
 });
 
 // NOLINTNEXTLINE(hicpp-special-member-functions)
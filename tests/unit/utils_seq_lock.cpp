@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utils/seq_lock.hpp"
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(SeqLock, OptimisticReadFailsWhileLocked) {
+  utils::SeqLock lock;
+  int reads = 0;
+  ASSERT_TRUE(lock.TryOptimisticRead([&] {
+    ++reads;
+    return true;
+  }));
+  ASSERT_EQ(reads, 1);
+
+  {
+    std::lock_guard<utils::SeqLock> guard(lock);
+    ASSERT_FALSE(lock.try_lock());
+    ASSERT_FALSE(lock.TryOptimisticRead([&] {
+      ++reads;
+      return true;
+    }));
+    ASSERT_EQ(reads, 1);
+  }
+
+  // The reader can refuse to read the data optimistically.
+  ASSERT_FALSE(lock.TryOptimisticRead([&] {
+    ++reads;
+    return false;
+  }));
+  ASSERT_EQ(reads, 2);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(SeqLock, OptimisticReadRetriesAfterWrite) {
+  utils::SeqLock lock;
+  int reads = 0;
+  ASSERT_TRUE(lock.TryOptimisticRead([&] {
+    // A write that happens during the first read invalidates it.
+    if (reads++ == 0) {
+      std::lock_guard<utils::SeqLock> guard(lock);
+    }
+    return true;
+  }));
+  ASSERT_EQ(reads, 2);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(SeqLock, ConsistentReads) {
+  const int kWrites = 100000;
+  const int kReaders = 4;
+  utils::SeqLock lock;
+  // The writer keeps both values equal, so the readers must never see them
+  // differ.
+  std::atomic<uint64_t> first{0};
+  std::atomic<uint64_t> second{0};
+  std::atomic<bool> done{false};
+  std::atomic<uint64_t> inconsistent{0};
+
+  std::vector<std::thread> readers;
+  for (int i = 0; i < kReaders; ++i) {
+    readers.emplace_back([&] {
+      while (!done.load()) {
+        uint64_t first_copy = 0;
+        uint64_t second_copy = 0;
+        auto read = [&] {
+          first_copy = first.load(std::memory_order_relaxed);
+          second_copy = second.load(std::memory_order_relaxed);
+          return true;
+        };
+        if (!lock.TryOptimisticRead(read)) {
+          std::lock_guard<utils::SeqLock> guard(lock);
+          read();
+        }
+        if (first_copy != second_copy) ++inconsistent;
+      }
+    });
+  }
+  for (int i = 1; i <= kWrites; ++i) {
+    std::lock_guard<utils::SeqLock> guard(lock);
+    first.store(i, std::memory_order_relaxed);
+    second.store(i, std::memory_order_relaxed);
+  }
+  done.store(true);
+  for (auto &reader : readers) reader.join();
+  ASSERT_EQ(inconsistent.load(), 0);
+}